@@ -29,6 +29,7 @@ tests=( \
        test-cpu-openmpi-py2_7-tfhead-kerashead-torchhead-mxnethead-pyspark2_4_0 \
        test-cpu-openmpi-py3_6-tfhead-kerashead-torchhead-mxnethead-pyspark2_4_0 \
        test-cpu-mpich-py3_6-tf1_14_0-keras2_3_1-torch1_3_0-mxnet1_5_0-pyspark2_4_0 \
+       test-cpu-mpich4-py3_6-tf1_14_0-keras2_3_1-torch1_3_0-mxnet1_5_0-pyspark2_4_0 \
        test-cpu-mlsl-py3_6-tf1_14_0-keras2_3_1-torch1_3_0-mxnet1_5_0-pyspark2_4_0 \
        test-gpu-openmpi-py3_6-tf1_15_0-keras2_3_1-torch1_3_0-mxnet1_4_1-pyspark2_4_0 \
        test-gpu-gloo-py3_6-tf1_15_0-keras2_3_1-torch1_3_0-mxnet1_4_1-pyspark2_4_0 \
@@ -98,6 +99,24 @@ run_test() {
   echo "    queue: ${queue}"
 }
 
+run_allreduce_algorithm_tests() {
+  local test=$1
+  local queue=$2
+  local label=$3
+  local setting=$4
+
+  local test_files="test_torch_allreduce_algorithms.py test_tensorflow_allreduce_algorithms.py"
+  local command="(echo ${test_files} | xargs -n 1 env ${setting} \\\$(cat /mpirun_command) pytest -v --capture=no)"
+  if [[ ${test} == *"openmpi"* ]]; then
+    # Also on an odd number of ranks, which is not a power of two.
+    command="${command} && (echo ${test_files} | xargs -n 1 env ${setting} mpirun -allow-run-as-root -np 3 -H localhost:3 -bind-to none -map-by slot -mca mpi_abort_print_stack 1 pytest -v --capture=no)"
+  fi
+
+  run_test "${test}" "${queue}" \
+    ":pytest: Run CPU Allreduce Algorithm PyTests ${label} (${test})" \
+    "bash -c \"cd /horovod/test && ${command}\""
+}
+
 run_all() {
   local test=$1
   local queue=$2
@@ -116,6 +135,26 @@ run_all() {
     ":pytest: Run PyTests (${test})" \
     "bash -c \"cd /horovod/test && (echo test_*.py ${exclude_keras_if_needed} ${exclude_interactiverun} | xargs -n 1 \\\$(cat /mpirun_command) pytest -v --capture=no)\""
 
+  # Run the CPU allreduce algorithm tests with every built-in algorithm
+  # forced, with algorithms selected by size, and with a table that is ignored
+  # because MPI does not implement bcube.
+  if [[ ${test} != *"mlsl"* ]]; then
+    for algorithm in ring recursive_doubling rabenseifner tree; do
+      run_allreduce_algorithm_tests "${test}" "${queue}" "${algorithm}" \
+        "HOROVOD_CPU_ALLREDUCE_ALGORITHM=${algorithm}"
+    done
+    run_allreduce_algorithm_tests "${test}" "${queue}" "table" \
+      "HOROVOD_CPU_ALLREDUCE_TABLE='16:*:recursive_doubling,4096:*:tree,*:*:rabenseifner'"
+    run_allreduce_algorithm_tests "${test}" "${queue}" "ignored table" \
+      "HOROVOD_CPU_ALLREDUCE_TABLE='64:*:bcube,*:*:ring'"
+
+    # Run the collective tests again with non-blocking MPI collectives, which
+    # need MPI_THREAD_MULTIPLE.
+    run_test "${test}" "${pytest_queue}" \
+      ":pytest: Run PyTests with HOROVOD_MPI_ASYNC_OPS (${test})" \
+      "bash -c \"cd /horovod/test && (echo test_torch.py test_tensorflow.py test_mxnet.py test_torch_mpi_async.py test_torch_persistent_collectives.py | xargs -n 1 env HOROVOD_MPI_ASYNC_OPS=4 \\\$(cat /mpirun_command) pytest -v --capture=no)\""
+  fi
+
   # Run test_interactiverun.py
   if [[ ${test} != *"mpich"* ]]; then
     # TODO: support mpich
@@ -196,6 +235,23 @@ run_gloo() {
     ":pytest: Run PyTests (${test})" \
     "bash -c \"cd /horovod/test && (echo test_*.py ${exclude_spark_if_needed} ${exclude_interactiverun} | xargs -n 1 horovodrun -np 2 -H localhost:2 --gloo pytest -v --capture=no)\""
 
+  run_test "${test}" "${pytest_queue}" \
+    ":pytest: Run PyTests Striped (${test})" \
+    "bash -c \"cd /horovod/test && HOROVOD_GLOO_IFACE=lo HOROVOD_GLOO_NUM_STRIPES=3 horovodrun -np 2 -H localhost:2 --gloo pytest -v --capture=no test_torch.py -k allreduce\""
+
+  # Partial meshes only leave peers unconnected on more than a few ranks.
+  run_test "${test}" "${queue}" \
+    ":pytest: Run PyTests Gloo Partial Mesh (${test})" \
+    "bash -c \"cd /horovod/test && horovodrun -np 5 -H localhost:5 --gloo pytest -v --capture=no test_torch_gloo_partial_mesh.py && horovodrun -np 8 -H localhost:8 --gloo pytest -v --capture=no test_torch_gloo_partial_mesh.py\""
+
+  # Gloo's algorithm classes are opt-in and only bound for recurring fused
+  # responses, so run the allreduce tests with each of them forced.
+  for algorithm in ring halving_doubling bcube; do
+    run_test "${test}" "${pytest_queue}" \
+      ":pytest: Run PyTests Gloo ${algorithm} (${test})" \
+      "bash -c \"cd /horovod/test && (echo test_torch_allreduce_algorithms.py test_torch_persistent_collectives.py | xargs -n 1 env HOROVOD_CPU_ALLREDUCE_ALGORITHM=${algorithm} horovodrun -np 2 -H localhost:2 --gloo pytest -v --capture=no)\""
+  done
+
   run_test "${test}" "${queue}" \
     ":muscle: Test Keras MNIST (${test})" \
     "horovodrun -np 2 -H localhost:2 --gloo python /horovod/examples/keras_mnist_advanced.py"
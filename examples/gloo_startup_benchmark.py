@@ -0,0 +1,25 @@
+from __future__ import print_function
+
+import os
+import timeit
+
+import torch
+import horovod.torch as hvd
+
+# Measures how long hvd.init() takes and how many file descriptors every
+# process holds afterwards, e.g. with and without HOROVOD_GLOO_PARTIAL_MESH=1.
+fds_before = len(os.listdir('/proc/self/fd'))
+init_time = timeit.timeit(hvd.init, number=1)
+fds_after = len(os.listdir('/proc/self/fd'))
+
+stats = hvd.allgather(torch.tensor([[init_time, fds_after - fds_before]],
+                                   dtype=torch.float64), name='startup_stats')
+
+if hvd.rank() == 0:
+    print('Number of processes: %d' % hvd.size())
+    print('%24s %12s %12s %12s' % ('', 'Min', 'Mean', 'Max'))
+    for name, column in [('Init time (s)', stats[:, 0]),
+                         ('File descriptors', stats[:, 1])]:
+        print('%24s %12.3f %12.3f %12.3f' % (name, column.min().item(),
+                                             column.mean().item(),
+                                             column.max().item()))
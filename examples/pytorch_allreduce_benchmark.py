@@ -0,0 +1,55 @@
+from __future__ import print_function
+
+import argparse
+import torch
+import horovod.torch as hvd
+import timeit
+import numpy as np
+
+# Benchmark settings
+parser = argparse.ArgumentParser(description='PyTorch Allreduce Benchmark',
+                                 formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+parser.add_argument('--min-size', type=int, default=1024,
+                    help='smallest tensor size in bytes')
+parser.add_argument('--max-size', type=int, default=64 * 1024 * 1024,
+                    help='largest tensor size in bytes, sizes double from --min-size')
+
+parser.add_argument('--num-warmup-iters', type=int, default=2,
+                    help='number of warm-up iterations that don\'t count towards benchmark')
+parser.add_argument('--num-iters', type=int, default=10,
+                    help='number of benchmark iterations per size')
+
+args = parser.parse_args()
+
+# The allreduce algorithm is chosen through HOROVOD_CPU_ALLREDUCE_ALGORITHM, e.g.
+# ring, halving_doubling or bcube with Gloo, and from the message size otherwise.
+hvd.init()
+
+
+def log(s, nl=True):
+    if hvd.rank() != 0:
+        return
+    print(s, end='\n' if nl else '')
+
+
+log('Number of CPUs: %d' % hvd.size())
+log('%12s %12s %12s %12s' % ('Bytes', 'Time (ms)', '+-', 'Bus GB/s'))
+
+size = args.min_size
+while size <= args.max_size:
+    tensor = torch.randn(size // 4)
+
+    def benchmark_step():
+        hvd.allreduce(tensor, name='tensor.%d' % size)
+
+    timeit.timeit(benchmark_step, number=args.num_warmup_iters)
+    times = [timeit.timeit(benchmark_step, number=1) for _ in range(args.num_iters)]
+
+    # Bus bandwidth counts the 2 * (n - 1) / n of the buffer that every rank
+    # sends in a bandwidth optimal allreduce, so it is comparable across sizes.
+    time_mean = np.mean(times)
+    time_conf = 1.96 * np.std(times)
+    bus_bytes = 2.0 * (hvd.size() - 1) / hvd.size() * size
+    log('%12d %12.3f %12.3f %12.3f' % (size, time_mean * 1000, time_conf * 1000,
+                                       bus_bytes / time_mean / 1e9))
+    size *= 2
@@ -0,0 +1,74 @@
+from __future__ import print_function
+
+import argparse
+import torch
+import horovod.torch as hvd
+import timeit
+import numpy as np
+
+# Benchmark settings
+parser = argparse.ArgumentParser(description='PyTorch Broadcast Benchmark',
+                                 formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+parser.add_argument('--num-tensors', type=int, default=5000,
+                    help='number of tensors to broadcast')
+parser.add_argument('--tensor-size', type=int, default=64,
+                    help='number of float32 elements per tensor')
+
+parser.add_argument('--num-warmup-iters', type=int, default=2,
+                    help='number of warm-up iterations that don\'t count towards benchmark')
+parser.add_argument('--num-iters', type=int, default=10,
+                    help='number of benchmark iterations')
+
+parser.add_argument('--no-cuda', action='store_true', default=False,
+                    help='disables CUDA tensors')
+
+args = parser.parse_args()
+args.cuda = not args.no_cuda and torch.cuda.is_available()
+
+hvd.init()
+
+if args.cuda:
+    # Horovod: pin GPU to local rank.
+    torch.cuda.set_device(hvd.local_rank())
+
+# Set up many small tensors, similar to the state dict of a large model.
+params = {}
+for i in range(args.num_tensors):
+    tensor = torch.randn(args.tensor_size)
+    if args.cuda:
+        tensor = tensor.cuda()
+    params['param.%d' % i] = tensor
+
+
+def benchmark_step():
+    hvd.broadcast_parameters(params, root_rank=0)
+
+
+def log(s, nl=True):
+    if hvd.rank() != 0:
+        return
+    print(s, end='\n' if nl else '')
+
+
+log('Number of tensors: %d' % args.num_tensors)
+log('Tensor size: %d' % args.tensor_size)
+device = 'GPU' if args.cuda else 'CPU'
+log('Number of %ss: %d' % (device, hvd.size()))
+
+# Warm-up
+log('Running warmup...')
+timeit.timeit(benchmark_step, number=args.num_warmup_iters)
+
+# Benchmark
+log('Running benchmark...')
+times = []
+for x in range(args.num_iters):
+    time = timeit.timeit(benchmark_step, number=1)
+    log('Iter #%d: %.1f ms to broadcast %d tensors' % (x, time * 1000, args.num_tensors))
+    times.append(time)
+
+# Results
+time_mean = np.mean(times) * 1000
+time_conf = 1.96 * np.std(times) * 1000
+log('Broadcast time: %.1f +-%.1f ms' % (time_mean, time_conf))
+log('Tensors/sec: %.1f' % (args.num_tensors * 1000 / time_mean))
@@ -29,6 +29,9 @@ class HorovodBasics(object):
         self.Average = self.MPI_LIB_CTYPES.horovod_reduce_op_average()
         self.Sum = self.MPI_LIB_CTYPES.horovod_reduce_op_sum()
         self.Adasum = self.MPI_LIB_CTYPES.horovod_reduce_op_adasum()
+        self.Min = self.MPI_LIB_CTYPES.horovod_reduce_op_min()
+        self.Max = self.MPI_LIB_CTYPES.horovod_reduce_op_max()
+        self.Product = self.MPI_LIB_CTYPES.horovod_reduce_op_product()
 
     def init(self, comm=None):
         """A function that initializes Horovod.
@@ -68,6 +71,60 @@ class HorovodBasics(object):
         """A function that shuts Horovod down."""
         self.MPI_LIB_CTYPES.horovod_shutdown()
 
+    def add_process_set(self, ranks):
+        """A function that registers a process set, a subset of the Horovod ranks
+        that runs collectives among themselves.
+
+        Process sets must be registered on all ranks in the same order before
+        `init()` is called. Collectives on a process set only support CPU tensors.
+
+        Args:
+          ranks: List of the Horovod ranks that are members of the process set.
+
+        Returns:
+          An integer scalar with the ID of the process set, which is passed as
+          `process_set` to collectives.
+        """
+        ranks = list(ranks)
+        process_set_id = self.MPI_LIB_CTYPES.horovod_add_process_set(
+            (ctypes.c_int * len(ranks))(*ranks), ctypes.c_int(len(ranks)))
+        if process_set_id == -1:
+            raise ValueError(
+                'Process sets must be added before Horovod is initialized.')
+        return process_set_id
+
+    def process_set_rank(self, process_set):
+        """A function that returns the rank of the calling process within a process set.
+
+        Args:
+          process_set: ID of the process set, as returned by `add_process_set()`.
+
+        Returns:
+          An integer scalar with the rank of the calling process within the process set.
+        """
+        rank = self.MPI_LIB_CTYPES.horovod_process_set_rank(ctypes.c_int(process_set))
+        if rank == -1:
+            raise ValueError(
+                'Horovod has not been initialized or this process is not a member of '
+                'process set {}.'.format(process_set))
+        return rank
+
+    def process_set_size(self, process_set):
+        """A function that returns the number of processes in a process set.
+
+        Args:
+          process_set: ID of the process set, as returned by `add_process_set()`.
+
+        Returns:
+          An integer scalar containing the number of processes in the process set.
+        """
+        size = self.MPI_LIB_CTYPES.horovod_process_set_size(ctypes.c_int(process_set))
+        if size == -1:
+            raise ValueError(
+                'Horovod has not been initialized or process set {} does not '
+                'exist.'.format(process_set))
+        return size
+
     def size(self):
         """A function that returns the number of Horovod processes.
 
@@ -17,10 +17,51 @@
 
 #include <sstream>
 #include <cassert>
+#include <strings.h>
 
 namespace horovod {
 namespace common {
 
+std::string AllreduceAlgorithmName(AllreduceAlgorithm algorithm) {
+  switch (algorithm) {
+  case AllreduceAlgorithm::AUTO:
+    return "auto";
+  case AllreduceAlgorithm::LIBRARY:
+    return "library";
+  case AllreduceAlgorithm::RING:
+    return "ring";
+  case AllreduceAlgorithm::RECURSIVE_DOUBLING:
+    return "recursive_doubling";
+  case AllreduceAlgorithm::RABENSEIFNER:
+    return "rabenseifner";
+  case AllreduceAlgorithm::TWO_LEVEL_TREE:
+    return "tree";
+  case AllreduceAlgorithm::BCUBE:
+    return "bcube";
+  default:
+    return "<unknown>";
+  }
+}
+
+bool ParseAllreduceAlgorithm(const std::string& name,
+                             AllreduceAlgorithm& algorithm) {
+  for (auto candidate :
+       {AllreduceAlgorithm::AUTO, AllreduceAlgorithm::LIBRARY,
+        AllreduceAlgorithm::RING, AllreduceAlgorithm::RECURSIVE_DOUBLING,
+        AllreduceAlgorithm::RABENSEIFNER, AllreduceAlgorithm::TWO_LEVEL_TREE,
+        AllreduceAlgorithm::BCUBE}) {
+    if (strcasecmp(name.c_str(), AllreduceAlgorithmName(candidate).c_str()) == 0) {
+      algorithm = candidate;
+      return true;
+    }
+  }
+  if (strcasecmp(name.c_str(), "halving_doubling") == 0) {
+    algorithm = AllreduceAlgorithm::RABENSEIFNER;
+    return true;
+  }
+  return false;
+}
+
 Status::Status() = default;
 
 Status::Status(StatusType type, std::string reason) {
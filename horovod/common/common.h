@@ -45,6 +45,12 @@ namespace common {
 #define NCCL_ALLREDUCE "NCCL_ALLREDUCE"
 #define MEMCPY_OUT_FUSION_BUFFER "MEMCPY_OUT_FUSION_BUFFER"
 #define MPI_BCAST "MPI_BCAST"
+#define MPI_REDUCESCATTER "MPI_REDUCESCATTER"
+#define MPI_ALLTOALL "MPI_ALLTOALL"
+#define MPI_SPARSE_ALLREDUCE "MPI_SPARSE_ALLREDUCE"
+#define MPI_REDUCE "MPI_REDUCE"
+#define MPI_GATHER "MPI_GATHER"
+#define MPI_SCATTER "MPI_SCATTER"
 #define NCCL_REDUCESCATTER "NCCL_REDUCESCATTER"
 #define NCCL_ALLGATHER "NCCL_ALLGATHER"
 #define NCCL_REDUCE "NCCL_REDUCE"
@@ -56,7 +62,14 @@ namespace common {
 #define MLSL_BCAST "MLSL_BCAST"
 #define GLOO_ALLREDUCE "GLOO_ALLREDUCE"
 #define GLOO_ALLGATHER "GLOO_ALLGATHER"
+#define GLOO_CROSS_ALLGATHER "GLOO_CROSS_ALLGATHER"
 #define GLOO_BCAST "GLOO_BCAST"
+#define GLOO_REDUCESCATTER "GLOO_REDUCESCATTER"
+#define GLOO_ALLTOALL "GLOO_ALLTOALL"
+#define GLOO_SPARSE_ALLREDUCE "GLOO_SPARSE_ALLREDUCE"
+#define GLOO_REDUCE "GLOO_REDUCE"
+#define GLOO_GATHER "GLOO_GATHER"
+#define GLOO_SCATTER "GLOO_SCATTER"
 
 // Horovod knobs.
 #define HOROVOD_MPI_THREADS_DISABLE "HOROVOD_MPI_THREADS_DISABLE"
@@ -81,10 +94,18 @@ namespace common {
 #define HOROVOD_CPU_OPERATIONS "HOROVOD_CPU_OPERATIONS"
 #define HOROVOD_CONTROLLER "HOROVOD_CONTROLLER"
 #define HOROVOD_GLOO_IFACE "HOROVOD_GLOO_IFACE"
+#define HOROVOD_GLOO_NUM_STRIPES "HOROVOD_GLOO_NUM_STRIPES"
+#define HOROVOD_GLOO_STRIPE_THRESHOLD "HOROVOD_GLOO_STRIPE_THRESHOLD"
+#define HOROVOD_GLOO_PARTIAL_MESH "HOROVOD_GLOO_PARTIAL_MESH"
 #define HOROVOD_MPI "MPI"
 #define HOROVOD_MLSL "MLSL"
 #define HOROVOD_GLOO "GLOO"
 #define HOROVOD_ADASUM_MPI_CHUNK_SIZE "HOROVOD_ADASUM_MPI_CHUNK_SIZE"
+#define HOROVOD_MPI_ASYNC_OPS "HOROVOD_MPI_ASYNC_OPS"
+#define HOROVOD_MPI_ALLGATHER_DERIVED_DATATYPES "HOROVOD_MPI_ALLGATHER_DERIVED_DATATYPES"
+#define HOROVOD_CPU_ALLREDUCE_ALGORITHM "HOROVOD_CPU_ALLREDUCE_ALGORITHM"
+#define HOROVOD_CPU_ALLREDUCE_TABLE "HOROVOD_CPU_ALLREDUCE_TABLE"
+#define HOROVOD_SPARSE_DENSITY_THRESHOLD "HOROVOD_SPARSE_DENSITY_THRESHOLD"
 
 // String constant for gloo interface.
 #define GLOO_DEFAULT_IFACE ""
@@ -97,6 +118,9 @@ namespace common {
 // Device ID used for CPU.
 #define CPU_DEVICE_ID (-1)
 
+// ID of the process set made of all ranks.
+#define GLOBAL_PROCESS_SET_ID 0
+
 // Temporary tensor name for ranks that did Join().
 #define JOIN_TENSOR_NAME "join.noname"
 
@@ -113,6 +137,28 @@ enum Communicator {
   CROSS = 2
 };
 
+// Algorithms used to allreduce CPU tensors. AUTO selects one by message size
+// and number of ranks, LIBRARY leaves the choice to the communication library.
+// Not every library implements every algorithm. Gloo's halving-doubling is
+// RABENSEIFNER, and BCUBE is only implemented by Gloo.
+enum class AllreduceAlgorithm {
+  AUTO = 0,
+  LIBRARY = 1,
+  RING = 2,
+  RECURSIVE_DOUBLING = 3,
+  RABENSEIFNER = 4,
+  TWO_LEVEL_TREE = 5,
+  BCUBE = 6
+};
+
+std::string AllreduceAlgorithmName(AllreduceAlgorithm algorithm);
+
+// Parses names returned by AllreduceAlgorithmName, case insensitive, as well
+// as "halving_doubling" for RABENSEIFNER. Returns false if the name is
+// unknown.
+bool ParseAllreduceAlgorithm(const std::string& name,
+                             AllreduceAlgorithm& algorithm);
+
 inline std::string CommunicatorName(Communicator comm) {
   switch (comm) {
     case GLOBAL:
@@ -216,6 +262,10 @@ public:
                      std::shared_ptr<PersistentBuffer>* tensor) = 0;
   virtual Status AllocateOutput(TensorShape shape,
                                 std::shared_ptr<Tensor>* tensor) = 0;
+  // Allocates the output with the given index, for operations with several
+  // outputs.
+  virtual Status AllocateOutput(int output_index, TensorShape shape,
+                                std::shared_ptr<Tensor>* tensor) = 0;
   virtual Status AllocateZeros(int64_t num_elements, DataType dtype,
                                 std::shared_ptr<Tensor>* tensor) = 0;
   virtual Framework framework() const = 0;
@@ -238,8 +288,20 @@ struct TensorTableEntry {
   std::shared_ptr<Tensor> tensor;
   // Pre-allocated output tensor.
   std::shared_ptr<Tensor> output;
-  // Root rank for broadcast operation.
+  // Root rank for broadcast, reduce, gather and scatter operations.
   int root_rank = 0;
+  // Factors an allreduce multiplies the tensor by before and after the
+  // reduction.
+  double prescale_factor = 1.0;
+  double postscale_factor = 1.0;
+  // Row indices of a sparse allreduce, whose rows are held by tensor, and
+  // the output receiving the indices of the reduced rows. Both are int64.
+  std::shared_ptr<Tensor> indices;
+  std::shared_ptr<Tensor> output_indices;
+  // Number of rows of the dense tensor a sparse allreduce stands for, and
+  // whether rows with the same index are summed into one.
+  int64_t dense_rows = 0;
+  bool deduplicate = false;
   // Event indicating that data is ready.
   std::shared_ptr<ReadyEvent> ready_event;
   // GPU to do reduction on, or CPU_DEVICE_ID in case of CPU.
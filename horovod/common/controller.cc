@@ -16,6 +16,7 @@
 
 #include "controller.h"
 
+#include <algorithm>
 #include <atomic>
 #include <map>
 #include <queue>
@@ -47,10 +48,11 @@ void Controller::SynchronizeParameters() {
 }
 
 Controller::Controller(ResponseCache& response_cache, TensorQueue& tensor_queue,
-                       Timeline& timeline, ParameterManager& parameter_manager)
+                       Timeline& timeline, ParameterManager& parameter_manager,
+                       GroupTable& group_table)
     : stall_inspector_(response_cache), tensor_queue_(tensor_queue),
       timeline_(timeline), response_cache_(response_cache),
-      parameter_manager_(parameter_manager) {}
+      parameter_manager_(parameter_manager), group_table_(group_table) {}
 
 ResponseList Controller::ComputeResponseList(std::atomic_bool& shut_down,
                                              HorovodGlobalState& state) {
@@ -121,13 +123,60 @@ ResponseList Controller::ComputeResponseList(std::atomic_bool& shut_down,
     // a shutdown. This function removes any invalid cache entries, if they
     // exist.
     CoordinateCacheAndState(cache_coordinator);
+
+    // A group is served from the cache only as a whole. If only some of its
+    // tensors are common cache hits, e.g. because another one was
+    // invalidated, the whole group is negotiated again. Common hits and group
+    // members are the same on all workers, so they all agree on this.
+    std::unordered_set<int32_t> renegotiated_groups;
+    if (!group_table_.empty()) {
+      std::unordered_map<int32_t, std::pair<bool, bool>> group_hits;
+      for (auto& message : message_queue_tmp) {
+        if (message.group_id() == NULL_GROUP_ID) {
+          continue;
+        }
+        bool common_hit =
+            response_cache_.cached(message) ==
+                ResponseCache::CacheState::HIT &&
+            cache_coordinator.cache_hits().count(
+                response_cache_.peek_cache_bit(message)) > 0;
+        auto it = group_hits.emplace(message.group_id(),
+                                     std::make_pair(false, true)).first;
+        it->second.first |= common_hit;
+        it->second.second &= common_hit;
+      }
+      for (auto& group : group_hits) {
+        if (group.second.first && !group.second.second) {
+          renegotiated_groups.insert(group.first);
+        }
+      }
+      for (auto& message : message_queue_tmp) {
+        if (renegotiated_groups.find(message.group_id()) !=
+                renegotiated_groups.end() &&
+            response_cache_.cached(message) ==
+                ResponseCache::CacheState::HIT) {
+          // erase_hit() runs after the cache state was synchronized and sets
+          // uncached_in_queue_ on this worker only, without another exchange.
+          // This is safe because every worker erases the same hits: the
+          // common hits come from the sync, and AddToTensorQueueMulti enqueues
+          // all members of a group at once, so every worker pops either all
+          // of them or none in this cycle. All workers therefore take the
+          // negotiation path below together.
+          cache_coordinator.erase_hit(
+              response_cache_.peek_cache_bit(message));
+        }
+      }
+    }
+
     // Remove uncommon cached tensors from queue and replace to state
     // queue for next cycle. Skip adding common cached tensors to
     // queue as they are handled separately.
     size_t num_messages = message_queue_tmp.size();
     for (size_t i = 0; i < num_messages; ++i) {
       auto message = message_queue_tmp.front();
-      if (response_cache_.cached(message) == ResponseCache::CacheState::HIT) {
+      if (response_cache_.cached(message) == ResponseCache::CacheState::HIT &&
+          renegotiated_groups.find(message.group_id()) ==
+              renegotiated_groups.end()) {
         uint32_t cache_bit = response_cache_.peek_cache_bit(message);
         if (cache_coordinator.cache_hits().find(cache_bit) ==
             cache_coordinator.cache_hits().end()) {
@@ -200,11 +249,11 @@ ResponseList Controller::ComputeResponseList(std::atomic_bool& shut_down,
         message_queue_tmp.pop_front();
 
         if (message.request_type() == Request::JOIN) {
-          state.joined_size++;
+          joined_size_++;
           continue;
         }
 
-        bool reduce = IncrementTensorCount(message, state.joined_size);
+        bool reduce = IncrementTensorCount(message, joined_size_);
         stall_inspector_.RecordUncachedTensorStart(
             message.tensor_name(), message.request_rank(), size_);
         if (reduce) {
@@ -224,11 +273,11 @@ ResponseList Controller::ComputeResponseList(std::atomic_bool& shut_down,
           auto& received_name = received_message.tensor_name();
 
           if (received_message.request_type() == Request::JOIN) {
-            state.joined_size++;
+            joined_size_++;
             continue;
           }
 
-          bool reduce = IncrementTensorCount(received_message, state.joined_size);
+          bool reduce = IncrementTensorCount(received_message, joined_size_);
           stall_inspector_.RecordUncachedTensorStart(
               received_message.tensor_name(), received_message.request_rank(),
               size_);
@@ -243,10 +292,10 @@ ResponseList Controller::ComputeResponseList(std::atomic_bool& shut_down,
       }
 
       // Check if tensors from previous ticks are ready to reduce after Joins.
-      if (state.joined_size > 0) {
+      if (joined_size_ > 0) {
         for (auto& table_iter : message_table_) {
           int count = (int)table_iter.second.size();
-          if (count == (size_ - state.joined_size) &&
+          if (count == (size_ - joined_size_) &&
               std::find(ready_to_reduce.begin(), ready_to_reduce.end(),
                         table_iter.first) == ready_to_reduce.end()) {
             state.timeline.NegotiateEnd(table_iter.first);
@@ -255,6 +304,32 @@ ResponseList Controller::ComputeResponseList(std::atomic_bool& shut_down,
         }
       }
 
+      // Tensors of a group are held back until all of them are ready, and
+      // are then processed together in the order in which they were
+      // enqueued, so that they are fused the same way every step.
+      if (!group_table_.empty()) {
+        std::vector<std::string> ready_tensors;
+        ready_tensors.reserve(ready_to_reduce.size());
+        for (auto& tensor_name : ready_to_reduce) {
+          int32_t group_id = group_table_.GetGroupIDFromTensorName(tensor_name);
+          if (group_id == NULL_GROUP_ID) {
+            ready_tensors.push_back(tensor_name);
+            continue;
+          }
+
+          auto& group_ready = group_ready_tensors_[group_id];
+          group_ready.insert(tensor_name);
+          auto group_tensor_names = group_table_.GetGroupTensorNames(group_id);
+          if (group_ready.size() == group_tensor_names.size()) {
+            ready_tensors.insert(ready_tensors.end(),
+                                 group_tensor_names.begin(),
+                                 group_tensor_names.end());
+            group_ready_tensors_.erase(group_id);
+          }
+        }
+        ready_to_reduce = std::move(ready_tensors);
+      }
+
       // At this point, rank zero should have a fully updated tensor count
       // table and should know all the tensors that need to be reduced or
       // gathered, and everyone else should have sent all their information
@@ -274,16 +349,16 @@ ResponseList Controller::ComputeResponseList(std::atomic_bool& shut_down,
       }
 
       for (auto& tensor_name : ready_to_reduce) {
-        Response response = ConstructResponse(tensor_name, state.joined_size);
+        Response response = ConstructResponse(tensor_name, joined_size_);
         responses.push_back(std::move(response));
       }
-      if (state.joined_size == size_) {
+      if (joined_size_ == size_) {
         // All ranks did Join(). Send the response, reset joined size.
         Response join_response;
         join_response.set_response_type(Response::JOIN);
         join_response.add_tensor_name(JOIN_TENSOR_NAME);
         responses.push_back(std::move(join_response));
-        state.joined_size = 0;
+        joined_size_ = 0;
       }
       response_list = FuseResponses(responses);
       response_list.set_shutdown(should_shut_down);
@@ -322,7 +397,11 @@ ResponseList Controller::ComputeResponseList(std::atomic_bool& shut_down,
     // order consistently across workers.
     for (auto& response : response_list.responses()) {
       if ((response.response_type() == Response::ResponseType::ALLREDUCE ||
-           response.response_type() == Response::ResponseType::ADASUM) &&
+           response.response_type() == Response::ResponseType::ADASUM ||
+           response.response_type() == Response::ResponseType::REDUCESCATTER ||
+           response.response_type() == Response::ResponseType::REDUCE ||
+           response.response_type() == Response::ResponseType::GATHER ||
+           response.response_type() == Response::ResponseType::SCATTER) &&
           (int)response.devices().size() == size_) {
         response_cache_.put(response, tensor_queue_);
       }
@@ -398,11 +477,84 @@ Response Controller::ConstructResponse(std::string& name, int joined_size) {
     }
   }
 
-  // If we are doing an allreduce or broadcast, check that all tensor shapes are
-  // identical.
+  // If we are doing an allreduce, reducescatter or reduce, check that all
+  // reduce operations are identical.
+  auto reduce_op = requests[0].reduce_op();
+  if (message_type == Request::ALLREDUCE ||
+      message_type == Request::REDUCESCATTER ||
+      message_type == Request::REDUCE) {
+    for (unsigned int i = 1; i < requests.size(); ++i) {
+      if (error) {
+        break;
+      }
+
+      auto request_reduce_op = requests[i].reduce_op();
+      if (reduce_op != request_reduce_op) {
+        error = true;
+        error_message_stream << "Mismatched reduce operations: One rank did "
+                             << ReduceOp_Name(reduce_op)
+                             << ", but another rank did "
+                             << ReduceOp_Name(request_reduce_op) << ".";
+        break;
+      }
+    }
+
+    // Scaling is applied by every rank on its own, so all ranks have to agree
+    // on the factors for the results to match.
+    for (unsigned int i = 1; i < requests.size(); ++i) {
+      if (error) {
+        break;
+      }
+
+      if (requests[i].prescale_factor() != requests[0].prescale_factor() ||
+          requests[i].postscale_factor() != requests[0].postscale_factor()) {
+        error = true;
+        error_message_stream
+            << "Mismatched scale factors: One rank had prescale_factor "
+            << requests[0].prescale_factor() << " and postscale_factor "
+            << requests[0].postscale_factor()
+            << ", but another rank had prescale_factor "
+            << requests[i].prescale_factor() << " and postscale_factor "
+            << requests[i].postscale_factor() << ".";
+        break;
+      }
+    }
+
+    // Joined ranks contribute zeros, which is only neutral for a sum.
+    if (!error && joined_size > 0 && reduce_op != ReduceOp::SUM) {
+      error = true;
+      error_message_stream << ReduceOp_Name(reduce_op)
+                           << " reduction is not supported with Join at this "
+                              "time.";
+    }
+  }
+
+  // Groups are negotiated and fused as a unit, so a tensor has to be part of
+  // the same group on all ranks.
+  auto group_id = requests[0].group_id();
+  for (unsigned int i = 1; i < requests.size(); ++i) {
+    if (error) {
+      break;
+    }
+
+    if (group_id != requests[i].group_id()) {
+      error = true;
+      error_message_stream << "Mismatched groups: One rank enqueued the tensor "
+                           << "in group " << group_id
+                           << ", but another rank in group "
+                           << requests[i].group_id() << ".";
+      break;
+    }
+  }
+
+  // If we are doing an allreduce, reducescatter, broadcast, reduce or
+  // scatter, check that all tensor shapes are identical.
   if (message_type == Request::ALLREDUCE ||
       message_type == Request::ADASUM ||
-      message_type == Request::BROADCAST) {
+      message_type == Request::REDUCESCATTER ||
+      message_type == Request::BROADCAST ||
+      message_type == Request::REDUCE ||
+      message_type == Request::SCATTER) {
     TensorShape tensor_shape;
     for (auto dim : requests[0].tensor_shape()) {
       tensor_shape.AddDim(dim);
@@ -430,16 +582,24 @@ Response Controller::ConstructResponse(std::string& name, int joined_size) {
   }
 
   std::vector<int64_t> tensor_sizes;
-  if (message_type == Request::ALLGATHER) {
+  if (message_type == Request::ALLGATHER ||
+      message_type == Request::GATHER ||
+      message_type == Request::SPARSE_ALLREDUCE) {
     if (joined_size > 0) {
       error = true;
-      error_message_stream << "Allgather is not supported with Join at this time. "
+      error_message_stream << (message_type == Request::ALLGATHER
+                                   ? "Allgather"
+                                   : message_type == Request::GATHER
+                                         ? "Gather"
+                                         : "Sparse allreduce")
+                           << " is not supported with Join at this time. "
                            << "Specify sparse_to_dense=True if using DistributedOptimizer";
     }
 
-    // If we are doing an allgather, make sure all but the first dimension are
-    // the same. The first dimension may be different and the output tensor is
-    // the sum of the first dimension. Collect the sizes by rank.
+    // If we are doing an allgather, a gather or a sparse allreduce, make sure
+    // all but the first dimension are the same. The first dimension may be
+    // different and the output tensor is the sum of the first dimension.
+    // Collect the sizes by rank.
     tensor_sizes.resize(requests.size());
     TensorShape tensor_shape;
     for (auto dim : requests[0].tensor_shape()) {
@@ -497,6 +657,92 @@ Response Controller::ConstructResponse(std::string& name, int joined_size) {
     }
   }
 
+  if (message_type == Request::ALLTOALL) {
+    if (joined_size > 0) {
+      error = true;
+      error_message_stream << "Alltoall is not supported with Join at this time.";
+    }
+
+    // If we are doing an alltoall, make sure all but the first dimension are
+    // the same and that every rank splits its first dimension among all the
+    // ranks. Collect the splits by rank.
+    tensor_sizes.resize(size_ * size_);
+    TensorShape tensor_shape;
+    for (auto dim : requests[0].tensor_shape()) {
+      tensor_shape.AddDim(dim);
+    }
+
+    if (tensor_shape.dims() == 0) {
+      error = true;
+      error_message_stream << "Rank zero tried to "
+                           << Request::RequestType_Name(message_type)
+                           << " a rank-zero tensor.";
+    }
+
+    for (unsigned int i = 0; i < requests.size(); ++i) {
+      if (error) {
+        break;
+      }
+
+      TensorShape request_shape;
+      for (auto dim : requests[i].tensor_shape()) {
+        request_shape.AddDim(dim);
+      }
+      if (tensor_shape.dims() != request_shape.dims()) {
+        error = true;
+        error_message_stream
+            << "Mismatched " << Request::RequestType_Name(message_type)
+            << " tensor shapes: One rank sent a tensor of rank "
+            << tensor_shape.dims()
+            << ", but another rank sent a tensor of rank "
+            << request_shape.dims() << ".";
+        break;
+      }
+
+      for (int dim = 1; dim < tensor_shape.dims(); ++dim) {
+        if (tensor_shape.dim_size(dim) != request_shape.dim_size(dim)) {
+          error = true;
+          error_message_stream
+              << "Mismatched " << Request::RequestType_Name(message_type)
+              << " tensor shapes: One rank sent a tensor with dimension " << dim
+              << " equal to " << tensor_shape.dim_size(dim)
+              << ", but another rank sent a tensor with dimension " << dim
+              << " equal to " << request_shape.dim_size(dim) << ".";
+          break;
+        }
+      }
+      if (error) {
+        break;
+      }
+
+      const auto& splits = requests[i].splits();
+      int64_t split_rows = 0;
+      for (auto split : splits) {
+        if (split < 0) {
+          split_rows = -1;
+          break;
+        }
+        split_rows += split;
+      }
+      if ((int)splits.size() != size_ ||
+          split_rows != request_shape.dim_size(0)) {
+        error = true;
+        error_message_stream
+            << "Invalid " << Request::RequestType_Name(message_type)
+            << " splits: Rank " << requests[i].request_rank()
+            << " must split the " << request_shape.dim_size(0)
+            << " rows of its tensor into " << size_
+            << " non-negative parts.";
+        break;
+      }
+
+      int64_t offset = requests[i].request_rank() * size_;
+      for (int rc = 0; rc < size_; ++rc) {
+        tensor_sizes[offset + rc] = splits[rc];
+      }
+    }
+  }
+
   // If there is at least one rank that requested Join, communicate tensor sizes
   // in the response, because joined ranks don't have this info.
   if (joined_size > 0 && (message_type == Request::ALLREDUCE || message_type == Request::ADASUM)) {
@@ -507,13 +753,50 @@ Response Controller::ConstructResponse(std::string& name, int joined_size) {
     tensor_sizes.push_back(tensor_shape.num_elements());
   }
 
+  if (message_type == Request::REDUCESCATTER) {
+    if (joined_size > 0) {
+      error = true;
+      error_message_stream << "Reducescatter is not supported with Join at this time.";
+    }
+
+    // The first dimension is split across the ranks.
+    if (requests[0].tensor_shape().empty()) {
+      error = true;
+      error_message_stream << "Rank zero tried to "
+                           << Request::RequestType_Name(message_type)
+                           << " a rank-zero tensor.";
+    }
+  }
+
   if (message_type == Request::BROADCAST) {
     if (joined_size > 0) {
       error = true;
       error_message_stream << "Broadcast is not supported with Join at this time.";
     }
+  }
+
+  if (message_type == Request::REDUCE || message_type == Request::GATHER ||
+      message_type == Request::SCATTER) {
+    if (joined_size > 0) {
+      error = true;
+      error_message_stream << Request::RequestType_Name(message_type)
+                           << " is not supported with Join at this time.";
+    }
+
+    // The first dimension of a scatter is split across the ranks.
+    if (message_type == Request::SCATTER &&
+        requests[0].tensor_shape().empty()) {
+      error = true;
+      error_message_stream << "Rank zero tried to "
+                           << Request::RequestType_Name(message_type)
+                           << " a rank-zero tensor.";
+    }
+  }
 
-    // If we are doing a broadcast, check that all root ranks are identical.
+  if (message_type == Request::BROADCAST || message_type == Request::REDUCE ||
+      message_type == Request::GATHER || message_type == Request::SCATTER) {
+    // If we are doing a rooted operation, check that all root ranks are
+    // identical.
     int first_root_rank = requests[0].root_rank();
     for (unsigned int i = 1; i < requests.size(); ++i) {
       if (error) {
@@ -569,6 +852,9 @@ Response Controller::ConstructResponse(std::string& name, int joined_size) {
     }
   } else if (message_type == Request::ALLREDUCE) {
     response.set_response_type(Response::ALLREDUCE);
+    response.set_reduce_op(reduce_op);
+    response.set_prescale_factor(requests[0].prescale_factor());
+    response.set_postscale_factor(requests[0].postscale_factor());
     if (joined_size > 0) {
       for (auto dim : tensor_sizes) {
         response.add_tensor_size(dim);
@@ -577,6 +863,29 @@ Response Controller::ConstructResponse(std::string& name, int joined_size) {
     }
   } else if (message_type == Request::BROADCAST) {
     response.set_response_type(Response::BROADCAST);
+  } else if (message_type == Request::REDUCESCATTER) {
+    response.set_response_type(Response::REDUCESCATTER);
+    response.set_reduce_op(reduce_op);
+  } else if (message_type == Request::ALLTOALL) {
+    response.set_response_type(Response::ALLTOALL);
+    for (auto split : tensor_sizes) {
+      response.add_tensor_size(split);
+    }
+  } else if (message_type == Request::SPARSE_ALLREDUCE) {
+    response.set_response_type(Response::SPARSE_ALLREDUCE);
+    for (auto dim : tensor_sizes) {
+      response.add_tensor_size(dim);
+    }
+  } else if (message_type == Request::REDUCE) {
+    response.set_response_type(Response::REDUCE);
+    response.set_reduce_op(reduce_op);
+  } else if (message_type == Request::GATHER) {
+    response.set_response_type(Response::GATHER);
+    for (auto dim : tensor_sizes) {
+      response.add_tensor_size(dim);
+    }
+  } else if (message_type == Request::SCATTER) {
+    response.set_response_type(Response::SCATTER);
   } else if (message_type == Request::ADASUM) {
     response.set_response_type(Response::ADASUM);
     if (joined_size > 0) {
@@ -639,6 +948,24 @@ ResponseList Controller::FuseResponses(std::deque<Response>& responses) {
       // found_tensor can be false for ranks that did Join.
       bool found_tensor = tensor_queue_.GetTensorSizeAndType(response.tensor_names()[0], tensor_size, dtype);
 
+      // CPU allreduce operations are able to reduce a fusion buffer made of
+      // several data type segments in one go, so mixed-precision responses
+      // do not need to be split into separate collectives. Responses carrying
+      // tensor sizes for joined ranks are kept homogeneous.
+      bool mixed_dtype_fusion =
+          found_tensor &&
+          response.response_type() == Response::ResponseType::ALLREDUCE &&
+          response.tensor_sizes().empty() &&
+          tensor_queue_.GetTensorEntry(response.tensor_names()[0]).device ==
+              CPU_DEVICE_ID;
+      std::vector<std::pair<std::string, DataType>> fused_tensors;
+      fused_tensors.emplace_back(response.tensor_names()[0], dtype);
+      bool mixed_dtype = false;
+
+      // Tensors of a group are only fused with each other.
+      int32_t group_id =
+          group_table_.GetGroupIDFromTensorName(response.tensor_names()[0]);
+
       std::deque<Response> skipped_responses;
       int64_t skipped_size = 0;
       while (!responses.empty()) {
@@ -650,12 +977,20 @@ ResponseList Controller::FuseResponses(std::deque<Response>& responses) {
 
         if (found_tensor &&
             response.response_type() == new_response.response_type() &&
+            response.reduce_op() == new_response.reduce_op() &&
+            response.prescale_factor() == new_response.prescale_factor() &&
+            response.postscale_factor() == new_response.postscale_factor() &&
             response.devices() == new_response.devices() &&
-            dtype == new_entry.tensor->dtype() &&
+            (dtype == new_entry.tensor->dtype() || mixed_dtype_fusion) &&
+            group_id == group_table_.GetGroupIDFromTensorName(
+                            new_response.tensor_names()[0]) &&
             tensor_size + new_tensor_size <= TensorFusionThresholdBytes()) {
           // These tensors will fuse together well.
           tensor_size += new_tensor_size;
           response.add_tensor_name(new_response.tensor_names()[0]);
+          fused_tensors.emplace_back(new_response.tensor_names()[0],
+                                     new_entry.tensor->dtype());
+          mixed_dtype |= dtype != new_entry.tensor->dtype();
           responses.pop_front();
         } else {
           // In general, don't try to fuse additional tensors since they are
@@ -664,10 +999,13 @@ ResponseList Controller::FuseResponses(std::deque<Response>& responses) {
           // tensors could be reduced at that time. However, mixed-precision
           // training may yield requests of various dtype in a mixed-up
           // sequence causing breakups in fusion. To counter this some look
-          // ahead is allowed.
+          // ahead is allowed. Members of a group are looked for in all
+          // remaining responses, so that the group is fused the same way
+          // whatever order its responses come in.
 
           skipped_size += new_tensor_size;
-          if (tensor_size + skipped_size <= TensorFusionThresholdBytes()) {
+          if (group_id != NULL_GROUP_ID ||
+              tensor_size + skipped_size <= TensorFusionThresholdBytes()) {
             // Skip response and look ahead for more to fuse.
             skipped_responses.push_back(std::move(responses.front()));
             responses.pop_front();
@@ -683,8 +1021,30 @@ ResponseList Controller::FuseResponses(std::deque<Response>& responses) {
         skipped_responses.pop_back();
       }
 
-    } else if (response.response_type() == Response::ResponseType::ALLGATHER) {
-      // Attempt to add more responses to this fused response.
+      if (mixed_dtype) {
+        // Group tensors of the same data type into contiguous segments of the
+        // fusion buffer. Ordering segments by decreasing element size keeps
+        // every segment aligned to its own element size.
+        std::stable_sort(
+            fused_tensors.begin(), fused_tensors.end(),
+            [this](const std::pair<std::string, DataType>& a,
+                   const std::pair<std::string, DataType>& b) {
+              int a_size = GetTypeSize(a.second);
+              int b_size = GetTypeSize(b.second);
+              return a_size != b_size ? a_size > b_size : a.second < b.second;
+            });
+        std::vector<std::string> tensor_names;
+        tensor_names.reserve(fused_tensors.size());
+        for (auto& tensor : fused_tensors) {
+          tensor_names.push_back(tensor.first);
+        }
+        response.set_tensor_names(tensor_names);
+      }
+
+    } else if (response.response_type() == Response::ResponseType::ALLGATHER ||
+               response.response_type() == Response::ResponseType::GATHER) {
+      // Attempt to add more responses to this fused response. Gathers are
+      // only fused with gathers to the same root rank.
       const auto& entry =
           tensor_queue_.GetTensorEntry(response.tensor_names()[0]);
 
@@ -707,6 +1067,7 @@ ResponseList Controller::FuseResponses(std::deque<Response>& responses) {
         if (response.response_type() == new_response.response_type() &&
             response.devices() == new_response.devices() &&
             entry.tensor->dtype() == new_entry.tensor->dtype() &&
+            entry.root_rank == new_entry.root_rank &&
             total_byte_size_of_output + new_total_byte_size_of_output <=
                 TensorFusionThresholdBytes()) {
 
@@ -736,6 +1097,151 @@ ResponseList Controller::FuseResponses(std::deque<Response>& responses) {
         }
       }
 
+      // Replace any skipped responses.
+      while (!skipped_responses.empty()) {
+        responses.push_front(std::move(skipped_responses.back()));
+        skipped_responses.pop_back();
+      }
+
+    } else if (response.response_type() ==
+                   Response::ResponseType::REDUCESCATTER ||
+               response.response_type() == Response::ResponseType::REDUCE ||
+               response.response_type() == Response::ResponseType::SCATTER) {
+      // Attempt to add more responses to this fused response. Fused
+      // reducescatters and scatters are laid out rank by rank in the fusion
+      // buffer and fused reduces back to back, which works for any shapes as
+      // long as the data type and the root rank of reduces and scatters match.
+      const auto& entry =
+          tensor_queue_.GetTensorEntry(response.tensor_names()[0]);
+      tensor_size = entry.tensor->size();
+      dtype = entry.tensor->dtype();
+
+      std::deque<Response> skipped_responses;
+      int64_t skipped_size = 0;
+      while (!responses.empty()) {
+        auto new_response = responses.front();
+        assert(new_response.tensor_names().size() == 1);
+        const auto& new_entry =
+            tensor_queue_.GetTensorEntry(new_response.tensor_names()[0]);
+        int64_t new_tensor_size = new_entry.tensor->size();
+
+        if (response.response_type() == new_response.response_type() &&
+            response.reduce_op() == new_response.reduce_op() &&
+            response.devices() == new_response.devices() &&
+            dtype == new_entry.tensor->dtype() &&
+            entry.root_rank == new_entry.root_rank &&
+            tensor_size + new_tensor_size <= TensorFusionThresholdBytes()) {
+          // These tensors will fuse together well.
+          tensor_size += new_tensor_size;
+          response.add_tensor_name(new_response.tensor_names()[0]);
+          responses.pop_front();
+        } else {
+          // Allow the same look ahead as for allreduce.
+          skipped_size += new_tensor_size;
+          if (tensor_size + skipped_size <= TensorFusionThresholdBytes()) {
+            // Skip response and look ahead for more to fuse.
+            skipped_responses.push_back(std::move(responses.front()));
+            responses.pop_front();
+          } else {
+            break;
+          }
+        }
+      }
+
+      // Replace any skipped responses.
+      while (!skipped_responses.empty()) {
+        responses.push_front(std::move(skipped_responses.back()));
+        skipped_responses.pop_back();
+      }
+
+    } else if (response.response_type() == Response::ResponseType::ALLTOALL) {
+      // Attempt to add more responses to this fused response. Only
+      // alltoalls with the same splits on all ranks are fused, so that the
+      // fused response carries a single set of splits and every rank
+      // exchanges the rows of all entries in one collective.
+      const auto& entry =
+          tensor_queue_.GetTensorEntry(response.tensor_names()[0]);
+      tensor_size = entry.tensor->size();
+      dtype = entry.tensor->dtype();
+
+      std::deque<Response> skipped_responses;
+      int64_t skipped_size = 0;
+      while (!responses.empty()) {
+        auto new_response = responses.front();
+        assert(new_response.tensor_names().size() == 1);
+        const auto& new_entry =
+            tensor_queue_.GetTensorEntry(new_response.tensor_names()[0]);
+        int64_t new_tensor_size = new_entry.tensor->size();
+
+        if (response.response_type() == new_response.response_type() &&
+            response.devices() == new_response.devices() &&
+            response.tensor_sizes() == new_response.tensor_sizes() &&
+            dtype == new_entry.tensor->dtype() &&
+            tensor_size + new_tensor_size <= TensorFusionThresholdBytes()) {
+          // These tensors will fuse together well.
+          tensor_size += new_tensor_size;
+          response.add_tensor_name(new_response.tensor_names()[0]);
+          responses.pop_front();
+        } else {
+          // Allow the same look ahead as for allreduce.
+          skipped_size += new_tensor_size;
+          if (tensor_size + skipped_size <= TensorFusionThresholdBytes()) {
+            // Skip response and look ahead for more to fuse.
+            skipped_responses.push_back(std::move(responses.front()));
+            responses.pop_front();
+          } else {
+            break;
+          }
+        }
+      }
+
+      // Replace any skipped responses.
+      while (!skipped_responses.empty()) {
+        responses.push_front(std::move(skipped_responses.back()));
+        skipped_responses.pop_back();
+      }
+
+    } else if (response.response_type() == Response::ResponseType::BROADCAST) {
+      // Attempt to add more responses to this fused response. Fused
+      // broadcasts are sent as bytes through the CPU fusion buffer, so only
+      // the root rank and devices have to match.
+      const auto& entry =
+          tensor_queue_.GetTensorEntry(response.tensor_names()[0]);
+      tensor_size = entry.tensor->size();
+      int root_rank = entry.root_rank;
+      bool on_cpu = entry.device == CPU_DEVICE_ID;
+
+      std::deque<Response> skipped_responses;
+      int64_t skipped_size = 0;
+      while (on_cpu && !responses.empty()) {
+        auto new_response = responses.front();
+        assert(new_response.tensor_names().size() == 1);
+        const auto& new_entry =
+            tensor_queue_.GetTensorEntry(new_response.tensor_names()[0]);
+        int64_t new_tensor_size = new_entry.tensor->size();
+
+        if (response.response_type() == new_response.response_type() &&
+            response.devices() == new_response.devices() &&
+            root_rank == new_entry.root_rank &&
+            tensor_size + new_tensor_size <= TensorFusionThresholdBytes()) {
+          // These tensors will fuse together well.
+          tensor_size += new_tensor_size;
+          response.add_tensor_name(new_response.tensor_names()[0]);
+          responses.pop_front();
+        } else {
+          // Broadcasts from other root ranks are often interleaved with the
+          // ones being fused, so allow the same look ahead as above.
+          skipped_size += new_tensor_size;
+          if (tensor_size + skipped_size <= TensorFusionThresholdBytes()) {
+            // Skip response and look ahead for more to fuse.
+            skipped_responses.push_back(std::move(responses.front()));
+            responses.pop_front();
+          } else {
+            break;
+          }
+        }
+      }
+
       // Replace any skipped responses.
       while (!skipped_responses.empty()) {
         responses.push_front(std::move(skipped_responses.back()));
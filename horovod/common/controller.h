@@ -18,9 +18,11 @@
 
 #include <iostream>
 #include <queue>
+#include <unordered_set>
 #include <vector>
 
 #include "global_state.h"
+#include "group_table.h"
 #include "parameter_manager.h"
 #include "response_cache.h"
 #include "stall_inspector.h"
@@ -35,7 +37,8 @@ using MessageTable = std::unordered_map<std::string, std::vector<Request>>;
 class Controller : public std::enable_shared_from_this<Controller> {
 public:
   Controller(ResponseCache& response_cache, TensorQueue& tensor_queue,
-             Timeline& timeline, ParameterManager& parameter_manager);
+             Timeline& timeline, ParameterManager& parameter_manager,
+             GroupTable& group_table);
 
   Controller(const Controller&) = delete;
   // Functions must be overridden by concrete controller
@@ -172,6 +175,9 @@ protected:
   bool is_coordinator_ = false;
   bool is_homogeneous_ = false;
 
+  // Only used on the coordinator. Number of ranks that did Join().
+  int joined_size_ = 0;
+
   // ranks of the horovod world
   std::vector<int> ranks_;
 
@@ -189,6 +195,11 @@ protected:
   // requests to allreduce every tensor (keyed by tensor name).
   MessageTable message_table_;
 
+  // Only exists on the coordinator node (rank zero). Tensors of groups that
+  // are ready on all ranks, held back until the rest of their group is ready.
+  std::unordered_map<int32_t, std::unordered_set<std::string>>
+      group_ready_tensors_;
+
   bool timeline_enabled_ = false;
 
   // Outside dependencies
@@ -199,6 +210,8 @@ protected:
   ResponseCache& response_cache_;
 
   ParameterManager& parameter_manager_;
+
+  GroupTable& group_table_;
 };
 
 } // namespace common
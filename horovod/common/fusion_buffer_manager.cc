@@ -33,6 +33,7 @@ Status FusionBufferManager::InitializeBuffer(int64_t threshold, int device, std:
   if (buffer == nullptr) {
     on_start_init();
     size = threshold;
+    ++buffer_generations_[std::make_tuple(device, context->framework(), stream_id)];
 
     // Lazily allocate persistent buffer for Tensor Fusion and keep it
     // forever per device.
@@ -49,5 +50,9 @@ std::shared_ptr<PersistentBuffer> FusionBufferManager::GetBuffer(int device, Fra
   return tensor_fusion_buffers_[std::make_tuple(device, framework, stream_id)].first;
 }
 
+uint64_t FusionBufferManager::GetBufferGeneration(int device, Framework framework, int stream_id) {
+  return buffer_generations_[std::make_tuple(device, framework, stream_id)];
+}
+
 } // namespace common
 } // namespace horovod
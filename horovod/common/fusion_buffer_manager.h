@@ -46,6 +46,11 @@ public:
   // Returns the buffer associated with the given device and framework, or null.
   std::shared_ptr<PersistentBuffer> GetBuffer(int device, Framework framework, int stream_id);
 
+  // Returns how many times the buffer associated with the given device and
+  // framework has been allocated. Buffers are reallocated in the same cycle
+  // on all ranks, so unlike their addresses, generations agree across ranks.
+  uint64_t GetBufferGeneration(int device, Framework framework, int stream_id);
+
 private:
   // Memory buffers for Tensor Fusion.  They are keyed off device ID and
   // framework, and all are allocated tensor_fusion_threshold bytes if
@@ -53,6 +58,9 @@ private:
   std::unordered_map<
       std::tuple<int, Framework, int>,
       std::pair<std::shared_ptr<PersistentBuffer>, int64_t>> tensor_fusion_buffers_;
+
+  std::unordered_map<std::tuple<int, Framework, int>, uint64_t>
+      buffer_generations_;
 };
 
 } // namespace common
@@ -21,6 +21,7 @@
 #include <thread>
 
 #include "fusion_buffer_manager.h"
+#include "group_table.h"
 #include "parameter_manager.h"
 #include "response_cache.h"
 #include "tensor_queue.h"
@@ -75,6 +76,9 @@ struct HorovodGlobalState {
 
   TensorQueue tensor_queue;
 
+  // Groups of tensors that are negotiated and fused together.
+  GroupTable group_table;
+
   // Pointer to shared buffer for allgather
   void* shared_buffer = nullptr;
 
@@ -93,6 +97,11 @@ struct HorovodGlobalState {
   // Index of current CUDA stream to use
   int current_nccl_stream = 0;
 
+  // Index of the fusion buffer to use for CPU tensors. Rotates when MPI
+  // operations are executed asynchronously, so that every operation in flight
+  // owns a separate fusion buffer.
+  int current_cpu_fusion_buffer = 0;
+
   // A LibType indicating what framework we are using to perform CPU operations.
   LibType cpu_operation;
 
@@ -100,9 +109,6 @@ struct HorovodGlobalState {
   // operations.
   LibType control_operation;
 
-  // Number of ranks that did Join()
-  int joined_size = 0;
-
   // If a rank is Joined, AllReduce uses temporary 0 tensors for it.
   bool joined = false;
 
@@ -113,6 +119,20 @@ struct HorovodGlobalState {
   // benefit from a smaller chunk size.
   int64_t adasum_mpi_chunk_size = 1<<30;
 
+  // Sparse allreduces gathering more rows than this fraction of the rows of
+  // the dense tensor allreduce the dense tensor instead.
+  double sparse_density_threshold = 0.5;
+
+  // Whether fused MPI allgathers of CPU tensors move data between the
+  // framework buffers with derived datatypes instead of the fusion buffer.
+  bool mpi_allgather_derived_datatypes = false;
+
+  // Stream ID of the fusion buffer used for tensors on the given device.
+  int FusionBufferStream(int device) const {
+    return device == CPU_DEVICE_ID ? current_cpu_fusion_buffer
+                                   : current_nccl_stream;
+  }
+
   ~HorovodGlobalState() {
     // Make sure that the destructor of the background thread is safe to
     // call. If a thread is still joinable (not detached or complete) its
@@ -15,12 +15,20 @@
 
 #include "gloo_context.h"
 
+#include <algorithm>
+#include <cassert>
 #include <chrono>
 #include <memory>
+#include <set>
+#include <sstream>
 
+#include "gloo/allgather.h"
 #include "gloo/rendezvous/context.h"
 #include "gloo/rendezvous/file_store.h"
 #include "gloo/rendezvous/prefix_store.h"
+#include "gloo/transport/address.h"
+#include "gloo/transport/context.h"
+#include "gloo/transport/pair.h"
 #include "gloo/transport/tcp/device.h"
 
 #if HAVE_MPI
@@ -41,6 +49,9 @@ namespace common {
 #define HOROVOD_GLOO_GLOBAL_PREFIX "global_"
 #define HOROVOD_GLOO_LOCAL_PREFIX "local_"
 #define HOROVOD_GLOO_CROSS_PREFIX "cross_"
+#define HOROVOD_GLOO_PROCESS_SET_PREFIX "process_set_"
+#define HOROVOD_GLOO_STRIPE_PREFIX "stripe_"
+#define HOROVOD_GLOO_FULL_MESH_PREFIX "full_"
 #define HOROVOD_RANK "HOROVOD_RANK"
 #define HOROVOD_SIZE "HOROVOD_SIZE"
 #define HOROVOD_LOCAL_RANK "HOROVOD_LOCAL_RANK"
@@ -53,28 +64,278 @@ std::chrono::milliseconds GetTimeoutFromEnv() {
   return std::chrono::duration_cast<std::chrono::milliseconds>(s);
 }
 
+PartialMeshContext::PartialMeshContext(int rank, int size,
+                                       std::unique_ptr<GlooStore> store)
+    : gloo::Context(rank, size), store_(std::move(store)) {}
+
+void PartialMeshContext::ConnectPartialMesh(
+    std::shared_ptr<gloo::transport::Device>& dev) {
+  auto transport_context = dev->createContext(rank, size);
+  transport_context->setTimeout(getTimeout());
+  device_ = dev;
+  transportContext_ = std::move(transport_context);
+
+  int context_size = size;
+  ConnectPeers("", [context_size](int peer_rank) {
+    return Peers(peer_rank, context_size);
+  });
+}
+
+void PartialMeshContext::ConnectFullMesh() {
+  if (full_mesh_) {
+    return;
+  }
+  if (store_ == nullptr) {
+    throw std::logic_error("Cannot connect the full mesh of a Gloo context "
+                           "after its store has been finalized.");
+  }
+
+  int context_size = size;
+  ConnectPeers(HOROVOD_GLOO_FULL_MESH_PREFIX, [context_size](int peer_rank) {
+    auto partial_peers = Peers(peer_rank, context_size);
+    std::vector<int> peers;
+    for (int other = 0; other < context_size; ++other) {
+      if (other != peer_rank &&
+          !std::binary_search(partial_peers.begin(), partial_peers.end(),
+                              other)) {
+        peers.push_back(other);
+      }
+    }
+    return peers;
+  });
+  full_mesh_ = true;
+}
+
+void PartialMeshContext::FinalizeStore() {
+  if (store_ != nullptr) {
+    store_->Finalize();
+    store_.reset();
+  }
+}
+
+std::vector<int> PartialMeshContext::Peers(int rank, int size) {
+  std::set<int> peers;
+  for (int distance = 1; distance < size; distance <<= 1) {
+    peers.insert((rank + distance) % size);
+    peers.insert((rank + size - distance) % size);
+  }
+  peers.erase(rank);
+  return std::vector<int>(peers.begin(), peers.end());
+}
+
+// Same exchange as rendezvous::Context::connectFullMesh, restricted to the
+// peers: every rank stores the addresses of its pairs in the order of its
+// peers under a single key, and picks its own from the key of each peer.
+void PartialMeshContext::ConnectPeers(
+    const std::string& key_prefix,
+    const std::function<std::vector<int>(int)>& peers_of) {
+  auto peers = peers_of(rank);
+  if (peers.empty()) {
+    return;
+  }
+
+  std::vector<char> addresses;
+  for (auto peer : peers) {
+    auto& pair = transportContext_->createPair(peer);
+    auto address = pair->address().bytes();
+    addresses.insert(addresses.end(), address.begin(), address.end());
+  }
+  store_->set(key_prefix + std::to_string(rank), addresses);
+
+  std::vector<std::string> keys;
+  for (auto peer : peers) {
+    keys.push_back(key_prefix + std::to_string(peer));
+  }
+  store_->wait(keys, getTimeout());
+
+  for (size_t i = 0; i < peers.size(); ++i) {
+    auto peer_addresses = store_->get(keys[i]);
+    auto peer_peers = peers_of(peers[i]);
+    auto index = std::lower_bound(peer_peers.begin(), peer_peers.end(), rank) -
+                 peer_peers.begin();
+    auto address_size = peer_addresses.size() / peer_peers.size();
+    auto address = peer_addresses.begin() + index * address_size;
+    transportContext_->getPair(peers[i])->connect(
+        std::vector<char>(address, address + address_size));
+  }
+}
+
+void ConnectFullMesh(gloo::Context& context) {
+  auto partial_mesh_context = dynamic_cast<PartialMeshContext*>(&context);
+  if (partial_mesh_context != nullptr) {
+    partial_mesh_context->ConnectFullMesh();
+  }
+}
+
+StripeWorkers::~StripeWorkers() { Stop(); }
+
+void StripeWorkers::Start(int num_stripes) {
+  Stop();
+  shut_down_ = false;
+  for (int stripe = 1; stripe < num_stripes; ++stripe) {
+    threads_.emplace_back(&StripeWorkers::WorkerLoop, this, stripe,
+                          run_count_);
+  }
+}
+
+void StripeWorkers::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shut_down_ = true;
+  }
+  work_cond_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+  threads_.clear();
+}
+
+void StripeWorkers::Run(int num_stripes,
+                        const std::function<void(int)>& fn) {
+  if (num_stripes == 1) {
+    fn(0);
+    return;
+  }
+  assert(num_stripes == (int)threads_.size() + 1);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    fn_ = &fn;
+    errors_.assign(num_stripes, nullptr);
+    pending_ = num_stripes - 1;
+    ++run_count_;
+  }
+  work_cond_.notify_all();
+
+  try {
+    fn(0);
+  } catch (...) {
+    errors_[0] = std::current_exception();
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cond_.wait(lock, [this]() { return pending_ == 0; });
+  fn_ = nullptr;
+  for (auto& error : errors_) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+void StripeWorkers::WorkerLoop(int stripe, uint64_t last_run) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    work_cond_.wait(lock,
+                    [&]() { return shut_down_ || run_count_ != last_run; });
+    if (shut_down_) {
+      return;
+    }
+    last_run = run_count_;
+    auto fn = fn_;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      (*fn)(stripe);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    errors_[stripe] = error;
+    if (--pending_ == 0) {
+      done_cond_.notify_one();
+    }
+  }
+}
+
+void FinalizeStore(const std::shared_ptr<gloo::Context>& context) {
+  auto partial_mesh_context = dynamic_cast<PartialMeshContext*>(context.get());
+  if (partial_mesh_context != nullptr) {
+    partial_mesh_context->FinalizeStore();
+  }
+}
+
+// Finalizing the store tells the rendezvous server that the rank is done with
+// the scope of the prefix. If unfinalized_store is given, the store is handed
+// out instead and must be finalized by the caller. Partial mesh contexts keep
+// their store and finalize it themselves.
 std::shared_ptr<gloo::Context> Rendezvous(const std::string& prefix,
                                           const char* server_addr_env, int server_port,
                                           int rank, int size,
                                           std::shared_ptr<gloo::transport::Device>& dev,
-                                          std::chrono::milliseconds timeout) {
+                                          std::chrono::milliseconds timeout,
+                                          std::unique_ptr<GlooStore>* unfinalized_store = nullptr) {
   std::unique_ptr<GlooStore> store;
   if (server_addr_env != nullptr) {
     std::string server_addr = server_addr_env;
     store.reset(new HTTPStore(server_addr, server_port, prefix, rank));
   } else {
-    store.reset(new MemoryStore());
+    store.reset(new MemoryStore(prefix));
   }
   LOG(DEBUG) << prefix << " rendezvous started for rank=" << rank << ", size=" << size
              << ", dev={" << dev->str() << "}";
 
+  bool partial_mesh = false;
+  SetBoolFromEnv(HOROVOD_GLOO_PARTIAL_MESH, partial_mesh, true);
+  if (partial_mesh) {
+    auto context =
+        std::make_shared<PartialMeshContext>(rank, size, std::move(store));
+    context->setTimeout(timeout);
+    context->ConnectPartialMesh(dev);
+    return context;
+  }
+
   auto context = std::make_shared<gloo::rendezvous::Context>(rank, size);
   context->setTimeout(timeout);
   context->connectFullMesh(*store, dev);
-  store->Finalize();
+  if (unfinalized_store != nullptr) {
+    *unfinalized_store = std::move(store);
+  } else {
+    store->Finalize();
+  }
   return context;
 }
 
+// Interfaces of the comma-separated list, or the empty interface, which
+// leaves the choice to Gloo.
+std::vector<std::string> ParseInterfaces(const std::string& gloo_iface) {
+  std::vector<std::string> ifaces;
+  std::stringstream iface_stream(gloo_iface);
+  std::string iface;
+  while (std::getline(iface_stream, iface, ',')) {
+    ifaces.push_back(iface);
+  }
+  if (ifaces.empty()) {
+    ifaces.push_back("");
+  }
+  return ifaces;
+}
+
+std::shared_ptr<gloo::transport::Device>
+CreateDevice(const std::string& iface) {
+  gloo::transport::tcp::attr attr;
+  attr.iface = iface;
+  attr.ai_family = AF_UNSPEC;
+  return gloo::transport::tcp::CreateDevice(attr);
+}
+
+// Creates a TCP device for every stripe, on the interfaces in turn. Stripes
+// sharing an interface still get devices of their own, so that each has its
+// own connections and event loop.
+std::vector<std::shared_ptr<gloo::transport::Device>>
+CreateDevices(const std::string& gloo_iface) {
+  auto ifaces = ParseInterfaces(gloo_iface);
+  int num_stripes = std::max(
+      GetIntEnvOrDefault(HOROVOD_GLOO_NUM_STRIPES, (int)ifaces.size()), 1);
+  std::vector<std::shared_ptr<gloo::transport::Device>> devs;
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    devs.push_back(CreateDevice(ifaces[stripe % ifaces.size()]));
+  }
+  return devs;
+}
+
 #if HAVE_MPI
 void GlooContext::InitializeFromMPI(MPIContext& mpi_ctx,
                                     const std::string& gloo_iface) {
@@ -82,12 +343,8 @@ void GlooContext::InitializeFromMPI(MPIContext& mpi_ctx,
     return;
   }
 
-  // TODO(sihan): Add support for multiple interfaces:
-  //  https://github.com/facebookincubator/gloo/issues/190
-  gloo::transport::tcp::attr attr;
-  attr.iface = gloo_iface;
-  attr.ai_family = AF_UNSPEC;
-  auto dev = gloo::transport::tcp::CreateDevice(attr);
+  auto devs = CreateDevices(gloo_iface);
+  auto& dev = devs[0];
   auto timeout = GetTimeoutFromEnv();
 
   auto context =
@@ -96,6 +353,18 @@ void GlooContext::InitializeFromMPI(MPIContext& mpi_ctx,
   context->connectFullMesh(dev);
   ctx = context;
 
+  stripe_ctxs = {ctx};
+  for (size_t stripe = 1; stripe < devs.size(); ++stripe) {
+    auto stripe_context = std::make_shared<gloo::mpi::Context>(
+        mpi_ctx.GetMPICommunicator(GLOBAL));
+    stripe_context->setTimeout(timeout);
+    stripe_context->connectFullMesh(devs[stripe]);
+    stripe_ctxs.push_back(stripe_context);
+  }
+  stripe_threshold = GetIntEnvOrDefault(HOROVOD_GLOO_STRIPE_THRESHOLD,
+                                        DEFAULT_STRIPE_THRESHOLD);
+  stripe_workers.Start((int)stripe_ctxs.size());
+
   auto cross_context =
       std::make_shared<gloo::mpi::Context>(mpi_ctx.GetMPICommunicator(CROSS));
   cross_context->setTimeout(timeout);
@@ -115,14 +384,9 @@ void GlooContext::Initialize(const std::string& gloo_iface) {
     return;
   }
 
-  // Create a tcp device for communication
-  // TODO(sihan): Add support for multiple interfaces:
-  //  https://github.com/facebookincubator/gloo/issues/190
-  gloo::transport::tcp::attr attr;
-  attr.iface = gloo_iface;
-
-  attr.ai_family = AF_UNSPEC;
-  auto dev = gloo::transport::tcp::CreateDevice(attr);
+  // Create tcp devices for communication
+  auto devs = CreateDevices(gloo_iface);
+  auto& dev = devs[0];
   auto timeout = GetTimeoutFromEnv();
 
   int rank = GetIntEnvOrDefault(HOROVOD_RANK, 0);
@@ -140,11 +404,26 @@ void GlooContext::Initialize(const std::string& gloo_iface) {
     LOG(DEBUG) << "no rendezvous server provided, assuming single process execution";
   }
 
+  // The global store is finalized once process sets have been set up as
+  // well, so that the rendezvous server keeps running for them.
   ctx = Rendezvous(HOROVOD_GLOO_GLOBAL_PREFIX,
                    rendezvous_addr_env, rendezvous_port,
-                   rank, size, dev, timeout);
+                   rank, size, dev, timeout, &global_store_);
   LOG(DEBUG) << "Global Gloo context initialized.";
 
+  stripe_ctxs = {ctx};
+  for (size_t stripe = 1; stripe < devs.size(); ++stripe) {
+    stripe_ctxs.push_back(Rendezvous(
+        HOROVOD_GLOO_STRIPE_PREFIX + std::to_string(stripe) + "_",
+        rendezvous_addr_env, rendezvous_port, rank, size, devs[stripe],
+        timeout));
+  }
+  stripe_threshold = GetIntEnvOrDefault(HOROVOD_GLOO_STRIPE_THRESHOLD,
+                                        DEFAULT_STRIPE_THRESHOLD);
+  stripe_workers.Start((int)stripe_ctxs.size());
+  LOG(DEBUG) << "Gloo contexts of " << stripe_ctxs.size()
+             << " stripes initialized.";
+
   local_ctx = Rendezvous(HOROVOD_GLOO_LOCAL_PREFIX + std::to_string(cross_rank),
                          rendezvous_addr_env, rendezvous_port,
                          local_rank, local_size, dev, timeout);
@@ -156,11 +435,110 @@ void GlooContext::Initialize(const std::string& gloo_iface) {
   LOG(DEBUG) << "Cross-node Gloo context initialized.";
 }
 
+void GlooContext::InitializeForProcessSet(const std::string& gloo_iface,
+                                          int32_t process_set_id,
+                                          const std::vector<int>& ranks) {
+  if (!enabled_) {
+    return;
+  }
+
+  // Process sets are not striped and only use the first interface.
+  auto dev = CreateDevice(ParseInterfaces(gloo_iface)[0]);
+  auto timeout = GetTimeoutFromEnv();
+
+  int global_rank = GetIntEnvOrDefault(HOROVOD_RANK, 0);
+  int global_cross_rank = GetIntEnvOrDefault(HOROVOD_CROSS_RANK, 0);
+  int rank = (int)(std::lower_bound(ranks.begin(), ranks.end(), global_rank) -
+                   ranks.begin());
+  int size = (int)ranks.size();
+
+  auto rendezvous_addr_env = std::getenv(HOROVOD_GLOO_RENDEZVOUS_ADDR);
+  auto rendezvous_port = GetIntEnvOrDefault(HOROVOD_GLOO_RENDEZVOUS_PORT, -1);
+  auto prefix =
+      HOROVOD_GLOO_PROCESS_SET_PREFIX + std::to_string(process_set_id) + "_";
+
+  ctx = Rendezvous(prefix + HOROVOD_GLOO_GLOBAL_PREFIX, rendezvous_addr_env,
+                   rendezvous_port, rank, size, dev, timeout);
+  stripe_ctxs = {ctx};
+
+  // Members running on the same node, identified by their cross rank in the
+  // global context, form the local contexts.
+  std::vector<int> cross_ranks(size);
+  {
+    gloo::AllgatherOptions opts(ctx);
+    opts.setInput(&global_cross_rank, 1);
+    opts.setOutput(cross_ranks.data(), size);
+    gloo::allgather(opts);
+  }
+  int local_rank = 0;
+  int local_size = 0;
+  for (int i = 0; i < size; ++i) {
+    if (cross_ranks[i] == global_cross_rank) {
+      if (i < rank) {
+        ++local_rank;
+      }
+      ++local_size;
+    }
+  }
+
+  // Members with the same local rank form the cross contexts. Nodes are
+  // ordered by their global cross rank.
+  std::vector<int> node_cross_ranks(cross_ranks);
+  std::sort(node_cross_ranks.begin(), node_cross_ranks.end());
+  node_cross_ranks.erase(
+      std::unique(node_cross_ranks.begin(), node_cross_ranks.end()),
+      node_cross_ranks.end());
+  int cross_rank = 0;
+  int cross_size = 0;
+  for (auto node_cross_rank : node_cross_ranks) {
+    int node_size = (int)std::count(cross_ranks.begin(), cross_ranks.end(),
+                                    node_cross_rank);
+    if (node_size > local_rank) {
+      if (node_cross_rank < global_cross_rank) {
+        ++cross_rank;
+      }
+      ++cross_size;
+    }
+  }
+
+  local_ctx = Rendezvous(
+      prefix + HOROVOD_GLOO_LOCAL_PREFIX + std::to_string(global_cross_rank),
+      rendezvous_addr_env, rendezvous_port, local_rank, local_size, dev,
+      timeout);
+
+  cross_ctx = Rendezvous(
+      prefix + HOROVOD_GLOO_CROSS_PREFIX + std::to_string(local_rank),
+      rendezvous_addr_env, rendezvous_port, cross_rank, cross_size, dev,
+      timeout);
+  LOG(DEBUG) << "Gloo contexts of process set " << process_set_id
+             << " initialized.";
+}
+
+void GlooContext::FinalizeRendezvous() {
+  if (global_store_ != nullptr) {
+    global_store_->Finalize();
+    global_store_.reset();
+  }
+}
+
 void GlooContext::Finalize() {
   if (!enabled_) {
     return;
   }
 
+  FinalizeRendezvous();
+  stripe_workers.Stop();
+  for (auto& context : stripe_ctxs) {
+    FinalizeStore(context);
+  }
+  FinalizeStore(ctx);
+  FinalizeStore(local_ctx);
+  FinalizeStore(cross_ctx);
+  persistent_allreduces.Clear();
+  persistent_allgathers.Clear();
+  persistent_broadcasts.Clear();
+  algorithms.clear();
+  stripe_ctxs.clear();
   ctx.reset();
   cross_ctx.reset();
   local_ctx.reset();
@@ -16,10 +16,22 @@
 #ifndef HOROVOD_GLOO_CONTEXT_H
 #define HOROVOD_GLOO_CONTEXT_H
 
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "gloo/algorithm.h"
 #include "gloo/context.h"
+#include "gloo/transport/device.h"
 
 #include "../common.h"
 #include "../logging.h"
+#include "../ops/persistent_collectives.h"
+#include "gloo_store.h"
 
 #if HAVE_MPI
 #include "../mpi/mpi_context.h"
@@ -28,6 +40,88 @@
 namespace horovod {
 namespace common {
 
+class IGlooAlgorithms;
+
+// Algorithm instances bound to the buffers of one collective.
+struct GlooPersistentAlgorithms {
+  std::vector<std::unique_ptr<gloo::Algorithm>> algorithms;
+};
+
+// Context connected only to the peers at a distance of a power of two around
+// the ring, enabled by HOROVOD_GLOO_PARTIAL_MESH. These are all the peers
+// that ring algorithms, binomial tree broadcasts, dissemination barriers and
+// halving-doubling on a power of two ranks talk to, so every rank opens
+// O(log N) instead of N-1 connections. Collectives talking to other peers
+// connect the full mesh on first use, which keeps the store open until
+// FinalizeStore().
+class PartialMeshContext : public gloo::Context {
+public:
+  PartialMeshContext(int rank, int size, std::unique_ptr<GlooStore> store);
+
+  void ConnectPartialMesh(std::shared_ptr<gloo::transport::Device>& dev);
+
+  // Connects the remaining peers unless done before. Must be called on all
+  // ranks of the context at the same point.
+  void ConnectFullMesh();
+
+  // Tells the rendezvous server that this rank is done with the store.
+  void FinalizeStore();
+
+  // Peers of the partial mesh in increasing order.
+  static std::vector<int> Peers(int rank, int size);
+
+private:
+  // Connects the pairs of every rank to the peers of peers_of(rank), which
+  // must be symmetric and increasing. Addresses are exchanged under keys
+  // starting with the given prefix.
+  void ConnectPeers(const std::string& key_prefix,
+                    const std::function<std::vector<int>(int)>& peers_of);
+
+  std::unique_ptr<GlooStore> store_;
+  bool full_mesh_ = false;
+};
+
+// Connects the full mesh of partial mesh contexts, does nothing for others.
+void ConnectFullMesh(gloo::Context& context);
+
+// Threads running the stripes beyond the first one of striped collectives,
+// started along with the stripe contexts and kept until they are finalized.
+class StripeWorkers {
+public:
+  StripeWorkers() = default;
+  StripeWorkers(const StripeWorkers&) = delete;
+  ~StripeWorkers();
+
+  // Starts a thread for every stripe but the first one.
+  void Start(int num_stripes);
+
+  // Joins the threads. Must not be called while Run() is in progress.
+  void Stop();
+
+  // Runs fn for the given number of stripes in parallel, the first one on the
+  // calling thread, and rethrows the first error. Runs only the first stripe
+  // or all stripes that were started.
+  void Run(int num_stripes, const std::function<void(int)>& fn);
+
+private:
+  // Runs the given stripe of every run after last_run until stopped.
+  void WorkerLoop(int stripe, uint64_t last_run);
+
+  std::vector<std::thread> threads_;
+
+  std::mutex mutex_;
+  std::condition_variable work_cond_;
+  std::condition_variable done_cond_;
+
+  // Function of the current run, which workers start when the run count
+  // changes.
+  const std::function<void(int)>* fn_ = nullptr;
+  uint64_t run_count_ = 0;
+  int pending_ = 0;
+  std::vector<std::exception_ptr> errors_;
+  bool shut_down_ = false;
+};
+
 struct GlooContext {
 
 #if HAVE_MPI
@@ -36,6 +130,18 @@ struct GlooContext {
 
   void Initialize(const std::string& gloo_iface);
 
+  // Sets up the contexts of a process set made of the given Horovod ranks,
+  // in increasing order, through the rendezvous server. Must only be called
+  // on the ranks of the process set, before FinalizeRendezvous() is called on
+  // the global context.
+  void InitializeForProcessSet(const std::string& gloo_iface,
+                               int32_t process_set_id,
+                               const std::vector<int>& ranks);
+
+  // Tells the rendezvous server that this rank has set up all of its
+  // contexts. The server shuts down once all ranks did.
+  void FinalizeRendezvous();
+
   void Finalize();
 
   std::shared_ptr<gloo::Context> GetGlooContext(Communicator communicator);
@@ -52,9 +158,31 @@ struct GlooContext {
   std::shared_ptr<gloo::Context> cross_ctx = nullptr;
   std::shared_ptr<gloo::Context> local_ctx = nullptr;
 
+  // Global contexts over connections of their own, starting with ctx, one
+  // per stripe set up by HOROVOD_GLOO_NUM_STRIPES, on the interfaces listed
+  // in HOROVOD_GLOO_IFACE. Allreduces of at least stripe_threshold bytes are
+  // split across them and run in parallel.
+  static constexpr int DEFAULT_STRIPE_THRESHOLD = 1024 * 1024;
+  std::vector<std::shared_ptr<gloo::Context>> stripe_ctxs;
+  int64_t stripe_threshold = DEFAULT_STRIPE_THRESHOLD;
+  StripeWorkers stripe_workers;
+
+  // Algorithms of every Gloo context and data type, created on first use.
+  std::map<std::pair<gloo::Context*, DataType>,
+           std::shared_ptr<IGlooAlgorithms>>
+      algorithms;
+
+  // Collectives of recurring fused responses.
+  PersistentCollectives<GlooPersistentAlgorithms> persistent_allreduces;
+  PersistentCollectives<GlooPersistentAlgorithms> persistent_allgathers;
+  PersistentCollectives<GlooPersistentAlgorithms> persistent_broadcasts;
+
 private:
   // Flag indicating whether gloo is enabled.
   bool enabled_ = false;
+
+  // Store of the global rendezvous, kept until FinalizeRendezvous().
+  std::unique_ptr<GlooStore> global_store_;
 };
 
 } // namespace common
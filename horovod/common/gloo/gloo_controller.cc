@@ -39,6 +39,13 @@ void GlooController::Initialize() {
     LOG(DEBUG) << "Started Horovod with " << size_ << " processes";
   }
 
+  // Get cross-node rank and size in case of hierarchical allreduce. The
+  // cross size is needed below to collect the local sizes of all nodes.
+  if (gloo_context_.cross_ctx != nullptr) {
+    cross_rank_ = gloo_context_.cross_ctx->rank;
+    cross_size_ = gloo_context_.cross_ctx->size;
+  }
+
   // Determine local rank by if local context is presented.
   if (gloo_context_.local_ctx != nullptr) {
     local_rank_ = gloo_context_.local_ctx->rank;
@@ -82,12 +89,6 @@ void GlooController::Initialize() {
     }
   }
 
-  // Get cross-node rank and size in case of hierarchical allreduce.
-  if (gloo_context_.cross_ctx != nullptr) {
-    cross_rank_ = gloo_context_.cross_ctx->rank;
-    cross_size_ = gloo_context_.cross_ctx->size;
-  }
-
   LOG(DEBUG) << "Gloo controller initialized.";
 }
 
@@ -15,6 +15,7 @@
 
 #include "http_store.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <istream>
@@ -32,10 +33,15 @@ namespace common {
 void HTTPStore::Finalize() { HTTP_DELETE(std::to_string(rank_)); }
 
 void HTTPStore::set(const std::string& key, const std::vector<char>& data) {
+  cache_.erase(key);
   HTTP_PUT(key, data);
 }
 
 std::vector<char> HTTPStore::get(const std::string& key) {
+  auto cached = cache_.find(key);
+  if (cached != cache_.end()) {
+    return cached->second;
+  }
   std::vector<char> result;
   HTTP_GET(key, result);
   return result;
@@ -45,26 +51,25 @@ void HTTPStore::wait(const std::vector<std::string>& keys,
                      const std::chrono::milliseconds& timeout) {
   const auto start = std::chrono::steady_clock::now();
 
-  while (!CheckKeys(keys)) {
-    const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+  // Each round is a single long-poll request for all missing keys, which the
+  // server answers as soon as they all exist.
+  int64_t wait_ms = LONG_POLL_WAITING_TIME_MILLSEC;
+  while (!HTTP_MULTI_GET(keys, wait_ms)) {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now() - start);
-    if (timeout != gloo::kNoTimeout && elapsed > timeout) {
-      GLOO_THROW_IO_EXCEPTION(GLOO_ERROR_MSG("Wait timeout for key(s): ",
-                                             ::gloo::MakeString(keys)));
+    if (timeout != gloo::kNoTimeout) {
+      if (elapsed >= timeout) {
+        GLOO_THROW_IO_EXCEPTION(GLOO_ERROR_MSG("Wait timeout for key(s): ",
+                                               ::gloo::MakeString(keys)));
+      }
+      wait_ms = std::min<int64_t>(LONG_POLL_WAITING_TIME_MILLSEC,
+                                  (timeout - elapsed).count());
     }
-    /* sleep override */
-    std::this_thread::sleep_for(std::chrono::milliseconds(10));
   }
 }
 
 bool HTTPStore::CheckKeys(const std::vector<std::string>& keys) {
-  std::vector<char> result;
-  for (const auto& key : keys) {
-    if (!HTTP_GET(key, result)) {
-      return false;
-    }
-  }
-  return true;
+  return HTTP_MULTI_GET(keys, 0);
 }
 
 // Perform http request to rendezvous server with retry logic
@@ -123,6 +128,56 @@ void HTTPStore::HTTP_PUT(const std::string& key,
   PerformHTTP(request, HTTP_PUT_METHOD, body);
 }
 
+bool HTTPStore::HTTP_MULTI_GET(const std::vector<std::string>& keys,
+                               int64_t wait_ms) {
+  std::string body;
+  for (const auto& key : keys) {
+    if (cache_.find(key) == cache_.end()) {
+      body += key + "\n";
+    }
+  }
+  if (body.empty()) {
+    return true;
+  }
+
+  std::string url = url_prefix_ + "?wait_ms=" + std::to_string(wait_ms);
+  LOG(TRACE) << "Send POST request to " << url;
+  http::Request request(url);
+
+  http::Response response = PerformHTTP(request, HTTP_POST_METHOD, body);
+  if (response.status != HTTP_OK) {
+    return false;
+  }
+
+  // The response holds a "<key>\n<length>\n<value>" record for every key
+  // found.
+  auto& data = response.body;
+  auto it = data.begin();
+  while (it != data.end()) {
+    auto key_end = std::find(it, data.end(), '\n');
+    auto length_end = key_end == data.end()
+                          ? data.end()
+                          : std::find(key_end + 1, data.end(), '\n');
+    if (length_end == data.end()) {
+      throw std::runtime_error("Malformed HTTP response from " + url + ".");
+    }
+    std::string key(it, key_end);
+    size_t length = std::stoull(std::string(key_end + 1, length_end));
+    if (static_cast<size_t>(data.end() - length_end - 1) < length) {
+      throw std::runtime_error("Malformed HTTP response from " + url + ".");
+    }
+    cache_[key].assign(length_end + 1, length_end + 1 + length);
+    it = length_end + 1 + length;
+  }
+
+  for (const auto& key : keys) {
+    if (cache_.find(key) == cache_.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void HTTPStore::HTTP_DELETE(const std::string& key) {
   std::string url = url_prefix_ + key;
   LOG(TRACE) << "Send GET request to " << url;
@@ -16,6 +16,8 @@
 #ifndef HOROVOD_GLOO_HTTP_STORE_H
 #define HOROVOD_GLOO_HTTP_STORE_H
 
+#include <unordered_map>
+
 #include "HTTPRequest.hpp"
 
 #include "gloo_store.h"
@@ -28,6 +30,8 @@ namespace common {
 #define HTTP_GET_METHOD "GET"
 #define HTTP_PUT_METHOD "PUT"
 #define HTTP_DELETE_METHOD "DELETE"
+#define HTTP_POST_METHOD "POST"
+#define LONG_POLL_WAITING_TIME_MILLSEC 5000
 #define HTTP_OK 200
 #define HTTP_NOT_FOUND 404
 
@@ -51,6 +55,8 @@ public:
   void wait(const std::vector<std::string>& keys,
             const std::chrono::milliseconds& timeout) override;
 
+  // Fetches all the keys in one request, without waiting for them. Returns
+  // whether all of them exist.
   bool CheckKeys(const std::vector<std::string>& keys);
 
   void Finalize() override;
@@ -70,12 +76,22 @@ protected:
   // the PUT body.
   void HTTP_PUT(const std::string& key, const std::vector<char>& data);
 
+  // HTTP POST: fetch the values of all keys with one request. The server
+  // holds the request for up to wait_ms milliseconds until all the keys
+  // exist. Values found are added to the cache; return a bool representing
+  // whether all keys are cached.
+  bool HTTP_MULTI_GET(const std::vector<std::string>& keys, int64_t wait_ms);
+
   // HTTP DELETE: send HTTP DELETE request to server, informing the server that
   // this rank has finished.
   void HTTP_DELETE(const std::string& key);
 
   std::string url_prefix_;
   int rank_;
+
+  // Values fetched by HTTP_MULTI_GET, so that the get which follows a wait
+  // needs no further request. Rendezvous keys are written only once.
+  std::unordered_map<std::string, std::vector<char>> cache_;
 };
 
 } // namespace common
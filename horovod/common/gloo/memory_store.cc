@@ -16,49 +16,66 @@
 #include "memory_store.h"
 
 #include <chrono>
-#include <thread>
 
 #include "gloo/common/error.h"
 
 namespace horovod {
 namespace common {
 
+MemoryStore::MemoryStore(const std::string& scope) {
+  // Scopes live as long as any of their stores.
+  static std::mutex scopes_mutex;
+  static std::unordered_map<std::string, std::weak_ptr<Scope>> scopes;
+
+  std::lock_guard<std::mutex> guard(scopes_mutex);
+  scope_ = scopes[scope].lock();
+  if (scope_ == nullptr) {
+    scope_ = std::make_shared<Scope>();
+    scopes[scope] = scope_;
+  }
+}
+
 void MemoryStore::set(const std::string& key, const std::vector<char>& data) {
-  map_[key] = data;
+  {
+    std::lock_guard<std::mutex> guard(scope_->mutex);
+    scope_->map[key] = data;
+  }
+  scope_->cond.notify_all();
 }
 
 std::vector<char> MemoryStore::get(const std::string& key) {
-  return map_[key];
+  wait({key}, Store::kDefaultTimeout);
+  std::lock_guard<std::mutex> guard(scope_->mutex);
+  return scope_->map[key];
 }
 
 void MemoryStore::wait(const std::vector<std::string>& keys) {
-  for (auto& key : keys) {
-    while (map_.find(key) == map_.end()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-  }
+  wait(keys, gloo::kNoTimeout);
 }
 
 void MemoryStore::wait(const std::vector<std::string>& keys,
                        const std::chrono::milliseconds& timeout) {
-  const auto start = std::chrono::steady_clock::now();
-  for (auto& key : keys) {
-    while (map_.find(key) == map_.end()) {
-      auto now = std::chrono::steady_clock::now();
-      const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - start);
-      if (timeout != gloo::kNoTimeout && elapsed > timeout) {
-        GLOO_THROW_IO_EXCEPTION(GLOO_ERROR_MSG("Wait timeout for key(s): ",
-                                               ::gloo::MakeString(keys)));
+  auto has_keys = [this, &keys]() {
+    for (auto& key : keys) {
+      if (scope_->map.find(key) == scope_->map.end()) {
+        return false;
       }
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
+    return true;
+  };
+
+  std::unique_lock<std::mutex> lock(scope_->mutex);
+  if (timeout == gloo::kNoTimeout) {
+    scope_->cond.wait(lock, has_keys);
+  } else if (!scope_->cond.wait_for(lock, timeout, has_keys)) {
+    GLOO_THROW_IO_EXCEPTION(GLOO_ERROR_MSG("Wait timeout for key(s): ",
+                                           ::gloo::MakeString(keys)));
   }
 }
 
 void MemoryStore::Finalize() {
-  map_.clear();
+  scope_.reset();
 }
 
 } // namespace common
 } // namespace horovod
-
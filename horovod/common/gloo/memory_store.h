@@ -16,6 +16,9 @@
 #ifndef HOROVOD_GLOO_MEMORY_STORE_H
 #define HOROVOD_GLOO_MEMORY_STORE_H
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -25,12 +28,19 @@
 namespace horovod {
 namespace common {
 
+// Store kept in memory, for rendezvous without a server. Stores of the same
+// scope share their keys within the process, so that contexts of several
+// ranks can also rendezvous from threads of one process. Waiting threads wake
+// up as soon as the keys are set. A store must not be used after Finalize().
 class MemoryStore : public GlooStore {
 public:
+  explicit MemoryStore(const std::string& scope = "");
+
   virtual ~MemoryStore()=default;
 
   void set(const std::string& key, const std::vector<char>& data) override;
 
+  // Waits for the key up to the default timeout.
   std::vector<char> get(const std::string& key) override;
 
   void wait(const std::vector<std::string>& keys) override;
@@ -38,10 +48,17 @@ public:
   void wait(const std::vector<std::string>& keys,
             const std::chrono::milliseconds& timeout) override;
 
+  // Releases the keys of the scope once all of its stores are finalized.
   void Finalize() override;
 
 private:
-  std::unordered_map<std::string, std::vector<char>> map_;
+  struct Scope {
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::unordered_map<std::string, std::vector<char>> map;
+  };
+
+  std::shared_ptr<Scope> scope_;
 };
 
 } // namespace common
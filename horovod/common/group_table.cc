@@ -0,0 +1,93 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#include "group_table.h"
+
+#include <assert.h>
+
+namespace horovod {
+namespace common {
+
+int32_t GroupTable::GetGroupIDFromTensorName(
+    const std::string& tensor_name) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = tensor_name_to_id_.find(tensor_name);
+  if (it == tensor_name_to_id_.end()) {
+    return NULL_GROUP_ID;
+  }
+  return it->second;
+}
+
+std::vector<std::string>
+GroupTable::GetGroupTensorNames(int32_t group_id) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return id_to_tensor_names_.at(group_id);
+}
+
+bool GroupTable::empty() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return tensor_name_to_id_.empty();
+}
+
+int32_t GroupTable::RegisterGroup(std::vector<std::string>&& tensor_names) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  int32_t group_id = next_group_id_++;
+  for (auto& name : tensor_names) {
+    tensor_name_to_id_.emplace(name, group_id);
+  }
+  pending_counts_.emplace(group_id, tensor_names.size());
+  id_to_tensor_names_.emplace(group_id, std::move(tensor_names));
+  return group_id;
+}
+
+void GroupTable::DeregisterGroups(
+    const std::vector<std::string>& tensor_names) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto& name : tensor_names) {
+    auto it = tensor_name_to_id_.find(name);
+    if (it == tensor_name_to_id_.end()) {
+      continue;
+    }
+    int32_t group_id = it->second;
+    tensor_name_to_id_.erase(it);
+
+    auto count_it = pending_counts_.find(group_id);
+    assert(count_it != pending_counts_.end());
+    if (--count_it->second == 0) {
+      pending_counts_.erase(count_it);
+      id_to_tensor_names_.erase(group_id);
+    }
+  }
+}
+
+void GroupTable::DeregisterGroup(int32_t group_id) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = id_to_tensor_names_.find(group_id);
+  if (it == id_to_tensor_names_.end()) {
+    return;
+  }
+  for (auto& name : it->second) {
+    // Names that were already taken by another group keep their mapping.
+    auto name_it = tensor_name_to_id_.find(name);
+    if (name_it != tensor_name_to_id_.end() && name_it->second == group_id) {
+      tensor_name_to_id_.erase(name_it);
+    }
+  }
+  pending_counts_.erase(group_id);
+  id_to_tensor_names_.erase(it);
+}
+
+} // namespace common
+} // namespace horovod
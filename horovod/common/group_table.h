@@ -0,0 +1,71 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#ifndef HOROVOD_GROUP_TABLE_H
+#define HOROVOD_GROUP_TABLE_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "message.h"
+
+namespace horovod {
+namespace common {
+
+// Tensors enqueued together as a group, which are negotiated as a unit and
+// fused into the same responses.
+//
+// Group IDs are handed out by a counter that is never reset, so as long as
+// all ranks register the same groups in the same order, the same group has
+// the same ID on every rank.
+class GroupTable {
+public:
+  GroupTable() = default;
+  GroupTable(const GroupTable&) = delete;
+
+  int32_t GetGroupIDFromTensorName(const std::string& tensor_name) const;
+
+  std::vector<std::string> GetGroupTensorNames(int32_t group_id) const;
+
+  bool empty() const;
+
+  // Registers the tensors as a new group and returns its ID.
+  int32_t RegisterGroup(std::vector<std::string>&& tensor_names);
+
+  // Forgets the given tensors once they have been processed. A group is
+  // removed together with its last tensor.
+  void DeregisterGroups(const std::vector<std::string>& tensor_names);
+
+  // Removes a group whose tensors could not be enqueued.
+  void DeregisterGroup(int32_t group_id);
+
+private:
+  std::unordered_map<std::string, int32_t> tensor_name_to_id_;
+  std::unordered_map<int32_t, std::vector<std::string>> id_to_tensor_names_;
+
+  // Number of tensors of every group that were not processed yet.
+  std::unordered_map<int32_t, size_t> pending_counts_;
+
+  int32_t next_group_id_ = 0;
+
+  mutable std::mutex mutex_;
+};
+
+} // namespace common
+} // namespace horovod
+
+#endif // HOROVOD_GROUP_TABLE_H
@@ -20,6 +20,15 @@
 #include <immintrin.h>
 #endif
 
+// AVX-512 code is compiled through function target attributes, so it does
+// not depend on the compiler flags and is only run on CPUs supporting it.
+#if defined(__x86_64__) && (__GNUC__ >= 5 || defined(__clang__))
+#define HOROVOD_FLOAT16_AVX512 1
+#include <immintrin.h>
+#else
+#define HOROVOD_FLOAT16_AVX512 0
+#endif
+
 namespace horovod {
 namespace common {
 
@@ -39,38 +48,207 @@ bool is_avx_and_f16c() {
 }
 #endif
 
+#if HOROVOD_FLOAT16_AVX512
+// Unlike CPUID alone, this also checks that the OS saves the AVX-512 state.
+bool is_avx512f() {
+  static bool initialized = false;
+  static bool result = false;
+  if (!initialized) {
+    __builtin_cpu_init();
+    result = __builtin_cpu_supports("avx512f");
+    initialized = true;
+  }
+  return result;
+}
+#endif
+
+namespace {
+
+enum class Float16Op { SUM, MIN, MAX, PROD };
+
+// Scalar reference of every reduction, which the vector code matches bit for
+// bit: elements are converted to float, combined and rounded to nearest even.
+template <Float16Op op> float float16_combine(float a, float b) {
+  switch (op) {
+  case Float16Op::SUM:
+    return a + b;
+  case Float16Op::MIN:
+    return a < b ? a : b;
+  case Float16Op::MAX:
+    return a > b ? a : b;
+  default:
+    return a * b;
+  }
+}
+
+#if HOROVOD_FLOAT16_AVX512
+// Combines sixteen elements at a time, returns the number of elements done.
+template <Float16Op op>
+__attribute__((target("avx512f"))) int64_t
+float16_reduce_avx512(const unsigned short* a, const unsigned short* b,
+                      unsigned short* out, int64_t len) {
+  int64_t i = 0;
+  for (; i < (len / 16) * 16; i += 16) {
+    __m512 a_m512 =
+        _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(a + i)));
+    __m512 b_m512 =
+        _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(b + i)));
+    __m512 out_m512;
+    switch (op) {
+    case Float16Op::SUM:
+      out_m512 = _mm512_add_ps(a_m512, b_m512);
+      break;
+    case Float16Op::MIN:
+      out_m512 = _mm512_min_ps(a_m512, b_m512);
+      break;
+    case Float16Op::MAX:
+      out_m512 = _mm512_max_ps(a_m512, b_m512);
+      break;
+    default:
+      out_m512 = _mm512_mul_ps(a_m512, b_m512);
+      break;
+    }
+    _mm256_storeu_si256((__m256i*)(out + i),
+                        _mm512_cvtps_ph(out_m512, _MM_FROUND_TO_NEAREST_INT));
+  }
+  return i;
+}
+#endif
+
+#if __AVX__ && __F16C__
+// Combines eight elements at a time, returns the number of elements done.
+template <Float16Op op>
+int64_t float16_reduce_avx(const unsigned short* a, const unsigned short* b,
+                           unsigned short* out, int64_t len) {
+  int64_t i = 0;
+  for (; i < (len / 8) * 8; i += 8) {
+    __m256 a_m256 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(a + i)));
+    __m256 b_m256 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(b + i)));
+    __m256 out_m256;
+    switch (op) {
+    case Float16Op::SUM:
+      out_m256 = _mm256_add_ps(a_m256, b_m256);
+      break;
+    case Float16Op::MIN:
+      out_m256 = _mm256_min_ps(a_m256, b_m256);
+      break;
+    case Float16Op::MAX:
+      out_m256 = _mm256_max_ps(a_m256, b_m256);
+      break;
+    default:
+      out_m256 = _mm256_mul_ps(a_m256, b_m256);
+      break;
+    }
+    _mm_storeu_si128((__m128i*)(out + i),
+                     _mm256_cvtps_ph(out_m256, _MM_FROUND_TO_NEAREST_INT));
+  }
+  return i;
+}
+#endif
+
+// Combines the float16 elements of a and b into out, which may alias either,
+// with the widest instructions the CPU supports.
+template <Float16Op op>
+void float16_reduce(const void* avec, const void* bvec, void* outvec,
+                    int64_t len) {
+  auto* a = (const unsigned short*)avec;
+  auto* b = (const unsigned short*)bvec;
+  auto* out = (unsigned short*)outvec;
+
+  int64_t i = 0;
+#if HOROVOD_FLOAT16_AVX512
+  if (is_avx512f()) {
+    i = float16_reduce_avx512<op>(a, b, out, len);
+  }
+#endif
+#if __AVX__ && __F16C__
+  if (is_avx_and_f16c()) {
+    i += float16_reduce_avx<op>(a + i, b + i, out + i, len - i);
+  }
+#endif
+  for (; i < len; ++i) {
+    unsigned short a_bits = a[i];
+    unsigned short b_bits = b[i];
+    float a_float;
+    float b_float;
+    HalfBits2Float(&a_bits, &a_float);
+    HalfBits2Float(&b_bits, &b_float);
+    float out_float = float16_combine<op>(a_float, b_float);
+    Float2HalfBits(&out_float, out + i);
+  }
+}
+
+} // namespace
+
+#if HAVE_MPI
 // float16 custom data type summation operation.
 void float16_sum(void* invec, void* inoutvec, int* len,
                  MPI_Datatype* datatype) {
-  // cast invec and inoutvec to your float16 type
-  auto* in = (unsigned short*)invec;
-  auto* inout = (unsigned short*)inoutvec;
+  float16_reduce<Float16Op::SUM>(invec, inoutvec, inoutvec, *len);
+}
+
+// float16 custom data type minimum operation.
+void float16_min(void* invec, void* inoutvec, int* len,
+                 MPI_Datatype* datatype) {
+  float16_reduce<Float16Op::MIN>(invec, inoutvec, inoutvec, *len);
+}
+
+// float16 custom data type maximum operation.
+void float16_max(void* invec, void* inoutvec, int* len,
+                 MPI_Datatype* datatype) {
+  float16_reduce<Float16Op::MAX>(invec, inoutvec, inoutvec, *len);
+}
+
+// float16 custom data type product operation.
+void float16_prod(void* invec, void* inoutvec, int* len,
+                  MPI_Datatype* datatype) {
+  float16_reduce<Float16Op::PROD>(invec, inoutvec, inoutvec, *len);
+}
+#endif
+
+void float16_reduce_sum(void* out, const void* a, const void* b, size_t len) {
+  float16_reduce<Float16Op::SUM>(a, b, out, (int64_t)len);
+}
+
+void float16_reduce_min(void* out, const void* a, const void* b, size_t len) {
+  float16_reduce<Float16Op::MIN>(a, b, out, (int64_t)len);
+}
+
+void float16_reduce_max(void* out, const void* a, const void* b, size_t len) {
+  float16_reduce<Float16Op::MAX>(a, b, out, (int64_t)len);
+}
+
+void float16_reduce_prod(void* out, const void* a, const void* b,
+                         size_t len) {
+  float16_reduce<Float16Op::PROD>(a, b, out, (int64_t)len);
+}
+
+// Multiplies float16 elements by factor, eight at a time when AVX and F16C
+// are available. outvec may alias invec.
+void float16_scale(const void* invec, void* outvec, int64_t len,
+                   float factor) {
+  auto* in = (const unsigned short*)invec;
+  auto* out = (unsigned short*)outvec;
 
-  int i = 0;
+  int64_t i = 0;
 #if __AVX__ && __F16C__
   if (is_avx_and_f16c()) {
-    for (; i < (*len / 8) * 8; i += 8) {
-      // convert in & inout to m256
-      __m256 in_m256 = _mm256_cvtph_ps(_mm_loadu_si128((__m128i*)(in + i)));
-      __m256 inout_m256 =
-          _mm256_cvtph_ps(_mm_loadu_si128((__m128i*)(inout + i)));
-
-      // add them together to new_inout_m256
-      __m256 new_inout_m256 = _mm256_add_ps(in_m256, inout_m256);
-
-      // convert back and store in inout
-      __m128i new_inout_m128i = _mm256_cvtps_ph(new_inout_m256, 0);
-      _mm_storeu_si128((__m128i*)(inout + i), new_inout_m128i);
+    __m256 factor_m256 = _mm256_set1_ps(factor);
+    for (; i < (len / 8) * 8; i += 8) {
+      __m256 in_m256 =
+          _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(in + i)));
+      __m128i out_m128i =
+          _mm256_cvtps_ph(_mm256_mul_ps(in_m256, factor_m256), 0);
+      _mm_storeu_si128((__m128i*)(out + i), out_m128i);
     }
   }
 #endif
-  for (; i < *len; ++i) {
-    float in_float;
-    float inout_float;
-    HalfBits2Float(in + i, &in_float);
-    HalfBits2Float(inout + i, &inout_float);
-    inout_float += in_float;
-    Float2HalfBits(&inout_float, inout + i);
+  for (; i < len; ++i) {
+    unsigned short in_bits = in[i];
+    float value;
+    HalfBits2Float(&in_bits, &value);
+    value *= factor;
+    Float2HalfBits(&value, out + i);
   }
 }
 
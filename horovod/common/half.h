@@ -26,10 +26,13 @@
 #ifndef HOROVOD_HALF_H
 #define HOROVOD_HALF_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#if HAVE_MPI
 #define OMPI_SKIP_MPICXX
 #include "mpi.h"
+#endif
 
 namespace horovod {
 namespace common {
@@ -132,8 +135,30 @@ inline void Float2HalfBits(float* src, unsigned short* dest) {
   *dest = u;
 }
 
+#if HAVE_MPI
 void float16_sum(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
 
+void float16_min(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
+
+void float16_max(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
+
+void float16_prod(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
+#endif
+
+// Element-wise reductions of len float16 elements, out = a op b, with the
+// signature of the reduction functions of Gloo. out may alias a or b. They
+// use AVX-512, or AVX and F16C, when the CPU supports them and give the same
+// bits as the scalar conversion functions above.
+void float16_reduce_sum(void* out, const void* a, const void* b, size_t len);
+
+void float16_reduce_min(void* out, const void* a, const void* b, size_t len);
+
+void float16_reduce_max(void* out, const void* a, const void* b, size_t len);
+
+void float16_reduce_prod(void* out, const void* a, const void* b, size_t len);
+
+void float16_scale(const void* invec, void* outvec, int64_t len, float factor);
+
 } // namespace common
 } // namespace horovod
 
@@ -62,6 +62,32 @@ const std::string& DataType_Name(DataType value) {
   }
 }
 
+const std::string& ReduceOp_Name(ReduceOp value) {
+  switch (value) {
+    case ReduceOp::AVERAGE:
+      static const std::string average("AVERAGE");
+      return average;
+    case ReduceOp::SUM:
+      static const std::string sum("SUM");
+      return sum;
+    case ReduceOp::ADASUM:
+      static const std::string adasum("ADASUM");
+      return adasum;
+    case ReduceOp::MIN:
+      static const std::string min("MIN");
+      return min;
+    case ReduceOp::MAX:
+      static const std::string max("MAX");
+      return max;
+    case ReduceOp::PRODUCT:
+      static const std::string product("PRODUCT");
+      return product;
+    default:
+      static const std::string unknown("<unknown>");
+      return unknown;
+  }
+}
+
 const std::string& Request::RequestType_Name(RequestType value) {
   switch (value) {
     case RequestType::ALLREDUCE:
@@ -79,6 +105,24 @@ const std::string& Request::RequestType_Name(RequestType value) {
     case RequestType::ADASUM:
       static const std::string adasum("ADASUM");
       return adasum;
+    case RequestType::REDUCESCATTER:
+      static const std::string reducescatter("REDUCESCATTER");
+      return reducescatter;
+    case RequestType::ALLTOALL:
+      static const std::string alltoall("ALLTOALL");
+      return alltoall;
+    case RequestType::SPARSE_ALLREDUCE:
+      static const std::string sparse_allreduce("SPARSE_ALLREDUCE");
+      return sparse_allreduce;
+    case RequestType::REDUCE:
+      static const std::string reduce("REDUCE");
+      return reduce;
+    case RequestType::GATHER:
+      static const std::string gather("GATHER");
+      return gather;
+    case RequestType::SCATTER:
+      static const std::string scatter("SCATTER");
+      return scatter;
     default:
       static const std::string unknown("<unknown>");
       return unknown;
@@ -125,6 +169,28 @@ void Request::add_tensor_shape(int64_t value) {
   tensor_shape_.push_back(value);
 }
 
+const std::vector<int64_t>& Request::splits() const { return splits_; }
+
+void Request::set_splits(const std::vector<int64_t>& value) {
+  splits_ = value;
+}
+
+ReduceOp Request::reduce_op() const { return reduce_op_; }
+
+void Request::set_reduce_op(ReduceOp value) { reduce_op_ = value; }
+
+double Request::prescale_factor() const { return prescale_factor_; }
+
+void Request::set_prescale_factor(double value) { prescale_factor_ = value; }
+
+double Request::postscale_factor() const { return postscale_factor_; }
+
+void Request::set_postscale_factor(double value) { postscale_factor_ = value; }
+
+int32_t Request::group_id() const { return group_id_; }
+
+void Request::set_group_id(int32_t value) { group_id_ = value; }
+
 namespace {
 
 void Request_ParseFromWire(Request& request,
@@ -137,6 +203,12 @@ void Request_ParseFromWire(Request& request,
   request.set_device(obj->device());
   request.set_tensor_shape(std::vector<int64_t>(obj->tensor_shape()->begin(),
                                                 obj->tensor_shape()->end()));
+  request.set_splits(std::vector<int64_t>(obj->splits()->begin(),
+                                          obj->splits()->end()));
+  request.set_reduce_op((ReduceOp) obj->reduce_op());
+  request.set_prescale_factor(obj->prescale_factor());
+  request.set_postscale_factor(obj->postscale_factor());
+  request.set_group_id(obj->group_id());
 }
 
 void Request_SerializeToWire(const Request& request,
@@ -145,6 +217,7 @@ void Request_SerializeToWire(const Request& request,
   // FlatBuffers must be built bottom-up.
   auto tensor_name_wire = builder.CreateString(request.tensor_name());
   auto tensor_shape_wire = builder.CreateVector(request.tensor_shape());
+  auto splits_wire = builder.CreateVector(request.splits());
 
   wire::RequestBuilder request_builder(builder);
   request_builder.add_request_rank(request.request_rank());
@@ -155,6 +228,11 @@ void Request_SerializeToWire(const Request& request,
   request_builder.add_root_rank(request.root_rank());
   request_builder.add_device(request.device());
   request_builder.add_tensor_shape(tensor_shape_wire);
+  request_builder.add_splits(splits_wire);
+  request_builder.add_reduce_op(request.reduce_op());
+  request_builder.add_prescale_factor(request.prescale_factor());
+  request_builder.add_postscale_factor(request.postscale_factor());
+  request_builder.add_group_id(request.group_id());
   obj = request_builder.Finish();
 }
 
@@ -249,6 +327,24 @@ const std::string& Response::ResponseType_Name(ResponseType value) {
     case ResponseType::ADASUM:
       static const std::string adasum("ADASUM");
       return adasum;
+    case ResponseType::REDUCESCATTER:
+      static const std::string reducescatter("REDUCESCATTER");
+      return reducescatter;
+    case ResponseType::ALLTOALL:
+      static const std::string alltoall("ALLTOALL");
+      return alltoall;
+    case ResponseType::SPARSE_ALLREDUCE:
+      static const std::string sparse_allreduce("SPARSE_ALLREDUCE");
+      return sparse_allreduce;
+    case ResponseType::REDUCE:
+      static const std::string reduce("REDUCE");
+      return reduce;
+    case ResponseType::GATHER:
+      static const std::string gather("GATHER");
+      return gather;
+    case ResponseType::SCATTER:
+      static const std::string scatter("SCATTER");
+      return scatter;
     case ResponseType::ERROR:
       static const std::string error("ERROR");
       return error;
@@ -322,8 +418,22 @@ void Response::add_tensor_size(int64_t value) {
   tensor_sizes_.push_back(value);
 }
 
+ReduceOp Response::reduce_op() const { return reduce_op_; }
+
+void Response::set_reduce_op(ReduceOp value) { reduce_op_ = value; }
+
+double Response::prescale_factor() const { return prescale_factor_; }
+
+void Response::set_prescale_factor(double value) { prescale_factor_ = value; }
+
+double Response::postscale_factor() const { return postscale_factor_; }
+
+void Response::set_postscale_factor(double value) { postscale_factor_ = value; }
+
 void Response::add_allgather_response(const Response& response) {
-  assert(response_type() == Response::ResponseType::ALLGATHER);
+  assert(response_type() == Response::ResponseType::ALLGATHER ||
+         response_type() == Response::ResponseType::GATHER);
+  assert(response.response_type() == response_type());
   assert(response.tensor_names().size() == 1);
   assert(response.devices() == devices());
   add_tensor_name(response.tensor_names()[0]);
@@ -344,6 +454,9 @@ void Response_ParseFromWire(Response& response,
       std::vector<int32_t>(obj->devices()->begin(), obj->devices()->end()));
   response.set_tensor_sizes(std::vector<int64_t>(obj->tensor_sizes()->begin(),
                                                  obj->tensor_sizes()->end()));
+  response.set_reduce_op((ReduceOp) obj->reduce_op());
+  response.set_prescale_factor(obj->prescale_factor());
+  response.set_postscale_factor(obj->postscale_factor());
 }
 
 void Response::ParseFromBytes(Response& response, const uint8_t* input) {
@@ -370,6 +483,9 @@ void Response_SerializeToWire(const Response& response,
   response_builder.add_error_message(error_message_wire);
   response_builder.add_devices(devices_wire);
   response_builder.add_tensor_sizes(tensor_sizes_wire);
+  response_builder.add_reduce_op(response.reduce_op());
+  response_builder.add_prescale_factor(response.prescale_factor());
+  response_builder.add_postscale_factor(response.postscale_factor());
   obj = response_builder.Finish();
 }
 
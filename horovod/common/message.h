@@ -40,13 +40,30 @@ enum DataType {
 
 const std::string& DataType_Name(DataType value);
 
+enum ReduceOp {
+  AVERAGE = 0, // This value should never appear past framework code, as
+               // averaging is taken care of there.
+  SUM = 1,
+  ADASUM = 2,
+  MIN = 3,
+  MAX = 4,
+  PRODUCT = 5
+};
+
+const std::string& ReduceOp_Name(ReduceOp value);
+
+// Group ID of tensors that were not enqueued as part of a group.
+#define NULL_GROUP_ID (-1)
+
 // A Request is a message sent from a rank greater than zero to the
 // coordinator (rank zero), informing the coordinator of an operation that
 // the rank wants to do and the tensor that it wants to apply the operation to.
 class Request {
 public:
   enum RequestType {
-    ALLREDUCE = 0, ALLGATHER = 1, BROADCAST = 2, JOIN = 3, ADASUM = 4
+    ALLREDUCE = 0, ALLGATHER = 1, BROADCAST = 2, JOIN = 3, ADASUM = 4,
+    REDUCESCATTER = 5, ALLTOALL = 6, SPARSE_ALLREDUCE = 7, REDUCE = 8,
+    GATHER = 9, SCATTER = 10
   };
 
   static const std::string& RequestType_Name(RequestType value);
@@ -84,6 +101,32 @@ public:
 
   void add_tensor_shape(int64_t value);
 
+  // Number of first dimension rows sent to every rank by an alltoall.
+  const std::vector<int64_t>& splits() const;
+
+  void set_splits(const std::vector<int64_t>& value);
+
+  // Reduction performed by an allreduce, reducescatter or reduce.
+  ReduceOp reduce_op() const;
+
+  void set_reduce_op(ReduceOp value);
+
+  // Factors an allreduce multiplies the tensor by before and after the
+  // reduction.
+  double prescale_factor() const;
+
+  void set_prescale_factor(double value);
+
+  double postscale_factor() const;
+
+  void set_postscale_factor(double value);
+
+  // Group of tensors which are negotiated and fused together, or
+  // NULL_GROUP_ID if the tensor was enqueued on its own.
+  int32_t group_id() const;
+
+  void set_group_id(int32_t value);
+
   static void ParseFromBytes(Request& request, const uint8_t* input);
 
   static void SerializeToString(const Request& request, std::string& output);
@@ -96,6 +139,11 @@ private:
   int32_t device_ = 0;
   std::string tensor_name_;
   std::vector<int64_t> tensor_shape_;
+  std::vector<int64_t> splits_;
+  ReduceOp reduce_op_ = ReduceOp::SUM;
+  double prescale_factor_ = 1.0;
+  double postscale_factor_ = 1.0;
+  int32_t group_id_ = NULL_GROUP_ID;
 };
 
 class RequestList {
@@ -131,7 +179,9 @@ private:
 class Response {
 public:
   enum ResponseType {
-    ALLREDUCE = 0, ALLGATHER = 1, BROADCAST = 2, JOIN = 3, ADASUM = 4, ERROR = 5
+    ALLREDUCE = 0, ALLGATHER = 1, BROADCAST = 2, JOIN = 3, ADASUM = 4,
+    REDUCESCATTER = 5, ALLTOALL = 6, SPARSE_ALLREDUCE = 7, REDUCE = 8,
+    GATHER = 9, SCATTER = 10, ERROR = 11
   };
 
   static const std::string& ResponseType_Name(ResponseType value);
@@ -164,16 +214,35 @@ public:
 
   void add_device(int32_t value);
 
-  // Empty unless response_type is ALLGATHER.
-  // These tensor sizes are the dimension zero sizes of all the input matrices,
-  // indexed by the rank.
+  // Empty unless response_type is ALLGATHER, GATHER, ALLTOALL or
+  // SPARSE_ALLREDUCE. For ALLGATHER, GATHER and SPARSE_ALLREDUCE, these tensor
+  // sizes are the dimension zero sizes of all the input matrices, indexed by
+  // the rank. For ALLTOALL,
+  // these are the splits of all the ranks, the rows sent from rank i to rank
+  // j being at i * size + j.
   const std::vector<int64_t>& tensor_sizes() const;
 
   void set_tensor_sizes(const std::vector<int64_t>& value);
 
   void add_tensor_size(int64_t value);
 
-  // To fuse multiple allgather responses
+  // Reduction performed by an allreduce, reducescatter or reduce, the same
+  // for all the fused tensors.
+  ReduceOp reduce_op() const;
+
+  void set_reduce_op(ReduceOp value);
+
+  // Factors an allreduce multiplies the tensors by before and after the
+  // reduction, the same for all the fused tensors.
+  double prescale_factor() const;
+
+  void set_prescale_factor(double value);
+
+  double postscale_factor() const;
+
+  void set_postscale_factor(double value);
+
+  // To fuse multiple allgather or gather responses
   void add_allgather_response(const Response& response);
 
   static void ParseFromBytes(Response& response, const uint8_t* input);
@@ -188,6 +257,9 @@ private:
   std::string error_message_;
   std::vector<int32_t> devices_;
   std::vector<int64_t> tensor_sizes_;
+  ReduceOp reduce_op_ = ReduceOp::SUM;
+  double prescale_factor_ = 1.0;
+  double postscale_factor_ = 1.0;
 };
 
 class ResponseList {
@@ -16,7 +16,10 @@
 
 #include "mpi_context.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -62,9 +65,37 @@ MPI_Datatype MPIContext::GetMPIDataType(const DataType dtype) {
 }
 
 MPI_Op MPIContext::GetMPISumOp(DataType dtype) {
+  if (dtype == HOROVOD_BOOL) {
+    return MPI_LOR;
+  }
   return dtype == HOROVOD_FLOAT16 ? mpi_float16_sum : MPI_SUM;
 }
 
+MPI_Op MPIContext::GetMPIOp(DataType dtype, ReduceOp reduce_op) {
+  switch (reduce_op) {
+  case ReduceOp::SUM:
+    return GetMPISumOp(dtype);
+  case ReduceOp::MIN:
+    if (dtype == HOROVOD_FLOAT16) {
+      return mpi_float16_min;
+    }
+    return dtype == HOROVOD_BOOL ? MPI_LAND : MPI_MIN;
+  case ReduceOp::MAX:
+    if (dtype == HOROVOD_FLOAT16) {
+      return mpi_float16_max;
+    }
+    return dtype == HOROVOD_BOOL ? MPI_LOR : MPI_MAX;
+  case ReduceOp::PRODUCT:
+    if (dtype == HOROVOD_FLOAT16) {
+      return mpi_float16_prod;
+    }
+    return dtype == HOROVOD_BOOL ? MPI_LAND : MPI_PROD;
+  default:
+    throw std::logic_error("Reduce op " + ReduceOp_Name(reduce_op) +
+                           " is not supported in MPI mode.");
+  }
+}
+
 MPI_Comm MPIContext::GetMPICommunicator(Communicator comm) {
   switch (comm) {
   case GLOBAL:
@@ -85,6 +116,435 @@ int MPIContext::GetMPITypeSize(DataType dtype) {
   return out;
 }
 
+namespace {
+
+// Largest count accepted by the int-count MPI interface.
+const int64_t MAX_INT_COUNT = std::numeric_limits<int>::max();
+
+int64_t TypeExtent(MPI_Datatype datatype) {
+  MPI_Aint lb, extent;
+  MPI_Type_get_extent(datatype, &lb, &extent);
+  return (int64_t) extent;
+}
+
+} // namespace
+
+int LargeCountAllreduce(const void* sendbuf, void* recvbuf, int64_t count,
+                        MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+  if (count <= MAX_INT_COUNT) {
+    return MPI_Allreduce(sendbuf, recvbuf, (int) count, datatype, op, comm);
+  }
+#if MPI_VERSION >= 4
+  return MPI_Allreduce_c(sendbuf, recvbuf, (MPI_Count) count, datatype, op,
+                         comm);
+#else
+  // Reduction is element-wise, so the buffer can be reduced chunk by chunk.
+  int64_t extent = TypeExtent(datatype);
+  for (int64_t offset = 0; offset < count; offset += MAX_INT_COUNT) {
+    int chunk = (int) std::min(MAX_INT_COUNT, count - offset);
+    const void* chunk_sendbuf =
+        sendbuf == MPI_IN_PLACE
+            ? MPI_IN_PLACE
+            : (const uint8_t*) sendbuf + offset * extent;
+    int op_result = MPI_Allreduce(chunk_sendbuf,
+                                  (uint8_t*) recvbuf + offset * extent, chunk,
+                                  datatype, op, comm);
+    if (op_result != MPI_SUCCESS) {
+      return op_result;
+    }
+  }
+  return MPI_SUCCESS;
+#endif
+}
+
+int LargeCountAllgatherv(const void* sendbuf, int64_t sendcount,
+                         void* recvbuf, const int64_t* recvcounts,
+                         const int64_t* displcmnts, MPI_Datatype datatype,
+                         MPI_Comm comm) {
+  int size;
+  MPI_Comm_size(comm, &size);
+
+  bool fits_int = sendcount <= MAX_INT_COUNT;
+  for (int rc = 0; rc < size; ++rc) {
+    fits_int &= recvcounts[rc] <= MAX_INT_COUNT &&
+                displcmnts[rc] <= MAX_INT_COUNT;
+  }
+  if (fits_int) {
+    std::vector<int> int_recvcounts(recvcounts, recvcounts + size);
+    std::vector<int> int_displcmnts(displcmnts, displcmnts + size);
+    return MPI_Allgatherv(sendbuf, (int) sendcount, datatype, recvbuf,
+                          int_recvcounts.data(), int_displcmnts.data(),
+                          datatype, comm);
+  }
+
+#if MPI_VERSION >= 4
+  std::vector<MPI_Count> count_recvcounts(recvcounts, recvcounts + size);
+  std::vector<MPI_Aint> aint_displcmnts(displcmnts, displcmnts + size);
+  return MPI_Allgatherv_c(sendbuf, (MPI_Count) sendcount, datatype, recvbuf,
+                          count_recvcounts.data(), aint_displcmnts.data(),
+                          datatype, comm);
+#else
+  // Every rank broadcasts its own component of the output in int-sized
+  // chunks, straight from its send buffer unless the operation is in place.
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+  int64_t extent = TypeExtent(datatype);
+  for (int rc = 0; rc < size; ++rc) {
+    uint8_t* component = (uint8_t*) recvbuf + displcmnts[rc] * extent;
+    void* bcast_buffer = component;
+    if (rc == rank && sendbuf != MPI_IN_PLACE) {
+      bcast_buffer = const_cast<void*>(sendbuf);
+    }
+    int op_result =
+        LargeCountBcast(bcast_buffer, recvcounts[rc], datatype, rc, comm);
+    if (op_result != MPI_SUCCESS) {
+      return op_result;
+    }
+  }
+
+  if (sendbuf != MPI_IN_PLACE) {
+    // Place own component into the output buffer. A self send-receive is used
+    // rather than memcpy since buffers may reside in device memory.
+    uint8_t* component = (uint8_t*) recvbuf + displcmnts[rank] * extent;
+    for (int64_t offset = 0; offset < sendcount; offset += MAX_INT_COUNT) {
+      int chunk = (int) std::min(MAX_INT_COUNT, sendcount - offset);
+      int op_result = MPI_Sendrecv(
+          (const uint8_t*) sendbuf + offset * extent, chunk, datatype, rank, 0,
+          component + offset * extent, chunk, datatype, rank, 0, comm,
+          MPI_STATUS_IGNORE);
+      if (op_result != MPI_SUCCESS) {
+        return op_result;
+      }
+    }
+  }
+  return MPI_SUCCESS;
+#endif
+}
+
+int LargeCountBcast(void* buffer, int64_t count, MPI_Datatype datatype,
+                    int root, MPI_Comm comm) {
+  if (count <= MAX_INT_COUNT) {
+    return MPI_Bcast(buffer, (int) count, datatype, root, comm);
+  }
+#if MPI_VERSION >= 4
+  return MPI_Bcast_c(buffer, (MPI_Count) count, datatype, root, comm);
+#else
+  int64_t extent = TypeExtent(datatype);
+  for (int64_t offset = 0; offset < count; offset += MAX_INT_COUNT) {
+    int chunk = (int) std::min(MAX_INT_COUNT, count - offset);
+    int op_result = MPI_Bcast((uint8_t*) buffer + offset * extent, chunk,
+                              datatype, root, comm);
+    if (op_result != MPI_SUCCESS) {
+      return op_result;
+    }
+  }
+  return MPI_SUCCESS;
+#endif
+}
+
+int LargeCountAlltoallv(const void* sendbuf, const int64_t* sendcounts,
+                        const int64_t* sdispls, void* recvbuf,
+                        const int64_t* recvcounts, const int64_t* rdispls,
+                        MPI_Datatype datatype, MPI_Comm comm) {
+  int size, rank;
+  MPI_Comm_size(comm, &size);
+  MPI_Comm_rank(comm, &rank);
+
+  bool fits_int = true;
+  for (int rc = 0; rc < size; ++rc) {
+    fits_int &= sendcounts[rc] <= MAX_INT_COUNT &&
+                sdispls[rc] <= MAX_INT_COUNT &&
+                recvcounts[rc] <= MAX_INT_COUNT &&
+                rdispls[rc] <= MAX_INT_COUNT;
+  }
+  if (fits_int) {
+    std::vector<int> int_sendcounts(sendcounts, sendcounts + size);
+    std::vector<int> int_sdispls(sdispls, sdispls + size);
+    std::vector<int> int_recvcounts(recvcounts, recvcounts + size);
+    std::vector<int> int_rdispls(rdispls, rdispls + size);
+    return MPI_Alltoallv(sendbuf, int_sendcounts.data(), int_sdispls.data(),
+                         datatype, recvbuf, int_recvcounts.data(),
+                         int_rdispls.data(), datatype, comm);
+  }
+#if MPI_VERSION >= 4
+  std::vector<MPI_Count> count_sendcounts(sendcounts, sendcounts + size);
+  std::vector<MPI_Aint> aint_sdispls(sdispls, sdispls + size);
+  std::vector<MPI_Count> count_recvcounts(recvcounts, recvcounts + size);
+  std::vector<MPI_Aint> aint_rdispls(rdispls, rdispls + size);
+  return MPI_Alltoallv_c(sendbuf, count_sendcounts.data(), aint_sdispls.data(),
+                         datatype, recvbuf, count_recvcounts.data(),
+                         aint_rdispls.data(), datatype, comm);
+#else
+  // Pairwise exchange, every step sending to one rank and receiving from
+  // another. Messages are split into chunks, the receiver of a message
+  // splitting it the same way as its sender.
+  int64_t extent = TypeExtent(datatype);
+  for (int step = 0; step < size; ++step) {
+    int dest = (rank + step) % size;
+    int source = (rank - step + size) % size;
+    std::vector<MPI_Request> requests;
+    for (int64_t offset = 0; offset < recvcounts[source];
+         offset += MAX_INT_COUNT) {
+      MPI_Request request;
+      int op_result = MPI_Irecv(
+          (uint8_t*) recvbuf + (rdispls[source] + offset) * extent,
+          (int) std::min(MAX_INT_COUNT, recvcounts[source] - offset),
+          datatype, source, 0, comm, &request);
+      if (op_result != MPI_SUCCESS) {
+        return op_result;
+      }
+      requests.push_back(request);
+    }
+    for (int64_t offset = 0; offset < sendcounts[dest];
+         offset += MAX_INT_COUNT) {
+      MPI_Request request;
+      int op_result = MPI_Isend(
+          (const uint8_t*) sendbuf + (sdispls[dest] + offset) * extent,
+          (int) std::min(MAX_INT_COUNT, sendcounts[dest] - offset),
+          datatype, dest, 0, comm, &request);
+      if (op_result != MPI_SUCCESS) {
+        return op_result;
+      }
+      requests.push_back(request);
+    }
+    int op_result = MPI_Waitall((int) requests.size(), requests.data(),
+                                MPI_STATUSES_IGNORE);
+    if (op_result != MPI_SUCCESS) {
+      return op_result;
+    }
+  }
+  return MPI_SUCCESS;
+#endif
+}
+
+int LargeCountReducescatter(const void* sendbuf, void* recvbuf,
+                            const int64_t* recvcounts, MPI_Datatype datatype,
+                            MPI_Op op, MPI_Comm comm) {
+  int size, rank;
+  MPI_Comm_size(comm, &size);
+  MPI_Comm_rank(comm, &rank);
+
+  int64_t total_count = 0;
+  for (int rc = 0; rc < size; ++rc) {
+    total_count += recvcounts[rc];
+  }
+
+  if (total_count <= MAX_INT_COUNT) {
+    std::vector<int> int_recvcounts(recvcounts, recvcounts + size);
+    return MPI_Reduce_scatter(sendbuf, recvbuf, int_recvcounts.data(),
+                              datatype, op, comm);
+  }
+#if MPI_VERSION >= 4
+  std::vector<MPI_Count> count_recvcounts(recvcounts, recvcounts + size);
+  return MPI_Reduce_scatter_c(sendbuf, recvbuf, count_recvcounts.data(),
+                              datatype, op, comm);
+#else
+  // Every segment is reduced onto the rank owning it, chunk by chunk.
+  bool in_place = sendbuf == MPI_IN_PLACE;
+  const uint8_t* input =
+      (const uint8_t*) (in_place ? recvbuf : sendbuf);
+  int64_t extent = TypeExtent(datatype);
+  int64_t segment_offset = 0;
+  int64_t own_segment_offset = 0;
+  for (int rc = 0; rc < size; ++rc) {
+    if (rc == rank) {
+      own_segment_offset = segment_offset;
+    }
+    for (int64_t offset = 0; offset < recvcounts[rc]; offset += MAX_INT_COUNT) {
+      int chunk = (int) std::min(MAX_INT_COUNT, recvcounts[rc] - offset);
+      const uint8_t* chunk_input = input + (segment_offset + offset) * extent;
+      int op_result;
+      if (rc != rank) {
+        op_result = MPI_Reduce(chunk_input, nullptr, chunk, datatype, op, rc,
+                               comm);
+      } else if (in_place) {
+        op_result = MPI_Reduce(MPI_IN_PLACE, (void*) chunk_input, chunk,
+                               datatype, op, rc, comm);
+      } else {
+        op_result = MPI_Reduce(chunk_input,
+                               (uint8_t*) recvbuf + offset * extent, chunk,
+                               datatype, op, rc, comm);
+      }
+      if (op_result != MPI_SUCCESS) {
+        return op_result;
+      }
+    }
+    segment_offset += recvcounts[rc];
+  }
+  if (in_place && own_segment_offset > 0) {
+    std::memmove(recvbuf, (uint8_t*) recvbuf + own_segment_offset * extent,
+                 (size_t) (recvcounts[rank] * extent));
+  }
+  return MPI_SUCCESS;
+#endif
+}
+
+int LargeCountReduce(const void* sendbuf, void* recvbuf, int64_t count,
+                     MPI_Datatype datatype, MPI_Op op, int root,
+                     MPI_Comm comm) {
+  if (count <= MAX_INT_COUNT) {
+    return MPI_Reduce(sendbuf, recvbuf, (int) count, datatype, op, root, comm);
+  }
+#if MPI_VERSION >= 4
+  return MPI_Reduce_c(sendbuf, recvbuf, (MPI_Count) count, datatype, op, root,
+                      comm);
+#else
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+  int64_t extent = TypeExtent(datatype);
+  for (int64_t offset = 0; offset < count; offset += MAX_INT_COUNT) {
+    int chunk = (int) std::min(MAX_INT_COUNT, count - offset);
+    const void* chunk_sendbuf =
+        sendbuf == MPI_IN_PLACE
+            ? MPI_IN_PLACE
+            : (const uint8_t*) sendbuf + offset * extent;
+    void* chunk_recvbuf =
+        rank == root ? (uint8_t*) recvbuf + offset * extent : nullptr;
+    int op_result = MPI_Reduce(chunk_sendbuf, chunk_recvbuf, chunk, datatype,
+                               op, root, comm);
+    if (op_result != MPI_SUCCESS) {
+      return op_result;
+    }
+  }
+  return MPI_SUCCESS;
+#endif
+}
+
+int LargeCountGatherv(const void* sendbuf, int64_t sendcount, void* recvbuf,
+                      const int64_t* recvcounts, const int64_t* displcmnts,
+                      MPI_Datatype datatype, int root, MPI_Comm comm) {
+  int size, rank;
+  MPI_Comm_size(comm, &size);
+  MPI_Comm_rank(comm, &rank);
+
+  bool fits_int = true;
+  for (int rc = 0; rc < size; ++rc) {
+    fits_int &= recvcounts[rc] <= MAX_INT_COUNT &&
+                displcmnts[rc] <= MAX_INT_COUNT;
+  }
+  if (fits_int) {
+    std::vector<int> int_recvcounts(recvcounts, recvcounts + size);
+    std::vector<int> int_displcmnts(displcmnts, displcmnts + size);
+    return MPI_Gatherv(sendbuf, (int) sendcount, datatype, recvbuf,
+                       int_recvcounts.data(), int_displcmnts.data(), datatype,
+                       root, comm);
+  }
+#if MPI_VERSION >= 4
+  std::vector<MPI_Count> count_recvcounts(recvcounts, recvcounts + size);
+  std::vector<MPI_Aint> aint_displcmnts(displcmnts, displcmnts + size);
+  return MPI_Gatherv_c(sendbuf, (MPI_Count) sendcount, datatype, recvbuf,
+                       count_recvcounts.data(), aint_displcmnts.data(),
+                       datatype, root, comm);
+#else
+  // The root receives the component of every rank in int-sized chunks, its
+  // own through a self send-receive unless the operation is in place.
+  int64_t extent = TypeExtent(datatype);
+  std::vector<MPI_Request> requests;
+  if (rank == root) {
+    for (int rc = 0; rc < size; ++rc) {
+      if (rc == rank && sendbuf == MPI_IN_PLACE) {
+        continue;
+      }
+      for (int64_t offset = 0; offset < recvcounts[rc];
+           offset += MAX_INT_COUNT) {
+        MPI_Request request;
+        int op_result = MPI_Irecv(
+            (uint8_t*) recvbuf + (displcmnts[rc] + offset) * extent,
+            (int) std::min(MAX_INT_COUNT, recvcounts[rc] - offset), datatype,
+            rc, 0, comm, &request);
+        if (op_result != MPI_SUCCESS) {
+          return op_result;
+        }
+        requests.push_back(request);
+      }
+    }
+  }
+  if (sendbuf != MPI_IN_PLACE) {
+    for (int64_t offset = 0; offset < sendcount; offset += MAX_INT_COUNT) {
+      MPI_Request request;
+      int op_result = MPI_Isend(
+          (const uint8_t*) sendbuf + offset * extent,
+          (int) std::min(MAX_INT_COUNT, sendcount - offset), datatype, root, 0,
+          comm, &request);
+      if (op_result != MPI_SUCCESS) {
+        return op_result;
+      }
+      requests.push_back(request);
+    }
+  }
+  return MPI_Waitall((int) requests.size(), requests.data(),
+                     MPI_STATUSES_IGNORE);
+#endif
+}
+
+int LargeCountScatterv(const void* sendbuf, const int64_t* sendcounts,
+                       const int64_t* displcmnts, void* recvbuf,
+                       int64_t recvcount, MPI_Datatype datatype, int root,
+                       MPI_Comm comm) {
+  int size, rank;
+  MPI_Comm_size(comm, &size);
+  MPI_Comm_rank(comm, &rank);
+
+  bool fits_int = true;
+  for (int rc = 0; rc < size; ++rc) {
+    fits_int &= sendcounts[rc] <= MAX_INT_COUNT &&
+                displcmnts[rc] <= MAX_INT_COUNT;
+  }
+  if (fits_int) {
+    std::vector<int> int_sendcounts(sendcounts, sendcounts + size);
+    std::vector<int> int_displcmnts(displcmnts, displcmnts + size);
+    return MPI_Scatterv(sendbuf, int_sendcounts.data(), int_displcmnts.data(),
+                        datatype, recvbuf, (int) recvcount, datatype, root,
+                        comm);
+  }
+#if MPI_VERSION >= 4
+  std::vector<MPI_Count> count_sendcounts(sendcounts, sendcounts + size);
+  std::vector<MPI_Aint> aint_displcmnts(displcmnts, displcmnts + size);
+  return MPI_Scatterv_c(sendbuf, count_sendcounts.data(),
+                        aint_displcmnts.data(), datatype, recvbuf,
+                        (MPI_Count) recvcount, datatype, root, comm);
+#else
+  // The root sends the component of every rank in int-sized chunks, its own
+  // through a self send-receive unless the operation is in place.
+  int64_t extent = TypeExtent(datatype);
+  std::vector<MPI_Request> requests;
+  if (recvbuf != MPI_IN_PLACE) {
+    for (int64_t offset = 0; offset < recvcount; offset += MAX_INT_COUNT) {
+      MPI_Request request;
+      int op_result = MPI_Irecv(
+          (uint8_t*) recvbuf + offset * extent,
+          (int) std::min(MAX_INT_COUNT, recvcount - offset), datatype, root, 0,
+          comm, &request);
+      if (op_result != MPI_SUCCESS) {
+        return op_result;
+      }
+      requests.push_back(request);
+    }
+  }
+  if (rank == root) {
+    for (int rc = 0; rc < size; ++rc) {
+      if (rc == rank && recvbuf == MPI_IN_PLACE) {
+        continue;
+      }
+      for (int64_t offset = 0; offset < sendcounts[rc];
+           offset += MAX_INT_COUNT) {
+        MPI_Request request;
+        int op_result = MPI_Isend(
+            (const uint8_t*) sendbuf + (displcmnts[rc] + offset) * extent,
+            (int) std::min(MAX_INT_COUNT, sendcounts[rc] - offset), datatype,
+            rc, 0, comm, &request);
+        if (op_result != MPI_SUCCESS) {
+          return op_result;
+        }
+        requests.push_back(request);
+      }
+    }
+  }
+  return MPI_Waitall((int) requests.size(), requests.data(),
+                     MPI_STATUSES_IGNORE);
+#endif
+}
+
 void MPIContext::Initialize(const std::vector<int>& ranks,
                             MPIContextManager& ctx_manager) {
 
@@ -145,6 +605,35 @@ void MPIContext::Initialize(const std::vector<int>& ranks,
     MPI_Comm_dup(MPI_COMM_WORLD, &mpi_comm);
   }
 
+  InitializeFromCommunicator();
+}
+
+void MPIContext::InitializeForProcessSet(const MPIContext& parent,
+                                         const std::vector<int>& ranks,
+                                         int tag) {
+  if (!enabled_) {
+    return;
+  }
+
+  // Only the members of the process set take part in creating its
+  // communicator.
+  MPI_Group parent_group;
+  MPI_Comm_group(parent.mpi_comm, &parent_group);
+  MPI_Group set_group;
+  MPI_Group_incl(parent_group, ranks.size(), ranks.data(), &set_group);
+  int ret_code =
+      MPI_Comm_create_group(parent.mpi_comm, set_group, tag, &mpi_comm);
+  MPI_Group_free(&parent_group);
+  MPI_Group_free(&set_group);
+  if (ret_code != MPI_SUCCESS) {
+    throw std::runtime_error(
+        "MPI_Comm_create_group failed, see MPI output for details.");
+  }
+
+  InitializeFromCommunicator();
+}
+
+void MPIContext::InitializeFromCommunicator() {
   // Create local comm, Determine local rank by querying the local communicator.
   MPI_Comm_split_type(mpi_comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
                       &local_comm);
@@ -161,14 +650,40 @@ void MPIContext::Initialize(const std::vector<int>& ranks,
   MPI_Type_contiguous(2, MPI_BYTE, &mpi_float16_t);
   MPI_Type_commit(&mpi_float16_t);
 
-  // Create custom MPI float16 summation op.
+  // Create custom MPI float16 reduction ops.
   MPI_Op_create(&float16_sum, 1, &mpi_float16_sum);
+  MPI_Op_create(&float16_min, 1, &mpi_float16_min);
+  MPI_Op_create(&float16_max, 1, &mpi_float16_max);
+  MPI_Op_create(&float16_prod, 1, &mpi_float16_prod);
+}
+
+MPIPersistentRequests::~MPIPersistentRequests() {
+  if (progress_engine != nullptr && slot >= 0) {
+    progress_engine->WaitForSlot(slot);
+  }
+  for (auto& request : requests) {
+    if (request != MPI_REQUEST_NULL) {
+      MPI_Request_free(&request);
+    }
+  }
 }
 
 void MPIContext::Finalize(MPIContextManager& ctx_manager) {
   if (!enabled_) {
     return;
   }
+  // Complete outstanding operations before any MPI state is released.
+  progress_engine.Stop();
+  persistent_allreduces.Clear();
+
+  if (window != MPI_WIN_NULL) {
+    MPI_Win_free(&window);
+  }
+
+  if (allreduce_window != MPI_WIN_NULL) {
+    MPI_Win_free(&allreduce_window);
+  }
+
   if (mpi_comm != MPI_COMM_NULL && mpi_comm != MPI_COMM_WORLD) {
     MPI_Comm_free(&mpi_comm);
   }
@@ -189,6 +704,18 @@ void MPIContext::Finalize(MPIContextManager& ctx_manager) {
     MPI_Op_free(&mpi_float16_sum);
   }
 
+  if (mpi_float16_min != MPI_OP_NULL) {
+    MPI_Op_free(&mpi_float16_min);
+  }
+
+  if (mpi_float16_max != MPI_OP_NULL) {
+    MPI_Op_free(&mpi_float16_max);
+  }
+
+  if (mpi_float16_prod != MPI_OP_NULL) {
+    MPI_Op_free(&mpi_float16_prod);
+  }
+
   if (should_finalize) {
     ctx_manager.EnvFinalize();
   }
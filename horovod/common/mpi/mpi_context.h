@@ -24,6 +24,8 @@
 #include "../common.h"
 #include "../half.h"
 #include "../logging.h"
+#include "../ops/persistent_collectives.h"
+#include "mpi_progress_engine.h"
 
 namespace horovod {
 namespace common {
@@ -39,6 +41,20 @@ public:
   virtual void EnvFinalize();
 };
 
+// Persistent requests of one collective, freed along with the object. If
+// the requests are started on a slot of the progress engine, freeing them
+// waits until the slot is idle, since the progress thread tests copies of
+// the handles.
+struct MPIPersistentRequests {
+  MPIPersistentRequests() = default;
+  MPIPersistentRequests(const MPIPersistentRequests&) = delete;
+  ~MPIPersistentRequests();
+
+  std::vector<MPI_Request> requests;
+  MPIProgressEngine* progress_engine = nullptr;
+  int slot = -1;
+};
+
 struct MPIContext {
 
   void Enable() {
@@ -53,6 +69,13 @@ struct MPIContext {
   void Initialize(const std::vector<int>& ranks,
                   MPIContextManager& ctx_manager);
 
+  // Creates the communicators of a process set made of the given ranks of
+  // the communicator of parent, which must be initialized. Must only be
+  // called on the ranks of the process set. The MPI environment is left to
+  // parent.
+  void InitializeForProcessSet(const MPIContext& parent,
+                               const std::vector<int>& ranks, int tag);
+
   // Take an argument of context manager pointer that will take care of
   // finalization of MPI environment.
   void Finalize(MPIContextManager& ctx_manager);
@@ -62,6 +85,10 @@ struct MPIContext {
 
   MPI_Op GetMPISumOp(DataType dtype);
 
+  // Returns the MPI reduction matching the reduce op, which must be SUM, MIN,
+  // MAX or PRODUCT.
+  MPI_Op GetMPIOp(DataType dtype, ReduceOp reduce_op);
+
   MPI_Comm GetMPICommunicator(Communicator comm);
 
   int GetMPITypeSize(DataType dtype);
@@ -72,6 +99,9 @@ struct MPIContext {
   // MPI custom data type for float16.
   MPI_Datatype mpi_float16_t;
   MPI_Op mpi_float16_sum;
+  MPI_Op mpi_float16_min;
+  MPI_Op mpi_float16_max;
+  MPI_Op mpi_float16_prod;
 
   // Private MPI communicator for Horovod to ensure no collisions with other
   // threads using MPI.
@@ -84,12 +114,69 @@ struct MPIContext {
   MPI_Comm cross_comm;
 
   // MPI Window used for shared memory allgather
-  MPI_Win window;
+  MPI_Win window = MPI_WIN_NULL;
+
+  // MPI Window used for shared memory hierarchical allreduce
+  MPI_Win allreduce_window = MPI_WIN_NULL;
+
+  // Completes MPI operations on CPU tensors issued asynchronously. Only
+  // running if HOROVOD_MPI_ASYNC_OPS is set.
+  MPIProgressEngine progress_engine;
+
+  // Persistent allreduce requests of recurring fused responses, only set up
+  // with MPI 4.0 libraries.
+  PersistentCollectives<MPIPersistentRequests> persistent_allreduces;
 
   // Whether mpi context should be finalize.
   bool should_finalize = false;
+
+private:
+  // Creates the local and cross communicators of mpi_comm, as well as the
+  // float16 data type and reduction ops.
+  void InitializeFromCommunicator();
 };
 
+// Variants of MPI collectives taking 64-bit element counts and displacements.
+// Large-count MPI_*_c routines are used when the library implements MPI 4.0,
+// otherwise buffers whose counts do not fit into int are processed in chunks.
+// Return MPI error codes like the routines they wrap.
+int LargeCountAllreduce(const void* sendbuf, void* recvbuf, int64_t count,
+                        MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
+
+int LargeCountAllgatherv(const void* sendbuf, int64_t sendcount,
+                         void* recvbuf, const int64_t* recvcounts,
+                         const int64_t* displcmnts, MPI_Datatype datatype,
+                         MPI_Comm comm);
+
+int LargeCountBcast(void* buffer, int64_t count, MPI_Datatype datatype,
+                    int root, MPI_Comm comm);
+
+int LargeCountAlltoallv(const void* sendbuf, const int64_t* sendcounts,
+                        const int64_t* sdispls, void* recvbuf,
+                        const int64_t* recvcounts, const int64_t* rdispls,
+                        MPI_Datatype datatype, MPI_Comm comm);
+
+// With MPI_IN_PLACE the input is taken from recvbuf and the segment of the
+// calling rank is left at its start.
+int LargeCountReducescatter(const void* sendbuf, void* recvbuf,
+                            const int64_t* recvcounts, MPI_Datatype datatype,
+                            MPI_Op op, MPI_Comm comm);
+
+// Rooted collectives. Counts and displacements must be given on all ranks, so
+// that all ranks agree on whether they fit into int.
+int LargeCountReduce(const void* sendbuf, void* recvbuf, int64_t count,
+                     MPI_Datatype datatype, MPI_Op op, int root,
+                     MPI_Comm comm);
+
+int LargeCountGatherv(const void* sendbuf, int64_t sendcount, void* recvbuf,
+                      const int64_t* recvcounts, const int64_t* displcmnts,
+                      MPI_Datatype datatype, int root, MPI_Comm comm);
+
+int LargeCountScatterv(const void* sendbuf, const int64_t* sendcounts,
+                       const int64_t* displcmnts, void* recvbuf,
+                       int64_t recvcount, MPI_Datatype datatype, int root,
+                       MPI_Comm comm);
+
 } // namespace common
 } // namespace horovod
 
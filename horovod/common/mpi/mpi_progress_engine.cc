@@ -0,0 +1,130 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#include "mpi_progress_engine.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace horovod {
+namespace common {
+
+constexpr std::chrono::microseconds MPIProgressEngine::MIN_POLL_INTERVAL;
+constexpr std::chrono::microseconds MPIProgressEngine::MAX_POLL_INTERVAL;
+
+MPIProgressEngine::~MPIProgressEngine() {
+  if (thread_.joinable()) {
+    Stop();
+  }
+}
+
+void MPIProgressEngine::Start(int num_slots) {
+  num_slots_ = num_slots;
+  busy_slots_.assign(num_slots, false);
+  shut_down_ = false;
+  running_ = true;
+  thread_ = std::thread(&MPIProgressEngine::ProgressLoop, this);
+}
+
+void MPIProgressEngine::Stop() {
+  if (!running_) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    shut_down_ = true;
+  }
+  cond_.notify_all();
+  thread_.join();
+  running_ = false;
+}
+
+void MPIProgressEngine::WaitForSlot(int slot) {
+  if (!running_) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  cond_.wait(lock, [this, slot]() { return !busy_slots_[slot]; });
+}
+
+void MPIProgressEngine::Enqueue(int slot, std::vector<MPI_Request> requests,
+                                std::function<void(const Status&)> on_complete) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this, slot]() { return !busy_slots_[slot]; });
+    busy_slots_[slot] = true;
+    operations_.push_back(Operation{slot, std::move(requests), std::move(on_complete)});
+  }
+  cond_.notify_all();
+}
+
+void MPIProgressEngine::ProgressLoop() {
+  std::vector<std::pair<Operation, Status>> completed;
+  auto poll_interval = MIN_POLL_INTERVAL;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cond_.wait(lock, [this]() { return shut_down_ || !operations_.empty(); });
+    if (operations_.empty()) {
+      // Shut down with no outstanding operations left.
+      break;
+    }
+
+    for (auto it = operations_.begin(); it != operations_.end();) {
+      int done = 0;
+      int op = MPI_Testall((int) it->requests.size(), it->requests.data(),
+                           &done, MPI_STATUSES_IGNORE);
+      if (op != MPI_SUCCESS) {
+        completed.emplace_back(std::move(*it), Status::UnknownError(
+            "MPI_Testall failed, see MPI output for details."));
+        it = operations_.erase(it);
+      } else if (done) {
+        completed.emplace_back(std::move(*it), Status::OK());
+        it = operations_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    if (completed.empty()) {
+      // Back off exponentially while nothing completes, so that a long
+      // operation does not keep a core spinning. Enqueue() wakes the thread
+      // up, and new operations are polled at the shortest interval again.
+      auto num_operations = operations_.size();
+      cond_.wait_for(lock, poll_interval);
+      poll_interval = operations_.size() > num_operations
+                          ? MIN_POLL_INTERVAL
+                          : std::min(poll_interval * 2, MAX_POLL_INTERVAL);
+      continue;
+    }
+    poll_interval = MIN_POLL_INTERVAL;
+
+    // Callbacks may copy out of the fusion buffer, so slots are released
+    // only after they return.
+    lock.unlock();
+    for (auto& c : completed) {
+      c.first.on_complete(c.second);
+    }
+    lock.lock();
+
+    for (auto& c : completed) {
+      busy_slots_[c.first.slot] = false;
+    }
+    completed.clear();
+    cond_.notify_all();
+  }
+}
+
+} // namespace common
+} // namespace horovod
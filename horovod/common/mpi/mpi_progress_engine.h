@@ -0,0 +1,95 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#ifndef HOROVOD_MPI_PROGRESS_ENGINE_H
+#define HOROVOD_MPI_PROGRESS_ENGINE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define OMPI_SKIP_MPICXX
+#include "mpi.h"
+
+#include "../common.h"
+
+namespace horovod {
+namespace common {
+
+// Drives non-blocking MPI collectives to completion on a dedicated thread.
+//
+// Operations are handed over as a set of outstanding requests together with a
+// completion callback, which is invoked on the progress thread once all of the
+// requests have finished. Every operation occupies one of a fixed number of
+// slots until it completes. Slots double as indices of the CPU fusion buffers,
+// so an operation holding a slot keeps its fusion buffer from being reused.
+//
+// Requires MPI to be initialized with MPI_THREAD_MULTIPLE, since the
+// background thread keeps issuing MPI calls while requests are being tested.
+class MPIProgressEngine {
+public:
+  ~MPIProgressEngine();
+
+  // Starts the progress thread with the given number of slots.
+  void Start(int num_slots);
+
+  // Waits for all outstanding operations to complete and stops the thread.
+  void Stop();
+
+  bool IsRunning() const { return running_; }
+
+  int NumSlots() const { return num_slots_; }
+
+  // Blocks until no operation occupies the given slot.
+  void WaitForSlot(int slot);
+
+  // Waits for the slot to become free and hands the requests over to the
+  // progress thread. The callback receives an error status if any of the
+  // requests failed.
+  void Enqueue(int slot, std::vector<MPI_Request> requests,
+               std::function<void(const Status&)> on_complete);
+
+private:
+  struct Operation {
+    int slot;
+    std::vector<MPI_Request> requests;
+    std::function<void(const Status&)> on_complete;
+  };
+
+  void ProgressLoop();
+
+  // Bounds of the interval between polls of outstanding requests.
+  static constexpr std::chrono::microseconds MIN_POLL_INTERVAL{1};
+  static constexpr std::chrono::microseconds MAX_POLL_INTERVAL{1000};
+
+  std::list<Operation> operations_;
+  std::vector<bool> busy_slots_;
+  int num_slots_ = 0;
+  bool running_ = false;
+  bool shut_down_ = false;
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::thread thread_;
+};
+
+} // namespace common
+} // namespace horovod
+
+#endif // HOROVOD_MPI_PROGRESS_ENGINE_H
@@ -19,6 +19,7 @@
 
 #include "operations.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstring>
@@ -38,6 +39,7 @@
 #include "message.h"
 #include "ops/operation_manager.h"
 #include "parameter_manager.h"
+#include "process_set.h"
 #include "timeline.h"
 #include "utils/env_parser.h"
 
@@ -139,6 +141,9 @@ MLSLContext mlsl_context;
 
 std::unique_ptr<OperationManager> op_manager;
 
+// Process sets other than the global one, which is kept in horovod_global.
+ProcessSetTable process_set_table;
+
 OperationManager* CreateOperationManager(HorovodGlobalState& state) {
   // Order of these operations is very important. Operations will be checked
   // sequentially from the first to the last. The first 'Enabled' operation will
@@ -147,6 +152,12 @@ OperationManager* CreateOperationManager(HorovodGlobalState& state) {
   std::vector<std::shared_ptr<AllgatherOp>> allgather_ops;
   std::vector<std::shared_ptr<BroadcastOp>> broadcast_ops;
   std::vector<std::shared_ptr<AllreduceOp>> adasum_ops;
+  std::vector<std::shared_ptr<ReducescatterOp>> reducescatter_ops;
+  std::vector<std::shared_ptr<AlltoallOp>> alltoall_ops;
+  std::vector<std::shared_ptr<SparseAllreduceOp>> sparse_allreduce_ops;
+  std::vector<std::shared_ptr<ReduceToRootOp>> reduce_ops;
+  std::vector<std::shared_ptr<GatherOp>> gather_ops;
+  std::vector<std::shared_ptr<ScatterOp>> scatter_ops;
 
 #if HAVE_MPI && HAVE_CUDA
   if (mpi_context.IsEnabled()) {
@@ -182,12 +193,28 @@ OperationManager* CreateOperationManager(HorovodGlobalState& state) {
 
 #if HAVE_GLOO
   if (gloo_context.IsEnabled()) {
+    allreduce_ops.push_back(std::shared_ptr<AllreduceOp>(
+        new GlooHierarchicalAllreduce(&gloo_context, &state)));
     allreduce_ops.push_back(
         std::shared_ptr<AllreduceOp>(new GlooAllreduce(&gloo_context, &state)));
+    allgather_ops.push_back(std::shared_ptr<AllgatherOp>(
+        new GlooHierarchicalAllgather(&gloo_context, &state)));
     allgather_ops.push_back(
         std::shared_ptr<AllgatherOp>(new GlooAllgather(&gloo_context, &state)));
     broadcast_ops.push_back(
         std::shared_ptr<BroadcastOp>(new GlooBroadcast(&gloo_context, &state)));
+    reducescatter_ops.push_back(std::shared_ptr<ReducescatterOp>(
+        new GlooReducescatter(&gloo_context, &state)));
+    alltoall_ops.push_back(std::shared_ptr<AlltoallOp>(
+        new GlooAlltoall(&gloo_context, &state)));
+    sparse_allreduce_ops.push_back(std::shared_ptr<SparseAllreduceOp>(
+        new GlooSparseAllreduce(&gloo_context, &state)));
+    reduce_ops.push_back(std::shared_ptr<ReduceToRootOp>(
+        new GlooReduce(&gloo_context, &state)));
+    gather_ops.push_back(
+        std::shared_ptr<GatherOp>(new GlooGather(&gloo_context, &state)));
+    scatter_ops.push_back(
+        std::shared_ptr<ScatterOp>(new GlooScatter(&gloo_context, &state)));
   }
 #endif
 
@@ -206,12 +233,26 @@ OperationManager* CreateOperationManager(HorovodGlobalState& state) {
   if (mpi_context.IsEnabled()){
     adasum_ops.push_back(
         std::shared_ptr<AllreduceOp>(new AdasumMPIAllreduceOp(&mpi_context, &state)));
+    allreduce_ops.push_back(
+        std::shared_ptr<AllreduceOp>(new MPIHierarchicalAllreduce(&mpi_context, &state)));
     allreduce_ops.push_back(
         std::shared_ptr<AllreduceOp>(new MPIAllreduce(&mpi_context,&state)));
     allgather_ops.push_back(
         std::shared_ptr<AllgatherOp>(new MPIAllgather(&mpi_context, &state)));
     broadcast_ops.push_back(
         std::shared_ptr<BroadcastOp>(new MPIBroadcast(&mpi_context, &state)));
+    reducescatter_ops.push_back(std::shared_ptr<ReducescatterOp>(
+        new MPIReducescatter(&mpi_context, &state)));
+    alltoall_ops.push_back(std::shared_ptr<AlltoallOp>(
+        new MPIAlltoall(&mpi_context, &state)));
+    sparse_allreduce_ops.push_back(std::shared_ptr<SparseAllreduceOp>(
+        new MPISparseAllreduce(&mpi_context, &state)));
+    reduce_ops.push_back(std::shared_ptr<ReduceToRootOp>(
+        new MPIReduce(&mpi_context, &state)));
+    gather_ops.push_back(
+        std::shared_ptr<GatherOp>(new MPIGather(&mpi_context, &state)));
+    scatter_ops.push_back(
+        std::shared_ptr<ScatterOp>(new MPIScatter(&mpi_context, &state)));
   }
 #endif
 
@@ -219,17 +260,120 @@ OperationManager* CreateOperationManager(HorovodGlobalState& state) {
   std::shared_ptr<ErrorOp> error_op(new ErrorOp(&state));
 
   return new OperationManager(&state.parameter_manager, allreduce_ops,
-                              allgather_ops, broadcast_ops, join_op, adasum_ops, error_op);
+                              allgather_ops, broadcast_ops, join_op, adasum_ops,
+                              reducescatter_ops, alltoall_ops,
+                              sparse_allreduce_ops, reduce_ops, gather_ops,
+                              scatter_ops, error_op);
+}
+
+template <class T>
+std::shared_ptr<T> BindToProcessSet(T* op, ProcessSet& process_set) {
+  op->SetController(process_set.controller);
+  op->SetFusionBuffer(&process_set.fusion_buffer);
+  return std::shared_ptr<T>(op);
+}
+
+// Process sets only run collectives on CPU tensors, with the MPI and Gloo
+// operations bound to their own contexts and controller.
+OperationManager* CreateProcessSetOperationManager(HorovodGlobalState& state,
+                                                   ProcessSet& process_set) {
+  std::vector<std::shared_ptr<AllreduceOp>> allreduce_ops;
+  std::vector<std::shared_ptr<AllgatherOp>> allgather_ops;
+  std::vector<std::shared_ptr<BroadcastOp>> broadcast_ops;
+  std::vector<std::shared_ptr<AllreduceOp>> adasum_ops;
+  std::vector<std::shared_ptr<ReducescatterOp>> reducescatter_ops;
+  std::vector<std::shared_ptr<AlltoallOp>> alltoall_ops;
+  std::vector<std::shared_ptr<SparseAllreduceOp>> sparse_allreduce_ops;
+  std::vector<std::shared_ptr<ReduceToRootOp>> reduce_ops;
+  std::vector<std::shared_ptr<GatherOp>> gather_ops;
+  std::vector<std::shared_ptr<ScatterOp>> scatter_ops;
+
+#if HAVE_GLOO
+  auto* gloo_ctx = &process_set.gloo_context;
+  if (gloo_ctx->IsEnabled()) {
+    allreduce_ops.push_back(
+        BindToProcessSet(new GlooAllreduce(gloo_ctx, &state), process_set));
+    allgather_ops.push_back(
+        BindToProcessSet(new GlooAllgather(gloo_ctx, &state), process_set));
+    broadcast_ops.push_back(
+        BindToProcessSet(new GlooBroadcast(gloo_ctx, &state), process_set));
+    reducescatter_ops.push_back(BindToProcessSet(
+        new GlooReducescatter(gloo_ctx, &state), process_set));
+    alltoall_ops.push_back(
+        BindToProcessSet(new GlooAlltoall(gloo_ctx, &state), process_set));
+    sparse_allreduce_ops.push_back(BindToProcessSet(
+        new GlooSparseAllreduce(gloo_ctx, &state), process_set));
+    reduce_ops.push_back(
+        BindToProcessSet(new GlooReduce(gloo_ctx, &state), process_set));
+    gather_ops.push_back(
+        BindToProcessSet(new GlooGather(gloo_ctx, &state), process_set));
+    scatter_ops.push_back(
+        BindToProcessSet(new GlooScatter(gloo_ctx, &state), process_set));
+  }
+#endif
+
+#if HAVE_MPI
+  auto* mpi_ctx = &process_set.mpi_context;
+  if (mpi_ctx->IsEnabled()) {
+    allreduce_ops.push_back(
+        BindToProcessSet(new MPIAllreduce(mpi_ctx, &state), process_set));
+    allgather_ops.push_back(
+        BindToProcessSet(new MPIAllgather(mpi_ctx, &state), process_set));
+    broadcast_ops.push_back(
+        BindToProcessSet(new MPIBroadcast(mpi_ctx, &state), process_set));
+    reducescatter_ops.push_back(
+        BindToProcessSet(new MPIReducescatter(mpi_ctx, &state), process_set));
+    alltoall_ops.push_back(
+        BindToProcessSet(new MPIAlltoall(mpi_ctx, &state), process_set));
+    sparse_allreduce_ops.push_back(BindToProcessSet(
+        new MPISparseAllreduce(mpi_ctx, &state), process_set));
+    reduce_ops.push_back(
+        BindToProcessSet(new MPIReduce(mpi_ctx, &state), process_set));
+    gather_ops.push_back(
+        BindToProcessSet(new MPIGather(mpi_ctx, &state), process_set));
+    scatter_ops.push_back(
+        BindToProcessSet(new MPIScatter(mpi_ctx, &state), process_set));
+  }
+#endif
+
+  std::shared_ptr<JoinOp> join_op(new JoinOp(&state));
+  std::shared_ptr<ErrorOp> error_op(new ErrorOp(&state));
+
+  return new OperationManager(&state.parameter_manager, allreduce_ops,
+                              allgather_ops, broadcast_ops, join_op, adasum_ops,
+                              reducescatter_ops, alltoall_ops,
+                              sparse_allreduce_ops, reduce_ops, gather_ops,
+                              scatter_ops, error_op);
 }
 
 // Process a Response by doing a reduction, a gather, a broadcast, or
-// raising an error.
-void PerformOperation(Response response, HorovodGlobalState& state) {
+// raising an error. Responses of a process set other than the global one are
+// processed with its tensor queue and operations.
+void PerformOperation(Response response, HorovodGlobalState& state,
+                      ProcessSet* process_set = nullptr) {
+  auto& tensor_queue = process_set != nullptr ? process_set->tensor_queue
+                                              : state.tensor_queue;
+  auto& group_table = process_set != nullptr ? process_set->group_table
+                                             : state.group_table;
+  auto& controller = process_set != nullptr ? process_set->controller
+                                            : state.controller;
+  auto& operation_manager =
+      process_set != nullptr ? process_set->op_manager : op_manager;
+  auto& fusion_buffer = process_set != nullptr ? process_set->fusion_buffer
+                                               : state.fusion_buffer;
+  // Only ranks of the global process set can Join().
+  bool joined = process_set == nullptr && state.joined;
+
   std::vector<TensorTableEntry> entries;
   auto& timeline = horovod_global.timeline;
   if (response.response_type() != Response::JOIN) {
-    horovod_global.tensor_queue.GetTensorEntriesFromResponse(
-        response, entries, state.joined, state.join_device);
+    tensor_queue.GetTensorEntriesFromResponse(response, entries, joined,
+                                              state.join_device);
+
+    // Groups are only needed until their tensors have been negotiated.
+    if (!group_table.empty()) {
+      group_table.DeregisterGroups(response.tensor_names());
+    }
 
     for (auto& e : entries) {
       timeline.Start(e.tensor_name, response.response_type());
@@ -237,13 +381,23 @@ void PerformOperation(Response response, HorovodGlobalState& state) {
 
     if (entries.size() > 1) {
       auto first_entry = entries[0];
+#if HAVE_MPI
+      // The fusion buffer may still be in use by an asynchronous MPI
+      // operation. Process sets only run blocking ones.
+      if (process_set == nullptr && first_entry.device == CPU_DEVICE_ID) {
+        mpi_context.progress_engine.WaitForSlot(
+            state.current_cpu_fusion_buffer);
+      }
+#endif
       // Note: it is OK for different entries to come from different frameworks
       // since buffer allocated here is guaranteed to survive at least till the
       // end of this operation.
-      Status status = horovod_global.fusion_buffer.InitializeBuffer(
-          horovod_global.controller->TensorFusionThresholdBytes(),
+      Status status = fusion_buffer.InitializeBuffer(
+          controller->TensorFusionThresholdBytes(),
           first_entry.device, first_entry.context,
-          horovod_global.current_nccl_stream,
+          process_set != nullptr
+              ? 0
+              : horovod_global.FusionBufferStream(first_entry.device),
           [&]() { timeline.ActivityStartAll(entries, INIT_FUSION_BUFFER); },
           [&]() { timeline.ActivityEndAll(entries); });
       if (!status.ok()) {
@@ -287,7 +441,7 @@ void PerformOperation(Response response, HorovodGlobalState& state) {
 
   Status status;
   try {
-    status = op_manager->ExecuteOperation(entries, response);
+    status = operation_manager->ExecuteOperation(entries, response);
   } catch (const std::exception& ex) {
     status = Status::UnknownError(ex.what());
   }
@@ -303,6 +457,137 @@ void PerformOperation(Response response, HorovodGlobalState& state) {
   }
 }
 
+// Sets up the process sets this rank is a member of. All ranks set up their
+// process sets one after another in the order of their IDs, so that the
+// members of a process set set it up together.
+void InitializeProcessSets(HorovodGlobalState& state) {
+  int rank = state.controller->GetRank();
+  int size = state.controller->GetSize();
+  for (auto process_set_id : process_set_table.Ids()) {
+    auto& process_set = *process_set_table.Get(process_set_id);
+    auto& ranks = process_set.registered_global_ranks;
+    if (ranks.empty() || ranks.front() < 0 || ranks.back() >= size) {
+      LOG(ERROR, rank) << "Ignoring process set " << process_set_id
+                       << ", its ranks must be between 0 and " << size - 1
+                       << ".";
+      continue;
+    }
+    if (!process_set.Includes(rank)) {
+      continue;
+    }
+
+#if HAVE_MPI
+    if (mpi_context.IsEnabled()) {
+      process_set.mpi_context.Enable();
+      process_set.mpi_context.InitializeForProcessSet(mpi_context, ranks,
+                                                      process_set_id);
+    }
+#endif
+
+#if HAVE_GLOO
+    if (gloo_context.IsEnabled()) {
+      process_set.gloo_context.Enable();
+#if HAVE_MPI
+      if (mpi_context.IsEnabled()) {
+        process_set.gloo_context.InitializeFromMPI(process_set.mpi_context,
+                                                   ParseGlooIface());
+      } else
+#endif
+      {
+        process_set.gloo_context.InitializeForProcessSet(
+            ParseGlooIface(), process_set_id, ranks);
+      }
+    }
+#endif
+
+#if HAVE_MPI
+    if (state.control_operation == LibType::MPI) {
+      process_set.controller.reset(new MPIController(
+          process_set.response_cache, process_set.tensor_queue,
+          state.timeline, state.parameter_manager, process_set.group_table,
+          process_set.mpi_context));
+    }
+#endif
+
+#if HAVE_GLOO
+    if (state.control_operation == LibType::GLOO) {
+      process_set.controller.reset(new GlooController(
+          process_set.response_cache, process_set.tensor_queue,
+          state.timeline, state.parameter_manager, process_set.group_table,
+          process_set.gloo_context));
+    }
+#endif
+
+    process_set.controller->Initialize();
+    process_set.controller->SetTimelineEnabled(
+        std::getenv(HOROVOD_TIMELINE) != nullptr);
+    ParseStallInspectorFromEnv(process_set.controller->GetStallInspector());
+    process_set.response_cache.set_capacity(
+        (int)state.parameter_manager.CacheEnabled() * state.cache_capacity);
+    process_set.op_manager.reset(
+        CreateProcessSetOperationManager(state, process_set));
+    LOG(DEBUG, rank) << "Process set " << process_set_id << " initialized";
+  }
+}
+
+// Process sets run on threads of their own unless their negotiation must stay
+// in step with the global one: MPI calls may only be made from several threads
+// with MPI_THREAD_MULTIPLE, and autotuned parameters must change at the same
+// point of the negotiation on all members of a process set.
+bool CanRunProcessSetThreads(HorovodGlobalState& state) {
+  if (state.parameter_manager.IsAutoTuning()) {
+    return false;
+  }
+#if HAVE_MPI
+  if (mpi_context.IsEnabled()) {
+    int provided;
+    MPI_Query_thread(&provided);
+    return provided == MPI_THREAD_MULTIPLE;
+  }
+#endif
+  return true;
+}
+
+// Negotiates and performs the collectives of a process set until all of its
+// members have been asked to shut down, independently of the global process
+// set and of other process sets.
+void ProcessSetLoop(HorovodGlobalState& state, ProcessSet& process_set,
+                    int32_t process_set_id) {
+  int rank = state.controller->GetRank();
+  auto last_cycle_start = std::chrono::steady_clock::now();
+  bool shut_down = false;
+  while (!shut_down) {
+    auto sleep_duration = last_cycle_start +
+                          std::chrono::microseconds(long(
+                              state.parameter_manager.CycleTimeMs() * 1000.)) -
+                          std::chrono::steady_clock::now();
+    if (sleep_duration > std::chrono::steady_clock::duration::zero()) {
+      std::this_thread::sleep_for(sleep_duration);
+    }
+    last_cycle_start = std::chrono::steady_clock::now();
+
+    auto response_list = process_set.controller->ComputeResponseList(
+        process_set.shut_down, state);
+    for (auto& response : response_list.responses()) {
+      LOG(TRACE, rank) << "Performing " << response.tensor_names_string()
+                       << " in process set " << process_set_id;
+      PerformOperation(response, horovod_global, &process_set);
+      LOG(TRACE, rank) << "Finished performing "
+                       << response.tensor_names_string();
+    }
+    shut_down = response_list.shutdown();
+  }
+
+  // A stalled process set may shut down before the global one. Its pending
+  // and future tensors can no longer be processed.
+  std::vector<StatusCallback> callbacks;
+  process_set.tensor_queue.FinalizeTensorQueue(callbacks);
+  for (auto& cb : callbacks) {
+    cb(SHUT_DOWN_ERROR);
+  }
+  LOG(DEBUG, rank) << "Process set " << process_set_id << " shut down";
+}
+
 // The background thread loop coordinates all the controller processes and the
 // tensor reductions. The design of the communicator mechanism is limited by a
 // few considerations:
@@ -385,6 +670,30 @@ void BackgroundThreadLoop(HorovodGlobalState& state) {
   cuda_context.streams.resize(state.num_nccl_streams);
 #endif
 
+#if HAVE_MPI
+  // Set number of MPI operations on CPU tensors that may be in flight at
+  // once. Asynchronous collectives are completed by a progress thread, which
+  // requires multi-threaded MPI.
+  auto horovod_mpi_async_ops = std::getenv(HOROVOD_MPI_ASYNC_OPS);
+  if (mpi_context.IsEnabled() && horovod_mpi_async_ops != nullptr &&
+      std::strtol(horovod_mpi_async_ops, nullptr, 10) > 0) {
+    int provided;
+    MPI_Query_thread(&provided);
+    if (provided == MPI_THREAD_MULTIPLE) {
+      mpi_context.progress_engine.Start(std::atoi(horovod_mpi_async_ops));
+    } else if (is_coordinator) {
+      LOG(WARNING) << "HOROVOD_MPI_ASYNC_OPS requires MPI to support "
+                      "MPI_THREAD_MULTIPLE, using blocking MPI collectives "
+                      "instead.";
+    }
+  }
+
+  // Gathering through derived datatypes saves the copies through the fusion
+  // buffer, but is left to how well the MPI library packs such datatypes.
+  SetBoolFromEnv(HOROVOD_MPI_ALLGATHER_DERIVED_DATATYPES,
+                 state.mpi_allgather_derived_datatypes, true);
+#endif
+
   // Open the timeline file on coordinator.
   auto horovod_timeline = std::getenv(HOROVOD_TIMELINE);
   if (is_coordinator && horovod_timeline != nullptr) {
@@ -448,8 +757,46 @@ void BackgroundThreadLoop(HorovodGlobalState& state) {
     state.parameter_manager.SetHierarchicalAllreduce(value, true);
   }
 
-#if HOROVOD_GPU_ALLREDUCE != 'N' && HOROVOD_GPU_ALLREDUCE != 'D'
-  // Hierarchical allreduce is not supported without NCCL or DDL
+  // Set algorithm for allreduce of CPU tensors. Only MPI and Gloo implement
+  // algorithms of their own, so it is not tuned for other CPU operations.
+  std::vector<AllreduceAlgorithm> cpu_allreduce_algorithms{
+      AllreduceAlgorithm::AUTO};
+  if (state.cpu_operation == LibType::MPI) {
+    cpu_allreduce_algorithms.insert(
+        cpu_allreduce_algorithms.end(),
+        {AllreduceAlgorithm::RING, AllreduceAlgorithm::RECURSIVE_DOUBLING,
+         AllreduceAlgorithm::RABENSEIFNER, AllreduceAlgorithm::TWO_LEVEL_TREE,
+         AllreduceAlgorithm::LIBRARY});
+  } else if (state.cpu_operation == LibType::GLOO) {
+    cpu_allreduce_algorithms.insert(
+        cpu_allreduce_algorithms.end(),
+        {AllreduceAlgorithm::RING, AllreduceAlgorithm::RABENSEIFNER,
+         AllreduceAlgorithm::BCUBE, AllreduceAlgorithm::LIBRARY});
+  }
+  state.parameter_manager.SetCpuAllreduceAlgorithms(cpu_allreduce_algorithms);
+  if (cpu_allreduce_algorithms.size() == 1) {
+    state.parameter_manager.SetCpuAllreduceAlgorithm(AllreduceAlgorithm::AUTO,
+                                                     true);
+  }
+  auto horovod_cpu_allreduce_algorithm =
+      std::getenv(HOROVOD_CPU_ALLREDUCE_ALGORITHM);
+  if (horovod_cpu_allreduce_algorithm != nullptr) {
+    AllreduceAlgorithm algorithm;
+    if (ParseAllreduceAlgorithm(horovod_cpu_allreduce_algorithm, algorithm) &&
+        std::find(cpu_allreduce_algorithms.begin(),
+                  cpu_allreduce_algorithms.end(),
+                  algorithm) != cpu_allreduce_algorithms.end()) {
+      state.parameter_manager.SetCpuAllreduceAlgorithm(algorithm, true);
+    } else if (is_coordinator) {
+      LOG(WARNING) << "Ignoring unknown or unsupported "
+                   << HOROVOD_CPU_ALLREDUCE_ALGORITHM << " "
+                   << horovod_cpu_allreduce_algorithm << ".";
+    }
+  }
+
+#if !HAVE_MPI && !HAVE_GLOO && HOROVOD_GPU_ALLREDUCE != 'N' &&                 \
+    HOROVOD_GPU_ALLREDUCE != 'D'
+  // Hierarchical allreduce is not supported without MPI, Gloo, NCCL or DDL
   state.parameter_manager.SetHierarchicalAllreduce(false, true);
 #endif
 
@@ -484,8 +831,29 @@ void BackgroundThreadLoop(HorovodGlobalState& state) {
     state.adasum_mpi_chunk_size = std::strtol(horovod_adasum_mpi_chunk_size, nullptr, 10);
   }
 
+  // Set the density above which sparse allreduces switch to dense ones. All
+  // ranks must use the same value.
+  state.sparse_density_threshold = GetDoubleEnvOrDefault(
+      HOROVOD_SPARSE_DENSITY_THRESHOLD, state.sparse_density_threshold);
+
   op_manager.reset(CreateOperationManager(state));
 
+  InitializeProcessSets(state);
+#if HAVE_GLOO
+  gloo_context.FinalizeRendezvous();
+#endif
+
+  if (CanRunProcessSetThreads(state)) {
+    for (auto process_set_id : process_set_table.Ids()) {
+      auto& process_set = *process_set_table.Get(process_set_id);
+      if (process_set.controller != nullptr) {
+        process_set.background_thread =
+            std::thread(ProcessSetLoop, std::ref(state), std::ref(process_set),
+                        process_set_id);
+      }
+    }
+  }
+
   // Signal that initialization is completed.
   state.initialization_done = true;
   LOG(INFO, horovod_global.controller->GetRank()) << "Horovod Initialized";
@@ -494,12 +862,27 @@ void BackgroundThreadLoop(HorovodGlobalState& state) {
   while (RunLoopOnce(state))
     ;
 
+  // Process sets shut down together with the global process set, which all
+  // ranks leave in the same cycle.
+  for (auto process_set_id : process_set_table.Ids()) {
+    process_set_table.Get(process_set_id)->shut_down = true;
+  }
+  for (auto process_set_id : process_set_table.Ids()) {
+    auto& process_set = *process_set_table.Get(process_set_id);
+    if (process_set.background_thread.joinable()) {
+      process_set.background_thread.join();
+    }
+  }
+
     // Finalize all contexts
 #if HAVE_NCCL
   nccl_context.ShutDown();
 #endif
 
 #if HAVE_GLOO
+  for (auto process_set_id : process_set_table.Ids()) {
+    process_set_table.Get(process_set_id)->gloo_context.Finalize();
+  }
   gloo_context.Finalize();
 #endif
 
@@ -512,11 +895,19 @@ void BackgroundThreadLoop(HorovodGlobalState& state) {
   // and finalize tensor queue.
   std::vector<StatusCallback> callbacks;
   horovod_global.tensor_queue.FinalizeTensorQueue(callbacks);
+  for (auto process_set_id : process_set_table.Ids()) {
+    process_set_table.Get(process_set_id)
+        ->tensor_queue.FinalizeTensorQueue(callbacks);
+  }
   for (auto& cb : callbacks) {
     cb(SHUT_DOWN_ERROR);
   }
 
 #if HAVE_MPI
+  for (auto process_set_id : process_set_table.Ids()) {
+    process_set_table.Get(process_set_id)
+        ->mpi_context.Finalize(mpi_ctx_manager);
+  }
   mpi_context.Finalize(mpi_ctx_manager);
 #endif
 
@@ -577,6 +968,30 @@ bool RunLoopOnce(HorovodGlobalState& state) {
     }
   }
 
+  // Process sets without a thread of their own are negotiated one after
+  // another in the order of their IDs, like on all of their other members.
+  // Only the global process set decides when to shut down.
+  if (!response_list.shutdown()) {
+    for (auto process_set_id : process_set_table.Ids()) {
+      auto& process_set = *process_set_table.Get(process_set_id);
+      if (process_set.controller == nullptr ||
+          process_set.background_thread.joinable()) {
+        continue;
+      }
+
+      std::atomic_bool shut_down{false};
+      auto process_set_responses =
+          process_set.controller->ComputeResponseList(shut_down, state);
+      for (auto& response : process_set_responses.responses()) {
+        LOG(TRACE, rank) << "Performing " << response.tensor_names_string()
+                         << " in process set " << process_set_id;
+        PerformOperation(response, horovod_global, &process_set);
+        LOG(TRACE, rank) << "Finished performing "
+                         << response.tensor_names_string();
+      }
+    }
+  }
+
   return !response_list.shutdown();
 }
 
@@ -598,7 +1013,8 @@ void InitializeHorovodOnce(const int* ranks, int nranks) {
       horovod_global.controller.reset(new MPIController(
           horovod_global.response_cache,
           horovod_global.tensor_queue, horovod_global.timeline,
-          horovod_global.parameter_manager, mpi_context));
+          horovod_global.parameter_manager, horovod_global.group_table,
+          mpi_context));
       horovod_global.controller->SetRanks(ranks, nranks);
     }
 #endif
@@ -614,7 +1030,8 @@ void InitializeHorovodOnce(const int* ranks, int nranks) {
       horovod_global.controller.reset(new GlooController(
           horovod_global.response_cache,
           horovod_global.tensor_queue, horovod_global.timeline,
-          horovod_global.parameter_manager, gloo_context));
+          horovod_global.parameter_manager, horovod_global.group_table,
+          gloo_context));
     }
 #endif
     // Reset initialization flag
@@ -630,6 +1047,49 @@ void InitializeHorovodOnce(const int* ranks, int nranks) {
   LOG(DEBUG) << "Background thread init done";
 }
 
+// Looks up the process set that tensors are enqueued into. process_set is set
+// to nullptr for the global process set, whose state is horovod_global.
+Status GetProcessSet(int32_t process_set_id, int device,
+                     ProcessSet*& process_set) {
+  process_set = nullptr;
+  if (process_set_id == GLOBAL_PROCESS_SET_ID) {
+    return Status::OK();
+  }
+
+  process_set = process_set_table.Get(process_set_id);
+  if (process_set == nullptr) {
+    return Status::InvalidArgument("Process set " +
+                                   std::to_string(process_set_id) +
+                                   " does not exist.");
+  }
+  int rank = horovod_global.controller->GetRank();
+  if (!process_set->Includes(rank)) {
+    return Status::InvalidArgument(
+        "Rank " + std::to_string(rank) + " is not a member of process set " +
+        std::to_string(process_set_id) + ".");
+  }
+  if (process_set->controller == nullptr) {
+    return Status::InvalidArgument(
+        "Process set " + std::to_string(process_set_id) +
+        " has ranks outside of the Horovod world.");
+  }
+  if (device != CPU_DEVICE_ID) {
+    return Status::InvalidArgument(
+        "Process sets only support CPU tensors.");
+  }
+  return Status::OK();
+}
+
+Controller& ProcessSetController(ProcessSet* process_set) {
+  return process_set != nullptr ? *process_set->controller
+                                : *horovod_global.controller;
+}
+
+TensorQueue& ProcessSetTensorQueue(ProcessSet* process_set) {
+  return process_set != nullptr ? process_set->tensor_queue
+                                : horovod_global.tensor_queue;
+}
+
 } // namespace
 
 Status CheckInitialized() {
@@ -652,6 +1112,43 @@ void horovod_init_comm(MPI_Comm comm) {
 }
 #endif
 
+int horovod_add_process_set(const int* ranks, int nranks) {
+  if (horovod_global.background_thread.joinable()) {
+    return -1;
+  }
+  return process_set_table.RegisterProcessSet(
+      std::vector<int>(ranks, ranks + nranks));
+}
+
+int horovod_process_set_rank(int process_set_id) {
+  if (!horovod_global.initialization_done) {
+    return -1;
+  }
+  if (process_set_id == GLOBAL_PROCESS_SET_ID) {
+    return horovod_global.controller->GetRank();
+  }
+  auto process_set = process_set_table.Get(process_set_id);
+  if (process_set == nullptr || process_set->controller == nullptr ||
+      !process_set->Includes(horovod_global.controller->GetRank())) {
+    return -1;
+  }
+  return process_set->controller->GetRank();
+}
+
+int horovod_process_set_size(int process_set_id) {
+  if (!horovod_global.initialization_done) {
+    return -1;
+  }
+  if (process_set_id == GLOBAL_PROCESS_SET_ID) {
+    return horovod_global.controller->GetSize();
+  }
+  auto process_set = process_set_table.Get(process_set_id);
+  if (process_set == nullptr) {
+    return -1;
+  }
+  return (int)process_set->registered_global_ranks.size();
+}
+
 void horovod_shutdown() {
   if (horovod_global.background_thread.joinable()) {
     horovod_global.shut_down = true;
@@ -659,6 +1156,7 @@ void horovod_shutdown() {
     // Reset the initialization flag to allow restarting with horovod_init(...)
     horovod_global.initialize_flag.clear();
     horovod_global.shut_down = false;
+    process_set_table.Clear();
   }
 }
 
@@ -776,6 +1274,18 @@ int horovod_reduce_op_adasum() {
   return ReduceOp::ADASUM;
 }
 
+int horovod_reduce_op_min() {
+  return ReduceOp::MIN;
+}
+
+int horovod_reduce_op_max() {
+  return ReduceOp::MAX;
+}
+
+int horovod_reduce_op_product() {
+  return ReduceOp::PRODUCT;
+}
+
 }
 
 // Contexts and controller must be initialized and the background thread
@@ -786,28 +1296,146 @@ Status EnqueueTensorAllreduce(std::shared_ptr<OpContext> context,
                               std::shared_ptr<ReadyEvent> ready_event,
                               const std::string name, const int device,
                               StatusCallback callback,
-                              ReduceOp reduce_op) {
-  Status status;
+                              ReduceOp reduce_op,
+                              double prescale_factor,
+                              double postscale_factor,
+                              int32_t process_set_id) {
+  return EnqueueTensorAllreduces({context}, {tensor}, {output}, {ready_event},
+                                 {name}, device, {callback}, reduce_op,
+                                 prescale_factor, postscale_factor,
+                                 process_set_id);
+}
+
+// Contexts and controller must be initialized and the background thread
+// must be running before this function is called.
+Status EnqueueTensorAllreduces(
+    const std::vector<std::shared_ptr<OpContext>>& contexts,
+    const std::vector<std::shared_ptr<Tensor>>& tensors,
+    const std::vector<std::shared_ptr<Tensor>>& outputs,
+    const std::vector<std::shared_ptr<ReadyEvent>>& ready_events,
+    const std::vector<std::string>& names, const int device,
+    const std::vector<StatusCallback>& callbacks, ReduceOp reduce_op,
+    double prescale_factor, double postscale_factor,
+    int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+  auto& tensor_queue = ProcessSetTensorQueue(process_set);
+  auto& group_table = process_set != nullptr ? process_set->group_table
+                                             : horovod_global.group_table;
 
   // AVERAGE should be taken care of in the framework layer. Equeuing it here directly is not allowed.
   // For example of how to deal with op=hvd.Average in framework layer, please refer to function
   // `def _allreduce_async(tensor, output, name, op)` in
   // horovod/horovod/torch/mpi_ops.py
   if (reduce_op == ReduceOp::AVERAGE) {
-    LOG(ERROR, horovod_global.controller->GetRank()) << "Enqueuing AVERAGE allreduce is not allowed.";
+    LOG(ERROR, controller.GetRank()) << "Enqueuing AVERAGE allreduce is not allowed.";
     return status.Aborted("AVERAGE not allowed.");
   }
+  if (reduce_op == ReduceOp::ADASUM && process_set != nullptr) {
+    return Status::InvalidArgument(
+        "ADASUM is not supported in process sets.");
+  }
+  if (prescale_factor != 1.0 || postscale_factor != 1.0) {
+    // Scaling is fused into host memory copies.
+    if (reduce_op == ReduceOp::ADASUM) {
+      return Status::InvalidArgument(
+          "Scale factors are not supported with ADASUM.");
+    }
+    if (device != CPU_DEVICE_ID) {
+      return Status::InvalidArgument(
+          "Scale factors are only supported for CPU tensors.");
+    }
+  }
+
+  std::vector<Request> messages;
+  std::vector<TensorTableEntry> entries;
+  messages.reserve(tensors.size());
+  entries.reserve(tensors.size());
+
+  for (size_t n = 0; n < tensors.size(); ++n) {
+    Request message;
+    message.set_request_rank(controller.GetRank());
+    message.set_tensor_name(names[n]);
+    message.set_tensor_type(tensors[n]->dtype());
+    message.set_device(device);
+
+    if (reduce_op == ReduceOp::ADASUM) {
+      message.set_request_type(Request::ADASUM);
+    } else {
+      message.set_request_type(Request::ALLREDUCE);
+      message.set_reduce_op(reduce_op);
+      message.set_prescale_factor(prescale_factor);
+      message.set_postscale_factor(postscale_factor);
+    }
+    for (int i = 0; i < tensors[n]->shape().dims(); ++i) {
+      message.add_tensor_shape((int64_t)tensors[n]->shape().dim_size(i));
+    }
+    messages.push_back(std::move(message));
+
+    TensorTableEntry e;
+    e.tensor_name = names[n];
+    e.context = contexts[n];
+    e.tensor = tensors[n];
+    e.output = outputs[n];
+    e.ready_event = ready_events[n];
+    e.device = device;
+    e.prescale_factor = prescale_factor;
+    e.postscale_factor = postscale_factor;
+    e.callback = callbacks[n];
+    entries.push_back(std::move(e));
+  }
+
+  if (horovod_global.shut_down) {
+    return SHUT_DOWN_ERROR;
+  }
+
+  if (tensors.size() == 1) {
+    status = tensor_queue.AddToTensorQueue(entries[0], messages[0]);
+  } else {
+    // Tensors enqueued together are negotiated and fused as a group.
+    std::vector<std::string> group_names(names);
+    int32_t group_id = group_table.RegisterGroup(std::move(group_names));
+    for (auto& message : messages) {
+      message.set_group_id(group_id);
+    }
+    status = tensor_queue.AddToTensorQueueMulti(entries, messages);
+    if (!status.ok()) {
+      group_table.DeregisterGroup(group_id);
+    }
+  }
+  if (status.ok()) {
+    for (auto& name : names) {
+      LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
+    }
+  }
+  return status;
+}
+
+// Contexts and controller must be initialized and the background thread
+// must be running before this function is called.
+Status EnqueueTensorAllgather(std::shared_ptr<OpContext> context,
+                              std::shared_ptr<Tensor> tensor,
+                              std::shared_ptr<ReadyEvent> ready_event,
+                              const std::string name, const int device,
+                              StatusCallback callback,
+                              int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+
   Request message;
-  message.set_request_rank(horovod_global.controller->GetRank());
+  message.set_request_rank(controller.GetRank());
   message.set_tensor_name(name);
   message.set_tensor_type(tensor->dtype());
   message.set_device(device);
-  
-  if (reduce_op == ReduceOp::ADASUM) {
-    message.set_request_type(Request::ADASUM);
-  } else {
-    message.set_request_type(Request::ALLREDUCE);
-  }
+  message.set_request_type(Request::ALLGATHER);
   for (int i = 0; i < tensor->shape().dims(); ++i) {
     message.add_tensor_shape((int64_t)tensor->shape().dim_size(i));
   }
@@ -816,7 +1444,6 @@ Status EnqueueTensorAllreduce(std::shared_ptr<OpContext> context,
   e.tensor_name = name;
   e.context = context;
   e.tensor = tensor;
-  e.output = output;
   e.ready_event = ready_event;
   e.device = device;
   e.callback = callback;
@@ -824,26 +1451,36 @@ Status EnqueueTensorAllreduce(std::shared_ptr<OpContext> context,
   if (horovod_global.shut_down) {
     return SHUT_DOWN_ERROR;
   }
-  status = horovod_global.tensor_queue.AddToTensorQueue(e, message);
+  status = ProcessSetTensorQueue(process_set).AddToTensorQueue(e, message);
   if (status.ok()) {
-    LOG(TRACE, horovod_global.controller->GetRank()) << "Enqueued " << name;
+    LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
   }
   return status;
 }
 
 // Contexts and controller must be initialized and the background thread
 // must be running before this function is called.
-Status EnqueueTensorAllgather(std::shared_ptr<OpContext> context,
+Status EnqueueTensorBroadcast(std::shared_ptr<OpContext> context,
                               std::shared_ptr<Tensor> tensor,
+                              std::shared_ptr<Tensor> output, int root_rank,
                               std::shared_ptr<ReadyEvent> ready_event,
                               const std::string name, const int device,
-                              StatusCallback callback) {
+                              StatusCallback callback,
+                              int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+
   Request message;
-  message.set_request_rank(horovod_global.controller->GetRank());
+  message.set_request_rank(controller.GetRank());
   message.set_tensor_name(name);
   message.set_tensor_type(tensor->dtype());
+  message.set_root_rank(root_rank);
   message.set_device(device);
-  message.set_request_type(Request::ALLGATHER);
+  message.set_request_type(Request::BROADCAST);
   for (int i = 0; i < tensor->shape().dims(); ++i) {
     message.add_tensor_shape((int64_t)tensor->shape().dim_size(i));
   }
@@ -852,6 +1489,8 @@ Status EnqueueTensorAllgather(std::shared_ptr<OpContext> context,
   e.tensor_name = name;
   e.context = context;
   e.tensor = tensor;
+  e.output = output;
+  e.root_rank = root_rank;
   e.ready_event = ready_event;
   e.device = device;
   e.callback = callback;
@@ -859,28 +1498,219 @@ Status EnqueueTensorAllgather(std::shared_ptr<OpContext> context,
   if (horovod_global.shut_down) {
     return SHUT_DOWN_ERROR;
   }
-  Status status = horovod_global.tensor_queue.AddToTensorQueue(e, message);
+  status = ProcessSetTensorQueue(process_set).AddToTensorQueue(e, message);
   if (status.ok()) {
-    LOG(TRACE, horovod_global.controller->GetRank()) << "Enqueued " << name;
+    LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
   }
   return status;
 }
 
 // Contexts and controller must be initialized and the background thread
 // must be running before this function is called.
-Status EnqueueTensorBroadcast(std::shared_ptr<OpContext> context,
-                              std::shared_ptr<Tensor> tensor,
-                              std::shared_ptr<Tensor> output, int root_rank,
-                              std::shared_ptr<ReadyEvent> ready_event,
-                              const std::string name, const int device,
-                              StatusCallback callback) {
+Status EnqueueTensorReducescatter(std::shared_ptr<OpContext> context,
+                                  std::shared_ptr<Tensor> tensor,
+                                  std::shared_ptr<ReadyEvent> ready_event,
+                                  const std::string name, const int device,
+                                  StatusCallback callback,
+                                  ReduceOp reduce_op,
+                                  int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+
+  if (reduce_op == ReduceOp::AVERAGE || reduce_op == ReduceOp::ADASUM) {
+    return Status::InvalidArgument(
+        ReduceOp_Name(reduce_op) + " is not supported for reducescatter.");
+  }
   Request message;
-  message.set_request_rank(horovod_global.controller->GetRank());
+  message.set_request_rank(controller.GetRank());
+  message.set_tensor_name(name);
+  message.set_tensor_type(tensor->dtype());
+  message.set_device(device);
+  message.set_request_type(Request::REDUCESCATTER);
+  message.set_reduce_op(reduce_op);
+  for (int i = 0; i < tensor->shape().dims(); ++i) {
+    message.add_tensor_shape((int64_t)tensor->shape().dim_size(i));
+  }
+
+  TensorTableEntry e;
+  e.tensor_name = name;
+  e.context = context;
+  e.tensor = tensor;
+  e.ready_event = ready_event;
+  e.device = device;
+  e.callback = callback;
+
+  if (horovod_global.shut_down) {
+    return SHUT_DOWN_ERROR;
+  }
+  status = ProcessSetTensorQueue(process_set).AddToTensorQueue(e, message);
+  if (status.ok()) {
+    LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
+  }
+  return status;
+}
+
+// Contexts and controller must be initialized and the background thread
+// must be running before this function is called.
+Status EnqueueTensorAlltoall(std::shared_ptr<OpContext> context,
+                             std::shared_ptr<Tensor> tensor,
+                             const std::vector<int64_t>& splits,
+                             std::shared_ptr<ReadyEvent> ready_event,
+                             const std::string name, const int device,
+                             StatusCallback callback,
+                             int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+
+  Request message;
+  message.set_request_rank(controller.GetRank());
+  message.set_tensor_name(name);
+  message.set_tensor_type(tensor->dtype());
+  message.set_device(device);
+  message.set_request_type(Request::ALLTOALL);
+  for (int i = 0; i < tensor->shape().dims(); ++i) {
+    message.add_tensor_shape((int64_t)tensor->shape().dim_size(i));
+  }
+  message.set_splits(splits);
+
+  TensorTableEntry e;
+  e.tensor_name = name;
+  e.context = context;
+  e.tensor = tensor;
+  e.ready_event = ready_event;
+  e.device = device;
+  e.callback = callback;
+
+  if (horovod_global.shut_down) {
+    return SHUT_DOWN_ERROR;
+  }
+  status = ProcessSetTensorQueue(process_set).AddToTensorQueue(e, message);
+  if (status.ok()) {
+    LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
+  }
+  return status;
+}
+
+// Contexts and controller must be initialized and the background thread
+// must be running before this function is called.
+Status EnqueueTensorSparseAllreduce(std::shared_ptr<OpContext> context,
+                                    std::shared_ptr<Tensor> indices,
+                                    std::shared_ptr<Tensor> values,
+                                    int64_t dense_rows, bool deduplicate,
+                                    std::shared_ptr<ReadyEvent> ready_event,
+                                    const std::string name, const int device,
+                                    StatusCallback callback,
+                                    int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+
+  if (device != CPU_DEVICE_ID) {
+    return Status::InvalidArgument(
+        "Sparse allreduce is only supported for CPU tensors.");
+  }
+  if (indices->dtype() != HOROVOD_INT64 || indices->shape().dims() != 1) {
+    return Status::InvalidArgument(
+        "Sparse allreduce indices must be a vector of int64.");
+  }
+  if (values->shape().dims() == 0 ||
+      values->shape().dim_size(0) != indices->shape().dim_size(0)) {
+    return Status::InvalidArgument(
+        "Sparse allreduce needs one index for every row of the values.");
+  }
+  // Rows are summed into the dense tensor when the sparse allreduce
+  // switches to a dense one, so their indices have to fit into it.
+  if (dense_rows > 0) {
+    auto* index_data = (const int64_t*)indices->data();
+    for (int64_t i = 0; i < indices->shape().dim_size(0); ++i) {
+      if (index_data[i] < 0 || index_data[i] >= dense_rows) {
+        return Status::InvalidArgument(
+            "Sparse allreduce index " + std::to_string(index_data[i]) +
+            " is out of range for " + std::to_string(dense_rows) + " rows.");
+      }
+    }
+  }
+
+  Request message;
+  message.set_request_rank(controller.GetRank());
+  message.set_tensor_name(name);
+  message.set_tensor_type(values->dtype());
+  message.set_device(device);
+  message.set_request_type(Request::SPARSE_ALLREDUCE);
+  for (int i = 0; i < values->shape().dims(); ++i) {
+    message.add_tensor_shape((int64_t)values->shape().dim_size(i));
+  }
+
+  TensorTableEntry e;
+  e.tensor_name = name;
+  e.context = context;
+  e.tensor = values;
+  e.indices = indices;
+  e.dense_rows = dense_rows;
+  e.deduplicate = deduplicate;
+  e.ready_event = ready_event;
+  e.device = device;
+  e.callback = callback;
+
+  if (horovod_global.shut_down) {
+    return SHUT_DOWN_ERROR;
+  }
+  status = ProcessSetTensorQueue(process_set).AddToTensorQueue(e, message);
+  if (status.ok()) {
+    LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
+  }
+  return status;
+}
+
+// Contexts and controller must be initialized and the background thread
+// must be running before this function is called.
+Status EnqueueTensorReduce(std::shared_ptr<OpContext> context,
+                           std::shared_ptr<Tensor> tensor,
+                           std::shared_ptr<Tensor> output, int root_rank,
+                           std::shared_ptr<ReadyEvent> ready_event,
+                           const std::string name, const int device,
+                           StatusCallback callback, ReduceOp reduce_op,
+                           int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+
+  // AVERAGE is taken care of in the framework layer, as for allreduce.
+  if (reduce_op == ReduceOp::AVERAGE || reduce_op == ReduceOp::ADASUM) {
+    return Status::InvalidArgument("Reduce op " + ReduceOp_Name(reduce_op) +
+                                   " is not supported with reduce.");
+  }
+  if (device != CPU_DEVICE_ID) {
+    return Status::InvalidArgument(
+        "Reduce is only supported for CPU tensors.");
+  }
+  if (root_rank < 0 || root_rank >= controller.GetSize()) {
+    return Status::InvalidArgument("Root rank " + std::to_string(root_rank) +
+                                   " is out of range.");
+  }
+
+  Request message;
+  message.set_request_rank(controller.GetRank());
   message.set_tensor_name(name);
   message.set_tensor_type(tensor->dtype());
   message.set_root_rank(root_rank);
   message.set_device(device);
-  message.set_request_type(Request::BROADCAST);
+  message.set_request_type(Request::REDUCE);
+  message.set_reduce_op(reduce_op);
   for (int i = 0; i < tensor->shape().dims(); ++i) {
     message.add_tensor_shape((int64_t)tensor->shape().dim_size(i));
   }
@@ -898,9 +1728,117 @@ Status EnqueueTensorBroadcast(std::shared_ptr<OpContext> context,
   if (horovod_global.shut_down) {
     return SHUT_DOWN_ERROR;
   }
-  Status status = horovod_global.tensor_queue.AddToTensorQueue(e, message);
+  status = ProcessSetTensorQueue(process_set).AddToTensorQueue(e, message);
   if (status.ok()) {
-    LOG(TRACE, horovod_global.controller->GetRank()) << "Enqueued " << name;
+    LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
+  }
+  return status;
+}
+
+// Contexts and controller must be initialized and the background thread
+// must be running before this function is called.
+Status EnqueueTensorGather(std::shared_ptr<OpContext> context,
+                           std::shared_ptr<Tensor> tensor, int root_rank,
+                           std::shared_ptr<ReadyEvent> ready_event,
+                           const std::string name, const int device,
+                           StatusCallback callback,
+                           int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+
+  if (device != CPU_DEVICE_ID) {
+    return Status::InvalidArgument(
+        "Gather is only supported for CPU tensors.");
+  }
+  if (root_rank < 0 || root_rank >= controller.GetSize()) {
+    return Status::InvalidArgument("Root rank " + std::to_string(root_rank) +
+                                   " is out of range.");
+  }
+
+  Request message;
+  message.set_request_rank(controller.GetRank());
+  message.set_tensor_name(name);
+  message.set_tensor_type(tensor->dtype());
+  message.set_root_rank(root_rank);
+  message.set_device(device);
+  message.set_request_type(Request::GATHER);
+  for (int i = 0; i < tensor->shape().dims(); ++i) {
+    message.add_tensor_shape((int64_t)tensor->shape().dim_size(i));
+  }
+
+  TensorTableEntry e;
+  e.tensor_name = name;
+  e.context = context;
+  e.tensor = tensor;
+  e.root_rank = root_rank;
+  e.ready_event = ready_event;
+  e.device = device;
+  e.callback = callback;
+
+  if (horovod_global.shut_down) {
+    return SHUT_DOWN_ERROR;
+  }
+  status = ProcessSetTensorQueue(process_set).AddToTensorQueue(e, message);
+  if (status.ok()) {
+    LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
+  }
+  return status;
+}
+
+// Contexts and controller must be initialized and the background thread
+// must be running before this function is called.
+Status EnqueueTensorScatter(std::shared_ptr<OpContext> context,
+                            std::shared_ptr<Tensor> tensor, int root_rank,
+                            std::shared_ptr<ReadyEvent> ready_event,
+                            const std::string name, const int device,
+                            StatusCallback callback,
+                            int32_t process_set_id) {
+  ProcessSet* process_set;
+  Status status = GetProcessSet(process_set_id, device, process_set);
+  if (!status.ok()) {
+    return status;
+  }
+  auto& controller = ProcessSetController(process_set);
+
+  if (device != CPU_DEVICE_ID) {
+    return Status::InvalidArgument(
+        "Scatter is only supported for CPU tensors.");
+  }
+  if (root_rank < 0 || root_rank >= controller.GetSize()) {
+    return Status::InvalidArgument("Root rank " + std::to_string(root_rank) +
+                                   " is out of range.");
+  }
+
+  Request message;
+  message.set_request_rank(controller.GetRank());
+  message.set_tensor_name(name);
+  message.set_tensor_type(tensor->dtype());
+  message.set_root_rank(root_rank);
+  message.set_device(device);
+  message.set_request_type(Request::SCATTER);
+  for (int i = 0; i < tensor->shape().dims(); ++i) {
+    message.add_tensor_shape((int64_t)tensor->shape().dim_size(i));
+  }
+
+  TensorTableEntry e;
+  e.tensor_name = name;
+  e.context = context;
+  e.tensor = tensor;
+  e.root_rank = root_rank;
+  e.ready_event = ready_event;
+  e.device = device;
+  e.callback = callback;
+
+  if (horovod_global.shut_down) {
+    return SHUT_DOWN_ERROR;
+  }
+  status = ProcessSetTensorQueue(process_set).AddToTensorQueue(e, message);
+  if (status.ok()) {
+    LOG(TRACE, controller.GetRank()) << "Enqueued " << name;
   }
   return status;
 }
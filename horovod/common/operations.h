@@ -32,13 +32,6 @@ namespace common {
 // Check that Horovod is initialized.
 Status CheckInitialized();
 
-enum ReduceOp {
-    AVERAGE = 0, // This value should never appear past framework code, as
-                 // averaging is taken care of there.
-    SUM = 1,
-    ADASUM = 2
-};
-
 extern "C" {
 
 // C interface to initialize Horovod.
@@ -49,6 +42,20 @@ void horovod_init(const int *ranks, int nranks);
 void horovod_init_comm(MPI_Comm comm);
 #endif
 
+// C interface to register a process set of the given ranks. Process sets must
+// be registered on all ranks in the same order before horovod_init() is
+// called. Returns the ID of the process set, or -1 if Horovod is running.
+int horovod_add_process_set(const int* ranks, int nranks);
+
+// C interface to get the rank of the current process within the given
+// process set. Returns -1 if Horovod is not initialized or the current
+// process is not a member of the process set.
+int horovod_process_set_rank(int process_set_id);
+
+// C interface to return the number of processes in the given process set.
+// Returns -1 if Horovod is not initialized or there is no such process set.
+int horovod_process_set_size(int process_set_id);
+
 // C interface to shut down Horovod.
 void horovod_shutdown();
 
@@ -102,28 +109,135 @@ int horovod_reduce_op_sum();
 // C interface to return value of the ReduceOp::ADASUM enum field.
 int horovod_reduce_op_adasum();
 
+// C interface to return value of the ReduceOp::MIN enum field.
+int horovod_reduce_op_min();
+
+// C interface to return value of the ReduceOp::MAX enum field.
+int horovod_reduce_op_max();
+
+// C interface to return value of the ReduceOp::PRODUCT enum field.
+int horovod_reduce_op_product();
+
 }
 
+// Tensors are enqueued into the process set with the given ID, which this
+// rank must be a member of, and ranks are numbered within it. Process sets
+// other than the global one only support CPU tensors.
+
+// Reduces the tensor over all ranks into the output. The tensor is multiplied
+// by prescale_factor before and by postscale_factor after the reduction, as
+// part of the copies into and out of the fusion buffer. Scale factors other
+// than 1 are only supported for CPU tensors.
 Status EnqueueTensorAllreduce(std::shared_ptr<OpContext> context,
                               std::shared_ptr<Tensor> tensor,
                               std::shared_ptr<Tensor> output,
                               std::shared_ptr<ReadyEvent> ready_event,
                               const std::string name, const int device,
                               StatusCallback callback,
-                              ReduceOp reduce_op = ReduceOp::SUM);
+                              ReduceOp reduce_op = ReduceOp::SUM,
+                              double prescale_factor = 1.0,
+                              double postscale_factor = 1.0,
+                              int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
+
+// Enqueues several tensors as a group. The group is negotiated as a unit, so
+// none of its tensors is processed before all of them are ready on all ranks,
+// and its tensors are only fused with each other. Tensors must be enqueued in
+// the same groups and in the same order on all ranks.
+Status EnqueueTensorAllreduces(
+    const std::vector<std::shared_ptr<OpContext>>& contexts,
+    const std::vector<std::shared_ptr<Tensor>>& tensors,
+    const std::vector<std::shared_ptr<Tensor>>& outputs,
+    const std::vector<std::shared_ptr<ReadyEvent>>& ready_events,
+    const std::vector<std::string>& names, const int device,
+    const std::vector<StatusCallback>& callbacks,
+    ReduceOp reduce_op = ReduceOp::SUM, double prescale_factor = 1.0,
+    double postscale_factor = 1.0,
+    int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
 
 Status EnqueueTensorAllgather(std::shared_ptr<OpContext> context,
                               std::shared_ptr<Tensor> tensor,
                               std::shared_ptr<ReadyEvent> ready_event,
                               const std::string name, const int device,
-                              StatusCallback callback);
+                              StatusCallback callback,
+                              int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
 
 Status EnqueueTensorBroadcast(std::shared_ptr<OpContext> context,
                               std::shared_ptr<Tensor> tensor,
                               std::shared_ptr<Tensor> output, int root_rank,
                               std::shared_ptr<ReadyEvent> ready_event,
                               const std::string name, const int device,
-                              StatusCallback callback);
+                              StatusCallback callback,
+                              int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
+
+// Reduces the tensor over all ranks and returns the slice of its first
+// dimension assigned to this rank. The output is allocated through the
+// context.
+Status EnqueueTensorReducescatter(std::shared_ptr<OpContext> context,
+                                  std::shared_ptr<Tensor> tensor,
+                                  std::shared_ptr<ReadyEvent> ready_event,
+                                  const std::string name, const int device,
+                                  StatusCallback callback,
+                                  ReduceOp reduce_op = ReduceOp::SUM,
+                                  int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
+
+// Sends splits[i] rows of the first dimension of the tensor to rank i, in
+// order, and concatenates the rows received from all ranks into the output,
+// which is allocated through the context.
+Status EnqueueTensorAlltoall(std::shared_ptr<OpContext> context,
+                             std::shared_ptr<Tensor> tensor,
+                             const std::vector<int64_t>& splits,
+                             std::shared_ptr<ReadyEvent> ready_event,
+                             const std::string name, const int device,
+                             StatusCallback callback,
+                             int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
+
+// Sums the rows of a tensor given as values and their int64 indices over all
+// ranks. The rows and indices of all ranks are concatenated into the outputs
+// 0 and 1 of the context, and rows with the same index are summed if
+// deduplicate is set. When the rows of all ranks outnumber
+// HOROVOD_SPARSE_DENSITY_THRESHOLD times dense_rows, the dense tensor is
+// allreduced instead and the outputs hold all of its rows. Only CPU tensors
+// are supported.
+Status EnqueueTensorSparseAllreduce(std::shared_ptr<OpContext> context,
+                                    std::shared_ptr<Tensor> indices,
+                                    std::shared_ptr<Tensor> values,
+                                    int64_t dense_rows, bool deduplicate,
+                                    std::shared_ptr<ReadyEvent> ready_event,
+                                    const std::string name, const int device,
+                                    StatusCallback callback,
+                                    int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
+
+// Reduces the tensor over all ranks into the output of the root rank. The
+// output of other ranks holds their input. Only CPU tensors are supported.
+Status EnqueueTensorReduce(std::shared_ptr<OpContext> context,
+                           std::shared_ptr<Tensor> tensor,
+                           std::shared_ptr<Tensor> output, int root_rank,
+                           std::shared_ptr<ReadyEvent> ready_event,
+                           const std::string name, const int device,
+                           StatusCallback callback,
+                           ReduceOp reduce_op = ReduceOp::SUM,
+                           int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
+
+// Concatenates the tensors of all ranks along the first dimension into the
+// output of the root rank, which is allocated through the context. Outputs of
+// other ranks have no rows. Only CPU tensors are supported.
+Status EnqueueTensorGather(std::shared_ptr<OpContext> context,
+                           std::shared_ptr<Tensor> tensor, int root_rank,
+                           std::shared_ptr<ReadyEvent> ready_event,
+                           const std::string name, const int device,
+                           StatusCallback callback,
+                           int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
+
+// Splits the tensor of the root rank along the first dimension as for
+// reducescatter and sends every rank its slice, which is allocated through
+// the context. All ranks pass tensors of the same shape. Only CPU tensors are
+// supported.
+Status EnqueueTensorScatter(std::shared_ptr<OpContext> context,
+                            std::shared_ptr<Tensor> tensor, int root_rank,
+                            std::shared_ptr<ReadyEvent> ready_event,
+                            const std::string name, const int device,
+                            StatusCallback callback,
+                            int32_t process_set_id = GLOBAL_PROCESS_SET_ID);
 
 Status EnqueueJoin(std::shared_ptr<OpContext> context,
                               std::shared_ptr<ReadyEvent> ready_event,
@@ -0,0 +1,94 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#include "allreduce_algorithm_table.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+
+#include "../logging.h"
+
+namespace horovod {
+namespace common {
+
+AllreduceAlgorithmTable::AllreduceAlgorithmTable(
+    std::vector<Rule> rules, std::vector<AllreduceAlgorithm> algorithms)
+    : rules_(std::move(rules)), algorithms_(std::move(algorithms)) {}
+
+bool AllreduceAlgorithmTable::Parse(const std::string& spec) {
+  std::vector<Rule> rules;
+  std::stringstream rules_stream(spec);
+  std::string rule_spec;
+  while (std::getline(rules_stream, rule_spec, ',')) {
+    std::stringstream rule_stream(rule_spec);
+    std::string max_bytes, max_ranks, algorithm;
+    if (!std::getline(rule_stream, max_bytes, ':') ||
+        !std::getline(rule_stream, max_ranks, ':') ||
+        !std::getline(rule_stream, algorithm)) {
+      return false;
+    }
+
+    Rule rule;
+    try {
+      rule.max_bytes = max_bytes == "*" ? std::numeric_limits<int64_t>::max()
+                                        : std::stoll(max_bytes);
+      rule.max_ranks = max_ranks == "*" ? std::numeric_limits<int>::max()
+                                        : std::stoi(max_ranks);
+    } catch (const std::exception&) {
+      return false;
+    }
+    if (!ParseAllreduceAlgorithm(algorithm, rule.algorithm) ||
+        !Supports(rule.algorithm)) {
+      return false;
+    }
+    rules.push_back(rule);
+  }
+
+  if (rules.empty()) {
+    return false;
+  }
+  rules_ = rules;
+  return true;
+}
+
+void AllreduceAlgorithmTable::ParseFromEnv() {
+  auto horovod_cpu_allreduce_table = std::getenv(HOROVOD_CPU_ALLREDUCE_TABLE);
+  if (horovod_cpu_allreduce_table != nullptr &&
+      !Parse(horovod_cpu_allreduce_table)) {
+    LOG(WARNING) << "Ignoring malformed " << HOROVOD_CPU_ALLREDUCE_TABLE << " "
+                 << horovod_cpu_allreduce_table << ".";
+  }
+}
+
+AllreduceAlgorithm AllreduceAlgorithmTable::Select(int64_t bytes,
+                                                   int num_ranks) const {
+  for (auto& rule : rules_) {
+    if (bytes <= rule.max_bytes && num_ranks <= rule.max_ranks) {
+      return rule.algorithm;
+    }
+  }
+  return AllreduceAlgorithm::LIBRARY;
+}
+
+bool AllreduceAlgorithmTable::Supports(AllreduceAlgorithm algorithm) const {
+  return algorithm == AllreduceAlgorithm::LIBRARY ||
+         std::find(algorithms_.begin(), algorithms_.end(), algorithm) !=
+             algorithms_.end();
+}
+
+} // namespace common
+} // namespace horovod
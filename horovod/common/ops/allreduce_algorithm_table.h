@@ -0,0 +1,65 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#ifndef HOROVOD_ALLREDUCE_ALGORITHM_TABLE_H
+#define HOROVOD_ALLREDUCE_ALGORITHM_TABLE_H
+
+#include <string>
+#include <vector>
+
+#include "../common.h"
+
+namespace horovod {
+namespace common {
+
+// Chooses an allreduce algorithm by message size and number of ranks.
+//
+// The table is a list of rules, the first rule whose limits cover the message
+// wins. It can be replaced through HOROVOD_CPU_ALLREDUCE_TABLE, given as a
+// comma-separated list of <max_bytes>:<max_ranks>:<algorithm> rules where
+// either limit may be '*', e.g. "16384:*:tree,1048576:*:rabenseifner,*:*:ring".
+class AllreduceAlgorithmTable {
+public:
+  struct Rule {
+    int64_t max_bytes;
+    int max_ranks;
+    AllreduceAlgorithm algorithm;
+  };
+
+  // Rules may only use the given algorithms of the communication library, or
+  // LIBRARY.
+  AllreduceAlgorithmTable(std::vector<Rule> rules,
+                          std::vector<AllreduceAlgorithm> algorithms);
+
+  // Replaces the rules by the ones in the given specification. Returns false
+  // and keeps the current rules if it cannot be parsed.
+  bool Parse(const std::string& spec);
+
+  // Replaces the rules by HOROVOD_CPU_ALLREDUCE_TABLE if it is set.
+  void ParseFromEnv();
+
+  AllreduceAlgorithm Select(int64_t bytes, int num_ranks) const;
+
+  bool Supports(AllreduceAlgorithm algorithm) const;
+
+private:
+  std::vector<Rule> rules_;
+  std::vector<AllreduceAlgorithm> algorithms_;
+};
+
+} // namespace common
+} // namespace horovod
+
+#endif // HOROVOD_ALLREDUCE_ALGORITHM_TABLE_H
@@ -16,11 +16,89 @@
 
 #include "collective_operations.h"
 
+#include <unordered_map>
+
+#include "../half.h"
+
 namespace horovod {
 namespace common {
 
+namespace {
+
+template <class T, class S>
+void ScaleElements(const void* input, void* output, int64_t num_elements,
+                   S scale_factor) {
+  auto* in = (const T*)input;
+  auto* out = (T*)output;
+  for (int64_t i = 0; i < num_elements; ++i) {
+    out[i] = (T)(in[i] * scale_factor);
+  }
+}
+
+template <class T>
+void AddElements(void* inout, const void* input, int64_t num_elements) {
+  auto* acc = (T*)inout;
+  auto* in = (const T*)input;
+  for (int64_t i = 0; i < num_elements; ++i) {
+    acc[i] += in[i];
+  }
+}
+
+void AddFloat16Elements(void* inout, const void* input, int64_t num_elements) {
+  auto* acc = (unsigned short*)inout;
+  auto* in = (unsigned short*)input;
+  for (int64_t i = 0; i < num_elements; ++i) {
+    float acc_float, in_float;
+    HalfBits2Float(acc + i, &acc_float);
+    HalfBits2Float(in + i, &in_float);
+    acc_float += in_float;
+    Float2HalfBits(&acc_float, acc + i);
+  }
+}
+
+// Sums num_elements elements of input into inout.
+void AddElements(void* inout, const void* input, int64_t num_elements,
+                 DataType dtype) {
+  switch (dtype) {
+  case HOROVOD_UINT8:
+    AddElements<uint8_t>(inout, input, num_elements);
+    break;
+  case HOROVOD_INT8:
+    AddElements<int8_t>(inout, input, num_elements);
+    break;
+  case HOROVOD_UINT16:
+    AddElements<uint16_t>(inout, input, num_elements);
+    break;
+  case HOROVOD_INT16:
+    AddElements<int16_t>(inout, input, num_elements);
+    break;
+  case HOROVOD_INT32:
+    AddElements<int32_t>(inout, input, num_elements);
+    break;
+  case HOROVOD_INT64:
+    AddElements<int64_t>(inout, input, num_elements);
+    break;
+  case HOROVOD_FLOAT16:
+    AddFloat16Elements(inout, input, num_elements);
+    break;
+  case HOROVOD_FLOAT32:
+    AddElements<float>(inout, input, num_elements);
+    break;
+  case HOROVOD_FLOAT64:
+    AddElements<double>(inout, input, num_elements);
+    break;
+  default:
+    throw std::logic_error("Type " + DataType_Name(dtype) +
+                           " is not supported for summation.");
+  }
+}
+
+int64_t PadTo8Bytes(int64_t size) { return (size + 7) / 8 * 8; }
+
+} // namespace
+
 HorovodOp::HorovodOp(HorovodGlobalState* global_state)
-    : global_state_(global_state) {}
+    : global_state_(global_state), controller_(global_state->controller) {}
 
 int64_t HorovodOp::NumElements(std::vector<TensorTableEntry>& entries) {
   int64_t num_elements = 0;
@@ -30,17 +108,113 @@ int64_t HorovodOp::NumElements(std::vector<TensorTableEntry>& entries) {
   return num_elements;
 }
 
+FusionBufferManager& HorovodOp::FusionBuffer() const {
+  return fusion_buffer_ != nullptr ? *fusion_buffer_
+                                   : global_state_->fusion_buffer;
+}
+
+int HorovodOp::FusionBufferStream(int device) const {
+  return fusion_buffer_ != nullptr ? 0
+                                   : global_state_->FusionBufferStream(device);
+}
+
+uint64_t
+HorovodOp::FusionBufferGeneration(const TensorTableEntry& first_entry) const {
+  return FusionBuffer().GetBufferGeneration(
+      first_entry.device, first_entry.context->framework(),
+      FusionBufferStream(first_entry.device));
+}
+
 // Allreduce
 AllreduceOp::AllreduceOp(HorovodGlobalState* global_state)
     : HorovodOp(global_state) {}
 
+std::vector<AllreduceOp::DataTypeSegment> AllreduceOp::GetDataTypeSegments(
+    const std::vector<TensorTableEntry>& entries) const {
+  std::vector<DataTypeSegment> segments;
+  int64_t offset = 0;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    auto& e = entries[i];
+    if (segments.empty() || segments.back().dtype != e.tensor->dtype()) {
+      segments.push_back({e.tensor->dtype(), i, i, offset, 0});
+    }
+    auto& segment = segments.back();
+    segment.end = i + 1;
+    segment.num_elements += e.tensor->shape().num_elements();
+    offset += e.tensor->size();
+  }
+  return segments;
+}
+
+std::string AllreduceOp::PersistentCollectiveKey(
+    const std::vector<TensorTableEntry>& entries,
+    const std::vector<DataTypeSegment>& segments, ReduceOp reduce_op) const {
+  std::string key =
+      std::to_string(FusionBufferStream(entries[0].device)) +
+      ":" + ReduceOp_Name(reduce_op);
+  for (auto& segment : segments) {
+    key += ":" + std::to_string(segment.dtype) + "x" +
+           std::to_string(segment.num_elements);
+  }
+  return key;
+}
+
+void AllreduceOp::ScaleBuffer(double scale_factor, const void* input,
+                              void* output, int64_t num_elements,
+                              DataType dtype) {
+  switch (dtype) {
+  case HOROVOD_UINT8:
+    ScaleElements<uint8_t>(input, output, num_elements, scale_factor);
+    break;
+  case HOROVOD_INT8:
+    ScaleElements<int8_t>(input, output, num_elements, scale_factor);
+    break;
+  case HOROVOD_UINT16:
+    ScaleElements<uint16_t>(input, output, num_elements, scale_factor);
+    break;
+  case HOROVOD_INT16:
+    ScaleElements<int16_t>(input, output, num_elements, scale_factor);
+    break;
+  case HOROVOD_INT32:
+    ScaleElements<int32_t>(input, output, num_elements, scale_factor);
+    break;
+  case HOROVOD_INT64:
+    ScaleElements<int64_t>(input, output, num_elements, scale_factor);
+    break;
+  case HOROVOD_FLOAT16:
+    float16_scale(input, output, num_elements, (float)scale_factor);
+    break;
+  case HOROVOD_FLOAT32:
+    // Multiplying by a float factor keeps the loop in single precision.
+    ScaleElements<float>(input, output, num_elements, (float)scale_factor);
+    break;
+  case HOROVOD_FLOAT64:
+    ScaleElements<double>(input, output, num_elements, scale_factor);
+    break;
+  default:
+    throw std::logic_error("Type " + DataType_Name(dtype) +
+                           " is not supported for scaling.");
+  }
+}
+
+void AllreduceOp::PrescaleEntry(const TensorTableEntry& e) {
+  ScaleBuffer(e.prescale_factor, e.tensor->data(), (void*)e.output->data(),
+              e.tensor->shape().num_elements(), e.tensor->dtype());
+}
+
+void AllreduceOp::PostscaleEntry(const TensorTableEntry& e) {
+  ScaleBuffer(e.postscale_factor, e.output->data(), (void*)e.output->data(),
+              e.output->shape().num_elements(), e.output->dtype());
+}
+
 void AllreduceOp::MemcpyInFusionBuffer(
     const std::vector<TensorTableEntry>& entries, const void*& fused_input_data,
     void*& buffer_data, size_t& buffer_len) {
   // Access the fusion buffer.
   auto& first_entry = entries[0];
-  auto buffer = global_state_->fusion_buffer.GetBuffer(
-      first_entry.device, first_entry.context->framework(), global_state_->current_nccl_stream);
+  auto buffer = FusionBuffer().GetBuffer(
+      first_entry.device, first_entry.context->framework(),
+      FusionBufferStream(first_entry.device));
   buffer_data = const_cast<void*>(buffer->AccessData(first_entry.context));
 
   int64_t offset = 0;
@@ -69,6 +243,11 @@ void AllreduceOp::MemcpyOutFusionBuffer(
 void AllreduceOp::MemcpyEntryInFusionBuffer(
     const std::vector<TensorTableEntry>& entries, const TensorTableEntry& e,
     void* buffer_data_at_offset) {
+  if (e.prescale_factor != 1.0) {
+    ScaleBuffer(e.prescale_factor, e.tensor->data(), buffer_data_at_offset,
+                e.tensor->shape().num_elements(), e.tensor->dtype());
+    return;
+  }
   std::memcpy(buffer_data_at_offset, e.tensor->data(),
               (size_t)e.tensor->size());
 }
@@ -76,6 +255,12 @@ void AllreduceOp::MemcpyEntryInFusionBuffer(
 void AllreduceOp::MemcpyEntryOutFusionBuffer(
     const std::vector<TensorTableEntry>& entries,
     const void* buffer_data_at_offset, TensorTableEntry& e) {
+  if (e.postscale_factor != 1.0) {
+    ScaleBuffer(e.postscale_factor, buffer_data_at_offset,
+                (void*)e.output->data(), e.output->shape().num_elements(),
+                e.output->dtype());
+    return;
+  }
   std::memcpy((void*)e.output->data(), buffer_data_at_offset,
               (size_t)e.output->size());
 }
@@ -87,8 +272,8 @@ AllgatherOp::AllgatherOp(HorovodGlobalState* global_state)
 Status AllgatherOp::AllocateOutput(std::vector<TensorTableEntry>& entries,
                                    const Response& response,
                                    int64_t**& entry_component_sizes,
-                                   int*& recvcounts) {
-  int global_size = global_state_->controller->GetSize();
+                                   int64_t*& recvcounts) {
+  int global_size = controller_->GetSize();
   for (size_t ec = 0; ec < entries.size(); ++ec) {
     auto& e = entries[ec];
     // Every tensor participating in Allgather operation may have different
@@ -126,8 +311,9 @@ Status AllgatherOp::AllocateOutput(std::vector<TensorTableEntry>& entries,
   return Status::OK();
 }
 
-void AllgatherOp::SetDisplacements(const int* recvcounts, int*& displcmnts) {
-  int global_size = global_state_->controller->GetSize();
+void AllgatherOp::SetDisplacements(const int64_t* recvcounts,
+                                   int64_t*& displcmnts) {
+  int global_size = controller_->GetSize();
   for (int rc = 0; rc < global_size; ++rc) {
     if (rc == 0) {
       displcmnts[rc] = 0;
@@ -139,10 +325,10 @@ void AllgatherOp::SetDisplacements(const int* recvcounts, int*& displcmnts) {
 
 void AllgatherOp::SetEntryComponentOffsets(
     const std::vector<TensorTableEntry>& entries,
-    const int64_t* const* entry_component_sizes, const int* recvcounts,
+    const int64_t* const* entry_component_sizes, const int64_t* recvcounts,
     int64_t**& entry_component_offsets) {
-  unsigned int rank_displacement = 0;
-  int global_size = global_state_->controller->GetSize();
+  int64_t rank_displacement = 0;
+  int global_size = controller_->GetSize();
   for (int rc = 0; rc < global_size; ++rc) {
     for (size_t ec = 0; ec < entries.size(); ++ec) {
       if (ec == 0) {
@@ -157,15 +343,16 @@ void AllgatherOp::SetEntryComponentOffsets(
 }
 
 void AllgatherOp::MemcpyInFusionBuffer(
-    const std::vector<TensorTableEntry>& entries, const int* displcmnts,
+    const std::vector<TensorTableEntry>& entries, const int64_t* displcmnts,
     int element_size, void*& buffer_data) {
   // Access the fusion buffer.
   auto& first_entry = entries[0];
-  auto buffer = global_state_->fusion_buffer.GetBuffer(
-      first_entry.device, first_entry.context->framework(), global_state_->current_nccl_stream);
+  auto buffer = FusionBuffer().GetBuffer(
+      first_entry.device, first_entry.context->framework(),
+      FusionBufferStream(first_entry.device));
   buffer_data = const_cast<void*>(buffer->AccessData(first_entry.context));
 
-  int64_t offset = displcmnts[global_state_->controller->GetRank()] * element_size;
+  int64_t offset = displcmnts[controller_->GetRank()] * element_size;
   for (auto& e : entries) {
     void* buffer_data_at_offset = (uint8_t*)buffer_data + offset;
     MemcpyEntryInFusionBuffer(entries, e, buffer_data_at_offset);
@@ -178,7 +365,7 @@ void AllgatherOp::MemcpyOutFusionBuffer(
     const int64_t* const* entry_component_sizes, const void* buffer_data,
     int element_size, std::vector<TensorTableEntry>& entries) {
   // Copy memory out of the fusion buffer.
-  int global_size = global_state_->controller->GetSize();
+  int global_size = controller_->GetSize();
   for (size_t ec = 0; ec < entries.size(); ++ec) {
     auto& e = entries[ec];
     int64_t copy_offset = 0;
@@ -211,7 +398,552 @@ void AllgatherOp::MemcpyEntryOutFusionBuffer(
 BroadcastOp::BroadcastOp(HorovodGlobalState* global_state)
     : HorovodOp(global_state) {}
 
+void* BroadcastOp::GetFusionBuffer(
+    const std::vector<TensorTableEntry>& entries) {
+  auto& first_entry = entries[0];
+  auto buffer = FusionBuffer().GetBuffer(
+      first_entry.device, first_entry.context->framework(),
+      FusionBufferStream(first_entry.device));
+  return const_cast<void*>(buffer->AccessData(first_entry.context));
+}
+
+int64_t BroadcastOp::FusedByteSize(
+    const std::vector<TensorTableEntry>& entries) {
+  int64_t size = 0;
+  for (auto& e : entries) {
+    size += e.tensor->size();
+  }
+  return size;
+}
+
+void BroadcastOp::MemcpyInFusionBuffer(
+    const std::vector<TensorTableEntry>& entries, void*& buffer_data) {
+  buffer_data = GetFusionBuffer(entries);
+
+  int64_t offset = 0;
+  for (auto& e : entries) {
+    void* buffer_data_at_offset = (uint8_t*)buffer_data + offset;
+    MemcpyEntryInFusionBuffer(entries, e, buffer_data_at_offset);
+    offset += e.tensor->size();
+  }
+}
+
+void BroadcastOp::MemcpyOutFusionBuffer(
+    const void* buffer_data, std::vector<TensorTableEntry>& entries) {
+  int64_t offset = 0;
+  for (auto& e : entries) {
+    void* buffer_data_at_offset = (uint8_t*)buffer_data + offset;
+    MemcpyEntryOutFusionBuffer(entries, buffer_data_at_offset, e);
+    offset += e.output->size();
+  }
+}
+
+void BroadcastOp::MemcpyEntryInFusionBuffer(
+    const std::vector<TensorTableEntry>& entries, const TensorTableEntry& e,
+    void* buffer_data_at_offset) {
+  std::memcpy(buffer_data_at_offset, e.tensor->data(),
+              (size_t)e.tensor->size());
+}
+
+void BroadcastOp::MemcpyEntryOutFusionBuffer(
+    const std::vector<TensorTableEntry>& entries,
+    const void* buffer_data_at_offset, TensorTableEntry& e) {
+  std::memcpy((void*)e.output->data(), buffer_data_at_offset,
+              (size_t)e.output->size());
+}
+
+// Reducescatter
+ReducescatterOp::ReducescatterOp(HorovodGlobalState* global_state)
+    : HorovodOp(global_state) {}
+
+std::vector<std::vector<TensorShape>> ReducescatterOp::ComputeOutputShapes(
+    const std::vector<TensorTableEntry>& entries, int num_ranks) const {
+  std::vector<std::vector<TensorShape>> output_shapes;
+  output_shapes.reserve(entries.size());
+  for (auto& e : entries) {
+    const auto& tensor_shape = e.tensor->shape();
+    TensorShape single_slice_shape;
+    for (int i = 1; i < tensor_shape.dims(); ++i) {
+      single_slice_shape.AddDim(tensor_shape.dim_size(i));
+    }
+
+    int64_t slices = tensor_shape.dim_size(0);
+    std::vector<TensorShape> entry_shapes;
+    entry_shapes.reserve(num_ranks);
+    for (int rc = 0; rc < num_ranks; ++rc) {
+      TensorShape shape;
+      shape.AddDim(slices / num_ranks + (rc < slices % num_ranks ? 1 : 0));
+      shape.AppendShape(single_slice_shape);
+      entry_shapes.push_back(std::move(shape));
+    }
+    output_shapes.push_back(std::move(entry_shapes));
+  }
+  return output_shapes;
+}
+
+std::vector<int64_t> ReducescatterOp::ComputeReceiveCounts(
+    const std::vector<std::vector<TensorShape>>& output_shapes) const {
+  std::vector<int64_t> recvcounts(
+      output_shapes.empty() ? 0 : output_shapes[0].size(), 0);
+  for (auto& entry_shapes : output_shapes) {
+    for (size_t rc = 0; rc < entry_shapes.size(); ++rc) {
+      recvcounts[rc] += entry_shapes[rc].num_elements();
+    }
+  }
+  return recvcounts;
+}
+
+Status ReducescatterOp::AllocateOutput(
+    std::vector<TensorTableEntry>& entries,
+    const std::vector<std::vector<TensorShape>>& output_shapes) {
+  int rank = controller_->GetRank();
+  for (size_t ec = 0; ec < entries.size(); ++ec) {
+    auto& e = entries[ec];
+    Status status = e.context->AllocateOutput(output_shapes[ec][rank], &e.output);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  return Status::OK();
+}
+
+void ReducescatterOp::MemcpyInFusionBuffer(
+    const std::vector<TensorTableEntry>& entries,
+    const std::vector<std::vector<TensorShape>>& output_shapes,
+    int element_size, void*& buffer_data) {
+  auto& first_entry = entries[0];
+  auto buffer = FusionBuffer().GetBuffer(
+      first_entry.device, first_entry.context->framework(),
+      FusionBufferStream(first_entry.device));
+  buffer_data = const_cast<void*>(buffer->AccessData(first_entry.context));
+
+  // Offset of the next slice to be sent of every entry, in bytes.
+  std::vector<int64_t> entry_offsets(entries.size(), 0);
+  int64_t offset = 0;
+  int num_ranks = (int)output_shapes[0].size();
+  for (int rc = 0; rc < num_ranks; ++rc) {
+    for (size_t ec = 0; ec < entries.size(); ++ec) {
+      size_t entry_size = output_shapes[ec][rc].num_elements() * element_size;
+      void* buffer_data_at_offset = (uint8_t*)buffer_data + offset;
+      MemcpyEntryInFusionBuffer(entries, entries[ec], entry_offsets[ec],
+                                entry_size, buffer_data_at_offset);
+      entry_offsets[ec] += entry_size;
+      offset += entry_size;
+    }
+  }
+}
+
+void ReducescatterOp::MemcpyOutFusionBuffer(
+    const void* buffer_data, std::vector<TensorTableEntry>& entries) {
+  int64_t offset = 0;
+  for (auto& e : entries) {
+    void* buffer_data_at_offset = (uint8_t*)buffer_data + offset;
+    MemcpyEntryOutFusionBuffer(entries, buffer_data_at_offset, e);
+    offset += e.output->size();
+  }
+}
+
+void ReducescatterOp::MemcpyEntryInFusionBuffer(
+    const std::vector<TensorTableEntry>& entries, const TensorTableEntry& e,
+    int64_t entry_offset, size_t entry_size, void* buffer_data_at_offset) {
+  std::memcpy(buffer_data_at_offset,
+              (const uint8_t*)e.tensor->data() + entry_offset, entry_size);
+}
+
+void ReducescatterOp::MemcpyEntryOutFusionBuffer(
+    const std::vector<TensorTableEntry>& entries,
+    const void* buffer_data_at_offset, TensorTableEntry& e) {
+  std::memcpy((void*)e.output->data(), buffer_data_at_offset,
+              (size_t)e.output->size());
+}
+
+// Alltoall
+AlltoallOp::AlltoallOp(HorovodGlobalState* global_state)
+    : HorovodOp(global_state) {}
+
+namespace {
+
+int64_t SliceNumElements(const TensorTableEntry& e) {
+  int64_t num_elements = 1;
+  for (int i = 1; i < e.tensor->shape().dims(); ++i) {
+    num_elements *= e.tensor->shape().dim_size(i);
+  }
+  return num_elements;
+}
+
+} // namespace
+
+Status AlltoallOp::AllocateOutput(std::vector<TensorTableEntry>& entries,
+                                  const Response& response) {
+  int global_size = controller_->GetSize();
+  int rank = controller_->GetRank();
+  const auto& splits = response.tensor_sizes();
+  int64_t received_rows = 0;
+  for (int rc = 0; rc < global_size; ++rc) {
+    received_rows += splits[rc * global_size + rank];
+  }
+
+  for (auto& e : entries) {
+    TensorShape output_shape;
+    output_shape.AddDim(received_rows);
+    for (int i = 1; i < e.tensor->shape().dims(); ++i) {
+      output_shape.AddDim(e.tensor->shape().dim_size(i));
+    }
+
+    Status status = e.context->AllocateOutput(output_shape, &e.output);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  return Status::OK();
+}
+
+void AlltoallOp::ComputeCounts(const std::vector<TensorTableEntry>& entries,
+                               const Response& response,
+                               std::vector<int64_t>& sendcounts,
+                               std::vector<int64_t>& sdispls,
+                               std::vector<int64_t>& recvcounts,
+                               std::vector<int64_t>& rdispls) const {
+  int global_size = controller_->GetSize();
+  int rank = controller_->GetRank();
+  const auto& splits = response.tensor_sizes();
+
+  // All entries share their splits, so a row sent to a rank carries one row
+  // of every entry.
+  int64_t row_elements = 0;
+  for (auto& e : entries) {
+    row_elements += SliceNumElements(e);
+  }
+
+  sendcounts.resize(global_size);
+  sdispls.resize(global_size);
+  recvcounts.resize(global_size);
+  rdispls.resize(global_size);
+  int64_t send_offset = 0;
+  int64_t recv_offset = 0;
+  for (int rc = 0; rc < global_size; ++rc) {
+    sendcounts[rc] = splits[rank * global_size + rc] * row_elements;
+    recvcounts[rc] = splits[rc * global_size + rank] * row_elements;
+    sdispls[rc] = send_offset;
+    rdispls[rc] = recv_offset;
+    send_offset += sendcounts[rc];
+    recv_offset += recvcounts[rc];
+  }
+}
+
+void AlltoallOp::MemcpyInFusionBuffer(
+    const std::vector<TensorTableEntry>& entries, const Response& response,
+    int element_size, void*& buffer_data) {
+  auto& first_entry = entries[0];
+  auto buffer = FusionBuffer().GetBuffer(
+      first_entry.device, first_entry.context->framework(),
+      FusionBufferStream(first_entry.device));
+  buffer_data = const_cast<void*>(buffer->AccessData(first_entry.context));
+
+  int global_size = controller_->GetSize();
+  int rank = controller_->GetRank();
+  const auto& splits = response.tensor_sizes();
+
+  // Offset of the next rows to be sent of every entry, in bytes.
+  std::vector<int64_t> entry_offsets(entries.size(), 0);
+  int64_t offset = 0;
+  for (int rc = 0; rc < global_size; ++rc) {
+    int64_t rows = splits[rank * global_size + rc];
+    for (size_t ec = 0; ec < entries.size(); ++ec) {
+      size_t entry_size = rows * SliceNumElements(entries[ec]) * element_size;
+      void* buffer_data_at_offset = (uint8_t*)buffer_data + offset;
+      MemcpyEntryInFusionBuffer(entries, entries[ec], entry_offsets[ec],
+                                entry_size, buffer_data_at_offset);
+      entry_offsets[ec] += entry_size;
+      offset += entry_size;
+    }
+  }
+}
+
+void AlltoallOp::MemcpyOutFusionBuffer(const void* buffer_data,
+                                       const Response& response,
+                                       int element_size,
+                                       std::vector<TensorTableEntry>& entries) {
+  int global_size = controller_->GetSize();
+  int rank = controller_->GetRank();
+  const auto& splits = response.tensor_sizes();
+
+  // Offset of the next rows to be received of every entry, in bytes.
+  std::vector<int64_t> entry_offsets(entries.size(), 0);
+  int64_t offset = 0;
+  for (int rc = 0; rc < global_size; ++rc) {
+    int64_t rows = splits[rc * global_size + rank];
+    for (size_t ec = 0; ec < entries.size(); ++ec) {
+      size_t entry_size = rows * SliceNumElements(entries[ec]) * element_size;
+      void* buffer_data_at_offset = (uint8_t*)buffer_data + offset;
+      MemcpyEntryOutFusionBuffer(entries, buffer_data_at_offset, entries[ec],
+                                 entry_offsets[ec], entry_size);
+      entry_offsets[ec] += entry_size;
+      offset += entry_size;
+    }
+  }
+}
+
+void AlltoallOp::MemcpyEntryInFusionBuffer(
+    const std::vector<TensorTableEntry>& entries, const TensorTableEntry& e,
+    int64_t entry_offset, size_t entry_size, void* buffer_data_at_offset) {
+  std::memcpy(buffer_data_at_offset,
+              (const uint8_t*)e.tensor->data() + entry_offset, entry_size);
+}
+
+void AlltoallOp::MemcpyEntryOutFusionBuffer(
+    const std::vector<TensorTableEntry>& entries,
+    const void* buffer_data_at_offset, TensorTableEntry& e,
+    int64_t entry_offset, size_t entry_size) {
+  std::memcpy((uint8_t*)e.output->data() + entry_offset,
+              buffer_data_at_offset, entry_size);
+}
+
+void* AlltoallOp::GetReceiveBuffer(int64_t size) {
+  if ((int64_t)receive_buffer_.size() < size) {
+    receive_buffer_.resize(size);
+  }
+  return receive_buffer_.data();
+}
+
+// Sparse allreduce
+SparseAllreduceOp::SparseAllreduceOp(HorovodGlobalState* global_state)
+    : HorovodOp(global_state) {}
+
+bool SparseAllreduceOp::UseDense(const TensorTableEntry& e,
+                                 const Response& response) const {
+  int64_t total_rows = 0;
+  for (auto rows : response.tensor_sizes()) {
+    total_rows += rows;
+  }
+  return e.dense_rows > 0 &&
+         total_rows > global_state_->sparse_density_threshold * e.dense_rows;
+}
+
+int64_t SparseAllreduceOp::RowBytes(const TensorTableEntry& e) const {
+  int64_t row_elements = 1;
+  for (int i = 1; i < e.tensor->shape().dims(); ++i) {
+    row_elements *= e.tensor->shape().dim_size(i);
+  }
+  return row_elements *
+         controller_->GetTypeSize(e.tensor->dtype());
+}
+
+void SparseAllreduceOp::ComputeBlockCounts(
+    const TensorTableEntry& e, const Response& response,
+    std::vector<int64_t>& counts, std::vector<int64_t>& displcmnts) const {
+  const auto& tensor_sizes = response.tensor_sizes();
+  int64_t row_bytes = RowBytes(e);
+  counts.resize(tensor_sizes.size());
+  displcmnts.resize(tensor_sizes.size());
+  int64_t offset = 0;
+  for (size_t rc = 0; rc < tensor_sizes.size(); ++rc) {
+    counts[rc] = PadTo8Bytes(tensor_sizes[rc] * (sizeof(int64_t) + row_bytes));
+    displcmnts[rc] = offset;
+    offset += counts[rc];
+  }
+}
+
+void SparseAllreduceOp::PackBlock(const TensorTableEntry& e,
+                                  void* block) const {
+  int64_t indices_bytes = e.indices->size();
+  std::memcpy(block, e.indices->data(), (size_t)indices_bytes);
+  std::memcpy((uint8_t*)block + indices_bytes, e.tensor->data(),
+              (size_t)e.tensor->size());
+}
+
+Status SparseAllreduceOp::UnpackBlocks(TensorTableEntry& e,
+                                       const Response& response,
+                                       const void* buffer,
+                                       const std::vector<int64_t>& displcmnts) {
+  const auto& tensor_sizes = response.tensor_sizes();
+  int64_t row_bytes = RowBytes(e);
+  int64_t total_rows = 0;
+  for (auto rows : tensor_sizes) {
+    total_rows += rows;
+  }
+
+  // Output row of every gathered row, in the order of the ranks. The first
+  // row with an index is copied, the following ones are summed into it.
+  std::vector<int64_t> output_rows(total_rows);
+  std::vector<bool> first_rows(total_rows, true);
+  int64_t num_output_rows = total_rows;
+  if (e.deduplicate) {
+    std::unordered_map<int64_t, int64_t> index_rows;
+    index_rows.reserve(total_rows);
+    int64_t row = 0;
+    for (size_t rc = 0; rc < tensor_sizes.size(); ++rc) {
+      auto* indices =
+          (const int64_t*)((const uint8_t*)buffer + displcmnts[rc]);
+      for (int64_t i = 0; i < tensor_sizes[rc]; ++i, ++row) {
+        auto it = index_rows.emplace(indices[i], (int64_t)index_rows.size());
+        output_rows[row] = it.first->second;
+        first_rows[row] = it.second;
+      }
+    }
+    num_output_rows = (int64_t)index_rows.size();
+  } else {
+    for (int64_t row = 0; row < total_rows; ++row) {
+      output_rows[row] = row;
+    }
+  }
+
+  TensorShape output_shape;
+  output_shape.AddDim(num_output_rows);
+  for (int i = 1; i < e.tensor->shape().dims(); ++i) {
+    output_shape.AddDim(e.tensor->shape().dim_size(i));
+  }
+  Status status = e.context->AllocateOutput(0, output_shape, &e.output);
+  if (!status.ok()) {
+    return status;
+  }
+  TensorShape indices_shape;
+  indices_shape.AddDim(num_output_rows);
+  status = e.context->AllocateOutput(1, indices_shape, &e.output_indices);
+  if (!status.ok()) {
+    return status;
+  }
+
+  auto* output = (uint8_t*)e.output->data();
+  auto* output_indices = (int64_t*)e.output_indices->data();
+  int64_t row_elements = row_bytes /
+                         controller_->GetTypeSize(e.tensor->dtype());
+  int64_t row = 0;
+  for (size_t rc = 0; rc < tensor_sizes.size(); ++rc) {
+    auto* block = (const uint8_t*)buffer + displcmnts[rc];
+    auto* indices = (const int64_t*)block;
+    auto* rows = block + tensor_sizes[rc] * sizeof(int64_t);
+    for (int64_t i = 0; i < tensor_sizes[rc]; ++i, ++row) {
+      uint8_t* output_row = output + output_rows[row] * row_bytes;
+      if (first_rows[row]) {
+        output_indices[output_rows[row]] = indices[i];
+        std::memcpy(output_row, rows + i * row_bytes, (size_t)row_bytes);
+      } else {
+        AddElements(output_row, rows + i * row_bytes, row_elements,
+                    e.tensor->dtype());
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status SparseAllreduceOp::ScatterDense(TensorTableEntry& e) {
+  TensorShape output_shape;
+  output_shape.AddDim(e.dense_rows);
+  for (int i = 1; i < e.tensor->shape().dims(); ++i) {
+    output_shape.AddDim(e.tensor->shape().dim_size(i));
+  }
+  Status status = e.context->AllocateOutput(0, output_shape, &e.output);
+  if (!status.ok()) {
+    return status;
+  }
+  TensorShape indices_shape;
+  indices_shape.AddDim(e.dense_rows);
+  status = e.context->AllocateOutput(1, indices_shape, &e.output_indices);
+  if (!status.ok()) {
+    return status;
+  }
+
+  int64_t row_bytes = RowBytes(e);
+  int64_t row_elements = row_bytes /
+                         controller_->GetTypeSize(e.tensor->dtype());
+  auto* output = (uint8_t*)e.output->data();
+  std::memset(output, 0, (size_t)e.output->size());
+  auto* indices = (const int64_t*)e.indices->data();
+  auto* rows = (const uint8_t*)e.tensor->data();
+  for (int64_t i = 0; i < e.tensor->shape().dim_size(0); ++i) {
+    AddElements(output + indices[i] * row_bytes, rows + i * row_bytes,
+                row_elements, e.tensor->dtype());
+  }
+
+  auto* output_indices = (int64_t*)e.output_indices->data();
+  for (int64_t i = 0; i < e.dense_rows; ++i) {
+    output_indices[i] = i;
+  }
+  return Status::OK();
+}
+
+void* SparseAllreduceOp::GetReceiveBuffer(int64_t size) {
+  if ((int64_t)receive_buffer_.size() < size) {
+    receive_buffer_.resize(size);
+  }
+  return receive_buffer_.data();
+}
+
 // Join
+// Reduce
+ReduceToRootOp::ReduceToRootOp(HorovodGlobalState* global_state)
+    : AllreduceOp(global_state) {}
+
+void ReduceToRootOp::CopyInputsToOutputs(
+    std::vector<TensorTableEntry>& entries) {
+  for (auto& e : entries) {
+    if (e.tensor->data() != e.output->data()) {
+      std::memcpy((void*)e.output->data(), e.tensor->data(),
+                  (size_t)e.tensor->size());
+    }
+  }
+}
+
+// Gather
+GatherOp::GatherOp(HorovodGlobalState* global_state)
+    : AllgatherOp(global_state) {}
+
+Status GatherOp::AllocateOutput(std::vector<TensorTableEntry>& entries,
+                                const Response& response,
+                                int64_t**& entry_component_sizes,
+                                int64_t*& recvcounts) {
+  int global_size = controller_->GetSize();
+  bool is_root =
+      controller_->GetRank() == entries[0].root_rank;
+  for (size_t ec = 0; ec < entries.size(); ++ec) {
+    auto& e = entries[ec];
+    TensorShape single_slice_shape;
+    for (int i = 1; i < e.tensor->shape().dims(); ++i) {
+      single_slice_shape.AddDim(e.tensor->shape().dim_size(i));
+    }
+
+    int64_t total_entry_dimension_size = 0;
+    const auto& tensor_sizes = response.tensor_sizes();
+    for (int rc = 0; rc < global_size; ++rc) {
+      auto component_size = tensor_sizes[ec * global_size + rc];
+      total_entry_dimension_size += component_size;
+      recvcounts[rc] += component_size * single_slice_shape.num_elements();
+      entry_component_sizes[ec][rc] =
+          component_size * single_slice_shape.num_elements();
+    }
+
+    TensorShape output_shape;
+    output_shape.AddDim(is_root ? total_entry_dimension_size : 0);
+    output_shape.AppendShape(single_slice_shape);
+
+    Status status = e.context->AllocateOutput(output_shape, &e.output);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  return Status::OK();
+}
+
+void* GatherOp::GetReceiveBuffer(int64_t size) {
+  if ((int64_t)receive_buffer_.size() < size) {
+    receive_buffer_.resize(size);
+  }
+  return receive_buffer_.data();
+}
+
+// Scatter
+ScatterOp::ScatterOp(HorovodGlobalState* global_state)
+    : ReducescatterOp(global_state) {}
+
+void* ScatterOp::GetReceiveBuffer(int64_t size) {
+  if ((int64_t)receive_buffer_.size() < size) {
+    receive_buffer_.resize(size);
+  }
+  return receive_buffer_.data();
+}
+
 JoinOp::JoinOp(HorovodGlobalState* global_state) : HorovodOp(global_state) {}
 
 Status JoinOp::Execute(std::vector<TensorTableEntry>& entries,
@@ -35,10 +35,37 @@ public:
   virtual Status Execute(std::vector<TensorTableEntry>& entries,
                          const Response& response) = 0;
 
+  // Binds the operation to the controller of a process set. Operations use
+  // the global controller otherwise.
+  void SetController(std::shared_ptr<Controller> controller) {
+    controller_ = std::move(controller);
+  }
+
+  // Binds the operation to the fusion buffers of a process set, which runs
+  // on its own thread and always uses its first fusion buffer. Operations use
+  // the global fusion buffers otherwise.
+  void SetFusionBuffer(FusionBufferManager* fusion_buffer) {
+    fusion_buffer_ = fusion_buffer;
+  }
+
 protected:
   int64_t NumElements(std::vector<TensorTableEntry>& entries);
 
+  // Fusion buffers of the operation, and the stream of the one used for
+  // tensors on the given device.
+  FusionBufferManager& FusionBuffer() const;
+
+  int FusionBufferStream(int device) const;
+
+  // Generation of the fusion buffer used for the entries, which identifies
+  // the buffer collectives are bound to in the same way on all ranks.
+  uint64_t FusionBufferGeneration(const TensorTableEntry& first_entry) const;
+
   HorovodGlobalState* global_state_;
+
+  std::shared_ptr<Controller> controller_;
+
+  FusionBufferManager* fusion_buffer_ = nullptr;
 };
 
 class AllreduceOp : public HorovodOp {
@@ -55,6 +82,43 @@ public:
                        const Response& response) const = 0;
 
 protected:
+  // A run of consecutive entries sharing one data type. Responses fused across
+  // data types are laid out in the fusion buffer as one such segment per type,
+  // and every segment has to be reduced with its own data type.
+  struct DataTypeSegment {
+    DataType dtype;
+    // Range of entries [begin, end) belonging to this segment.
+    size_t begin;
+    size_t end;
+    // Byte offset of the segment in the fusion buffer.
+    int64_t offset;
+    int64_t num_elements;
+  };
+
+  std::vector<DataTypeSegment>
+  GetDataTypeSegments(const std::vector<TensorTableEntry>& entries) const;
+
+  // Key identifying the layout and reduction of a fused response in the
+  // current fusion buffer, under which collectives bound to that buffer are
+  // cached.
+  std::string
+  PersistentCollectiveKey(const std::vector<TensorTableEntry>& entries,
+                          const std::vector<DataTypeSegment>& segments,
+                          ReduceOp reduce_op) const;
+
+  // Multiplies num_elements elements of input by the scale factor into
+  // output, which may alias input.
+  void ScaleBuffer(double scale_factor, const void* input, void* output,
+                   int64_t num_elements, DataType dtype);
+
+  // Scaling of tensors that are not fused. PrescaleEntry scales the input
+  // into the output, which is then reduced in place, and PostscaleEntry
+  // scales the output in place. Fused tensors are scaled while they are
+  // copied into and out of the fusion buffer instead.
+  void PrescaleEntry(const TensorTableEntry& e);
+
+  void PostscaleEntry(const TensorTableEntry& e);
+
   virtual void
   MemcpyInFusionBuffer(const std::vector<TensorTableEntry>& entries,
                        const void*& fused_input_data, void*& buffer_data,
@@ -91,19 +155,20 @@ protected:
   virtual Status AllocateOutput(std::vector<TensorTableEntry>& entries,
                                 const Response& response,
                                 int64_t**& entry_component_sizes,
-                                int*& recvcounts);
+                                int64_t*& recvcounts);
 
-  virtual void SetDisplacements(const int* recvcounts, int*& displcmnts);
+  virtual void SetDisplacements(const int64_t* recvcounts,
+                                int64_t*& displcmnts);
 
   virtual void
   SetEntryComponentOffsets(const std::vector<TensorTableEntry>& entries,
                            const int64_t* const* entry_component_sizes,
-                           const int* recvcounts,
+                           const int64_t* recvcounts,
                            int64_t**& entry_component_offsets);
 
   virtual void
   MemcpyInFusionBuffer(const std::vector<TensorTableEntry>& entries,
-                       const int* displcmnts, int element_size,
+                       const int64_t* displcmnts, int element_size,
                        void*& buffer_data);
 
   virtual void
@@ -137,6 +202,242 @@ public:
   virtual bool Enabled(const ParameterManager& param_manager,
                        const std::vector<TensorTableEntry>& entries,
                        const Response& response) const = 0;
+
+protected:
+  // Fused broadcasts are sent as bytes. The root rank packs the input tensors
+  // into the fusion buffer, while other ranks unpack the received buffer into
+  // their output tensors.
+  void* GetFusionBuffer(const std::vector<TensorTableEntry>& entries);
+
+  int64_t FusedByteSize(const std::vector<TensorTableEntry>& entries);
+
+  virtual void MemcpyInFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                                    void*& buffer_data);
+
+  virtual void MemcpyOutFusionBuffer(const void* buffer_data,
+                                     std::vector<TensorTableEntry>& entries);
+
+  virtual void
+  MemcpyEntryInFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                            const TensorTableEntry& e,
+                            void* buffer_data_at_offset);
+
+  virtual void
+  MemcpyEntryOutFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                             const void* buffer_data_at_offset,
+                             TensorTableEntry& e);
+};
+
+class ReducescatterOp : public HorovodOp {
+public:
+  ReducescatterOp(HorovodGlobalState* global_state);
+
+  virtual ~ReducescatterOp() = default;
+
+  virtual Status Execute(std::vector<TensorTableEntry>& entries,
+                         const Response& response) = 0;
+
+  virtual bool Enabled(const ParameterManager& param_manager,
+                       const std::vector<TensorTableEntry>& entries,
+                       const Response& response) const = 0;
+
+protected:
+  // Shapes of the slices of every entry received by every rank, indexed by
+  // entry and then by rank. The first dimension is split as evenly as
+  // possible, with the first ranks receiving one extra row.
+  std::vector<std::vector<TensorShape>>
+  ComputeOutputShapes(const std::vector<TensorTableEntry>& entries,
+                      int num_ranks) const;
+
+  // Number of elements received by every rank over all entries.
+  std::vector<int64_t> ComputeReceiveCounts(
+      const std::vector<std::vector<TensorShape>>& output_shapes) const;
+
+  virtual Status
+  AllocateOutput(std::vector<TensorTableEntry>& entries,
+                 const std::vector<std::vector<TensorShape>>& output_shapes);
+
+  // Fused reducescatters are laid out rank by rank: the slices of all entries
+  // sent to rank 0 come first, followed by those sent to rank 1, etc.
+  virtual void
+  MemcpyInFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                       const std::vector<std::vector<TensorShape>>& output_shapes,
+                       int element_size, void*& buffer_data);
+
+  // Copies the slices received by this rank, which the collective leaves at
+  // the start of the fusion buffer, into the output tensors.
+  virtual void MemcpyOutFusionBuffer(const void* buffer_data,
+                                     std::vector<TensorTableEntry>& entries);
+
+  virtual void
+  MemcpyEntryInFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                            const TensorTableEntry& e, int64_t entry_offset,
+                            size_t entry_size, void* buffer_data_at_offset);
+
+  virtual void
+  MemcpyEntryOutFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                             const void* buffer_data_at_offset,
+                             TensorTableEntry& e);
+};
+
+class AlltoallOp : public HorovodOp {
+public:
+  AlltoallOp(HorovodGlobalState* global_state);
+
+  virtual ~AlltoallOp() = default;
+
+  virtual Status Execute(std::vector<TensorTableEntry>& entries,
+                         const Response& response) = 0;
+
+  virtual bool Enabled(const ParameterManager& param_manager,
+                       const std::vector<TensorTableEntry>& entries,
+                       const Response& response) const = 0;
+
+protected:
+  // Allocates outputs holding the rows received from all ranks, in the order
+  // of the ranks.
+  virtual Status AllocateOutput(std::vector<TensorTableEntry>& entries,
+                                const Response& response);
+
+  // Number of elements sent to and received from every rank over all
+  // entries, and their displacements in the send and receive buffers.
+  void ComputeCounts(const std::vector<TensorTableEntry>& entries,
+                     const Response& response, std::vector<int64_t>& sendcounts,
+                     std::vector<int64_t>& sdispls,
+                     std::vector<int64_t>& recvcounts,
+                     std::vector<int64_t>& rdispls) const;
+
+  // Fused alltoalls share their splits and are laid out rank by rank: the
+  // rows of all entries sent to rank 0 come first, followed by those sent to
+  // rank 1, etc. Received rows are laid out the same way, by source rank.
+  virtual void MemcpyInFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                                    const Response& response, int element_size,
+                                    void*& buffer_data);
+
+  virtual void MemcpyOutFusionBuffer(const void* buffer_data,
+                                     const Response& response, int element_size,
+                                     std::vector<TensorTableEntry>& entries);
+
+  virtual void
+  MemcpyEntryInFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                            const TensorTableEntry& e, int64_t entry_offset,
+                            size_t entry_size, void* buffer_data_at_offset);
+
+  virtual void
+  MemcpyEntryOutFusionBuffer(const std::vector<TensorTableEntry>& entries,
+                             const void* buffer_data_at_offset,
+                             TensorTableEntry& e, int64_t entry_offset,
+                             size_t entry_size);
+
+  // Host buffer receiving fused alltoalls, which may receive more than the
+  // fusion buffer holds.
+  void* GetReceiveBuffer(int64_t size);
+
+private:
+  std::vector<uint8_t> receive_buffer_;
+};
+
+// Reduces a tensor given as rows and their indices into the rows of a dense
+// tensor, such as the gradient of an embedding lookup. Responses hold a single
+// entry, whose tensor holds the rows.
+class SparseAllreduceOp : public HorovodOp {
+public:
+  SparseAllreduceOp(HorovodGlobalState* global_state);
+
+  virtual ~SparseAllreduceOp() = default;
+
+  virtual Status Execute(std::vector<TensorTableEntry>& entries,
+                         const Response& response) = 0;
+
+  virtual bool Enabled(const ParameterManager& param_manager,
+                       const std::vector<TensorTableEntry>& entries,
+                       const Response& response) const = 0;
+
+protected:
+  // Whether the rows of all ranks outnumber the density threshold times the
+  // rows of the dense tensor, in which case allreducing the dense tensor moves
+  // less data. The decision only depends on negotiated sizes, so all ranks
+  // take the same one.
+  bool UseDense(const TensorTableEntry& e, const Response& response) const;
+
+  // Byte counts and displacements of the blocks of all ranks. A block holds
+  // the indices of the rows of a rank followed by the rows, padded to 8 bytes,
+  // so that indices and rows are exchanged in one collective.
+  void ComputeBlockCounts(const TensorTableEntry& e, const Response& response,
+                          std::vector<int64_t>& counts,
+                          std::vector<int64_t>& displcmnts) const;
+
+  void PackBlock(const TensorTableEntry& e, void* block) const;
+
+  // Allocates the outputs and fills them from the blocks of all ranks, in the
+  // order of the ranks. Rows with the same index are summed if the entry asks
+  // for it.
+  Status UnpackBlocks(TensorTableEntry& e, const Response& response,
+                      const void* buffer,
+                      const std::vector<int64_t>& displcmnts);
+
+  // Allocates outputs for all rows of the dense tensor and sums the rows of
+  // the entry into them, ready to be allreduced in place.
+  Status ScatterDense(TensorTableEntry& e);
+
+  int64_t RowBytes(const TensorTableEntry& e) const;
+
+  // Host buffer receiving the blocks of all ranks.
+  void* GetReceiveBuffer(int64_t size);
+
+private:
+  std::vector<uint8_t> receive_buffer_;
+};
+
+// Reduces tensors into the outputs of the root rank. Fused tensors are laid
+// out in the fusion buffer as for allreduce.
+class ReduceToRootOp : public AllreduceOp {
+public:
+  ReduceToRootOp(HorovodGlobalState* global_state);
+
+  virtual ~ReduceToRootOp() = default;
+
+protected:
+  // Outputs of ranks other than the root hold their input unchanged.
+  void CopyInputsToOutputs(std::vector<TensorTableEntry>& entries);
+};
+
+// Gathers tensors into the outputs of the root rank. Outputs of other ranks
+// have no rows, but the sizes and counts of all ranks are computed everywhere,
+// so that the root rank can lay out fused tensors as for allgather.
+class GatherOp : public AllgatherOp {
+public:
+  GatherOp(HorovodGlobalState* global_state);
+
+  virtual ~GatherOp() = default;
+
+protected:
+  Status AllocateOutput(std::vector<TensorTableEntry>& entries,
+                        const Response& response,
+                        int64_t**& entry_component_sizes,
+                        int64_t*& recvcounts) override;
+
+  // Host buffer receiving fused gathers on the root rank.
+  void* GetReceiveBuffer(int64_t size);
+
+private:
+  std::vector<uint8_t> receive_buffer_;
+};
+
+// Scatters the tensors of the root rank. The first dimension is split as for
+// reducescatter, and fused tensors are laid out rank by rank in the same way.
+class ScatterOp : public ReducescatterOp {
+public:
+  ScatterOp(HorovodGlobalState* global_state);
+
+  virtual ~ScatterOp() = default;
+
+protected:
+  // Host buffer receiving fused scatters.
+  void* GetReceiveBuffer(int64_t size);
+
+private:
+  std::vector<uint8_t> receive_buffer_;
 };
 
 class JoinOp : public HorovodOp {
@@ -102,6 +102,14 @@ Status DDLAllreduce::Execute(std::vector<TensorTableEntry>& entries, const Respo
   return cuda_op_context_.FinalizeCUDAQueue(entries);
 }
 
+bool DDLAllreduce::Enabled(const ParameterManager& param_manager,
+                           const std::vector<TensorTableEntry>& entries,
+                           const Response& response) const {
+  // DDL only sums, other reductions fall back to MPI.
+  return CUDAAllreduce::Enabled(param_manager, entries, response) &&
+         response.reduce_op() == ReduceOp::SUM;
+}
+
 void DDLAllreduce::DDLInit(DDLContext* ddl_context, CUDAContext* cuda_context) {
   auto ddl_options = std::getenv("DDL_OPTIONS");
   if (ddl_options == nullptr) {
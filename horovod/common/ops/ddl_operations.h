@@ -36,6 +36,10 @@ public:
 
   Status Execute(std::vector<TensorTableEntry>& entries, const Response& response) override;
 
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
   static void DDLInit(DDLContext* ddl_context, CUDAContext* cuda_context);
 
 protected:
@@ -15,121 +15,486 @@
 
 #include "gloo_operations.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 #include "gloo/allgather.h"
 #include "gloo/allgatherv.h"
 #include "gloo/allreduce.h"
+#include "gloo/allreduce_bcube.h"
+#include "gloo/allreduce_halving_doubling.h"
+#include "gloo/allreduce_ring_chunked.h"
+#include "gloo/alltoallv.h"
 #include "gloo/broadcast.h"
 #include "gloo/math.h"
+#include "gloo/reduce.h"
+#include "gloo/reduce_scatter.h"
 #include "gloo/types.h"
 
 #include "../common.h"
 #include "../global_state.h"
+#include "../half.h"
 
 namespace horovod {
 namespace common {
 
-IGlooAlgorithms* GetAlgorithmsForType(DataType dtype,
-                                      GlooContext* gloo_context) {
+namespace {
+
+// Element-wise reduction of the function API of Gloo.
+using ReduceFunction = void (*)(void*, const void*, const void*, size_t);
+
+template <typename T> ReduceFunction GetReduceFunction(ReduceOp reduce_op) {
+  switch (reduce_op) {
+  case ReduceOp::SUM:
+    return &::gloo::sum<T>;
+  case ReduceOp::MIN:
+    return &::gloo::min<T>;
+  case ReduceOp::MAX:
+    return &::gloo::max<T>;
+  case ReduceOp::PRODUCT:
+    return &::gloo::product<T>;
+  default:
+    throw std::logic_error("Reduce op " + ReduceOp_Name(reduce_op) +
+                           " is not supported in Gloo mode.");
+  }
+}
+
+// Gloo converts float16 elements one at a time, the reductions of Horovod
+// convert them with vector instructions.
+template <>
+ReduceFunction GetReduceFunction<gloo::float16>(ReduceOp reduce_op) {
+  switch (reduce_op) {
+  case ReduceOp::SUM:
+    return &float16_reduce_sum;
+  case ReduceOp::MIN:
+    return &float16_reduce_min;
+  case ReduceOp::MAX:
+    return &float16_reduce_max;
+  case ReduceOp::PRODUCT:
+    return &float16_reduce_prod;
+  default:
+    throw std::logic_error("Reduce op " + ReduceOp_Name(reduce_op) +
+                           " is not supported in Gloo mode.");
+  }
+}
+
+// Element-wise reduction of the algorithm classes of Gloo.
+template <typename T>
+const gloo::ReductionFunction<T>* GetReductionFunction(ReduceOp reduce_op) {
+  switch (reduce_op) {
+  case ReduceOp::SUM:
+    return gloo::ReductionFunction<T>::sum;
+  case ReduceOp::MIN:
+    return gloo::ReductionFunction<T>::min;
+  case ReduceOp::MAX:
+    return gloo::ReductionFunction<T>::max;
+  case ReduceOp::PRODUCT:
+    return gloo::ReductionFunction<T>::product;
+  default:
+    throw std::logic_error("Reduce op " + ReduceOp_Name(reduce_op) +
+                           " is not supported in Gloo mode.");
+  }
+}
+
+template <ReduceFunction fn>
+void ReduceInPlace(gloo::float16* x, const gloo::float16* y, size_t n) {
+  fn(x, x, y, n);
+}
+
+template <>
+const gloo::ReductionFunction<gloo::float16>*
+GetReductionFunction<gloo::float16>(ReduceOp reduce_op) {
+  static const gloo::ReductionFunction<gloo::float16> sum(
+      gloo::SUM, &ReduceInPlace<&float16_reduce_sum>);
+  static const gloo::ReductionFunction<gloo::float16> min(
+      gloo::MIN, &ReduceInPlace<&float16_reduce_min>);
+  static const gloo::ReductionFunction<gloo::float16> max(
+      gloo::MAX, &ReduceInPlace<&float16_reduce_max>);
+  static const gloo::ReductionFunction<gloo::float16> product(
+      gloo::PRODUCT, &ReduceInPlace<&float16_reduce_prod>);
+  switch (reduce_op) {
+  case ReduceOp::SUM:
+    return &sum;
+  case ReduceOp::MIN:
+    return &min;
+  case ReduceOp::MAX:
+    return &max;
+  case ReduceOp::PRODUCT:
+    return &product;
+  default:
+    throw std::logic_error("Reduce op " + ReduceOp_Name(reduce_op) +
+                           " is not supported in Gloo mode.");
+  }
+}
+
+// Every buffer is left to the allreduce function of Gloo until thresholds
+// between its algorithms have been measured, so ring, halving-doubling and
+// bcube are opt-in through HOROVOD_CPU_ALLREDUCE_ALGORITHM or
+// HOROVOD_CPU_ALLREDUCE_TABLE. Either only applies to recurring fused
+// responses, which are bound to an algorithm once.
+AllreduceAlgorithmTable DefaultAlgorithmTable() {
+  return AllreduceAlgorithmTable(
+      {{std::numeric_limits<int64_t>::max(), std::numeric_limits<int>::max(),
+        AllreduceAlgorithm::LIBRARY}},
+      {AllreduceAlgorithm::RING, AllreduceAlgorithm::RABENSEIFNER,
+       AllreduceAlgorithm::BCUBE});
+}
+
+// Runs a collective of the function API of Gloo with options set once, so
+// that its buffers are only registered with the transport once.
+template <typename Options, void (*Collective)(Options&)>
+class BoundCollective : public gloo::Algorithm {
+public:
+  explicit BoundCollective(const std::shared_ptr<gloo::Context>& context)
+      : gloo::Algorithm(context), opts(context) {}
+
+  void run() override { Collective(opts); }
+
+  Options opts;
+};
+
+// Elements [begin, end) of a segment of num_elements elements reduced on the
+// given stripe, which are empty for some stripes of small segments.
+void StripeRange(int64_t num_elements, int stripe, int num_stripes,
+                 int64_t& begin, int64_t& end) {
+  int64_t stripe_elements = (num_elements + num_stripes - 1) / num_stripes;
+  begin = std::min(num_elements, stripe * stripe_elements);
+  end = std::min(num_elements, begin + stripe_elements);
+}
+
+// Bound algorithms hold Gloo scratch buffers of up to the size of the fused
+// response they are bound to, which is at most the fusion threshold, so only a
+// few fused responses keep bound collectives of each kind.
+constexpr size_t MAX_BOUND_COLLECTIVES = 8;
+
+// Bound collectives are kept for at most MAX_BOUND_COLLECTIVES fused
+// responses, fewer if the response cache holds fewer responses, and not at
+// all if it is disabled.
+PersistentCollectives<GlooPersistentAlgorithms>&
+ResizeBoundCollectives(PersistentCollectives<GlooPersistentAlgorithms>& cache,
+                       HorovodGlobalState* global_state) {
+  size_t capacity = std::min(
+      (size_t) global_state->response_cache.capacity(), MAX_BOUND_COLLECTIVES);
+  if (cache.capacity() != capacity) {
+    cache.SetCapacity(capacity);
+  }
+  return cache;
+}
+
+IGlooAlgorithms*
+CreateAlgorithmsForType(DataType dtype,
+                        const std::shared_ptr<gloo::Context>& ctx) {
   switch (dtype) {
   case HOROVOD_UINT8:
-    return new GlooAlgorithms<u_int8_t>(gloo_context);
+    return new GlooAlgorithms<u_int8_t>(ctx);
   case HOROVOD_INT8:
-    return new GlooAlgorithms<int8_t>(gloo_context);
+    return new GlooAlgorithms<int8_t>(ctx);
   case HOROVOD_UINT16:
-    return new GlooAlgorithms<u_int16_t>(gloo_context);
+    return new GlooAlgorithms<u_int16_t>(ctx);
   case HOROVOD_INT16:
-    return new GlooAlgorithms<int16_t>(gloo_context);
+    return new GlooAlgorithms<int16_t>(ctx);
   case HOROVOD_INT32:
-    return new GlooAlgorithms<int32_t>(gloo_context);
+    return new GlooAlgorithms<int32_t>(ctx);
   case HOROVOD_INT64:
-    return new GlooAlgorithms<int64_t>(gloo_context);
+    return new GlooAlgorithms<int64_t>(ctx);
   case HOROVOD_FLOAT16:
-    return new GlooAlgorithms<gloo::float16>(gloo_context);
+    return new GlooAlgorithms<gloo::float16>(ctx);
   case HOROVOD_FLOAT32:
-    return new GlooAlgorithms<float>(gloo_context);
+    return new GlooAlgorithms<float>(ctx);
   case HOROVOD_FLOAT64:
-    return new GlooAlgorithms<double>(gloo_context);
+    return new GlooAlgorithms<double>(ctx);
   case HOROVOD_BOOL:
-    return new GlooAlgorithms<bool>(gloo_context);
+    return new GlooAlgorithms<bool>(ctx);
   default:
     throw std::logic_error("Type " + DataType_Name(dtype) +
                            " is not supported in Gloo mode.");
   }
 }
 
+} // namespace
+
+// Algorithms are created once per Gloo context and data type and owned by the
+// Horovod Gloo context.
+IGlooAlgorithms*
+GetAlgorithmsForType(DataType dtype, GlooContext* gloo_context,
+                     const std::shared_ptr<gloo::Context>& ctx) {
+  auto& algorithms = gloo_context->algorithms[std::make_pair(ctx.get(), dtype)];
+  if (algorithms == nullptr) {
+    algorithms.reset(CreateAlgorithmsForType(dtype, ctx));
+  }
+  return algorithms.get();
+}
+
+IGlooAlgorithms* GetAlgorithmsForType(
+    DataType dtype, GlooContext* gloo_context,
+    Communicator communicator = Communicator::GLOBAL) {
+  return GetAlgorithmsForType(dtype, gloo_context,
+                              gloo_context->GetGlooContext(communicator));
+}
+
 template <typename T>
-GlooAlgorithms<T>::GlooAlgorithms(GlooContext* gloo_context)
-    : gloo_context_(gloo_context) {}
+GlooAlgorithms<T>::GlooAlgorithms(std::shared_ptr<gloo::Context> ctx)
+    : ctx_(std::move(ctx)) {}
 
 template <typename T>
-void GlooAlgorithms<T>::Allreduce(void* buffer_data, int num_elements) {
-  gloo::AllreduceOptions opts(gloo_context_->ctx);
+void GlooAlgorithms<T>::Allreduce(void* buffer_data, int64_t num_elements,
+                                  ReduceOp reduce_op) {
+  gloo::AllreduceOptions opts(ctx_);
   opts.setOutput<T>(static_cast<T*>(buffer_data), (size_t) num_elements);
-
-  void (*func)(void*, const void*, const void*, size_t) = &::gloo::sum<T>;
-  opts.setReduceFunction(gloo::AllreduceOptions::Func(func));
+  opts.setReduceFunction(
+      gloo::AllreduceOptions::Func(GetReduceFunction<T>(reduce_op)));
 
   gloo::allreduce(opts);
 }
 
+template <typename T>
+std::unique_ptr<gloo::Algorithm>
+GlooAlgorithms<T>::BindAllreduce(void* buffer_data, int64_t num_elements,
+                                 ReduceOp reduce_op,
+                                 AllreduceAlgorithm algorithm) {
+  // Algorithm classes take int element counts, so larger buffers are bound
+  // to the allreduce function, which takes size_t counts.
+  if (num_elements > std::numeric_limits<int>::max()) {
+    auto bound =
+        new BoundCollective<gloo::AllreduceOptions, &gloo::allreduce>(ctx_);
+    bound->opts.setOutput<T>(static_cast<T*>(buffer_data),
+                             (size_t) num_elements);
+    bound->opts.setReduceFunction(
+        gloo::AllreduceOptions::Func(GetReduceFunction<T>(reduce_op)));
+    return std::unique_ptr<gloo::Algorithm>(bound);
+  }
+
+  auto fn = GetReductionFunction<T>(reduce_op);
+  std::vector<T*> ptrs{static_cast<T*>(buffer_data)};
+  // Partial meshes connect the partners of halving-doubling only on a power
+  // of two ranks, and none of the bcube groups.
+  if (algorithm == AllreduceAlgorithm::BCUBE ||
+      (algorithm == AllreduceAlgorithm::RABENSEIFNER &&
+       (ctx_->size & (ctx_->size - 1)) != 0)) {
+    ConnectFullMesh(*ctx_);
+  }
+  switch (algorithm) {
+  case AllreduceAlgorithm::RABENSEIFNER:
+    return std::unique_ptr<gloo::Algorithm>(
+        new gloo::AllreduceHalvingDoubling<T>(ctx_, ptrs, (int) num_elements,
+                                              fn));
+  case AllreduceAlgorithm::BCUBE:
+    return std::unique_ptr<gloo::Algorithm>(
+        new gloo::AllreduceBcube<T>(ctx_, ptrs, (int) num_elements, fn));
+  default:
+    return std::unique_ptr<gloo::Algorithm>(new gloo::AllreduceRingChunked<T>(
+        ctx_, ptrs, (int) num_elements, fn));
+  }
+}
+
 template <typename T>
 void GlooAlgorithms<T>::Allgather(void* buffer_data, void* buffer_out,
-                                  int* recvcounts, int* displcmnts) {
+                                  int64_t* recvcounts, int64_t* displcmnts) {
   // create count index
-  std::vector<size_t> counts(recvcounts, recvcounts + gloo_context_->ctx->size);
+  std::vector<size_t> counts(recvcounts, recvcounts + ctx_->size);
 
-  gloo::AllgathervOptions opts(gloo_context_->ctx);
+  gloo::AllgathervOptions opts(ctx_);
   opts.setInput<T>(static_cast<T*>(buffer_data) +
-                       displcmnts[gloo_context_->ctx->rank],
-                   counts[gloo_context_->ctx->rank]);
+                       displcmnts[ctx_->rank],
+                   counts[ctx_->rank]);
   opts.setOutput<T>(static_cast<T*>(buffer_out), counts);
 
   gloo::allgatherv(opts);
 }
 
 template <typename T>
-void GlooAlgorithms<T>::Broadcast(void* buffer_data, int num_elements,
+std::unique_ptr<gloo::Algorithm>
+GlooAlgorithms<T>::BindAllgather(void* buffer_data, void* buffer_out,
+                                 int64_t* recvcounts, int64_t* displcmnts) {
+  std::vector<size_t> counts(recvcounts, recvcounts + ctx_->size);
+
+  auto bound =
+      new BoundCollective<gloo::AllgathervOptions, &gloo::allgatherv>(ctx_);
+  bound->opts.setInput<T>(static_cast<T*>(buffer_data) + displcmnts[ctx_->rank],
+                          counts[ctx_->rank]);
+  bound->opts.setOutput<T>(static_cast<T*>(buffer_out), counts);
+  return std::unique_ptr<gloo::Algorithm>(bound);
+}
+
+template <typename T>
+void GlooAlgorithms<T>::Broadcast(void* buffer_data, int64_t num_elements,
                                   int root_rank) {
-  gloo::BroadcastOptions opts(gloo_context_->ctx);
+  gloo::BroadcastOptions opts(ctx_);
   opts.setRoot(root_rank);
   opts.setOutput<T>(static_cast<T*>(buffer_data), (size_t) num_elements);
   gloo::broadcast(opts);
 }
 
+template <typename T>
+std::unique_ptr<gloo::Algorithm>
+GlooAlgorithms<T>::BindBroadcast(void* buffer_data, int64_t num_elements,
+                                 int root_rank) {
+  auto bound =
+      new BoundCollective<gloo::BroadcastOptions, &gloo::broadcast>(ctx_);
+  bound->opts.setRoot(root_rank);
+  bound->opts.setOutput<T>(static_cast<T*>(buffer_data),
+                           (size_t) num_elements);
+  return std::unique_ptr<gloo::Algorithm>(bound);
+}
+
+template <typename T>
+void GlooAlgorithms<T>::Reducescatter(void* buffer_data,
+                                      const int64_t* recvcounts,
+                                      ReduceOp reduce_op) {
+  int64_t num_elements = 0;
+  int64_t offset = 0;
+  for (int rc = 0; rc < ctx_->size; ++rc) {
+    if (rc == ctx_->rank) {
+      offset = num_elements;
+    }
+    num_elements += recvcounts[rc];
+  }
+
+  bool bindable = num_elements <= std::numeric_limits<int>::max();
+  switch (reduce_op) {
+  case ReduceOp::SUM:
+  case ReduceOp::MIN:
+  case ReduceOp::MAX:
+  case ReduceOp::PRODUCT:
+    break;
+  default:
+    bindable = false;
+  }
+
+  if (bindable) {
+    // Halving-doubling leaves the segment of every rank at its offset in the
+    // buffer. Partial meshes connect its partners only on a power of two
+    // ranks.
+    if ((ctx_->size & (ctx_->size - 1)) != 0) {
+      ConnectFullMesh(*ctx_);
+    }
+    std::vector<T*> ptrs{static_cast<T*>(buffer_data)};
+    std::vector<int> counts(recvcounts, recvcounts + ctx_->size);
+    gloo::ReduceScatterHalvingDoubling<T> reducescatter(
+        ctx_, ptrs, (int) num_elements, counts,
+        GetReductionFunction<T>(reduce_op));
+    reducescatter.run();
+  } else {
+    // The algorithm class takes int counts and only the reductions above.
+    // Other buffers are allreduced as a whole with the function API, which
+    // also sends the segments of all other ranks to this rank.
+    Allreduce(buffer_data, num_elements, reduce_op);
+  }
+
+  if (offset > 0) {
+    std::memmove(buffer_data, static_cast<T*>(buffer_data) + offset,
+                 recvcounts[ctx_->rank] * sizeof(T));
+  }
+}
+
+template <typename T>
+void GlooAlgorithms<T>::Reduce(void* buffer_data, int64_t num_elements,
+                               ReduceOp reduce_op, int root_rank) {
+  ConnectFullMesh(*ctx_);
+  gloo::ReduceOptions opts(ctx_);
+  opts.setRoot(root_rank);
+  opts.setOutput<T>(static_cast<T*>(buffer_data), (size_t) num_elements);
+  opts.setReduceFunction(
+      gloo::ReduceOptions::Func(GetReduceFunction<T>(reduce_op)));
+
+  gloo::reduce(opts);
+}
+
+template <typename T>
+void GlooAlgorithms<T>::Alltoallv(void* sendbuf,
+                                  const std::vector<int64_t>& sendcounts,
+                                  void* recvbuf,
+                                  const std::vector<int64_t>& recvcounts) {
+  ConnectFullMesh(*ctx_);
+  gloo::AlltoallvOptions opts(ctx_);
+  opts.setInput<T>(static_cast<T*>(sendbuf), sendcounts);
+  opts.setOutput<T>(static_cast<T*>(recvbuf), recvcounts);
+  gloo::alltoallv(opts);
+}
+
 template <typename T> int GlooAlgorithms<T>::ElementSize() const {
   return sizeof(T);
 }
 
 GlooAllreduce::GlooAllreduce(GlooContext* gloo_context,
                              HorovodGlobalState* global_state)
-    : AllreduceOp(global_state), gloo_context_(gloo_context) {}
+    : AllreduceOp(global_state), gloo_context_(gloo_context),
+      algorithm_table_(DefaultAlgorithmTable()) {
+  algorithm_table_.ParseFromEnv();
+}
 
 Status GlooAllreduce::Execute(std::vector<TensorTableEntry>& entries,
                               const Response& response) {
   auto& first_entry = entries[0];
 
   void* buffer_data;
-  int num_elements = (int)NumElements(entries);
+  size_t buffer_len;
 
   // Copy memory into the fusion buffer.
   auto& timeline = global_state_->timeline;
   if (entries.size() > 1) {
     timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
     const void* fused_input_data;
-    size_t buffer_len;
     MemcpyInFusionBuffer(entries, fused_input_data, buffer_data, buffer_len);
     timeline.ActivityEndAll(entries);
   } else {
     buffer_data = (void*)first_entry.output->data();
-    std::memcpy(buffer_data, first_entry.tensor->data(),
-                (size_t)first_entry.tensor->size());
+    buffer_len = (size_t)first_entry.output->size();
+    if (first_entry.prescale_factor != 1.0) {
+      PrescaleEntry(first_entry);
+    } else {
+      std::memcpy(buffer_data, first_entry.tensor->data(),
+                  (size_t)first_entry.tensor->size());
+    }
   }
 
   // Do allreduce.
   timeline.ActivityStartAll(entries, GLOO_ALLREDUCE);
-  std::unique_ptr<IGlooAlgorithms> gloo_algos(
-      GetAlgorithmsForType(first_entry.tensor->dtype(), gloo_context_));
-  gloo_algos->Allreduce(buffer_data, num_elements);
+  auto segments = GetDataTypeSegments(entries);
+  int num_stripes = NumStripes((int64_t)buffer_len);
+  auto algorithm = SelectAlgorithm(segments, (int64_t)buffer_len / num_stripes,
+                                   num_stripes);
+  auto persistent =
+      GetPersistentAlgorithms(entries, segments, response.reduce_op(),
+                              algorithm, num_stripes, buffer_data);
+  if (persistent != nullptr) {
+    // Fused response recurs, rerun the algorithms bound to its layout.
+    gloo_context_->stripe_workers.Run(num_stripes, [&](int stripe) {
+      for (size_t i = stripe; i < persistent->algorithms.size();
+           i += num_stripes) {
+        if (persistent->algorithms[i] != nullptr) {
+          persistent->algorithms[i]->run();
+        }
+      }
+    });
+  } else {
+    // Responses fused across data types hold one segment per type in the
+    // fusion buffer, each reduced with the algorithms for its own type.
+    // Algorithms are looked up before the stripes run in parallel. Binding
+    // an algorithm class for a single run costs more than it saves, so
+    // buffers that are not cached go through the allreduce function.
+    std::vector<IGlooAlgorithms*> stripe_algos;
+    for (auto& segment : segments) {
+      for (int stripe = 0; stripe < num_stripes; ++stripe) {
+        stripe_algos.push_back(GetAlgorithmsForType(
+            segment.dtype, gloo_context_, gloo_context_->stripe_ctxs[stripe]));
+      }
+    }
+    gloo_context_->stripe_workers.Run(num_stripes, [&](int stripe) {
+      for (size_t i = 0; i < segments.size(); ++i) {
+        int64_t begin, end;
+        StripeRange(segments[i].num_elements, stripe, num_stripes, begin, end);
+        if (begin == end) {
+          continue;
+        }
+        auto gloo_algos = stripe_algos[i * num_stripes + stripe];
+        void* data = (uint8_t*)buffer_data + segments[i].offset +
+                     begin * gloo_algos->ElementSize();
+        gloo_algos->Allreduce(data, end - begin, response.reduce_op());
+      }
+    });
+  }
   timeline.ActivityEndAll(entries);
 
   // Copy memory out of the fusion buffer.
@@ -137,21 +502,223 @@ Status GlooAllreduce::Execute(std::vector<TensorTableEntry>& entries,
     timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
     MemcpyOutFusionBuffer(buffer_data, entries);
     timeline.ActivityEndAll(entries);
+  } else if (first_entry.postscale_factor != 1.0) {
+    PostscaleEntry(first_entry);
   }
 
   return Status::OK();
 }
 
+int GlooAllreduce::NumStripes(int64_t num_bytes) const {
+  if (num_bytes < gloo_context_->stripe_threshold) {
+    return 1;
+  }
+  return (int)gloo_context_->stripe_ctxs.size();
+}
+
+AllreduceAlgorithm
+GlooAllreduce::SelectAlgorithm(const std::vector<DataTypeSegment>& segments,
+                               int64_t num_bytes, int num_stripes) const {
+  for (auto& segment : segments) {
+    if (segment.num_elements > std::numeric_limits<int>::max()) {
+      return AllreduceAlgorithm::LIBRARY;
+    }
+  }
+
+  int size = controller_->GetSize();
+  auto algorithm = global_state_->parameter_manager.CpuAllreduceAlgorithm();
+  if (algorithm == AllreduceAlgorithm::AUTO) {
+    algorithm = algorithm_table_.Select(num_bytes, size);
+    // Halving-doubling folds the ranks beyond the largest power of two in
+    // extra steps, so ring is used instead on other numbers of ranks.
+    if (algorithm == AllreduceAlgorithm::RABENSEIFNER &&
+        (size & (size - 1)) != 0) {
+      algorithm = AllreduceAlgorithm::RING;
+    }
+  }
+
+  // Bcube splits the buffer among groups of base ranks at every step, so it
+  // needs a number of ranks that is a power of the base, and at least one
+  // element per rank on every stripe.
+  if (algorithm == AllreduceAlgorithm::BCUBE) {
+    int base = gloo_context_->ctx->base;
+    int64_t groups = 1;
+    while (groups < size) {
+      groups *= base;
+    }
+    bool supported = base > 1 && groups == size;
+    for (auto& segment : segments) {
+      supported &= segment.num_elements >= (int64_t)size * num_stripes;
+    }
+    if (!supported) {
+      algorithm = AllreduceAlgorithm::RING;
+    }
+  }
+  return algorithm;
+}
+
+GlooPersistentAlgorithms* GlooAllreduce::GetPersistentAlgorithms(
+    const std::vector<TensorTableEntry>& entries,
+    const std::vector<DataTypeSegment>& segments, ReduceOp reduce_op,
+    AllreduceAlgorithm algorithm, int num_stripes, void* buffer_data) {
+  // Only fusion buffers stay at the same address from step to step. The
+  // library has no algorithm class to bind, and it is selected for segments
+  // too large for int element counts.
+  if (entries.size() == 1 || algorithm == AllreduceAlgorithm::LIBRARY) {
+    return nullptr;
+  }
+
+  auto& cache = ResizeBoundCollectives(gloo_context_->persistent_allreduces,
+                                       global_state_);
+
+  // The autotuner may switch algorithms, so they are part of the key.
+  auto key = PersistentCollectiveKey(entries, segments, reduce_op) + ";" +
+             AllreduceAlgorithmName(algorithm) + ";" +
+             std::to_string(num_stripes);
+  auto generation = FusionBufferGeneration(entries[0]);
+  bool should_create;
+  auto persistent = cache.Get(key, generation, should_create);
+  if (persistent == nullptr && should_create) {
+    // Algorithms of stripe s are at the indices equal to s modulo the number
+    // of stripes, with nullptr for stripes without elements of a segment.
+    std::unique_ptr<GlooPersistentAlgorithms> created(
+        new GlooPersistentAlgorithms());
+    for (auto& segment : segments) {
+      for (int stripe = 0; stripe < num_stripes; ++stripe) {
+        int64_t begin, end;
+        StripeRange(segment.num_elements, stripe, num_stripes, begin, end);
+        if (begin == end) {
+          created->algorithms.emplace_back();
+          continue;
+        }
+        auto gloo_algos = GetAlgorithmsForType(
+            segment.dtype, gloo_context_, gloo_context_->stripe_ctxs[stripe]);
+        created->algorithms.push_back(gloo_algos->BindAllreduce(
+            (uint8_t*)buffer_data + segment.offset +
+                begin * gloo_algos->ElementSize(),
+            end - begin, reduce_op, algorithm));
+      }
+    }
+    persistent = cache.Put(key, generation, std::move(created));
+  }
+  return persistent;
+}
+
 bool GlooAllreduce::Enabled(const ParameterManager& param_manager,
                             const std::vector<TensorTableEntry>& entries,
                             const Response& response) const {
   return true;
 }
 
+GlooHierarchicalAllreduce::GlooHierarchicalAllreduce(
+    GlooContext* gloo_context, HorovodGlobalState* global_state)
+    : GlooAllreduce(gloo_context, global_state) {}
+
+Status
+GlooHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
+                                   const Response& response) {
+  auto& first_entry = entries[0];
+
+  void* buffer_data;
+  size_t buffer_len;
+
+  // Copy memory into the fusion buffer.
+  auto& timeline = global_state_->timeline;
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    const void* fused_input_data;
+    MemcpyInFusionBuffer(entries, fused_input_data, buffer_data, buffer_len);
+    timeline.ActivityEndAll(entries);
+  } else {
+    buffer_data = (void*)first_entry.output->data();
+    buffer_len = (size_t)first_entry.output->size();
+    if (first_entry.prescale_factor != 1.0) {
+      PrescaleEntry(first_entry);
+    } else {
+      std::memcpy(buffer_data, first_entry.tensor->data(),
+                  (size_t)first_entry.tensor->size());
+    }
+  }
+
+  // Reduce within the node to local rank 0. Gloo uses the buffers of the
+  // other local ranks as scratch space, which are theirs to overwrite since
+  // they receive the result below.
+  auto segments = GetDataTypeSegments(entries);
+  timeline.ActivityStartAll(entries, GLOO_REDUCE);
+  for (auto& segment : segments) {
+    auto local_algos =
+        GetAlgorithmsForType(segment.dtype, gloo_context_, Communicator::LOCAL);
+    local_algos->Reduce((uint8_t*)buffer_data + segment.offset,
+                        segment.num_elements, response.reduce_op(), 0);
+  }
+  timeline.ActivityEndAll(entries);
+
+  // Allreduce across nodes among local ranks 0.
+  if (controller_->GetLocalRank() == 0) {
+    timeline.ActivityStartAll(entries, GLOO_ALLREDUCE);
+    for (auto& segment : segments) {
+      auto cross_algos = GetAlgorithmsForType(
+          segment.dtype, gloo_context_, Communicator::CROSS);
+      cross_algos->Allreduce((uint8_t*)buffer_data + segment.offset,
+                             segment.num_elements, response.reduce_op());
+    }
+    timeline.ActivityEndAll(entries);
+  }
+
+  // Broadcast the result within the node, all segments at once as bytes.
+  timeline.ActivityStartAll(entries, GLOO_BCAST);
+  auto byte_algos =
+      GetAlgorithmsForType(HOROVOD_UINT8, gloo_context_, Communicator::LOCAL);
+  byte_algos->Broadcast(buffer_data, (int64_t)buffer_len, 0);
+  timeline.ActivityEndAll(entries);
+
+  // Copy memory out of the fusion buffer.
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(buffer_data, entries);
+    timeline.ActivityEndAll(entries);
+  } else if (first_entry.postscale_factor != 1.0) {
+    PostscaleEntry(first_entry);
+  }
+
+  return Status::OK();
+}
+
+bool GlooHierarchicalAllreduce::Enabled(
+    const ParameterManager& param_manager,
+    const std::vector<TensorTableEntry>& entries,
+    const Response& response) const {
+  return param_manager.HierarchicalAllreduce() &&
+         gloo_context_->local_ctx != nullptr &&
+         gloo_context_->cross_ctx != nullptr;
+}
+
 GlooAllgather::GlooAllgather(GlooContext* gloo_context,
                              HorovodGlobalState* global_state)
     : AllgatherOp(global_state), gloo_context_(gloo_context) {}
 
+GlooPersistentAlgorithms* GlooAllgather::GetPersistentAlgorithms(
+    const std::vector<TensorTableEntry>& entries, IGlooAlgorithms* gloo_algos,
+    void* buffer_data, int64_t* recvcounts, int64_t* displcmnts) {
+  auto& cache = ResizeBoundCollectives(gloo_context_->persistent_allgathers,
+                                       global_state_);
+  std::string key = std::to_string(entries[0].tensor->dtype());
+  for (int rc = 0; rc < controller_->GetSize(); ++rc) {
+    key += ":" + std::to_string(recvcounts[rc]);
+  }
+  auto generation = FusionBufferGeneration(entries[0]);
+  bool should_create;
+  auto persistent = cache.Get(key, generation, should_create);
+  if (persistent == nullptr && should_create) {
+    std::unique_ptr<GlooPersistentAlgorithms> created(
+        new GlooPersistentAlgorithms());
+    created->algorithms.push_back(gloo_algos->BindAllgather(
+        buffer_data, buffer_data, recvcounts, displcmnts));
+    persistent = cache.Put(key, generation, std::move(created));
+  }
+  return persistent;
+}
+
 bool GlooAllgather::Enabled(const ParameterManager& param_manager,
                             const std::vector<TensorTableEntry>& entries,
                             const Response& response) const {
@@ -169,9 +736,9 @@ Status GlooAllgather::Execute(std::vector<TensorTableEntry>& entries,
   // allgatherv
   auto** entry_component_offsets = new int64_t*[entries.size()];
 
-  int global_size = global_state_->controller->GetSize();
-  auto* recvcounts = new int[global_size]();
-  auto* displcmnts = new int[global_size]();
+  int global_size = controller_->GetSize();
+  auto* recvcounts = new int64_t[global_size]();
+  auto* displcmnts = new int64_t[global_size]();
 
   for (size_t ec = 0; ec < entries.size(); ++ec) {
     entry_component_sizes[ec] = new int64_t[global_size]();
@@ -192,8 +759,8 @@ Status GlooAllgather::Execute(std::vector<TensorTableEntry>& entries,
   SetEntryComponentOffsets(entries, entry_component_sizes, recvcounts,
                            entry_component_offsets);
 
-  std::unique_ptr<IGlooAlgorithms> gloo_algos(
-      GetAlgorithmsForType(first_entry.tensor->dtype(), gloo_context_));
+  auto gloo_algos =
+      GetAlgorithmsForType(first_entry.tensor->dtype(), gloo_context_);
   int element_size = gloo_algos->ElementSize();
 
   void* sendbuf = nullptr;
@@ -208,7 +775,7 @@ Status GlooAllgather::Execute(std::vector<TensorTableEntry>& entries,
     // need to move input data to its corresponding location in the output
     sendbuf = (void*)first_entry.tensor->data();
     buffer_data = (void*)first_entry.output->data();
-    int buffer_offset = displcmnts[gloo_context_->ctx->rank] * element_size;
+    int64_t buffer_offset = displcmnts[gloo_context_->ctx->rank] * element_size;
     std::memcpy((uint8_t*)buffer_data + buffer_offset, sendbuf,
                 (size_t)first_entry.tensor->size());
     sendbuf = buffer_data;
@@ -216,7 +783,16 @@ Status GlooAllgather::Execute(std::vector<TensorTableEntry>& entries,
 
   // call gloo allgather api
   global_state_->timeline.ActivityStartAll(entries, GLOO_ALLGATHER);
-  gloo_algos->Allgather(sendbuf, buffer_data, recvcounts, displcmnts);
+  GlooPersistentAlgorithms* persistent = nullptr;
+  if (entries.size() > 1) {
+    persistent = GetPersistentAlgorithms(entries, gloo_algos, buffer_data,
+                                         recvcounts, displcmnts);
+  }
+  if (persistent != nullptr) {
+    persistent->algorithms[0]->run();
+  } else {
+    gloo_algos->Allgather(sendbuf, buffer_data, recvcounts, displcmnts);
+  }
   global_state_->timeline.ActivityEndAll(entries);
 
   // if multiple tensors are gathered, restore the sequence from output
@@ -240,40 +816,614 @@ Status GlooAllgather::Execute(std::vector<TensorTableEntry>& entries,
   return Status::OK();
 }
 
+GlooHierarchicalAllgather::GlooHierarchicalAllgather(
+    GlooContext* gloo_context, HorovodGlobalState* global_state)
+    : GlooAllgather(gloo_context, global_state) {}
+
+Status
+GlooHierarchicalAllgather::Execute(std::vector<TensorTableEntry>& entries,
+                                   const Response& response) {
+  auto& timeline = global_state_->timeline;
+
+  // Sizes of subcomponents of each entry from all ranks
+  auto** entry_component_sizes = new int64_t*[entries.size()];
+
+  // Offset of each subcomponent of every entry in the final buffer after
+  // allgatherv
+  auto** entry_component_offsets = new int64_t*[entries.size()];
+
+  int global_size = controller_->GetSize();
+  auto* recvcounts = new int64_t[global_size]();
+  auto* displcmnts = new int64_t[global_size]();
+
+  for (size_t ec = 0; ec < entries.size(); ++ec) {
+    entry_component_sizes[ec] = new int64_t[global_size]();
+    entry_component_offsets[ec] = new int64_t[global_size]();
+  }
+
+  auto& first_entry = entries[0];
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status =
+      AllocateOutput(entries, response, entry_component_sizes, recvcounts);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  SetDisplacements(recvcounts, displcmnts);
+  SetEntryComponentOffsets(entries, entry_component_sizes, recvcounts,
+                           entry_component_offsets);
+
+  DataType dtype = first_entry.tensor->dtype();
+  auto local_algos =
+      GetAlgorithmsForType(dtype, gloo_context_, Communicator::LOCAL);
+  int element_size = local_algos->ElementSize();
+
+  // Data of every rank goes to its place in the buffer holding the data of
+  // all ranks, in the order of the ranks.
+  int rank = controller_->GetRank();
+  void* buffer_data;
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    MemcpyInFusionBuffer(entries, displcmnts, element_size, buffer_data);
+    timeline.ActivityEndAll(entries);
+  } else {
+    buffer_data = (void*)first_entry.output->data();
+    std::memcpy((uint8_t*)buffer_data + displcmnts[rank] * element_size,
+                first_entry.tensor->data(), (size_t)first_entry.tensor->size());
+  }
+
+  // Gather the data of the node on local rank 0, whose own data is already
+  // in place. Gloo's function API has no gatherv, so an alltoallv with no
+  // data sent to or received from other ranks than local rank 0 is used.
+  int local_rank = controller_->GetLocalRank();
+  int local_size = controller_->GetLocalSize();
+  int node_rank = rank - local_rank;
+  std::vector<int64_t> sendcounts(local_size, 0);
+  std::vector<int64_t> local_recvcounts(local_size, 0);
+  void* sendbuf = (uint8_t*)buffer_data + displcmnts[rank] * element_size;
+  void* recvbuf = sendbuf;
+  if (local_rank == 0) {
+    for (int lr = 1; lr < local_size; ++lr) {
+      local_recvcounts[lr] = recvcounts[node_rank + lr];
+    }
+    if (local_size > 1) {
+      recvbuf = (uint8_t*)buffer_data + displcmnts[rank + 1] * element_size;
+    }
+  } else {
+    sendcounts[0] = recvcounts[rank];
+  }
+  timeline.ActivityStartAll(entries, GLOO_GATHER);
+  local_algos->Alltoallv(sendbuf, sendcounts, recvbuf, local_recvcounts);
+  timeline.ActivityEndAll(entries);
+
+  // Allgather the data of the nodes among local ranks 0.
+  if (local_rank == 0) {
+    int cross_size = controller_->GetCrossSize();
+    std::vector<int64_t> cross_recvcounts(cross_size, 0);
+    std::vector<int64_t> cross_displcmnts(cross_size, 0);
+    int offset = 0;
+    for (int cr = 0; cr < cross_size; ++cr) {
+      int node_size = controller_->GetLocalSizeAtCrossRank(cr);
+      for (int rc = offset; rc < offset + node_size; ++rc) {
+        cross_recvcounts[cr] += recvcounts[rc];
+      }
+      cross_displcmnts[cr] = displcmnts[offset];
+      offset += node_size;
+    }
+
+    auto cross_algos =
+        GetAlgorithmsForType(dtype, gloo_context_, Communicator::CROSS);
+    timeline.ActivityStartAll(entries, GLOO_CROSS_ALLGATHER);
+    cross_algos->Allgather(buffer_data, buffer_data, cross_recvcounts.data(),
+                           cross_displcmnts.data());
+    timeline.ActivityEndAll(entries);
+  }
+
+  // Broadcast the data of all ranks within the node.
+  int64_t total_size =
+      displcmnts[global_size - 1] + recvcounts[global_size - 1];
+  timeline.ActivityStartAll(entries, GLOO_BCAST);
+  local_algos->Broadcast(buffer_data, total_size, 0);
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(entry_component_offsets, entry_component_sizes,
+                          buffer_data, element_size, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  delete[] recvcounts;
+  delete[] displcmnts;
+
+  for (size_t ec = 0; ec < entries.size(); ++ec) {
+    delete[] entry_component_sizes[ec];
+    delete[] entry_component_offsets[ec];
+  }
+  delete[] entry_component_sizes;
+  delete[] entry_component_offsets;
+
+  return Status::OK();
+}
+
+bool GlooHierarchicalAllgather::Enabled(
+    const ParameterManager& param_manager,
+    const std::vector<TensorTableEntry>& entries,
+    const Response& response) const {
+  return param_manager.HierarchicalAllgather() &&
+         gloo_context_->local_ctx != nullptr &&
+         gloo_context_->cross_ctx != nullptr;
+}
+
 GlooBroadcast::GlooBroadcast(GlooContext* gloo_context,
                              HorovodGlobalState* global_state)
     : BroadcastOp(global_state), gloo_context_(gloo_context) {}
 
 Status GlooBroadcast::Execute(std::vector<TensorTableEntry>& entries,
                               const Response& response) {
-  assert(entries.size() == 1);
-  auto e = entries[0];
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+  bool is_root_rank =
+      controller_->GetRank() == first_entry.root_rank;
 
   // On root rank, MPI_Bcast sends data, on other ranks it receives data.
-  // for gloo broadcast, only output needs to be set if inplace
-
+  // for gloo broadcast, only output needs to be set if inplace.
+  // Fused broadcasts are sent as bytes through the fusion buffer.
   void* data_ptr;
-  if (global_state_->controller->GetRank() == e.root_rank) {
-    data_ptr = (void*)e.tensor->data();
+  int64_t num_elements;
+  DataType dtype;
+  if (entries.size() > 1) {
+    if (is_root_rank) {
+      timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+      MemcpyInFusionBuffer(entries, data_ptr);
+      timeline.ActivityEndAll(entries);
+    } else {
+      data_ptr = GetFusionBuffer(entries);
+    }
+    num_elements = FusedByteSize(entries);
+    dtype = HOROVOD_UINT8;
   } else {
-    data_ptr = (void*)e.output->data();
+    if (is_root_rank) {
+      data_ptr = (void*)first_entry.tensor->data();
+    } else {
+      data_ptr = (void*)first_entry.output->data();
+    }
+    num_elements = first_entry.tensor->shape().num_elements();
+    dtype = first_entry.tensor->dtype();
   }
 
-  global_state_->timeline.ActivityStartAll(entries, GLOO_BCAST);
-  std::unique_ptr<IGlooAlgorithms> gloo_algos(
-      GetAlgorithmsForType(e.tensor->dtype(), gloo_context_));
-  gloo_algos->Broadcast(data_ptr, (int)e.tensor->shape().num_elements(),
-                        e.root_rank);
-  global_state_->timeline.ActivityEndAll(entries);
+  timeline.ActivityStartAll(entries, GLOO_BCAST);
+  auto gloo_algos = GetAlgorithmsForType(dtype, gloo_context_);
+  GlooPersistentAlgorithms* persistent = nullptr;
+  if (entries.size() > 1) {
+    persistent = GetPersistentAlgorithms(entries, gloo_algos, data_ptr,
+                                         num_elements, first_entry.root_rank);
+  }
+  if (persistent != nullptr) {
+    persistent->algorithms[0]->run();
+  } else {
+    gloo_algos->Broadcast(data_ptr, num_elements, first_entry.root_rank);
+  }
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1 && !is_root_rank) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(data_ptr, entries);
+    timeline.ActivityEndAll(entries);
+  }
 
   return Status::OK();
 }
 
+GlooPersistentAlgorithms* GlooBroadcast::GetPersistentAlgorithms(
+    const std::vector<TensorTableEntry>& entries, IGlooAlgorithms* gloo_algos,
+    void* buffer_data, int64_t num_bytes, int root_rank) {
+  auto& cache = ResizeBoundCollectives(gloo_context_->persistent_broadcasts,
+                                       global_state_);
+  auto key = std::to_string(root_rank) + ":" + std::to_string(num_bytes);
+  auto generation = FusionBufferGeneration(entries[0]);
+  bool should_create;
+  auto persistent = cache.Get(key, generation, should_create);
+  if (persistent == nullptr && should_create) {
+    std::unique_ptr<GlooPersistentAlgorithms> created(
+        new GlooPersistentAlgorithms());
+    created->algorithms.push_back(
+        gloo_algos->BindBroadcast(buffer_data, num_bytes, root_rank));
+    persistent = cache.Put(key, generation, std::move(created));
+  }
+  return persistent;
+}
+
 bool GlooBroadcast::Enabled(const ParameterManager& param_manager,
                             const std::vector<TensorTableEntry>& entries,
                             const Response& response) const {
   return true;
 }
 
+GlooReducescatter::GlooReducescatter(GlooContext* gloo_context,
+                                     HorovodGlobalState* global_state)
+    : ReducescatterOp(global_state), gloo_context_(gloo_context) {}
+
+Status GlooReducescatter::Execute(std::vector<TensorTableEntry>& entries,
+                                  const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+
+  int global_size = controller_->GetSize();
+  auto output_shapes = ComputeOutputShapes(entries, global_size);
+  auto recvcounts = ComputeReceiveCounts(output_shapes);
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status = AllocateOutput(entries, output_shapes);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  auto gloo_algos =
+      GetAlgorithmsForType(first_entry.tensor->dtype(), gloo_context_);
+
+  // Gloo reduces in place, so the input of a single entry is copied to keep
+  // it intact.
+  void* buffer_data;
+  std::vector<uint8_t> input_copy;
+  timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+  if (entries.size() > 1) {
+    MemcpyInFusionBuffer(entries, output_shapes, gloo_algos->ElementSize(),
+                         buffer_data);
+  } else {
+    auto input = static_cast<const uint8_t*>(first_entry.tensor->data());
+    input_copy.assign(input, input + first_entry.tensor->size());
+    buffer_data = input_copy.data();
+  }
+  timeline.ActivityEndAll(entries);
+
+  timeline.ActivityStartAll(entries, GLOO_REDUCESCATTER);
+  gloo_algos->Reducescatter(buffer_data, recvcounts.data(),
+                            response.reduce_op());
+  timeline.ActivityEndAll(entries);
+
+  timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+  MemcpyOutFusionBuffer(buffer_data, entries);
+  timeline.ActivityEndAll(entries);
+
+  return Status::OK();
+}
+
+bool GlooReducescatter::Enabled(const ParameterManager& param_manager,
+                                const std::vector<TensorTableEntry>& entries,
+                                const Response& response) const {
+  return true;
+}
+
+GlooAlltoall::GlooAlltoall(GlooContext* gloo_context,
+                           HorovodGlobalState* global_state)
+    : AlltoallOp(global_state), gloo_context_(gloo_context) {}
+
+Status GlooAlltoall::Execute(std::vector<TensorTableEntry>& entries,
+                             const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status = AllocateOutput(entries, response);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  std::vector<int64_t> sendcounts, sdispls, recvcounts, rdispls;
+  ComputeCounts(entries, response, sendcounts, sdispls, recvcounts, rdispls);
+
+  auto gloo_algos =
+      GetAlgorithmsForType(first_entry.tensor->dtype(), gloo_context_);
+  int element_size = gloo_algos->ElementSize();
+
+  void* sendbuf;
+  void* recvbuf;
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    MemcpyInFusionBuffer(entries, response, element_size, sendbuf);
+    timeline.ActivityEndAll(entries);
+    recvbuf = GetReceiveBuffer(
+        (rdispls.back() + recvcounts.back()) * element_size);
+  } else {
+    sendbuf = (void*)first_entry.tensor->data();
+    recvbuf = (void*)first_entry.output->data();
+  }
+
+  timeline.ActivityStartAll(entries, GLOO_ALLTOALL);
+  gloo_algos->Alltoallv(sendbuf, sendcounts, recvbuf, recvcounts);
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(recvbuf, response, element_size, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  return Status::OK();
+}
+
+bool GlooAlltoall::Enabled(const ParameterManager& param_manager,
+                           const std::vector<TensorTableEntry>& entries,
+                           const Response& response) const {
+  return true;
+}
+
+GlooSparseAllreduce::GlooSparseAllreduce(GlooContext* gloo_context,
+                                         HorovodGlobalState* global_state)
+    : SparseAllreduceOp(global_state), gloo_context_(gloo_context) {}
+
+Status GlooSparseAllreduce::Execute(std::vector<TensorTableEntry>& entries,
+                                    const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& e = entries[0];
+
+  if (UseDense(e, response)) {
+    timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+    Status status = ScatterDense(e);
+    if (!status.ok()) {
+      return status;
+    }
+    timeline.ActivityEndAll(entries);
+
+    auto gloo_algos = GetAlgorithmsForType(e.tensor->dtype(), gloo_context_);
+    timeline.ActivityStartAll(entries, GLOO_ALLREDUCE);
+    gloo_algos->Allreduce((void*)e.output->data(),
+                          e.output->shape().num_elements(), ReduceOp::SUM);
+    timeline.ActivityEndAll(entries);
+    return Status::OK();
+  }
+
+  std::vector<int64_t> counts, displcmnts;
+  ComputeBlockCounts(e, response, counts, displcmnts);
+  auto* buffer =
+      (uint8_t*)GetReceiveBuffer(displcmnts.back() + counts.back());
+  PackBlock(e, buffer + displcmnts[gloo_context_->ctx->rank]);
+
+  // The blocks are exchanged as bytes, in place.
+  auto gloo_algos = GetAlgorithmsForType(HOROVOD_UINT8, gloo_context_);
+  timeline.ActivityStartAll(entries, GLOO_SPARSE_ALLREDUCE);
+  gloo_algos->Allgather(buffer, buffer, counts.data(), displcmnts.data());
+  timeline.ActivityEndAll(entries);
+
+  timeline.ActivityStartAll(entries, MEMCPY_OUT_HOST_BUFFER);
+  Status status = UnpackBlocks(e, response, buffer, displcmnts);
+  timeline.ActivityEndAll(entries);
+  return status;
+}
+
+bool GlooSparseAllreduce::Enabled(const ParameterManager& param_manager,
+                                  const std::vector<TensorTableEntry>& entries,
+                                  const Response& response) const {
+  return true;
+}
+
+GlooReduce::GlooReduce(GlooContext* gloo_context,
+                       HorovodGlobalState* global_state)
+    : ReduceToRootOp(global_state), gloo_context_(gloo_context) {}
+
+Status GlooReduce::Execute(std::vector<TensorTableEntry>& entries,
+                           const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+  int root_rank = first_entry.root_rank;
+  bool is_root = controller_->GetRank() == root_rank;
+
+  auto gloo_algos =
+      GetAlgorithmsForType(first_entry.tensor->dtype(), gloo_context_);
+
+  // Gloo reduces in place and uses the buffers of all ranks, so a single
+  // entry is reduced in its output on the root rank and in a copy elsewhere.
+  void* buffer_data;
+  std::vector<uint8_t> input_copy;
+  timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+  if (entries.size() > 1) {
+    const void* fused_input_data;
+    size_t buffer_len;
+    MemcpyInFusionBuffer(entries, fused_input_data, buffer_data, buffer_len);
+  } else if (is_root) {
+    buffer_data = (void*) first_entry.output->data();
+    if (first_entry.tensor->data() != buffer_data) {
+      std::memcpy(buffer_data, first_entry.tensor->data(),
+                  (size_t) first_entry.tensor->size());
+    }
+  } else {
+    auto input = static_cast<const uint8_t*>(first_entry.tensor->data());
+    input_copy.assign(input, input + first_entry.tensor->size());
+    buffer_data = input_copy.data();
+  }
+  timeline.ActivityEndAll(entries);
+
+  timeline.ActivityStartAll(entries, GLOO_REDUCE);
+  gloo_algos->Reduce(buffer_data, NumElements(entries), response.reduce_op(),
+                     root_rank);
+  timeline.ActivityEndAll(entries);
+
+  if (!is_root) {
+    CopyInputsToOutputs(entries);
+  } else if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(buffer_data, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  return Status::OK();
+}
+
+bool GlooReduce::Enabled(const ParameterManager& param_manager,
+                         const std::vector<TensorTableEntry>& entries,
+                         const Response& response) const {
+  return true;
+}
+
+GlooGather::GlooGather(GlooContext* gloo_context,
+                       HorovodGlobalState* global_state)
+    : GatherOp(global_state), gloo_context_(gloo_context) {}
+
+Status GlooGather::Execute(std::vector<TensorTableEntry>& entries,
+                           const Response& response) {
+  auto& timeline = global_state_->timeline;
+
+  auto** entry_component_sizes = new int64_t* [entries.size()];
+  auto** entry_component_offsets = new int64_t* [entries.size()];
+
+  int global_size = controller_->GetSize();
+  auto* recvcounts = new int64_t[global_size]();
+  auto* displcmnts = new int64_t[global_size]();
+
+  for (size_t ec = 0; ec < entries.size(); ++ec) {
+    entry_component_sizes[ec] = new int64_t[global_size]();
+    entry_component_offsets[ec] = new int64_t[global_size]();
+  }
+
+  auto& first_entry = entries[0];
+  int root_rank = first_entry.root_rank;
+  int rank = controller_->GetRank();
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status = AllocateOutput(entries, response, entry_component_sizes, recvcounts);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  SetDisplacements(recvcounts, displcmnts);
+  SetEntryComponentOffsets(entries, entry_component_sizes, recvcounts, entry_component_offsets);
+
+  auto gloo_algos =
+      GetAlgorithmsForType(first_entry.tensor->dtype(), gloo_context_);
+  int element_size = gloo_algos->ElementSize();
+
+  // Gloo's function API has no gather, so an alltoallv with no data sent to
+  // or received from other ranks than the root is used instead.
+  std::vector<int64_t> sendcounts(global_size, 0);
+  std::vector<int64_t> rootcounts(global_size, 0);
+  sendcounts[root_rank] = recvcounts[rank];
+  if (rank == root_rank) {
+    rootcounts.assign(recvcounts, recvcounts + global_size);
+  }
+
+  void* sendbuf;
+  void* recvbuf;
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    void* buffer_data;
+    MemcpyInFusionBuffer(entries, displcmnts, element_size, buffer_data);
+    timeline.ActivityEndAll(entries);
+    sendbuf = (uint8_t*) buffer_data + displcmnts[rank] * element_size;
+    recvbuf = rank == root_rank
+                  ? GetReceiveBuffer((displcmnts[global_size - 1] +
+                                      recvcounts[global_size - 1]) *
+                                     element_size)
+                  : sendbuf;
+  } else {
+    sendbuf = (void*) first_entry.tensor->data();
+    recvbuf = rank == root_rank ? (void*) first_entry.output->data() : sendbuf;
+  }
+
+  timeline.ActivityStartAll(entries, GLOO_GATHER);
+  gloo_algos->Alltoallv(sendbuf, sendcounts, recvbuf, rootcounts);
+  timeline.ActivityEndAll(entries);
+
+  if (rank == root_rank && entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(entry_component_offsets, entry_component_sizes,
+                          recvbuf, element_size, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  delete[] recvcounts;
+  delete[] displcmnts;
+
+  for (size_t ec = 0; ec < entries.size(); ++ec) {
+    delete[] entry_component_sizes[ec];
+    delete[] entry_component_offsets[ec];
+  }
+  delete[] entry_component_sizes;
+  delete[] entry_component_offsets;
+
+  return Status::OK();
+}
+
+bool GlooGather::Enabled(const ParameterManager& param_manager,
+                         const std::vector<TensorTableEntry>& entries,
+                         const Response& response) const {
+  return true;
+}
+
+GlooScatter::GlooScatter(GlooContext* gloo_context,
+                         HorovodGlobalState* global_state)
+    : ScatterOp(global_state), gloo_context_(gloo_context) {}
+
+Status GlooScatter::Execute(std::vector<TensorTableEntry>& entries,
+                            const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+  int root_rank = first_entry.root_rank;
+  int rank = controller_->GetRank();
+
+  int global_size = controller_->GetSize();
+  auto output_shapes = ComputeOutputShapes(entries, global_size);
+  auto counts = ComputeReceiveCounts(output_shapes);
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status = AllocateOutput(entries, output_shapes);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  auto gloo_algos =
+      GetAlgorithmsForType(first_entry.tensor->dtype(), gloo_context_);
+  int element_size = gloo_algos->ElementSize();
+
+  // Gloo's function API has no scatter, so an alltoallv with no data sent to
+  // or received from other ranks than the root is used instead.
+  std::vector<int64_t> sendcounts(global_size, 0);
+  std::vector<int64_t> recvcounts(global_size, 0);
+  if (rank == root_rank) {
+    sendcounts = counts;
+  }
+  recvcounts[root_rank] = counts[rank];
+
+  void* sendbuf;
+  void* recvbuf;
+  if (entries.size() > 1) {
+    recvbuf = GetReceiveBuffer(counts[rank] * element_size);
+    if (rank == root_rank) {
+      timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+      MemcpyInFusionBuffer(entries, output_shapes, element_size, sendbuf);
+      timeline.ActivityEndAll(entries);
+    } else {
+      sendbuf = recvbuf;
+    }
+  } else {
+    sendbuf = (void*) first_entry.tensor->data();
+    recvbuf = (void*) first_entry.output->data();
+  }
+
+  timeline.ActivityStartAll(entries, GLOO_SCATTER);
+  gloo_algos->Alltoallv(sendbuf, sendcounts, recvbuf, recvcounts);
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(recvbuf, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  return Status::OK();
+}
+
+bool GlooScatter::Enabled(const ParameterManager& param_manager,
+                          const std::vector<TensorTableEntry>& entries,
+                          const Response& response) const {
+  return true;
+}
+
 } // namespace common
 } // namespace horovod
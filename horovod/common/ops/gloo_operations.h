@@ -16,6 +16,7 @@
 #ifndef HOROVOD_GLOO_OPERATIONS_H
 #define HOROVOD_GLOO_OPERATIONS_H
 
+#include "allreduce_algorithm_table.h"
 #include "collective_operations.h"
 #include "../gloo/gloo_context.h"
 
@@ -24,34 +25,94 @@ namespace common {
 
 class IGlooAlgorithms {
 public:
-  virtual void Allreduce(void* buffer_data, int num_elements) = 0;
+  virtual ~IGlooAlgorithms() = default;
 
-  virtual void Allgather(void* buffer_data, void* buffer_out, int* recvcounts,
-                         int* displcmnts) = 0;
+  virtual void Allreduce(void* buffer_data, int64_t num_elements,
+                         ReduceOp reduce_op) = 0;
 
-  virtual void Broadcast(void* buffer_data, int num_elements,
+  // Creates an allreduce with the given algorithm bound to the buffer, which
+  // can be run repeatedly. LIBRARY binds a ring allreduce. Buffers of more
+  // than INT_MAX elements are bound to the allreduce function instead.
+  virtual std::unique_ptr<gloo::Algorithm>
+  BindAllreduce(void* buffer_data, int64_t num_elements, ReduceOp reduce_op,
+                AllreduceAlgorithm algorithm) = 0;
+
+  virtual void Allgather(void* buffer_data, void* buffer_out,
+                         int64_t* recvcounts, int64_t* displcmnts) = 0;
+
+  // Creates an allgather bound to the buffers, which can be run repeatedly.
+  virtual std::unique_ptr<gloo::Algorithm>
+  BindAllgather(void* buffer_data, void* buffer_out, int64_t* recvcounts,
+                int64_t* displcmnts) = 0;
+
+  virtual void Broadcast(void* buffer_data, int64_t num_elements,
                          int root_rank) = 0;
 
+  // Creates a broadcast bound to the buffer, which can be run repeatedly.
+  virtual std::unique_ptr<gloo::Algorithm>
+  BindBroadcast(void* buffer_data, int64_t num_elements, int root_rank) = 0;
+
+  // Reduces the buffer, laid out rank by rank, and leaves the segment of
+  // this rank at its start.
+  virtual void Reducescatter(void* buffer_data, const int64_t* recvcounts,
+                             ReduceOp reduce_op) = 0;
+
+  // Reduces the buffer into the buffer of the root rank. Buffers of other
+  // ranks are used as scratch space.
+  virtual void Reduce(void* buffer_data, int64_t num_elements,
+                      ReduceOp reduce_op, int root_rank) = 0;
+
+  // Counts are numbers of elements sent to and received from every rank,
+  // whose data is laid out contiguously in the order of the ranks.
+  virtual void Alltoallv(void* sendbuf, const std::vector<int64_t>& sendcounts,
+                         void* recvbuf,
+                         const std::vector<int64_t>& recvcounts) = 0;
+
   virtual int ElementSize() const = 0;
 };
 
+// Algorithms running on the given Gloo context.
 template <typename T> class GlooAlgorithms : public IGlooAlgorithms {
 public:
-  GlooAlgorithms(GlooContext* gloo_context);
+  explicit GlooAlgorithms(std::shared_ptr<gloo::Context> ctx);
 
   ~GlooAlgorithms() = default;
 
-  void Allreduce(void* buffer_data, int num_elements) override;
+  void Allreduce(void* buffer_data, int64_t num_elements,
+                 ReduceOp reduce_op) override;
+
+  std::unique_ptr<gloo::Algorithm>
+  BindAllreduce(void* buffer_data, int64_t num_elements, ReduceOp reduce_op,
+                AllreduceAlgorithm algorithm) override;
 
-  void Allgather(void* buffer_data, void* buffer_out, int* recvcounts,
-                 int* displcmnts) override;
+  void Allgather(void* buffer_data, void* buffer_out, int64_t* recvcounts,
+                 int64_t* displcmnts) override;
 
-  void Broadcast(void* buffer_data, int num_elements, int root_rank) override;
+  std::unique_ptr<gloo::Algorithm>
+  BindAllgather(void* buffer_data, void* buffer_out, int64_t* recvcounts,
+                int64_t* displcmnts) override;
+
+  void Broadcast(void* buffer_data, int64_t num_elements,
+                 int root_rank) override;
+
+  std::unique_ptr<gloo::Algorithm>
+  BindBroadcast(void* buffer_data, int64_t num_elements,
+                int root_rank) override;
+
+  void Reducescatter(void* buffer_data, const int64_t* recvcounts,
+                     ReduceOp reduce_op) override;
+
+  void Reduce(void* buffer_data, int64_t num_elements, ReduceOp reduce_op,
+              int root_rank) override;
+
+  void Alltoallv(void* sendbuf, const std::vector<int64_t>& sendcounts,
+                 void* recvbuf,
+                 const std::vector<int64_t>& recvcounts) override;
 
   int ElementSize() const override;
 
 private:
-  GlooContext* gloo_context_;
+  std::shared_ptr<gloo::Context> ctx_;
 };
 
 class GlooAllreduce : public AllreduceOp {
@@ -68,7 +129,44 @@ public:
                const Response& response) const override;
 
 protected:
+  // Number of stripes of the global context a buffer is split across.
+  int NumStripes(int64_t num_bytes) const;
+
+  // Picks the algorithm for num_bytes of the buffer on each of its stripes
+  // from the autotuned parameter or the algorithm table, falling back to ring
+  // where bcube does not support the layout. Buffers with segments too large
+  // for the algorithm classes of Gloo are left to its allreduce function.
+  AllreduceAlgorithm
+  SelectAlgorithm(const std::vector<DataTypeSegment>& segments,
+                  int64_t num_bytes, int num_stripes) const;
+
+  // Returns the algorithms reducing the fused response in place if it
+  // recurs, or nullptr.
+  GlooPersistentAlgorithms*
+  GetPersistentAlgorithms(const std::vector<TensorTableEntry>& entries,
+                          const std::vector<DataTypeSegment>& segments,
+                          ReduceOp reduce_op, AllreduceAlgorithm algorithm,
+                          int num_stripes, void* buffer_data);
+
   GlooContext* gloo_context_;
+
+  AllreduceAlgorithmTable algorithm_table_;
+};
+
+// Reduces within every node to its local rank 0, allreduces across nodes
+// among those ranks and broadcasts the result within every node, so only one
+// rank per node sends data across nodes.
+class GlooHierarchicalAllreduce : public GlooAllreduce {
+public:
+  GlooHierarchicalAllreduce(GlooContext* gloo_context,
+                            HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries,
+                 const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
 };
 
 class GlooAllgather : public AllgatherOp {
@@ -83,9 +181,33 @@ public:
                const Response& response) const override;
 
 protected:
+  // Returns the allgather of the fused response in place in the fusion
+  // buffer if it recurs, or nullptr.
+  GlooPersistentAlgorithms*
+  GetPersistentAlgorithms(const std::vector<TensorTableEntry>& entries,
+                          IGlooAlgorithms* gloo_algos, void* buffer_data,
+                          int64_t* recvcounts, int64_t* displcmnts);
+
   GlooContext* gloo_context_;
 };
 
+// Gathers the data of every node on its local rank 0, allgathers the data of
+// the nodes among those ranks and broadcasts the result within every node.
+// Like the MPI hierarchical allgather, this expects the ranks of a node to be
+// consecutive, as they are assigned by horovodrun.
+class GlooHierarchicalAllgather : public GlooAllgather {
+public:
+  GlooHierarchicalAllgather(GlooContext* gloo_context,
+                            HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries,
+                 const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+};
+
 class GlooBroadcast : public BroadcastOp {
 public:
   GlooBroadcast(GlooContext* gloo_context, HorovodGlobalState* global_state);
@@ -97,6 +219,104 @@ public:
                const std::vector<TensorTableEntry>& entries,
                const Response& response) const override;
 
+protected:
+  // Returns the broadcast of the fused response in the fusion buffer if it
+  // recurs, or nullptr.
+  GlooPersistentAlgorithms*
+  GetPersistentAlgorithms(const std::vector<TensorTableEntry>& entries,
+                          IGlooAlgorithms* gloo_algos, void* buffer_data,
+                          int64_t num_bytes, int root_rank);
+
+  GlooContext* gloo_context_;
+};
+
+class GlooReducescatter : public ReducescatterOp {
+public:
+  GlooReducescatter(GlooContext* gloo_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries,
+                 const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  GlooContext* gloo_context_;
+};
+
+class GlooAlltoall : public AlltoallOp {
+public:
+  GlooAlltoall(GlooContext* gloo_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries,
+                 const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  GlooContext* gloo_context_;
+};
+
+class GlooSparseAllreduce : public SparseAllreduceOp {
+public:
+  GlooSparseAllreduce(GlooContext* gloo_context,
+                      HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries,
+                 const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  GlooContext* gloo_context_;
+};
+
+class GlooReduce : public ReduceToRootOp {
+public:
+  GlooReduce(GlooContext* gloo_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries,
+                 const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  GlooContext* gloo_context_;
+};
+
+class GlooGather : public GatherOp {
+public:
+  GlooGather(GlooContext* gloo_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries,
+                 const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  GlooContext* gloo_context_;
+};
+
+class GlooScatter : public ScatterOp {
+public:
+  GlooScatter(GlooContext* gloo_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries,
+                 const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
 protected:
   GlooContext* gloo_context_;
 };
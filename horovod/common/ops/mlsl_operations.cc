@@ -109,20 +109,46 @@ Status MLSLAllreduce::Execute(std::vector<TensorTableEntry>& entries, const Resp
   } else {
     buffer_data = (void*) first_entry.output->data();
     buffer_len = (size_t) first_entry.output->size();
+    if (first_entry.prescale_factor != 1.0) {
+      PrescaleEntry(first_entry);
+    }
   }
 
   // Do allreduce.
   timeline.ActivityStartAll(entries, MLSL_ALLREDUCE);
-  const void* sendbuf = entries.size() > 1 || first_entry.tensor->data() == first_entry.output->data()
-                        ? buffer_data : first_entry.tensor->data();
-  auto mlsl_req = mlsl_context_->dist->AllReduce((void*)sendbuf, buffer_data, num_elements,
-                                                 GetMLSLDataType(first_entry.tensor),
-                                                 MLSL::RT_SUM, MLSL::GT_DATA);
+  auto segments = GetDataTypeSegments(entries);
+  if (segments.size() > 1) {
+    // Response was fused across data types. Start a reduction for every
+    // segment of the fusion buffer before waiting on any of them.
+    std::vector<MLSL::CommReq*> mlsl_reqs;
+    for (auto& segment : segments) {
+      void* segment_data = (uint8_t*)buffer_data + segment.offset;
+      mlsl_reqs.push_back(mlsl_context_->dist->AllReduce(
+          segment_data, segment_data, segment.num_elements,
+          GetMLSLDataType(entries[segment.begin].tensor),
+          MLSL::RT_SUM, MLSL::GT_DATA));
+    }
 
-  try {
-      MLSL::Environment::GetEnv().Wait(mlsl_req);
-  } catch (...) {
+    try {
+      for (auto mlsl_req : mlsl_reqs) {
+        MLSL::Environment::GetEnv().Wait(mlsl_req);
+      }
+    } catch (...) {
       throw std::logic_error("MLSL_Allreduce failed.");
+    }
+  } else {
+    const void* sendbuf = entries.size() > 1 || first_entry.tensor->data() == first_entry.output->data() ||
+                          first_entry.prescale_factor != 1.0
+                          ? buffer_data : first_entry.tensor->data();
+    auto mlsl_req = mlsl_context_->dist->AllReduce((void*)sendbuf, buffer_data, num_elements,
+                                                   GetMLSLDataType(first_entry.tensor),
+                                                   MLSL::RT_SUM, MLSL::GT_DATA);
+
+    try {
+        MLSL::Environment::GetEnv().Wait(mlsl_req);
+    } catch (...) {
+        throw std::logic_error("MLSL_Allreduce failed.");
+    }
   }
   timeline.ActivityEndAll(entries);
 
@@ -131,6 +157,8 @@ Status MLSLAllreduce::Execute(std::vector<TensorTableEntry>& entries, const Resp
     timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
     MemcpyOutFusionBuffer(buffer_data, entries);
     timeline.ActivityEndAll(entries);
+  } else if (first_entry.postscale_factor != 1.0) {
+    PostscaleEntry(first_entry);
   }
 
   return Status::OK();
@@ -139,19 +167,18 @@ Status MLSLAllreduce::Execute(std::vector<TensorTableEntry>& entries, const Resp
 bool MLSLAllreduce::Enabled(const ParameterManager& param_manager,
                            const std::vector<TensorTableEntry>& entries,
                            const Response& response) const {
-  return true;
+  // Other reductions fall back to MPI.
+  return response.reduce_op() == ReduceOp::SUM;
 }
 
 void MLSLAllreduce::MemcpyEntryInFusionBuffer(const std::vector<TensorTableEntry>& entries,
                                              const TensorTableEntry& e, void* buffer_data_at_offset) {
-  std::memcpy(buffer_data_at_offset, e.tensor->data(),
-              (size_t) e.tensor->size());
+  AllreduceOp::MemcpyEntryInFusionBuffer(entries, e, buffer_data_at_offset);
 }
 
 void MLSLAllreduce::MemcpyEntryOutFusionBuffer(const std::vector<TensorTableEntry>& entries,
                                               const void* buffer_data_at_offset, TensorTableEntry& e) {
-  std::memcpy((void*) e.output->data(), buffer_data_at_offset,
-              (size_t) e.tensor->size());
+  AllreduceOp::MemcpyEntryOutFusionBuffer(entries, buffer_data_at_offset, e);
 }
 
 MLSLAllgather::MLSLAllgather(MLSLContext* mlsl_context, HorovodGlobalState* global_state)
@@ -173,9 +200,9 @@ Status MLSLAllgather::Execute(std::vector<TensorTableEntry>& entries, const Resp
   // allgatherv
   auto** entry_component_offsets = new int64_t* [entries.size()];
 
-  int global_size = global_state_->controller->GetSize();
-  auto* recvcounts = new int[global_size]();
-  auto* displcmnts = new int[global_size]();
+  int global_size = controller_->GetSize();
+  auto* recvcounts = new int64_t[global_size]();
+  auto* displcmnts = new int64_t[global_size]();
 
   for (size_t ec = 0; ec < entries.size(); ++ec) {
     entry_component_sizes[ec] = new int64_t[global_size]();
@@ -194,7 +221,7 @@ Status MLSLAllgather::Execute(std::vector<TensorTableEntry>& entries, const Resp
   SetDisplacements(recvcounts, displcmnts);
   SetEntryComponentOffsets(entries, entry_component_sizes, recvcounts, entry_component_offsets);
 
-  int element_size = global_state_->controller->GetTypeSize(first_entry.tensor->dtype());
+  int element_size = controller_->GetTypeSize(first_entry.tensor->dtype());
 
   const void* sendbuf = nullptr;
   void* buffer_data;
@@ -251,29 +278,45 @@ MLSLBroadcast::MLSLBroadcast(MLSLContext* mlsl_context, HorovodGlobalState* glob
     : BroadcastOp(global_state), mlsl_context_(mlsl_context) {}
 
 Status MLSLBroadcast::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
-  assert(entries.size() == 1);
-  auto e = entries[0];
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+  bool is_root_rank = controller_->GetRank() == first_entry.root_rank;
 
   // On root rank, MLSL_Bcast sends data, on other ranks it receives data.
   void* data_ptr;
   size_t size;
-  if (global_state_->controller->GetRank() == e.root_rank) {
-    data_ptr = (void*) e.tensor->data();
-    size = e.tensor->size();
+  if (entries.size() > 1) {
+    if (is_root_rank) {
+      timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+      MemcpyInFusionBuffer(entries, data_ptr);
+      timeline.ActivityEndAll(entries);
+    } else {
+      data_ptr = GetFusionBuffer(entries);
+    }
+    size = (size_t) FusedByteSize(entries);
+  } else if (is_root_rank) {
+    data_ptr = (void*) first_entry.tensor->data();
+    size = first_entry.tensor->size();
   } else {
-    data_ptr = (void*) e.output->data();
-    size = e.output->size();
+    data_ptr = (void*) first_entry.output->data();
+    size = first_entry.output->size();
   }
 
-  global_state_->timeline.ActivityStartAll(entries, MLSL_BCAST);
+  timeline.ActivityStartAll(entries, MLSL_BCAST);
   auto mlsl_req = mlsl_context_->dist->Bcast(data_ptr, size, MLSL::DT_BYTE,
-                                             e.root_rank, MLSL::GT_DATA);
+                                             first_entry.root_rank, MLSL::GT_DATA);
   try {
       MLSL::Environment::GetEnv().Wait(mlsl_req);
   } catch (...) {
       throw std::logic_error("MLSL_Bcast failed.");
   }
-  global_state_->timeline.ActivityEndAll(entries);
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1 && !is_root_rank) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(data_ptr, entries);
+    timeline.ActivityEndAll(entries);
+  }
 
   return Status::OK();
 }
@@ -0,0 +1,449 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#include "mpi_allreduce_algorithms.h"
+
+#include <limits>
+#include <stdexcept>
+
+#include "../half.h"
+
+namespace horovod {
+namespace common {
+
+namespace {
+
+template <typename T, class Op>
+void ReduceElements(void* inout, const void* in, int64_t num_elements, Op op) {
+  auto* a = static_cast<T*>(inout);
+  auto* b = static_cast<const T*>(in);
+  for (int64_t i = 0; i < num_elements; ++i) {
+    a[i] = op(a[i], b[i]);
+  }
+}
+
+template <typename T>
+void Reduce(void* inout, const void* in, int64_t num_elements,
+            ReduceOp reduce_op) {
+  switch (reduce_op) {
+  case ReduceOp::SUM:
+    ReduceElements<T>(inout, in, num_elements,
+                      [](T a, T b) { return (T) (a + b); });
+    break;
+  case ReduceOp::MIN:
+    ReduceElements<T>(inout, in, num_elements,
+                      [](T a, T b) { return b < a ? b : a; });
+    break;
+  case ReduceOp::MAX:
+    ReduceElements<T>(inout, in, num_elements,
+                      [](T a, T b) { return b > a ? b : a; });
+    break;
+  case ReduceOp::PRODUCT:
+    ReduceElements<T>(inout, in, num_elements,
+                      [](T a, T b) { return (T) (a * b); });
+    break;
+  default:
+    throw std::logic_error("Reduce op " + ReduceOp_Name(reduce_op) +
+                           " is not supported in MPI mode.");
+  }
+}
+
+// Largest power of two not greater than n.
+int PowerOfTwoFloor(int n) {
+  int pof2 = 1;
+  while (pof2 * 2 <= n) {
+    pof2 *= 2;
+  }
+  return pof2;
+}
+
+// Rank of the given participant of the power of two algorithms. Of the first
+// 2 * rem ranks, only the odd ones take part.
+int RealRank(int new_rank, int rem) {
+  return new_rank < rem ? new_rank * 2 + 1 : new_rank + rem;
+}
+
+const int ALGORITHM_TAG = 0;
+
+} // namespace
+
+void Reduce(void* inout, const void* in, int64_t num_elements, DataType dtype,
+            ReduceOp reduce_op) {
+  switch (dtype) {
+  case HOROVOD_UINT8:
+    Reduce<uint8_t>(inout, in, num_elements, reduce_op);
+    break;
+  case HOROVOD_INT8:
+    Reduce<int8_t>(inout, in, num_elements, reduce_op);
+    break;
+  case HOROVOD_UINT16:
+    Reduce<uint16_t>(inout, in, num_elements, reduce_op);
+    break;
+  case HOROVOD_INT16:
+    Reduce<int16_t>(inout, in, num_elements, reduce_op);
+    break;
+  case HOROVOD_INT32:
+    Reduce<int32_t>(inout, in, num_elements, reduce_op);
+    break;
+  case HOROVOD_INT64:
+    Reduce<int64_t>(inout, in, num_elements, reduce_op);
+    break;
+  case HOROVOD_FLOAT16: {
+    // Callers never reduce more than INT_MAX elements at once.
+    int len = (int) num_elements;
+    auto* invec = const_cast<void*>(in);
+    switch (reduce_op) {
+    case ReduceOp::SUM:
+      float16_sum(invec, inout, &len, nullptr);
+      break;
+    case ReduceOp::MIN:
+      float16_min(invec, inout, &len, nullptr);
+      break;
+    case ReduceOp::MAX:
+      float16_max(invec, inout, &len, nullptr);
+      break;
+    case ReduceOp::PRODUCT:
+      float16_prod(invec, inout, &len, nullptr);
+      break;
+    default:
+      throw std::logic_error("Reduce op " + ReduceOp_Name(reduce_op) +
+                             " is not supported in MPI mode.");
+    }
+    break;
+  }
+  case HOROVOD_FLOAT32:
+    Reduce<float>(inout, in, num_elements, reduce_op);
+    break;
+  case HOROVOD_FLOAT64:
+    Reduce<double>(inout, in, num_elements, reduce_op);
+    break;
+  case HOROVOD_BOOL: {
+    // Booleans are or-ed by SUM and MAX, and and-ed by MIN and PRODUCT.
+    bool any = reduce_op == ReduceOp::SUM || reduce_op == ReduceOp::MAX;
+    auto* a = static_cast<bool*>(inout);
+    auto* b = static_cast<const bool*>(in);
+    for (int64_t i = 0; i < num_elements; ++i) {
+      a[i] = any ? a[i] || b[i] : a[i] && b[i];
+    }
+    break;
+  }
+  default:
+    throw std::logic_error("Type " + DataType_Name(dtype) +
+                           " is not supported in MPI mode.");
+  }
+}
+
+AllreduceAlgorithmTable MPIAllreduceAlgorithms::DefaultTable() {
+  return AllreduceAlgorithmTable(
+      {{std::numeric_limits<int64_t>::max(), std::numeric_limits<int>::max(),
+        AllreduceAlgorithm::LIBRARY}},
+      {AllreduceAlgorithm::RING, AllreduceAlgorithm::RECURSIVE_DOUBLING,
+       AllreduceAlgorithm::RABENSEIFNER, AllreduceAlgorithm::TWO_LEVEL_TREE});
+}
+
+MPIAllreduceAlgorithms::MPIAllreduceAlgorithms(MPIContext* mpi_context)
+    : mpi_context_(mpi_context) {}
+
+void MPIAllreduceAlgorithms::Allreduce(AllreduceAlgorithm algorithm,
+                                       void* buffer, int64_t num_elements,
+                                       DataType dtype, ReduceOp reduce_op) {
+  MPI_Comm comm = mpi_context_->GetMPICommunicator(Communicator::GLOBAL);
+  switch (algorithm) {
+  case AllreduceAlgorithm::RING:
+    Ring(buffer, num_elements, dtype, reduce_op, comm);
+    break;
+  case AllreduceAlgorithm::RECURSIVE_DOUBLING:
+    RecursiveDoubling(buffer, num_elements, dtype, reduce_op, comm);
+    break;
+  case AllreduceAlgorithm::RABENSEIFNER:
+    Rabenseifner(buffer, num_elements, dtype, reduce_op, comm);
+    break;
+  case AllreduceAlgorithm::TWO_LEVEL_TREE:
+    TwoLevelTree(buffer, num_elements, dtype, reduce_op);
+    break;
+  default:
+    throw std::logic_error("Allreduce algorithm " +
+                           AllreduceAlgorithmName(algorithm) +
+                           " is not implemented on top of MPI.");
+  }
+}
+
+void MPIAllreduceAlgorithms::Ring(void* buffer, int64_t num_elements,
+                                  DataType dtype, ReduceOp reduce_op,
+                                  MPI_Comm comm) {
+  int rank, size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+  if (size == 1) {
+    return;
+  }
+
+  auto* data = static_cast<uint8_t*>(buffer);
+  int element_size = mpi_context_->GetMPITypeSize(dtype);
+  MPI_Datatype datatype = mpi_context_->GetMPIDataType(dtype);
+  int right = (rank + 1) % size;
+  int left = (rank - 1 + size) % size;
+
+  // Segment i spans elements [num_elements * i / size,
+  // num_elements * (i + 1) / size).
+  auto segment_begin = [num_elements, size](int segment) {
+    return num_elements * segment / size;
+  };
+  auto segment_count = [&](int segment) {
+    return segment_begin(segment + 1) - segment_begin(segment);
+  };
+  auto* tmp = Scratch(segment_count(size - 1) * element_size);
+
+  // Reduce-scatter. After step s, the segment received from the left holds
+  // contributions of s + 2 ranks, and in the end every rank owns the fully
+  // reduced segment rank + 1.
+  for (int step = 0; step < size - 1; ++step) {
+    int send_segment = (rank - step + size) % size;
+    int recv_segment = (rank - step - 1 + size) % size;
+    SendRecv(data + segment_begin(send_segment) * element_size,
+             segment_count(send_segment), right,
+             tmp, segment_count(recv_segment), left, datatype, comm);
+    Reduce(data + segment_begin(recv_segment) * element_size, tmp,
+           segment_count(recv_segment), dtype, reduce_op);
+  }
+
+  // Allgather the reduced segments around the ring.
+  for (int step = 0; step < size - 1; ++step) {
+    int send_segment = (rank + 1 - step + size) % size;
+    int recv_segment = (rank - step + size) % size;
+    SendRecv(data + segment_begin(send_segment) * element_size,
+             segment_count(send_segment), right,
+             data + segment_begin(recv_segment) * element_size,
+             segment_count(recv_segment), left, datatype, comm);
+  }
+}
+
+void MPIAllreduceAlgorithms::RecursiveDoubling(void* buffer,
+                                               int64_t num_elements,
+                                               DataType dtype,
+                                               ReduceOp reduce_op,
+                                               MPI_Comm comm) {
+  int rank, size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+  if (size == 1) {
+    return;
+  }
+
+  int element_size = mpi_context_->GetMPITypeSize(dtype);
+  MPI_Datatype datatype = mpi_context_->GetMPIDataType(dtype);
+  auto* tmp = Scratch(num_elements * element_size);
+
+  // Ranks beyond the largest power of two hand their data to a neighbour
+  // first, and receive the result from it in the end.
+  int pof2 = PowerOfTwoFloor(size);
+  int rem = size - pof2;
+  int new_rank = -1;
+  if (rank < 2 * rem) {
+    if (rank % 2 == 0) {
+      SendRecv(buffer, num_elements, rank + 1, nullptr, 0, MPI_PROC_NULL,
+               datatype, comm);
+    } else {
+      SendRecv(nullptr, 0, MPI_PROC_NULL, tmp, num_elements, rank - 1,
+               datatype, comm);
+      Reduce(buffer, tmp, num_elements, dtype, reduce_op);
+      new_rank = rank / 2;
+    }
+  } else {
+    new_rank = rank - rem;
+  }
+
+  if (new_rank != -1) {
+    for (int mask = 1; mask < pof2; mask <<= 1) {
+      int partner = RealRank(new_rank ^ mask, rem);
+      SendRecv(buffer, num_elements, partner, tmp, num_elements, partner,
+               datatype, comm);
+      Reduce(buffer, tmp, num_elements, dtype, reduce_op);
+    }
+  }
+
+  if (rank < 2 * rem) {
+    if (rank % 2 == 0) {
+      SendRecv(nullptr, 0, MPI_PROC_NULL, buffer, num_elements, rank + 1,
+               datatype, comm);
+    } else {
+      SendRecv(buffer, num_elements, rank - 1, nullptr, 0, MPI_PROC_NULL,
+               datatype, comm);
+    }
+  }
+}
+
+void MPIAllreduceAlgorithms::Rabenseifner(void* buffer, int64_t num_elements,
+                                          DataType dtype, ReduceOp reduce_op,
+                                          MPI_Comm comm) {
+  int rank, size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+  if (size == 1) {
+    return;
+  }
+
+  int pof2 = PowerOfTwoFloor(size);
+  if (num_elements < pof2) {
+    // Not every block would hold data.
+    RecursiveDoubling(buffer, num_elements, dtype, reduce_op, comm);
+    return;
+  }
+
+  auto* data = static_cast<uint8_t*>(buffer);
+  int element_size = mpi_context_->GetMPITypeSize(dtype);
+  MPI_Datatype datatype = mpi_context_->GetMPIDataType(dtype);
+  auto* tmp = Scratch(num_elements * element_size);
+
+  int rem = size - pof2;
+  int new_rank = -1;
+  if (rank < 2 * rem) {
+    if (rank % 2 == 0) {
+      SendRecv(buffer, num_elements, rank + 1, nullptr, 0, MPI_PROC_NULL,
+               datatype, comm);
+    } else {
+      SendRecv(nullptr, 0, MPI_PROC_NULL, tmp, num_elements, rank - 1,
+               datatype, comm);
+      Reduce(buffer, tmp, num_elements, dtype, reduce_op);
+      new_rank = rank / 2;
+    }
+  } else {
+    new_rank = rank - rem;
+  }
+
+  if (new_rank != -1) {
+    // Block i spans elements [num_elements * i / pof2,
+    // num_elements * (i + 1) / pof2).
+    auto block_begin = [num_elements, pof2](int block) {
+      return num_elements * block / pof2;
+    };
+
+    // Reduce-scatter by recursive halving. The range of blocks this rank is
+    // responsible for halves in every step, ending with block new_rank.
+    int lo = 0;
+    int hi = pof2;
+    for (int mask = pof2 / 2; mask > 0; mask >>= 1) {
+      int partner = RealRank(new_rank ^ mask, rem);
+      int mid = (lo + hi) / 2;
+      int keep_lo = (new_rank & mask) ? mid : lo;
+      int keep_hi = (new_rank & mask) ? hi : mid;
+      int send_lo = (new_rank & mask) ? lo : mid;
+      int send_hi = (new_rank & mask) ? mid : hi;
+      int64_t keep_count = block_begin(keep_hi) - block_begin(keep_lo);
+      SendRecv(data + block_begin(send_lo) * element_size,
+               block_begin(send_hi) - block_begin(send_lo), partner,
+               tmp, keep_count, partner, datatype, comm);
+      Reduce(data + block_begin(keep_lo) * element_size, tmp, keep_count,
+             dtype, reduce_op);
+      lo = keep_lo;
+      hi = keep_hi;
+    }
+
+    // Allgather by recursive doubling, growing the range back to all blocks.
+    for (int mask = 1; mask < pof2; mask <<= 1) {
+      int partner = RealRank(new_rank ^ mask, rem);
+      int recv_lo = (new_rank & mask) ? lo - mask : hi;
+      int recv_hi = recv_lo + mask;
+      SendRecv(data + block_begin(lo) * element_size,
+               block_begin(hi) - block_begin(lo), partner,
+               data + block_begin(recv_lo) * element_size,
+               block_begin(recv_hi) - block_begin(recv_lo), partner,
+               datatype, comm);
+      lo = std::min(lo, recv_lo);
+      hi = std::max(hi, recv_hi);
+    }
+  }
+
+  if (rank < 2 * rem) {
+    if (rank % 2 == 0) {
+      SendRecv(nullptr, 0, MPI_PROC_NULL, buffer, num_elements, rank + 1,
+               datatype, comm);
+    } else {
+      SendRecv(buffer, num_elements, rank - 1, nullptr, 0, MPI_PROC_NULL,
+               datatype, comm);
+    }
+  }
+}
+
+void MPIAllreduceAlgorithms::TwoLevelTree(void* buffer, int64_t num_elements,
+                                          DataType dtype, ReduceOp reduce_op) {
+  MPI_Comm local_comm = mpi_context_->GetMPICommunicator(Communicator::LOCAL);
+  MPI_Comm cross_comm = mpi_context_->GetMPICommunicator(Communicator::CROSS);
+  int local_rank, local_size;
+  MPI_Comm_rank(local_comm, &local_rank);
+  MPI_Comm_size(local_comm, &local_size);
+
+  int element_size = mpi_context_->GetMPITypeSize(dtype);
+  MPI_Datatype datatype = mpi_context_->GetMPIDataType(dtype);
+  auto* tmp = Scratch(num_elements * element_size);
+
+  // Binomial tree reduce to local rank 0.
+  int mask = 1;
+  for (; mask < local_size; mask <<= 1) {
+    if (local_rank & mask) {
+      SendRecv(buffer, num_elements, local_rank - mask, nullptr, 0,
+               MPI_PROC_NULL, datatype, local_comm);
+      break;
+    }
+    if (local_rank + mask < local_size) {
+      SendRecv(nullptr, 0, MPI_PROC_NULL, tmp, num_elements,
+               local_rank + mask, datatype, local_comm);
+      Reduce(buffer, tmp, num_elements, dtype, reduce_op);
+    }
+  }
+
+  // Local rank 0 of every node, including nodes with fewer ranks, shares the
+  // cross communicator.
+  if (local_rank == 0) {
+    RecursiveDoubling(buffer, num_elements, dtype, reduce_op, cross_comm);
+  }
+
+  // Binomial tree broadcast from local rank 0, retracing the reduction.
+  for (mask = 1; mask < local_size; mask <<= 1) {
+    if (local_rank & mask) {
+      SendRecv(nullptr, 0, MPI_PROC_NULL, buffer, num_elements,
+               local_rank - mask, datatype, local_comm);
+      break;
+    }
+  }
+  for (mask >>= 1; mask > 0; mask >>= 1) {
+    if (local_rank + mask < local_size) {
+      SendRecv(buffer, num_elements, local_rank + mask, nullptr, 0,
+               MPI_PROC_NULL, datatype, local_comm);
+    }
+  }
+}
+
+void* MPIAllreduceAlgorithms::Scratch(int64_t bytes) {
+  if ((int64_t) scratch_.size() < bytes) {
+    scratch_.resize(bytes);
+  }
+  return scratch_.data();
+}
+
+void MPIAllreduceAlgorithms::SendRecv(const void* sendbuf, int64_t send_count,
+                                      int dest, void* recvbuf,
+                                      int64_t recv_count, int source,
+                                      MPI_Datatype datatype, MPI_Comm comm) {
+  int op = MPI_Sendrecv(sendbuf, (int) send_count, datatype, dest,
+                        ALGORITHM_TAG, recvbuf, (int) recv_count, datatype,
+                        source, ALGORITHM_TAG, comm, MPI_STATUS_IGNORE);
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Sendrecv failed, see MPI output for details.");
+  }
+}
+
+} // namespace common
+} // namespace horovod
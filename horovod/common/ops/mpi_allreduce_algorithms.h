@@ -0,0 +1,87 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#ifndef HOROVOD_MPI_ALLREDUCE_ALGORITHMS_H
+#define HOROVOD_MPI_ALLREDUCE_ALGORITHMS_H
+
+#include <string>
+#include <vector>
+
+#include "mpi.h"
+
+#include "../common.h"
+#include "../mpi/mpi_context.h"
+#include "allreduce_algorithm_table.h"
+
+namespace horovod {
+namespace common {
+
+// Combines num_elements elements of in into inout with the reduce op, which
+// must be SUM, MIN, MAX or PRODUCT.
+void Reduce(void* inout, const void* in, int64_t num_elements, DataType dtype,
+            ReduceOp reduce_op);
+
+// Allreduce algorithms for CPU tensors implemented on top of MPI
+// point-to-point messages. Buffers are reduced in place and hold at most
+// INT_MAX elements.
+class MPIAllreduceAlgorithms {
+public:
+  MPIAllreduceAlgorithms(MPIContext* mpi_context);
+
+  // Table used by default, which leaves every allreduce to MPI_Allreduce. The
+  // algorithms below are opt-in through HOROVOD_CPU_ALLREDUCE_TABLE,
+  // HOROVOD_CPU_ALLREDUCE_ALGORITHM or the autotuner.
+  static AllreduceAlgorithmTable DefaultTable();
+
+  // Runs the given algorithm, which must not be AUTO or LIBRARY.
+  void Allreduce(AllreduceAlgorithm algorithm, void* buffer,
+                 int64_t num_elements, DataType dtype, ReduceOp reduce_op);
+
+  // Reduce-scatter followed by allgather around a ring. Bandwidth optimal,
+  // but takes 2 * (size - 1) steps.
+  void Ring(void* buffer, int64_t num_elements, DataType dtype,
+            ReduceOp reduce_op, MPI_Comm comm);
+
+  // Exchanges the whole buffer with a partner in log(size) steps. Latency
+  // optimal for small buffers.
+  void RecursiveDoubling(void* buffer, int64_t num_elements, DataType dtype,
+                         ReduceOp reduce_op, MPI_Comm comm);
+
+  // Reduce-scatter by recursive halving followed by allgather by recursive
+  // doubling, in 2 * log(size) steps.
+  void Rabenseifner(void* buffer, int64_t num_elements, DataType dtype,
+                    ReduceOp reduce_op, MPI_Comm comm);
+
+  // Binomial tree reduce within every node, recursive doubling allreduce
+  // between the nodes and binomial tree broadcast within every node.
+  void TwoLevelTree(void* buffer, int64_t num_elements, DataType dtype,
+                    ReduceOp reduce_op);
+
+private:
+  // Returns a scratch buffer of at least the given number of bytes.
+  void* Scratch(int64_t bytes);
+
+  void SendRecv(const void* sendbuf, int64_t send_count, int dest,
+                void* recvbuf, int64_t recv_count, int source,
+                MPI_Datatype datatype, MPI_Comm comm);
+
+  MPIContext* mpi_context_;
+  std::vector<uint8_t> scratch_;
+};
+
+} // namespace common
+} // namespace horovod
+
+#endif // HOROVOD_MPI_ALLREDUCE_ALGORITHMS_H
@@ -54,11 +54,12 @@ Status MPI_CUDAAllreduce::Execute(std::vector<TensorTableEntry>& entries, const
   timeline.ActivityStartAll(entries, MPI_ALLREDUCE);
   const void* sendbuf = entries.size() > 1 || first_entry.tensor->data() == first_entry.output->data()
                         ? MPI_IN_PLACE : first_entry.tensor->data();
-  int op = MPI_Allreduce(sendbuf, buffer_data,
-                         (int) num_elements,
-                         mpi_context_->GetMPIDataType(first_entry.tensor),
-                         mpi_context_->GetMPISumOp(first_entry.tensor->dtype()),
-                         mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+  int op = LargeCountAllreduce(sendbuf, buffer_data,
+                               num_elements,
+                               mpi_context_->GetMPIDataType(first_entry.tensor),
+                               mpi_context_->GetMPIOp(first_entry.tensor->dtype(),
+                                                      response.reduce_op()),
+                               mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
   if (op != MPI_SUCCESS) {
     throw std::runtime_error("MPI_Allreduce failed, see MPI output for details.");
   }
@@ -96,9 +97,9 @@ Status MPI_CUDAAllgather::Execute(std::vector<TensorTableEntry>& entries, const
   // allgatherv
   auto** entry_component_offsets = new int64_t* [entries.size()];
 
-  int global_size = global_state_->controller->GetSize();
-  auto* recvcounts = new int[global_size]();
-  auto* displcmnts = new int[global_size]();
+  int global_size = controller_->GetSize();
+  auto* recvcounts = new int64_t[global_size]();
+  auto* displcmnts = new int64_t[global_size]();
 
   for (size_t ec = 0; ec < entries.size(); ++ec) {
     entry_component_sizes[ec] = new int64_t[global_size]();
@@ -138,14 +139,13 @@ Status MPI_CUDAAllgather::Execute(std::vector<TensorTableEntry>& entries, const
 
   global_state_->timeline.ActivityStartAll(entries, MPI_ALLGATHER);
   auto dtype = mpi_context_->GetMPIDataType(first_entry.tensor->dtype());
-  int op = MPI_Allgatherv(sendbuf != nullptr ? sendbuf : MPI_IN_PLACE,
-                          (int) total_num_elements,
-                          dtype,
-                          buffer_data,
-                          recvcounts,
-                          displcmnts,
-                          dtype,
-                          mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+  int op = LargeCountAllgatherv(sendbuf != nullptr ? sendbuf : MPI_IN_PLACE,
+                                total_num_elements,
+                                buffer_data,
+                                recvcounts,
+                                displcmnts,
+                                dtype,
+                                mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
   if (op != MPI_SUCCESS) {
     throw std::runtime_error("MPI_Allgatherv failed, see MPI output for details.");
   }
@@ -16,11 +16,85 @@
 
 #include "mpi_operations.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <limits>
+
 namespace horovod {
 namespace common {
 
+namespace {
+
+// Bytes of the node-local shared window owned by every local rank in
+// hierarchical allreduce. Larger buffers are reduced in chunks of this size.
+constexpr int64_t SHARED_SLOT_SIZE = 16 * 1024 * 1024;
+
+// Synchronizes the ranks of a node around accesses to shared memory windows.
+void LocalBarrier(MPIContext* mpi_context) {
+  int op = MPI_Barrier(mpi_context->GetMPICommunicator(Communicator::LOCAL));
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Barrier failed, see MPI output for details.");
+  }
+}
+
+// Whether CPU operations issue non-blocking collectives completed by the
+// progress engine.
+bool ExecuteAsync(MPIContext* mpi_context,
+                  const std::vector<TensorTableEntry>& entries) {
+  return mpi_context->progress_engine.IsRunning() &&
+         entries[0].device == CPU_DEVICE_ID;
+}
+
+// Hands the requests of an asynchronous operation over to the progress
+// engine and moves on to the next CPU fusion buffer. Once the requests
+// complete, on_done runs on the progress thread (e.g. to copy data out of the
+// fusion buffer) and the entries are completed.
+Status EnqueueAsync(MPIContext* mpi_context, HorovodGlobalState* global_state,
+                    const std::vector<TensorTableEntry>& entries,
+                    std::vector<MPI_Request> requests,
+                    std::function<void(const Status&)> on_done) {
+  auto& first_entry = entries[0];
+  auto& timeline = global_state->timeline;
+  int slot = global_state->current_cpu_fusion_buffer;
+
+  // Claim a std::shared_ptr to the fusion buffer to prevent its memory from
+  // being reclaimed while the operation is in flight.
+  std::shared_ptr<PersistentBuffer> fusion_buffer;
+  if (entries.size() > 1) {
+    fusion_buffer = global_state->fusion_buffer.GetBuffer(
+        first_entry.device, first_entry.context->framework(), slot);
+  }
+
+  mpi_context->progress_engine.Enqueue(
+      slot, std::move(requests),
+      [entries, fusion_buffer, on_done, &timeline](const Status& status) {
+        timeline.ActivityEndAll(entries);
+        if (on_done != nullptr) {
+          on_done(status);
+        }
+        for (auto& e : entries) {
+          timeline.End(e.tensor_name, status.ok() ? e.output : nullptr);
+          // Callback can be null if the rank sent Join request.
+          if (e.callback != nullptr) {
+            e.callback(status);
+          }
+        }
+      });
+
+  global_state->current_cpu_fusion_buffer =
+      (slot + 1) % mpi_context->progress_engine.NumSlots();
+  return Status::InProgress();
+}
+
+} // namespace
+
 MPIAllreduce::MPIAllreduce(MPIContext* mpi_context, HorovodGlobalState* global_state)
-    : AllreduceOp(global_state), mpi_context_(mpi_context) {}
+    : AllreduceOp(global_state), mpi_context_(mpi_context),
+      algorithm_table_(MPIAllreduceAlgorithms::DefaultTable()),
+      algorithms_(mpi_context) {
+  algorithm_table_.ParseFromEnv();
+}
 
 Status MPIAllreduce::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
   auto& first_entry = entries[0];
@@ -39,19 +113,122 @@ Status MPIAllreduce::Execute(std::vector<TensorTableEntry>& entries, const Respo
   } else {
     buffer_data = (void*) first_entry.output->data();
     buffer_len = (size_t) first_entry.output->size();
+    if (first_entry.prescale_factor != 1.0) {
+      PrescaleEntry(first_entry);
+    }
   }
 
-  // Do allreduce.
-  timeline.ActivityStartAll(entries, MPI_ALLREDUCE);
-  const void* sendbuf = entries.size() > 1 || first_entry.tensor->data() == first_entry.output->data()
+  // Do allreduce. Built-in algorithms show up in the timeline by name, e.g.
+  // MPI_ALLREDUCE_RING.
+  auto segments = GetDataTypeSegments(entries);
+  bool async = ExecuteAsync(mpi_context_, entries);
+  const void* sendbuf = entries.size() > 1 || first_entry.tensor->data() == first_entry.output->data() ||
+                        first_entry.prescale_factor != 1.0
                         ? MPI_IN_PLACE : first_entry.tensor->data();
-  int op = MPI_Allreduce(sendbuf, buffer_data,
-                         (int) num_elements,
-                         mpi_context_->GetMPIDataType(first_entry.tensor),
-                         mpi_context_->GetMPISumOp(first_entry.tensor->dtype()),
-                         mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
-  if (op != MPI_SUCCESS) {
-    throw std::runtime_error("MPI_Allreduce failed, see MPI output for details.");
+  auto algorithm = async ? AllreduceAlgorithm::LIBRARY
+                         : SelectAlgorithm(entries, segments, (int64_t) buffer_len);
+  std::string activity = MPI_ALLREDUCE;
+  if (algorithm != AllreduceAlgorithm::LIBRARY) {
+    auto name = AllreduceAlgorithmName(algorithm);
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+    activity += "_" + name;
+  }
+  timeline.ActivityStartAll(entries, activity);
+  std::function<void(const Status&)> on_done;
+  if (async && entries.size() > 1) {
+    on_done = [this, buffer_data, entries](const Status& status) mutable {
+      if (status.ok()) {
+        auto& timeline = global_state_->timeline;
+        timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+        MemcpyOutFusionBuffer(buffer_data, entries);
+        timeline.ActivityEndAll(entries);
+      }
+    };
+  } else if (async && first_entry.postscale_factor != 1.0) {
+    on_done = [this, first_entry](const Status& status) {
+      if (status.ok()) {
+        PostscaleEntry(first_entry);
+      }
+    };
+  }
+  MPIPersistentRequests* persistent = nullptr;
+  if (algorithm == AllreduceAlgorithm::LIBRARY) {
+    persistent = GetPersistentRequests(entries, segments, response.reduce_op(),
+                                       buffer_data);
+  }
+
+  if (persistent != nullptr) {
+    // Fused response recurs, restart the requests bound to its layout.
+    auto& requests = persistent->requests;
+    int op = MPI_Startall((int) requests.size(), requests.data());
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Startall failed, see MPI output for details.");
+    }
+    if (async) {
+      return EnqueueAsync(mpi_context_, global_state_, entries, requests,
+                          on_done);
+    }
+    op = MPI_Waitall((int) requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Waitall failed, see MPI output for details.");
+    }
+  } else if (algorithm != AllreduceAlgorithm::LIBRARY) {
+    // Reduce in place with one of the built-in algorithms, segment by segment.
+    if (sendbuf != MPI_IN_PLACE) {
+      std::memcpy(buffer_data, sendbuf, buffer_len);
+    }
+    for (auto& segment : segments) {
+      algorithms_.Allreduce(algorithm, (uint8_t*) buffer_data + segment.offset,
+                            segment.num_elements, segment.dtype,
+                            response.reduce_op());
+    }
+  } else if (segments.size() > 1 || async) {
+    // Response was fused across data types, or is completed by the progress
+    // engine. Reduce every segment of the fusion buffer with its own
+    // datatype, issuing all of them at once so that they share a single round
+    // of latency.
+    // Segments larger than the int count limit are issued in chunks.
+    const int64_t max_count = std::numeric_limits<int>::max();
+    std::vector<MPI_Request> requests;
+    for (auto& segment : segments) {
+      int element_size = mpi_context_->GetMPITypeSize(segment.dtype);
+      for (int64_t chunk_offset = 0; chunk_offset < segment.num_elements;
+           chunk_offset += max_count) {
+        int64_t byte_offset = segment.offset + chunk_offset * element_size;
+        MPI_Request request;
+        int op = MPI_Iallreduce(sendbuf == MPI_IN_PLACE ? MPI_IN_PLACE : (const uint8_t*) sendbuf + byte_offset,
+                                (uint8_t*) buffer_data + byte_offset,
+                                (int) std::min(max_count, segment.num_elements - chunk_offset),
+                                mpi_context_->GetMPIDataType(segment.dtype),
+                                mpi_context_->GetMPIOp(segment.dtype, response.reduce_op()),
+                                mpi_context_->GetMPICommunicator(Communicator::GLOBAL),
+                                &request);
+        if (op != MPI_SUCCESS) {
+          throw std::runtime_error("MPI_Iallreduce failed, see MPI output for details.");
+        }
+        requests.push_back(request);
+      }
+    }
+
+    if (async) {
+      return EnqueueAsync(mpi_context_, global_state_, entries,
+                          std::move(requests), on_done);
+    }
+
+    int op = MPI_Waitall((int) requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Waitall failed, see MPI output for details.");
+    }
+  } else {
+    int op = LargeCountAllreduce(sendbuf, buffer_data,
+                                 num_elements,
+                                 mpi_context_->GetMPIDataType(first_entry.tensor),
+                                 mpi_context_->GetMPIOp(first_entry.tensor->dtype(),
+                                                        response.reduce_op()),
+                                 mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Allreduce failed, see MPI output for details.");
+    }
   }
   timeline.ActivityEndAll(entries);
 
@@ -60,6 +237,8 @@ Status MPIAllreduce::Execute(std::vector<TensorTableEntry>& entries, const Respo
     timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
     MemcpyOutFusionBuffer(buffer_data, entries);
     timeline.ActivityEndAll(entries);
+  } else if (first_entry.postscale_factor != 1.0) {
+    PostscaleEntry(first_entry);
   }
 
   return Status::OK();
@@ -71,6 +250,231 @@ bool MPIAllreduce::Enabled(const ParameterManager& param_manager,
   return true;
 }
 
+AllreduceAlgorithm MPIAllreduce::SelectAlgorithm(
+    const std::vector<TensorTableEntry>& entries,
+    const std::vector<DataTypeSegment>& segments, int64_t num_bytes) const {
+  // Built-in algorithms reduce on the host and send int element counts.
+  if (entries[0].device != CPU_DEVICE_ID) {
+    return AllreduceAlgorithm::LIBRARY;
+  }
+  for (auto& segment : segments) {
+    if (segment.num_elements > std::numeric_limits<int>::max()) {
+      return AllreduceAlgorithm::LIBRARY;
+    }
+  }
+
+  auto algorithm = global_state_->parameter_manager.CpuAllreduceAlgorithm();
+  if (algorithm == AllreduceAlgorithm::AUTO) {
+    algorithm = algorithm_table_.Select(num_bytes,
+                                        controller_->GetSize());
+  }
+  return algorithm;
+}
+
+MPIPersistentRequests* MPIAllreduce::GetPersistentRequests(
+    const std::vector<TensorTableEntry>& entries,
+    const std::vector<DataTypeSegment>& segments, ReduceOp reduce_op,
+    void* buffer_data) {
+#if MPI_VERSION >= 4
+  // Only fusion buffers stay at the same address from step to step.
+  if (entries.size() == 1 || entries[0].device != CPU_DEVICE_ID) {
+    return nullptr;
+  }
+
+  // Collectives are cached for as many fused responses as the response cache
+  // holds responses, and not at all if it is disabled.
+  auto& cache = mpi_context_->persistent_allreduces;
+  size_t capacity = global_state_->response_cache.capacity();
+  if (cache.capacity() != capacity) {
+    cache.SetCapacity(capacity);
+  }
+
+  // Asynchronous operations move on to the next fusion buffer every time, so
+  // a recurring response is bound once per slot.
+  int slot = FusionBufferStream(CPU_DEVICE_ID);
+  auto key = PersistentCollectiveKey(entries, segments, reduce_op) + ";" +
+             std::to_string(slot);
+  auto generation = FusionBufferGeneration(entries[0]);
+  bool should_create;
+  auto persistent = cache.Get(key, generation, should_create);
+  if (persistent == nullptr && should_create) {
+    // MPI_Allreduce_init is collective, so every rank has to reach it for the
+    // same responses in the same order. This holds as long as the cache
+    // evolves identically on all ranks: responses are performed in the same
+    // order everywhere, its capacity is the response cache capacity of every
+    // rank, and fusion buffers are reallocated in the same cycle on all ranks,
+    // so the key and the buffer generation agree across ranks. Nothing
+    // rank-local, such as the buffer address, may decide whether an entry is
+    // hit, created or evicted.
+    std::unique_ptr<MPIPersistentRequests> created(new MPIPersistentRequests());
+    created->progress_engine = &mpi_context_->progress_engine;
+    created->slot = slot;
+    for (auto& segment : segments) {
+      MPI_Request request;
+      int op = MPI_Allreduce_init_c(MPI_IN_PLACE,
+                                    (uint8_t*) buffer_data + segment.offset,
+                                    (MPI_Count) segment.num_elements,
+                                    mpi_context_->GetMPIDataType(segment.dtype),
+                                    mpi_context_->GetMPIOp(segment.dtype, reduce_op),
+                                    mpi_context_->GetMPICommunicator(Communicator::GLOBAL),
+                                    MPI_INFO_NULL, &request);
+      if (op != MPI_SUCCESS) {
+        throw std::runtime_error("MPI_Allreduce_init failed, see MPI output for details.");
+      }
+      created->requests.push_back(request);
+    }
+    persistent = cache.Put(key, generation, std::move(created));
+  }
+  return persistent;
+#else
+  return nullptr;
+#endif
+}
+
+MPIHierarchicalAllreduce::MPIHierarchicalAllreduce(MPIContext* mpi_context,
+                                                   HorovodGlobalState* global_state)
+    : MPIAllreduce(mpi_context, global_state) {
+  // Every rank creates its operations at the same point of initialization,
+  // so the collective window allocation is matched across local ranks. The
+  // window is only needed if hierarchical allreduce may be used at all.
+  auto& param_manager = global_state->parameter_manager;
+  if (param_manager.HierarchicalAllreduce() || param_manager.IsAutoTuning()) {
+    AllocateSharedSlots();
+  }
+}
+
+Status MPIHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
+                                         const Response& response) {
+  auto& first_entry = entries[0];
+
+  const void* input_data;
+  void* buffer_data;
+  size_t buffer_len;
+
+  // Copy memory into the fusion buffer. Single tensors are staged straight
+  // from their input into the shared window.
+  auto& timeline = global_state_->timeline;
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    const void* fused_input_data;
+    MemcpyInFusionBuffer(entries, fused_input_data, buffer_data, buffer_len);
+    input_data = buffer_data;
+    timeline.ActivityEndAll(entries);
+  } else {
+    input_data = first_entry.tensor->data();
+    buffer_data = (void*) first_entry.output->data();
+    buffer_len = (size_t) first_entry.output->size();
+    if (first_entry.prescale_factor != 1.0) {
+      PrescaleEntry(first_entry);
+      input_data = buffer_data;
+    }
+  }
+
+  timeline.ActivityStartAll(entries, MPI_ALLREDUCE);
+  for (auto& segment : GetDataTypeSegments(entries)) {
+    int element_size = mpi_context_->GetMPITypeSize(segment.dtype);
+    int64_t chunk_elements = SHARED_SLOT_SIZE / element_size;
+    for (int64_t chunk_offset = 0; chunk_offset < segment.num_elements;
+         chunk_offset += chunk_elements) {
+      int64_t byte_offset = segment.offset + chunk_offset * element_size;
+      AllreduceChunk((const uint8_t*) input_data + byte_offset,
+                     (uint8_t*) buffer_data + byte_offset,
+                     std::min(chunk_elements, segment.num_elements - chunk_offset),
+                     segment.dtype, response.reduce_op());
+    }
+  }
+  timeline.ActivityEndAll(entries);
+
+  // Copy memory out of the fusion buffer.
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(buffer_data, entries);
+    timeline.ActivityEndAll(entries);
+  } else if (first_entry.postscale_factor != 1.0) {
+    PostscaleEntry(first_entry);
+  }
+
+  return Status::OK();
+}
+
+bool MPIHierarchicalAllreduce::Enabled(const ParameterManager& param_manager,
+                                       const std::vector<TensorTableEntry>& entries,
+                                       const Response& response) const {
+  return entries[0].device == CPU_DEVICE_ID && !shared_slots_.empty() &&
+         param_manager.HierarchicalAllreduce();
+}
+
+void MPIHierarchicalAllreduce::AllreduceChunk(const void* input, void* output,
+                                              int64_t num_elements,
+                                              DataType dtype,
+                                              ReduceOp reduce_op) {
+  int local_size = controller_->GetLocalSize();
+  int local_rank = controller_->GetLocalRank();
+  int element_size = mpi_context_->GetMPITypeSize(dtype);
+  auto chunk_len = (size_t) (num_elements * element_size);
+
+  std::memcpy(shared_slots_[local_rank], input, chunk_len);
+  LocalBarrier(mpi_context_);
+
+  // Reduce-scatter within the node. If the cluster is homogeneous every
+  // local rank owns a shard and allreduces it with the ranks holding the
+  // same shard on other nodes, otherwise local rank 0 handles all data.
+  int64_t shard_begin = 0;
+  int64_t shard_end = 0;
+  if (controller_->IsHomogeneous()) {
+    shard_begin = num_elements * local_rank / local_size;
+    shard_end = num_elements * (local_rank + 1) / local_size;
+  } else if (local_rank == 0) {
+    shard_end = num_elements;
+  }
+
+  // Shards are accumulated in the slot of local rank 0.
+  if (shard_end > shard_begin) {
+    int64_t shard_offset = shard_begin * element_size;
+    int64_t shard_elements = shard_end - shard_begin;
+    for (int i = 1; i < local_size; ++i) {
+      Reduce(shared_slots_[0] + shard_offset, shared_slots_[i] + shard_offset,
+             shard_elements, dtype, reduce_op);
+    }
+
+    int op = LargeCountAllreduce(MPI_IN_PLACE, shared_slots_[0] + shard_offset,
+                                 shard_elements,
+                                 mpi_context_->GetMPIDataType(dtype),
+                                 mpi_context_->GetMPIOp(dtype, reduce_op),
+                                 mpi_context_->GetMPICommunicator(Communicator::CROSS));
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Allreduce failed, see MPI output for details.");
+    }
+  }
+  LocalBarrier(mpi_context_);
+
+  std::memcpy(output, shared_slots_[0], chunk_len);
+  // Local rank 0 must not stage the next chunk before everyone has read this
+  // one.
+  LocalBarrier(mpi_context_);
+}
+
+void MPIHierarchicalAllreduce::AllocateSharedSlots() {
+  void* base;
+  int op = MPI_Win_allocate_shared(SHARED_SLOT_SIZE, 1, MPI_INFO_NULL,
+                                   mpi_context_->GetMPICommunicator(Communicator::LOCAL),
+                                   &base, &mpi_context_->allreduce_window);
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Win_allocate_shared failed, see MPI output for details.");
+  }
+
+  int local_size = controller_->GetLocalSize();
+  shared_slots_.resize(local_size);
+  for (int i = 0; i < local_size; ++i) {
+    MPI_Aint winsize;
+    int disp_unit;
+    void* slot;
+    MPI_Win_shared_query(mpi_context_->allreduce_window, i, &winsize,
+                         &disp_unit, &slot);
+    shared_slots_[i] = (uint8_t*) slot;
+  }
+}
+
 MPIAllgather::MPIAllgather(MPIContext* mpi_context, HorovodGlobalState* global_state)
     : AllgatherOp(global_state), mpi_context_(mpi_context) {}
 
@@ -90,9 +494,9 @@ Status MPIAllgather::Execute(std::vector<TensorTableEntry>& entries, const Respo
   // allgatherv
   auto** entry_component_offsets = new int64_t* [entries.size()];
 
-  int global_size = global_state_->controller->GetSize();
-  auto* recvcounts = new int[global_size]();
-  auto* displcmnts = new int[global_size]();
+  int global_size = controller_->GetSize();
+  auto* recvcounts = new int64_t[global_size]();
+  auto* displcmnts = new int64_t[global_size]();
 
   for (size_t ec = 0; ec < entries.size(); ++ec) {
     entry_component_sizes[ec] = new int64_t[global_size]();
@@ -117,35 +521,109 @@ Status MPIAllgather::Execute(std::vector<TensorTableEntry>& entries, const Respo
   void* buffer_data;
   int64_t total_num_elements = NumElements(entries);
 
-  if (entries.size() > 1) {
-    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
-    MemcpyInFusionBuffer(entries, displcmnts, element_size, buffer_data);
-    timeline.ActivityEndAll(entries);
-  } else {
-    sendbuf = first_entry.tensor->data();
-    buffer_data = (void*) first_entry.output->data();
+  // Non-blocking allgatherv takes int counts and displacements, so larger
+  // gathers are executed with blocking collectives.
+  int64_t total_size = displcmnts[global_size - 1] + recvcounts[global_size - 1];
+  if (ExecuteAsync(mpi_context_, entries) &&
+      total_size <= std::numeric_limits<int>::max()) {
+    if (entries.size() > 1) {
+      timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+      MemcpyInFusionBuffer(entries, displcmnts, element_size, buffer_data);
+      timeline.ActivityEndAll(entries);
+    } else {
+      sendbuf = first_entry.tensor->data();
+      buffer_data = (void*) first_entry.output->data();
+    }
+
+    // Counts and displacements have to stay valid until the request
+    // completes.
+    auto* int_recvcounts = new int[global_size];
+    auto* int_displcmnts = new int[global_size];
+    for (int rc = 0; rc < global_size; ++rc) {
+      int_recvcounts[rc] = (int) recvcounts[rc];
+      int_displcmnts[rc] = (int) displcmnts[rc];
+    }
+    delete[] recvcounts;
+    delete[] displcmnts;
+
+    global_state_->timeline.ActivityStartAll(entries, MPI_ALLGATHER);
+    auto dtype = mpi_context_->GetMPIDataType(first_entry.tensor->dtype());
+    MPI_Request request;
+    int op = MPI_Iallgatherv(sendbuf != nullptr ? sendbuf : MPI_IN_PLACE,
+                             (int) total_num_elements,
+                             dtype,
+                             buffer_data,
+                             int_recvcounts,
+                             int_displcmnts,
+                             dtype,
+                             mpi_context_->GetMPICommunicator(Communicator::GLOBAL),
+                             &request);
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Iallgatherv failed, see MPI output for details.");
+    }
+
+    auto on_done = [this, entry_component_offsets, entry_component_sizes,
+                    int_recvcounts, int_displcmnts, buffer_data, element_size,
+                    entries](const Status& status) mutable {
+      if (status.ok() && entries.size() > 1) {
+        auto& timeline = global_state_->timeline;
+        timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+        MemcpyOutFusionBuffer(entry_component_offsets, entry_component_sizes,
+                              buffer_data, element_size, entries);
+        timeline.ActivityEndAll(entries);
+      }
+
+      delete[] int_recvcounts;
+      delete[] int_displcmnts;
+
+      for (size_t ec = 0; ec < entries.size(); ++ec) {
+        delete[] entry_component_sizes[ec];
+        delete[] entry_component_offsets[ec];
+      }
+      delete[] entry_component_sizes;
+      delete[] entry_component_offsets;
+    };
+    return EnqueueAsync(mpi_context_, global_state_, entries, {request}, on_done);
   }
 
-  global_state_->timeline.ActivityStartAll(entries, MPI_ALLGATHER);
-  auto dtype = mpi_context_->GetMPIDataType(first_entry.tensor->dtype());
-  int op = MPI_Allgatherv(sendbuf != nullptr ? sendbuf : MPI_IN_PLACE,
-                          (int) total_num_elements,
-                          dtype,
-                          buffer_data,
-                          recvcounts,
-                          displcmnts,
-                          dtype,
-                          mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
-  if (op != MPI_SUCCESS) {
-    throw std::runtime_error("MPI_Allgatherv failed, see MPI output for details.");
+  bool gathered = false;
+  if (global_state_->mpi_allgather_derived_datatypes && entries.size() > 1 &&
+      first_entry.device == CPU_DEVICE_ID) {
+    global_state_->timeline.ActivityStartAll(entries, MPI_ALLGATHER);
+    gathered = AllgatherDerivedDatatypes(entries, entry_component_sizes);
+    global_state_->timeline.ActivityEndAll(entries);
   }
-  global_state_->timeline.ActivityEndAll(entries);
 
-  if (entries.size() > 1) {
-    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
-    MemcpyOutFusionBuffer(entry_component_offsets, entry_component_sizes,
-                          buffer_data, element_size, entries);
-    timeline.ActivityEndAll(entries);
+  if (!gathered) {
+    if (entries.size() > 1) {
+      timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+      MemcpyInFusionBuffer(entries, displcmnts, element_size, buffer_data);
+      timeline.ActivityEndAll(entries);
+    } else {
+      sendbuf = first_entry.tensor->data();
+      buffer_data = (void*) first_entry.output->data();
+    }
+
+    global_state_->timeline.ActivityStartAll(entries, MPI_ALLGATHER);
+    auto dtype = mpi_context_->GetMPIDataType(first_entry.tensor->dtype());
+    int op = LargeCountAllgatherv(sendbuf != nullptr ? sendbuf : MPI_IN_PLACE,
+                                  total_num_elements,
+                                  buffer_data,
+                                  recvcounts,
+                                  displcmnts,
+                                  dtype,
+                                  mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Allgatherv failed, see MPI output for details.");
+    }
+    global_state_->timeline.ActivityEndAll(entries);
+
+    if (entries.size() > 1) {
+      timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+      MemcpyOutFusionBuffer(entry_component_offsets, entry_component_sizes,
+                            buffer_data, element_size, entries);
+      timeline.ActivityEndAll(entries);
+    }
   }
 
   delete[] recvcounts;
@@ -161,6 +639,79 @@ Status MPIAllgather::Execute(std::vector<TensorTableEntry>& entries, const Respo
   return Status::OK();
 }
 
+bool MPIAllgather::AllgatherDerivedDatatypes(
+    const std::vector<TensorTableEntry>& entries,
+    const int64_t* const* entry_component_sizes) {
+  int global_size = controller_->GetSize();
+  int rank = controller_->GetRank();
+  int num_entries = (int) entries.size();
+
+  // Block lengths of derived datatypes are int, so components above that
+  // limit have to go through the fusion buffer.
+  for (int ec = 0; ec < num_entries; ++ec) {
+    for (int rc = 0; rc < global_size; ++rc) {
+      if (entry_component_sizes[ec][rc] > std::numeric_limits<int>::max()) {
+        return false;
+      }
+    }
+  }
+
+  auto dtype = mpi_context_->GetMPIDataType(entries[0].tensor->dtype());
+  int element_size = mpi_context_->GetMPITypeSize(entries[0].tensor->dtype());
+
+  // Both datatypes use absolute addresses relative to MPI_BOTTOM.
+  std::vector<int> blocklengths(num_entries);
+  std::vector<MPI_Aint> addresses(num_entries);
+  std::vector<MPI_Aint> output_addresses(num_entries);
+  for (int ec = 0; ec < num_entries; ++ec) {
+    auto& e = entries[ec];
+    blocklengths[ec] = (int) entry_component_sizes[ec][rank];
+    MPI_Get_address(e.tensor->data(), &addresses[ec]);
+    MPI_Get_address(e.output->data(), &output_addresses[ec]);
+  }
+
+  // Every rank sends the same datatype, covering all of its input tensors.
+  MPI_Datatype sendtype;
+  MPI_Type_create_hindexed(num_entries, blocklengths.data(), addresses.data(),
+                           dtype, &sendtype);
+  MPI_Type_commit(&sendtype);
+
+  // Data from rank rc lands in the rc-th slice of every output tensor.
+  std::vector<MPI_Datatype> recvtypes(global_size);
+  for (int rc = 0; rc < global_size; ++rc) {
+    for (int ec = 0; ec < num_entries; ++ec) {
+      blocklengths[ec] = (int) entry_component_sizes[ec][rc];
+      addresses[ec] = output_addresses[ec];
+      output_addresses[ec] += entry_component_sizes[ec][rc] * element_size;
+    }
+    MPI_Type_create_hindexed(num_entries, blocklengths.data(),
+                             addresses.data(), dtype, &recvtypes[rc]);
+    MPI_Type_commit(&recvtypes[rc]);
+  }
+
+  // MPI_Allgatherv takes a single receive datatype, which cannot describe
+  // per-rank slices of several outputs. MPI_Alltoallw takes one datatype per
+  // peer, and sending the same datatype to every peer turns it into an
+  // allgather.
+  std::vector<int> counts(global_size, 1);
+  std::vector<int> displcmnts(global_size, 0);
+  std::vector<MPI_Datatype> sendtypes(global_size, sendtype);
+  int op = MPI_Alltoallw(MPI_BOTTOM, counts.data(), displcmnts.data(),
+                         sendtypes.data(), MPI_BOTTOM, counts.data(),
+                         displcmnts.data(), recvtypes.data(),
+                         mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+
+  MPI_Type_free(&sendtype);
+  for (auto& recvtype : recvtypes) {
+    MPI_Type_free(&recvtype);
+  }
+
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Alltoallw failed, see MPI output for details.");
+  }
+  return true;
+}
+
 MPIHierarchicalAllgather::MPIHierarchicalAllgather(MPIContext* mpi_context,
                                                    HorovodGlobalState* global_state)
     : MPIAllgather(mpi_context, global_state) {}
@@ -175,9 +726,9 @@ Status MPIHierarchicalAllgather::Execute(std::vector<TensorTableEntry>& entries,
   // allgatherv
   auto** entry_component_offsets = new int64_t* [entries.size()];
 
-  int global_size = global_state_->controller->GetSize();
-  auto* recvcounts = new int[global_size]();
-  auto* displcmnts = new int[global_size]();
+  int global_size = controller_->GetSize();
+  auto* recvcounts = new int64_t[global_size]();
+  auto* displcmnts = new int64_t[global_size]();
 
   for (size_t ec = 0; ec < entries.size(); ++ec) {
     entry_component_sizes[ec] = new int64_t[global_size]();
@@ -201,25 +752,32 @@ Status MPIHierarchicalAllgather::Execute(std::vector<TensorTableEntry>& entries,
   int64_t total_size = displcmnts[global_size - 1] +
                        recvcounts[global_size - 1];
 
-  // If shared buffer is not initialized or is not large enough, reallocate
+  // If shared buffer is not initialized or is not large enough, reallocate.
+  // Reallocating is collective within the node, so the buffer grows
+  // geometrically and is reused by later ops. All local ranks see the same
+  // response, so they agree on its size.
   int64_t total_size_in_bytes = total_size * element_size;
   if (global_state_->shared_buffer == nullptr || global_state_->shared_buffer_size < total_size_in_bytes) {
-    if (global_state_->shared_buffer != nullptr) {
-      MPI_Win_fence(0, mpi_context_->window);
+    if (mpi_context_->window != MPI_WIN_NULL) {
       MPI_Win_free(&mpi_context_->window);
       global_state_->shared_buffer = nullptr;
     }
+    int64_t buffer_size = std::max(total_size_in_bytes,
+                                   2 * global_state_->shared_buffer_size);
 
     // Allocate shared memory, give each rank their respective pointer
     timeline.ActivityStartAll(entries, ALLOCATE_SHARED_BUFFER);
-    int64_t window_size = global_state_->controller->GetLocalRank() == 0 ? total_size_in_bytes : 0;
-    MPI_Win_allocate_shared(window_size,
-                            element_size,
-                            MPI_INFO_NULL,
-                            mpi_context_->GetMPICommunicator(Communicator::LOCAL),
-                            &global_state_->shared_buffer,
-                            &mpi_context_->window);
-    if (global_state_->controller->GetLocalRank() != 0) {
+    int64_t window_size = controller_->GetLocalRank() == 0 ? buffer_size : 0;
+    int op = MPI_Win_allocate_shared(window_size,
+                                     1,
+                                     MPI_INFO_NULL,
+                                     mpi_context_->GetMPICommunicator(Communicator::LOCAL),
+                                     &global_state_->shared_buffer,
+                                     &mpi_context_->window);
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Win_allocate_shared failed, see MPI output for details.");
+    }
+    if (controller_->GetLocalRank() != 0) {
       int disp_unit;
       MPI_Aint winsize;
       MPI_Win_shared_query(mpi_context_->window,
@@ -228,39 +786,39 @@ Status MPIHierarchicalAllgather::Execute(std::vector<TensorTableEntry>& entries,
                            &disp_unit,
                            &global_state_->shared_buffer);
     }
-    global_state_->shared_buffer_size = total_size_in_bytes;
+    global_state_->shared_buffer_size = buffer_size;
     timeline.ActivityEndAll(entries);
   }
 
   // Compute cross-node allgather displacements and recvcounts for
   // homogeneous/parallelized case
-  int cross_size = global_state_->controller->GetCrossSize();
-  int local_size = global_state_->controller->GetLocalSize();
-  int local_rank = global_state_->controller->GetLocalRank();
-  auto* cross_recvcounts = new int[cross_size]();
-  auto* cross_displcmnts = new int[cross_size]();
-
-  if (global_state_->controller->IsHomogeneous()) {
-    for (int i = 0; i < global_state_->controller->GetCrossSize(); ++i) {
+  int cross_size = controller_->GetCrossSize();
+  int local_size = controller_->GetLocalSize();
+  int local_rank = controller_->GetLocalRank();
+  auto* cross_recvcounts = new int64_t[cross_size]();
+  auto* cross_displcmnts = new int64_t[cross_size]();
+
+  if (controller_->IsHomogeneous()) {
+    for (int i = 0; i < controller_->GetCrossSize(); ++i) {
       cross_recvcounts[i] = recvcounts[local_size * i + local_rank];
       cross_displcmnts[i] = displcmnts[local_size * i + local_rank];
     }
-  } else if (global_state_->controller->GetLocalRank() == 0) {
+  } else if (controller_->GetLocalRank() == 0) {
     // In this case local rank 0 will allgather with all local data
     int offset = 0;
     for (int i = 0; i < cross_size; ++i) {
-      for (int j = offset; j < offset + global_state_->controller->GetLocalSizeAtCrossRank(i);
+      for (int j = offset; j < offset + controller_->GetLocalSizeAtCrossRank(i);
            ++j) {
         cross_recvcounts[i] += recvcounts[j];
       }
       cross_displcmnts[i] = displcmnts[offset];
-      offset += global_state_->controller->GetLocalSizeAtCrossRank(i);
+      offset += controller_->GetLocalSizeAtCrossRank(i);
     }
   }
 
   timeline.ActivityStartAll(entries, MEMCPY_IN_SHARED_BUFFER);
 
-  int rank = global_state_->controller->GetRank();
+  int rank = controller_->GetRank();
   for (size_t ec = 0; ec < entries.size(); ++ec) {
     auto& e = entries[ec];
     void* shared_buffer_at_offset =
@@ -271,33 +829,37 @@ Status MPIHierarchicalAllgather::Execute(std::vector<TensorTableEntry>& entries,
     memcpy(shared_buffer_at_offset, e.tensor->data(),
            (size_t) (entry_component_sizes[ec][rank] * element_size));
   }
-  Barrier();
+  // In the homogeneous case every rank sends only the data it copied itself.
+  if (!controller_->IsHomogeneous()) {
+    LocalBarrier(mpi_context_);
+  }
   timeline.ActivityEndAll(entries);
 
   // Perform the cross-node allgather. If the cluster is homogeneous all
   // local ranks participate, otherwise local rank 0 handles all data
   global_state_->timeline.ActivityStartAll(entries, MPI_CROSS_ALLGATHER);
-  if (global_state_->controller->IsHomogeneous() || global_state_->controller->GetLocalRank() == 0) {
-    int op = MPI_Allgatherv(MPI_IN_PLACE,
-                            0,
-                            MPI_DATATYPE_NULL,
-                            global_state_->shared_buffer,
-                            cross_recvcounts,
-                            cross_displcmnts,
-                            mpi_context_->GetMPIDataType(first_entry.tensor->dtype()),
-                            mpi_context_->GetMPICommunicator(Communicator::CROSS));
+  if (controller_->IsHomogeneous() || controller_->GetLocalRank() == 0) {
+    int op = LargeCountAllgatherv(MPI_IN_PLACE,
+                                  0,
+                                  global_state_->shared_buffer,
+                                  cross_recvcounts,
+                                  cross_displcmnts,
+                                  mpi_context_->GetMPIDataType(first_entry.tensor->dtype()),
+                                  mpi_context_->GetMPICommunicator(Communicator::CROSS));
     if (op != MPI_SUCCESS) {
       throw std::runtime_error("MPI_Allgatherv failed, see MPI output for details.");
     }
   }
-  Barrier();
+  LocalBarrier(mpi_context_);
   global_state_->timeline.ActivityEndAll(entries);
 
   // Copy memory out of the fusion buffer.
   timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
   MemcpyOutFusionBuffer(entry_component_offsets, entry_component_sizes,
                         global_state_->shared_buffer, element_size, entries);
-  Barrier();
+  // The next op must not overwrite the buffer before every local rank has
+  // copied out of it.
+  LocalBarrier(mpi_context_);
   timeline.ActivityEndAll(entries);
 
   // Free the buffers
@@ -313,38 +875,91 @@ bool MPIHierarchicalAllgather::Enabled(const ParameterManager& param_manager,
   return param_manager.HierarchicalAllgather();
 }
 
-void MPIHierarchicalAllgather::Barrier() {
-  int op = MPI_Barrier(mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
-  if (op != MPI_SUCCESS) {
-    throw std::runtime_error("MPI_Barrier failed, see MPI output for details.");
-  }
-}
-
 MPIBroadcast::MPIBroadcast(MPIContext* mpi_context, HorovodGlobalState* global_state)
     : BroadcastOp(global_state), mpi_context_(mpi_context) {}
 
 Status MPIBroadcast::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
-  assert(entries.size() == 1);
-  auto e = entries[0];
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+  bool is_root_rank = controller_->GetRank() == first_entry.root_rank;
 
   // On root rank, MPI_Bcast sends data, on other ranks it receives data.
+  // Fused broadcasts are sent as bytes through the fusion buffer.
   void* data_ptr;
-  if (global_state_->controller->GetRank() == e.root_rank) {
-    data_ptr = (void*) e.tensor->data();
+  int64_t num_elements;
+  MPI_Datatype dtype;
+  if (entries.size() > 1) {
+    if (is_root_rank) {
+      timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+      MemcpyInFusionBuffer(entries, data_ptr);
+      timeline.ActivityEndAll(entries);
+    } else {
+      data_ptr = GetFusionBuffer(entries);
+    }
+    num_elements = FusedByteSize(entries);
+    dtype = MPI_BYTE;
   } else {
-    data_ptr = (void*) e.output->data();
+    if (is_root_rank) {
+      data_ptr = (void*) first_entry.tensor->data();
+    } else {
+      data_ptr = (void*) first_entry.output->data();
+    }
+    num_elements = first_entry.tensor->shape().num_elements();
+    dtype = mpi_context_->GetMPIDataType(first_entry.tensor->dtype());
   }
 
-  global_state_->timeline.ActivityStartAll(entries, MPI_BCAST);
-  int op = MPI_Bcast(data_ptr,
-                     (int) e.tensor->shape().num_elements(),
-                     mpi_context_->GetMPIDataType(e.tensor->dtype()),
-                     e.root_rank,
-                     mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+  timeline.ActivityStartAll(entries, MPI_BCAST);
+  if (ExecuteAsync(mpi_context_, entries)) {
+    // Buffers larger than the int count limit are broadcast in chunks.
+    const int64_t max_count = std::numeric_limits<int>::max();
+    int element_size;
+    MPI_Type_size(dtype, &element_size);
+    std::vector<MPI_Request> requests;
+    for (int64_t chunk_offset = 0; chunk_offset < num_elements;
+         chunk_offset += max_count) {
+      MPI_Request request;
+      int op = MPI_Ibcast((uint8_t*) data_ptr + chunk_offset * element_size,
+                          (int) std::min(max_count, num_elements - chunk_offset),
+                          dtype,
+                          first_entry.root_rank,
+                          mpi_context_->GetMPICommunicator(Communicator::GLOBAL),
+                          &request);
+      if (op != MPI_SUCCESS) {
+        throw std::runtime_error("MPI_Ibcast failed, see MPI output for details.");
+      }
+      requests.push_back(request);
+    }
+
+    std::function<void(const Status&)> on_done;
+    if (entries.size() > 1 && !is_root_rank) {
+      on_done = [this, data_ptr, entries](const Status& status) mutable {
+        if (status.ok()) {
+          auto& timeline = global_state_->timeline;
+          timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+          MemcpyOutFusionBuffer(data_ptr, entries);
+          timeline.ActivityEndAll(entries);
+        }
+      };
+    }
+    return EnqueueAsync(mpi_context_, global_state_, entries,
+                        std::move(requests), on_done);
+  }
+
+  int op = LargeCountBcast(data_ptr,
+                           num_elements,
+                           dtype,
+                           first_entry.root_rank,
+                           mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
   if (op != MPI_SUCCESS) {
     throw std::runtime_error("MPI_Broadcast failed, see MPI output for details.");
   }
-  global_state_->timeline.ActivityEndAll(entries);
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1 && !is_root_rank) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(data_ptr, entries);
+    timeline.ActivityEndAll(entries);
+  }
 
   return Status::OK();
 }
@@ -355,5 +970,403 @@ bool MPIBroadcast::Enabled(const ParameterManager& param_manager,
   return true;
 }
 
+MPIReducescatter::MPIReducescatter(MPIContext* mpi_context, HorovodGlobalState* global_state)
+    : ReducescatterOp(global_state), mpi_context_(mpi_context) {}
+
+Status MPIReducescatter::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+
+  int global_size = controller_->GetSize();
+  auto output_shapes = ComputeOutputShapes(entries, global_size);
+  auto recvcounts = ComputeReceiveCounts(output_shapes);
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status = AllocateOutput(entries, output_shapes);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  // A single entry is already laid out rank by rank, while fused entries are
+  // reduced in place in the fusion buffer.
+  const void* sendbuf;
+  void* buffer_data;
+  if (entries.size() > 1) {
+    int element_size = mpi_context_->GetMPITypeSize(first_entry.tensor->dtype());
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    MemcpyInFusionBuffer(entries, output_shapes, element_size, buffer_data);
+    timeline.ActivityEndAll(entries);
+    sendbuf = MPI_IN_PLACE;
+  } else {
+    sendbuf = first_entry.tensor->data();
+    buffer_data = (void*) first_entry.output->data();
+  }
+
+  timeline.ActivityStartAll(entries, MPI_REDUCESCATTER);
+  int op = LargeCountReducescatter(sendbuf, buffer_data, recvcounts.data(),
+                                   mpi_context_->GetMPIDataType(first_entry.tensor),
+                                   mpi_context_->GetMPIOp(first_entry.tensor->dtype(),
+                                                          response.reduce_op()),
+                                   mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Reduce_scatter failed, see MPI output for details.");
+  }
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(buffer_data, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  return Status::OK();
+}
+
+bool MPIReducescatter::Enabled(const ParameterManager& param_manager,
+                               const std::vector<TensorTableEntry>& entries,
+                               const Response& response) const {
+  return true;
+}
+
+MPIAlltoall::MPIAlltoall(MPIContext* mpi_context, HorovodGlobalState* global_state)
+    : AlltoallOp(global_state), mpi_context_(mpi_context) {}
+
+Status MPIAlltoall::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status = AllocateOutput(entries, response);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  std::vector<int64_t> sendcounts, sdispls, recvcounts, rdispls;
+  ComputeCounts(entries, response, sendcounts, sdispls, recvcounts, rdispls);
+
+  // A single entry is exchanged between the framework buffers directly, while
+  // fused entries are packed into the fusion buffer and received into a
+  // scratch buffer.
+  int element_size = mpi_context_->GetMPITypeSize(first_entry.tensor->dtype());
+  const void* sendbuf;
+  void* recvbuf;
+  if (entries.size() > 1) {
+    void* buffer_data;
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    MemcpyInFusionBuffer(entries, response, element_size, buffer_data);
+    timeline.ActivityEndAll(entries);
+    sendbuf = buffer_data;
+    recvbuf = GetReceiveBuffer((rdispls.back() + recvcounts.back()) * element_size);
+  } else {
+    sendbuf = first_entry.tensor->data();
+    recvbuf = (void*) first_entry.output->data();
+  }
+
+  timeline.ActivityStartAll(entries, MPI_ALLTOALL);
+  int op = LargeCountAlltoallv(sendbuf, sendcounts.data(), sdispls.data(),
+                               recvbuf, recvcounts.data(), rdispls.data(),
+                               mpi_context_->GetMPIDataType(first_entry.tensor),
+                               mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Alltoallv failed, see MPI output for details.");
+  }
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(recvbuf, response, element_size, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  return Status::OK();
+}
+
+bool MPIAlltoall::Enabled(const ParameterManager& param_manager,
+                          const std::vector<TensorTableEntry>& entries,
+                          const Response& response) const {
+  return true;
+}
+
+MPISparseAllreduce::MPISparseAllreduce(MPIContext* mpi_context, HorovodGlobalState* global_state)
+    : SparseAllreduceOp(global_state), mpi_context_(mpi_context) {}
+
+Status MPISparseAllreduce::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& e = entries[0];
+  auto comm = mpi_context_->GetMPICommunicator(Communicator::GLOBAL);
+
+  if (UseDense(e, response)) {
+    timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+    Status status = ScatterDense(e);
+    if (!status.ok()) {
+      return status;
+    }
+    timeline.ActivityEndAll(entries);
+
+    timeline.ActivityStartAll(entries, MPI_ALLREDUCE);
+    int op = LargeCountAllreduce(MPI_IN_PLACE, (void*) e.output->data(),
+                                 e.output->shape().num_elements(),
+                                 mpi_context_->GetMPIDataType(e.tensor),
+                                 mpi_context_->GetMPISumOp(e.tensor->dtype()),
+                                 comm);
+    if (op != MPI_SUCCESS) {
+      throw std::runtime_error("MPI_Allreduce failed, see MPI output for details.");
+    }
+    timeline.ActivityEndAll(entries);
+    return Status::OK();
+  }
+
+  std::vector<int64_t> counts, displcmnts;
+  ComputeBlockCounts(e, response, counts, displcmnts);
+  auto* buffer = (uint8_t*) GetReceiveBuffer(displcmnts.back() + counts.back());
+  PackBlock(e, buffer + displcmnts[controller_->GetRank()]);
+
+  // The blocks are exchanged as bytes, in place.
+  timeline.ActivityStartAll(entries, MPI_SPARSE_ALLREDUCE);
+  int op = LargeCountAllgatherv(MPI_IN_PLACE, 0, buffer, counts.data(),
+                                displcmnts.data(), MPI_BYTE, comm);
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Allgatherv failed, see MPI output for details.");
+  }
+  timeline.ActivityEndAll(entries);
+
+  timeline.ActivityStartAll(entries, MEMCPY_OUT_HOST_BUFFER);
+  Status status = UnpackBlocks(e, response, buffer, displcmnts);
+  timeline.ActivityEndAll(entries);
+  return status;
+}
+
+bool MPISparseAllreduce::Enabled(const ParameterManager& param_manager,
+                                 const std::vector<TensorTableEntry>& entries,
+                                 const Response& response) const {
+  return true;
+}
+
+MPIReduce::MPIReduce(MPIContext* mpi_context, HorovodGlobalState* global_state)
+    : ReduceToRootOp(global_state), mpi_context_(mpi_context) {}
+
+Status MPIReduce::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+  int root_rank = first_entry.root_rank;
+  bool is_root = controller_->GetRank() == root_rank;
+
+  // Fused entries are reduced in the fusion buffer, in place on the root rank.
+  const void* sendbuf;
+  void* buffer_data;
+  if (entries.size() > 1) {
+    const void* fused_input_data;
+    size_t buffer_len;
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    MemcpyInFusionBuffer(entries, fused_input_data, buffer_data, buffer_len);
+    timeline.ActivityEndAll(entries);
+    sendbuf = is_root ? MPI_IN_PLACE : buffer_data;
+  } else {
+    sendbuf = first_entry.tensor->data();
+    buffer_data = (void*) first_entry.output->data();
+    if (is_root && sendbuf == buffer_data) {
+      sendbuf = MPI_IN_PLACE;
+    }
+  }
+
+  timeline.ActivityStartAll(entries, MPI_REDUCE);
+  int op = LargeCountReduce(sendbuf, is_root ? buffer_data : nullptr,
+                            NumElements(entries),
+                            mpi_context_->GetMPIDataType(first_entry.tensor),
+                            mpi_context_->GetMPIOp(first_entry.tensor->dtype(),
+                                                   response.reduce_op()),
+                            root_rank,
+                            mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Reduce failed, see MPI output for details.");
+  }
+  timeline.ActivityEndAll(entries);
+
+  if (!is_root) {
+    CopyInputsToOutputs(entries);
+  } else if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(buffer_data, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  return Status::OK();
+}
+
+bool MPIReduce::Enabled(const ParameterManager& param_manager,
+                        const std::vector<TensorTableEntry>& entries,
+                        const Response& response) const {
+  return true;
+}
+
+MPIGather::MPIGather(MPIContext* mpi_context, HorovodGlobalState* global_state)
+    : GatherOp(global_state), mpi_context_(mpi_context) {}
+
+Status MPIGather::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
+  auto& timeline = global_state_->timeline;
+
+  auto** entry_component_sizes = new int64_t* [entries.size()];
+  auto** entry_component_offsets = new int64_t* [entries.size()];
+
+  int global_size = controller_->GetSize();
+  auto* recvcounts = new int64_t[global_size]();
+  auto* displcmnts = new int64_t[global_size]();
+
+  for (size_t ec = 0; ec < entries.size(); ++ec) {
+    entry_component_sizes[ec] = new int64_t[global_size]();
+    entry_component_offsets[ec] = new int64_t[global_size]();
+  }
+
+  auto& first_entry = entries[0];
+  int root_rank = first_entry.root_rank;
+  int rank = controller_->GetRank();
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status = AllocateOutput(entries, response, entry_component_sizes, recvcounts);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  SetDisplacements(recvcounts, displcmnts);
+  SetEntryComponentOffsets(entries, entry_component_sizes, recvcounts, entry_component_offsets);
+
+  int element_size = mpi_context_->GetMPITypeSize(first_entry.tensor->dtype());
+
+  // Fused entries are laid out as for allgather, the root rank gathering in
+  // place into the fusion buffer.
+  const void* sendbuf;
+  void* buffer_data = nullptr;
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+    MemcpyInFusionBuffer(entries, displcmnts, element_size, buffer_data);
+    timeline.ActivityEndAll(entries);
+    sendbuf = rank == root_rank
+                  ? MPI_IN_PLACE
+                  : (uint8_t*) buffer_data + displcmnts[rank] * element_size;
+  } else {
+    sendbuf = first_entry.tensor->data();
+    if (rank == root_rank) {
+      buffer_data = (void*) first_entry.output->data();
+    }
+  }
+
+  timeline.ActivityStartAll(entries, MPI_GATHER);
+  int op = LargeCountGatherv(sendbuf, NumElements(entries),
+                             rank == root_rank ? buffer_data : nullptr,
+                             recvcounts, displcmnts,
+                             mpi_context_->GetMPIDataType(first_entry.tensor),
+                             root_rank,
+                             mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Gatherv failed, see MPI output for details.");
+  }
+  timeline.ActivityEndAll(entries);
+
+  if (rank == root_rank && entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(entry_component_offsets, entry_component_sizes,
+                          buffer_data, element_size, entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  delete[] recvcounts;
+  delete[] displcmnts;
+
+  for (size_t ec = 0; ec < entries.size(); ++ec) {
+    delete[] entry_component_sizes[ec];
+    delete[] entry_component_offsets[ec];
+  }
+  delete[] entry_component_sizes;
+  delete[] entry_component_offsets;
+
+  return Status::OK();
+}
+
+bool MPIGather::Enabled(const ParameterManager& param_manager,
+                        const std::vector<TensorTableEntry>& entries,
+                        const Response& response) const {
+  return true;
+}
+
+MPIScatter::MPIScatter(MPIContext* mpi_context, HorovodGlobalState* global_state)
+    : ScatterOp(global_state), mpi_context_(mpi_context) {}
+
+Status MPIScatter::Execute(std::vector<TensorTableEntry>& entries, const Response& response) {
+  auto& timeline = global_state_->timeline;
+  auto& first_entry = entries[0];
+  int root_rank = first_entry.root_rank;
+  int rank = controller_->GetRank();
+
+  int global_size = controller_->GetSize();
+  auto output_shapes = ComputeOutputShapes(entries, global_size);
+  auto sendcounts = ComputeReceiveCounts(output_shapes);
+  std::vector<int64_t> displcmnts(global_size, 0);
+  for (int rc = 1; rc < global_size; ++rc) {
+    displcmnts[rc] = displcmnts[rc - 1] + sendcounts[rc - 1];
+  }
+
+  timeline.ActivityStartAll(entries, ALLOCATE_OUTPUT);
+  Status status = AllocateOutput(entries, output_shapes);
+  if (!status.ok()) {
+    return status;
+  }
+  timeline.ActivityEndAll(entries);
+
+  // A single entry is already laid out rank by rank. Fused entries are packed
+  // into the fusion buffer by the root rank, which keeps its own slices there,
+  // and received into a separate buffer by the other ranks.
+  int element_size = mpi_context_->GetMPITypeSize(first_entry.tensor->dtype());
+  const void* sendbuf = nullptr;
+  void* buffer_data;
+  if (entries.size() > 1) {
+    if (rank == root_rank) {
+      timeline.ActivityStartAll(entries, MEMCPY_IN_FUSION_BUFFER);
+      MemcpyInFusionBuffer(entries, output_shapes, element_size, buffer_data);
+      timeline.ActivityEndAll(entries);
+      sendbuf = buffer_data;
+    } else {
+      buffer_data = GetReceiveBuffer(sendcounts[rank] * element_size);
+    }
+  } else {
+    if (rank == root_rank) {
+      sendbuf = first_entry.tensor->data();
+    }
+    buffer_data = (void*) first_entry.output->data();
+  }
+
+  bool in_place = entries.size() > 1 && rank == root_rank;
+  timeline.ActivityStartAll(entries, MPI_SCATTER);
+  int op = LargeCountScatterv(sendbuf, sendcounts.data(), displcmnts.data(),
+                              in_place ? MPI_IN_PLACE : buffer_data,
+                              sendcounts[rank],
+                              mpi_context_->GetMPIDataType(first_entry.tensor),
+                              root_rank,
+                              mpi_context_->GetMPICommunicator(Communicator::GLOBAL));
+  if (op != MPI_SUCCESS) {
+    throw std::runtime_error("MPI_Scatterv failed, see MPI output for details.");
+  }
+  timeline.ActivityEndAll(entries);
+
+  if (entries.size() > 1) {
+    timeline.ActivityStartAll(entries, MEMCPY_OUT_FUSION_BUFFER);
+    MemcpyOutFusionBuffer(
+        in_place ? (uint8_t*) buffer_data + displcmnts[rank] * element_size
+                 : buffer_data,
+        entries);
+    timeline.ActivityEndAll(entries);
+  }
+
+  return Status::OK();
+}
+
+bool MPIScatter::Enabled(const ParameterManager& param_manager,
+                         const std::vector<TensorTableEntry>& entries,
+                         const Response& response) const {
+  return true;
+}
+
 } // namespace common
 } // namespace horovod
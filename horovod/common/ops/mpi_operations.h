@@ -22,6 +22,7 @@
 #include "mpi.h"
 
 #include "collective_operations.h"
+#include "mpi_allreduce_algorithms.h"
 #include "../common.h"
 #include "../global_state.h"
 #include "../mpi/mpi_context.h"
@@ -42,7 +43,48 @@ public:
                const Response& response) const override;
 
 protected:
+  // Picks the algorithm for a response. Every rank makes the same choice.
+  AllreduceAlgorithm SelectAlgorithm(const std::vector<TensorTableEntry>& entries,
+                                     const std::vector<DataTypeSegment>& segments,
+                                     int64_t num_bytes) const;
+
+  // Returns the persistent requests reducing the fused response in place if
+  // it recurs, or nullptr. Requires MPI 4.0.
+  MPIPersistentRequests* GetPersistentRequests(const std::vector<TensorTableEntry>& entries,
+                                               const std::vector<DataTypeSegment>& segments,
+                                               ReduceOp reduce_op, void* buffer_data);
+
   MPIContext* mpi_context_;
+
+  AllreduceAlgorithmTable algorithm_table_;
+  MPIAllreduceAlgorithms algorithms_;
+};
+
+class MPIHierarchicalAllreduce : public MPIAllreduce {
+public:
+  MPIHierarchicalAllreduce(MPIContext* mpi_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries, const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+private:
+  // Reduces num_elements elements of input into output. Local ranks stage
+  // their data in their slot of the node-local shared window, each reduces
+  // one shard across the slots and allreduces it across nodes, then every
+  // local rank copies the whole result out of the window.
+  void AllreduceChunk(const void* input, void* output, int64_t num_elements,
+                      DataType dtype, ReduceOp reduce_op);
+
+  // Allocates a shared window slot of SHARED_SLOT_SIZE bytes for every
+  // local rank. Called once, when the operation is created.
+  void AllocateSharedSlots();
+
+  // Start of the shared window slot of every local rank. Empty if the window
+  // was not allocated.
+  std::vector<uint8_t*> shared_slots_;
 };
 
 class MPIAllgather : public AllgatherOp {
@@ -56,6 +98,15 @@ public:
                const Response& response) const override;
 
 protected:
+  // Gathers fused entries without staging them in the fusion buffer. Derived
+  // datatypes describe the input tensors and, for every rank, the slices of
+  // the output tensors receiving its data, so MPI moves data between the
+  // framework buffers directly. Returns false if the entries cannot be
+  // described this way and the fusion buffer has to be used instead. Only
+  // used if HOROVOD_MPI_ALLGATHER_DERIVED_DATATYPES is set.
+  bool AllgatherDerivedDatatypes(const std::vector<TensorTableEntry>& entries,
+                                 const int64_t* const* entry_component_sizes);
+
   MPIContext* mpi_context_;
 };
 
@@ -68,9 +119,6 @@ public:
   bool Enabled(const ParameterManager& param_manager,
                const std::vector<TensorTableEntry>& entries,
                const Response& response) const override;
-
-private:
-  void Barrier();
 };
 
 class MPIBroadcast : public BroadcastOp {
@@ -87,6 +135,90 @@ protected:
   MPIContext* mpi_context_;
 };
 
+class MPIReducescatter : public ReducescatterOp {
+public:
+  MPIReducescatter(MPIContext* mpi_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries, const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  MPIContext* mpi_context_;
+};
+
+class MPIAlltoall : public AlltoallOp {
+public:
+  MPIAlltoall(MPIContext* mpi_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries, const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  MPIContext* mpi_context_;
+};
+
+class MPISparseAllreduce : public SparseAllreduceOp {
+public:
+  MPISparseAllreduce(MPIContext* mpi_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries, const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  MPIContext* mpi_context_;
+};
+
+class MPIReduce : public ReduceToRootOp {
+public:
+  MPIReduce(MPIContext* mpi_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries, const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  MPIContext* mpi_context_;
+};
+
+class MPIGather : public GatherOp {
+public:
+  MPIGather(MPIContext* mpi_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries, const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  MPIContext* mpi_context_;
+};
+
+class MPIScatter : public ScatterOp {
+public:
+  MPIScatter(MPIContext* mpi_context, HorovodGlobalState* global_state);
+
+  Status Execute(std::vector<TensorTableEntry>& entries, const Response& response) override;
+
+  bool Enabled(const ParameterManager& param_manager,
+               const std::vector<TensorTableEntry>& entries,
+               const Response& response) const override;
+
+protected:
+  MPIContext* mpi_context_;
+};
+
 } // namespace common
 } // namespace horovod
 
@@ -37,6 +37,22 @@ ncclDataType_t GetNCCLDataType(const std::shared_ptr<Tensor> tensor) {
   }
 }
 
+ncclRedOp_t GetNCCLReduceOp(ReduceOp reduce_op) {
+  switch (reduce_op) {
+    case ReduceOp::SUM:
+      return ncclSum;
+    case ReduceOp::MIN:
+      return ncclMin;
+    case ReduceOp::MAX:
+      return ncclMax;
+    case ReduceOp::PRODUCT:
+      return ncclProd;
+    default:
+      throw std::logic_error("Reduce op " + ReduceOp_Name(reduce_op) +
+                             " is not supported in NCCL mode.");
+  }
+}
+
 void NCCLContext::ErrorCheck(std::string op_name, ncclResult_t nccl_result) {
   if (nccl_result != ncclSuccess) {
     throw std::logic_error(std::string(op_name) + " failed: " + ncclGetErrorString(nccl_result));
@@ -85,7 +101,8 @@ Status NCCLAllreduce::Execute(std::vector<TensorTableEntry>& entries,
   // Do allreduce.
   auto nccl_result = ncclAllReduce(fused_input_data, buffer_data,
                                    (size_t) num_elements,
-                                   GetNCCLDataType(first_entry.tensor), ncclSum,
+                                   GetNCCLDataType(first_entry.tensor),
+                                   GetNCCLReduceOp(response.reduce_op()),
                                    *nccl_comm_, *cuda_op_context_.stream);
   nccl_context_->ErrorCheck("ncclAllReduce", nccl_result);
   if (global_state_->timeline.Initialized()) {
@@ -121,7 +138,7 @@ void NCCLAllreduce::InitNCCLComm(const std::vector<TensorTableEntry>& entries,
       nccl_context_->ErrorCheck("ncclGetUniqueId", ncclGetUniqueId(&nccl_id));
     }
 
-    global_state_->controller->Bcast((void*)&nccl_id, sizeof(nccl_id), 0,
+    controller_->Bcast((void*)&nccl_id, sizeof(nccl_id), 0,
                                      nccl_id_bcast_comm);
 
     ncclComm_t new_nccl_comm;
@@ -131,7 +148,7 @@ void NCCLAllreduce::InitNCCLComm(const std::vector<TensorTableEntry>& entries,
 
     // Barrier helps NCCL to synchronize after initialization and avoid
     // deadlock that we've been seeing without it.
-    global_state_->controller->Barrier(Communicator::GLOBAL);
+    controller_->Barrier(Communicator::GLOBAL);
 
     timeline.ActivityEndAll(entries);
   }
@@ -141,8 +158,8 @@ void NCCLAllreduce::InitNCCLComm(const std::vector<TensorTableEntry>& entries,
 
 void NCCLAllreduce::PopulateNCCLCommStrategy(int& nccl_rank, int& nccl_size,
                                              Communicator& nccl_id_bcast_comm) {
-  nccl_rank = global_state_->controller->GetRank();
-  nccl_size = global_state_->controller->GetSize();
+  nccl_rank = controller_->GetRank();
+  nccl_size = controller_->GetSize();
   nccl_id_bcast_comm = Communicator::GLOBAL;
 }
 
@@ -155,8 +172,8 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
   // Determine GPU IDs of the devices participating in this communicator.
   std::vector<int32_t> nccl_device_map;
   nccl_device_map.reserve(
-      global_state_->controller->GetLocalCommRanks().size());
-  for (int rank : global_state_->controller->GetLocalCommRanks()) {
+      controller_->GetLocalCommRanks().size());
+  for (int rank : controller_->GetLocalCommRanks()) {
     nccl_device_map.push_back(response.devices()[rank]);
   }
 
@@ -188,14 +205,14 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
 
   // Do allreduce.
   int element_size = mpi_context_->GetMPITypeSize(first_entry.tensor->dtype());
-  int local_size = global_state_->controller->GetLocalSize();
-  int local_rank = global_state_->controller->GetLocalRank();
+  int local_size = controller_->GetLocalSize();
+  int local_rank = controller_->GetLocalRank();
 
   // If cluster is homogeneous and we are using fusion buffer, include
   // dummy elements from the buffer (if necessary) to make sure the data
   // is divisible by local_size. This is always possible since we
   // set the fusion buffer size divisible by local_size.
-  if (global_state_->controller->IsHomogeneous() && entries.size() > 1) {
+  if (controller_->IsHomogeneous() && entries.size() > 1) {
     // Making sure the number of elements is divisible by
     // FUSION_BUFFER_ATOMIC_UNIT for improved performance
     int div = local_size * FUSION_BUFFER_ATOMIC_UNIT;
@@ -215,7 +232,7 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
   // non-divisible part (if any), do NCCL Reduce (at rank local_size-1),
   // MPI Allreduce (across rank (local_size-1)'s), and NCCL Bcast
 
-  int64_t num_elements_per_rank = global_state_->controller->IsHomogeneous()
+  int64_t num_elements_per_rank = controller_->IsHomogeneous()
                                       ? num_elements / local_size
                                       : 0;
 
@@ -224,7 +241,7 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
   void* buffer_data_at_rank_offset =
       (uint8_t*)buffer_data + buffer_len_per_rank * local_rank;
 
-  int64_t num_elements_remaining = global_state_->controller->IsHomogeneous()
+  int64_t num_elements_remaining = controller_->IsHomogeneous()
                                        ? num_elements % local_size
                                        : num_elements;
 
@@ -237,7 +254,7 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
       (uint8_t*)fused_input_data + buffer_len_per_rank * local_size;
 
   int root_rank =
-      global_state_->controller->IsHomogeneous() ? local_size - 1 : 0;
+      controller_->IsHomogeneous() ? local_size - 1 : 0;
   bool is_root_rank = local_rank == root_rank;
 
   int64_t total_num_elements =
@@ -253,7 +270,8 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
                                          buffer_data_at_rank_offset,
                                          (size_t) num_elements_per_rank,
                                          GetNCCLDataType(first_entry.tensor),
-                                         ncclSum, *nccl_comm_, *cuda_op_context_.stream);
+                                         GetNCCLReduceOp(response.reduce_op()),
+                                         *nccl_comm_, *cuda_op_context_.stream);
     nccl_context_->ErrorCheck("ncclReduceScatter", nccl_result);
     if (global_state_->timeline.Initialized()) {
       cuda_context_->RecordEvent(cuda_op_context_.event_queue, NCCL_REDUCESCATTER, *cuda_op_context_.stream);
@@ -266,7 +284,8 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
     auto nccl_result = ncclReduce(fused_input_data_remainder,
                                   buffer_data_remainder,
                                   (size_t) num_elements_remaining,
-                                  GetNCCLDataType(first_entry.tensor), ncclSum,
+                                  GetNCCLDataType(first_entry.tensor),
+                                  GetNCCLReduceOp(response.reduce_op()),
                                   root_rank, *nccl_comm_, *cuda_op_context_.stream);
     nccl_context_->ErrorCheck("ncclReduce", nccl_result);
     if (global_state_->timeline.Initialized()) {
@@ -274,7 +293,7 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
     }
   }
 
-  if (global_state_->controller->IsHomogeneous() || is_root_rank) {
+  if (controller_->IsHomogeneous() || is_root_rank) {
     // cudaHostAlloc is significantly slower than malloc.  Pre-allocating
     // a buffer is not safe since the tensor can be arbitrarily large.
     cuda_op_context_.host_buffer = malloc(total_buffer_len);
@@ -297,7 +316,8 @@ NCCLHierarchicalAllreduce::Execute(std::vector<TensorTableEntry>& entries,
     int op = MPI_Allreduce(MPI_IN_PLACE, cuda_op_context_.host_buffer,
                            (int) total_num_elements,
                            mpi_context_->GetMPIDataType(first_entry.tensor),
-                           mpi_context_->GetMPISumOp(first_entry.tensor->dtype()),
+                           mpi_context_->GetMPIOp(first_entry.tensor->dtype(),
+                                                  response.reduce_op()),
                            mpi_context_->GetMPICommunicator(Communicator::CROSS));
     if (op != MPI_SUCCESS) {
       throw std::runtime_error("MPI_Allreduce failed, see MPI output for details.");
@@ -356,8 +376,8 @@ bool NCCLHierarchicalAllreduce::Enabled(const ParameterManager& param_manager,
 
 void NCCLHierarchicalAllreduce::PopulateNCCLCommStrategy(int& nccl_rank, int& nccl_size,
                                                          Communicator& nccl_id_bcast_comm) {
-  nccl_rank = global_state_->controller->GetLocalRank();
-  nccl_size = global_state_->controller->GetLocalSize();
+  nccl_rank = controller_->GetLocalRank();
+  nccl_size = controller_->GetLocalSize();
   nccl_id_bcast_comm = Communicator::LOCAL;
 }
 #endif
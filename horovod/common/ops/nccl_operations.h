@@ -30,6 +30,8 @@ namespace common {
 
 ncclDataType_t GetNCCLDataType(const std::shared_ptr<Tensor> tensor);
 
+ncclRedOp_t GetNCCLReduceOp(ReduceOp reduce_op);
+
 struct NCCLContext {
   std::vector<std::unordered_map<std::vector<int32_t>, ncclComm_t>> nccl_comms;
 
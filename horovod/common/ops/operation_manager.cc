@@ -25,6 +25,12 @@ OperationManager::OperationManager(ParameterManager* param_manager,
                                    std::vector<std::shared_ptr<BroadcastOp>> broadcast_ops,
                                    std::shared_ptr<JoinOp> join_op,
                                    std::vector<std::shared_ptr<AllreduceOp>> adasum_ops,
+                                   std::vector<std::shared_ptr<ReducescatterOp>> reducescatter_ops,
+                                   std::vector<std::shared_ptr<AlltoallOp>> alltoall_ops,
+                                   std::vector<std::shared_ptr<SparseAllreduceOp>> sparse_allreduce_ops,
+                                   std::vector<std::shared_ptr<ReduceToRootOp>> reduce_ops,
+                                   std::vector<std::shared_ptr<GatherOp>> gather_ops,
+                                   std::vector<std::shared_ptr<ScatterOp>> scatter_ops,
                                    std::shared_ptr<ErrorOp> error_op)
     : param_manager_(param_manager),
       allreduce_ops_(std::move(allreduce_ops)),
@@ -32,6 +38,12 @@ OperationManager::OperationManager(ParameterManager* param_manager,
       broadcast_ops_(std::move(broadcast_ops)),
       join_op_(std::move(join_op)),
       adasum_ops_(std::move(adasum_ops)),
+      reducescatter_ops_(std::move(reducescatter_ops)),
+      alltoall_ops_(std::move(alltoall_ops)),
+      sparse_allreduce_ops_(std::move(sparse_allreduce_ops)),
+      reduce_ops_(std::move(reduce_ops)),
+      gather_ops_(std::move(gather_ops)),
+      scatter_ops_(std::move(scatter_ops)),
       error_op_(std::move(error_op)) {}
 
 Status OperationManager::ExecuteAllreduce(std::vector<TensorTableEntry>& entries,
@@ -79,6 +91,66 @@ Status OperationManager::ExecuteAdasum(std::vector<TensorTableEntry>& entries,
   throw std::logic_error("No Adasum operation enabled");
 }
 
+Status OperationManager::ExecuteReducescatter(std::vector<TensorTableEntry>& entries,
+                                              const Response& response) const {
+  for (auto& op : reducescatter_ops_) {
+    if (op->Enabled(*param_manager_, entries, response)) {
+      return op->Execute(entries, response);
+    }
+  }
+  throw std::logic_error("No Reducescatter operation enabled");
+}
+
+Status OperationManager::ExecuteAlltoall(std::vector<TensorTableEntry>& entries,
+                                         const Response& response) const {
+  for (auto& op : alltoall_ops_) {
+    if (op->Enabled(*param_manager_, entries, response)) {
+      return op->Execute(entries, response);
+    }
+  }
+  throw std::logic_error("No Alltoall operation enabled");
+}
+
+Status OperationManager::ExecuteSparseAllreduce(std::vector<TensorTableEntry>& entries,
+                                                const Response& response) const {
+  for (auto& op : sparse_allreduce_ops_) {
+    if (op->Enabled(*param_manager_, entries, response)) {
+      return op->Execute(entries, response);
+    }
+  }
+  throw std::logic_error("No SparseAllreduce operation enabled");
+}
+
+Status OperationManager::ExecuteReduce(std::vector<TensorTableEntry>& entries,
+                                       const Response& response) const {
+  for (auto& op : reduce_ops_) {
+    if (op->Enabled(*param_manager_, entries, response)) {
+      return op->Execute(entries, response);
+    }
+  }
+  throw std::logic_error("No Reduce operation enabled");
+}
+
+Status OperationManager::ExecuteGather(std::vector<TensorTableEntry>& entries,
+                                       const Response& response) const {
+  for (auto& op : gather_ops_) {
+    if (op->Enabled(*param_manager_, entries, response)) {
+      return op->Execute(entries, response);
+    }
+  }
+  throw std::logic_error("No Gather operation enabled");
+}
+
+Status OperationManager::ExecuteScatter(std::vector<TensorTableEntry>& entries,
+                                        const Response& response) const {
+  for (auto& op : scatter_ops_) {
+    if (op->Enabled(*param_manager_, entries, response)) {
+      return op->Execute(entries, response);
+    }
+  }
+  throw std::logic_error("No Scatter operation enabled");
+}
+
 Status OperationManager::ExecuteError(std::vector<TensorTableEntry>& entries,
                                       const Response& response) const {
   return error_op_->Execute(entries, response);
@@ -96,6 +168,18 @@ Status OperationManager::ExecuteOperation(std::vector<TensorTableEntry>& entries
     return ExecuteJoin(entries, response);
   } else if (response.response_type() == Response::ADASUM) {
     return ExecuteAdasum(entries, response);
+  } else if (response.response_type() == Response::REDUCESCATTER) {
+    return ExecuteReducescatter(entries, response);
+  } else if (response.response_type() == Response::ALLTOALL) {
+    return ExecuteAlltoall(entries, response);
+  } else if (response.response_type() == Response::SPARSE_ALLREDUCE) {
+    return ExecuteSparseAllreduce(entries, response);
+  } else if (response.response_type() == Response::REDUCE) {
+    return ExecuteReduce(entries, response);
+  } else if (response.response_type() == Response::GATHER) {
+    return ExecuteGather(entries, response);
+  } else if (response.response_type() == Response::SCATTER) {
+    return ExecuteScatter(entries, response);
   } else if (response.response_type() == Response::ERROR) {
     return ExecuteError(entries, response);
   } else {
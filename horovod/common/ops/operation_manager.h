@@ -31,6 +31,12 @@ public:
                    std::vector<std::shared_ptr<BroadcastOp>> broadcast_ops,
                    std::shared_ptr<JoinOp> join_op,
                    std::vector<std::shared_ptr<AllreduceOp>> adasum_ops,
+                   std::vector<std::shared_ptr<ReducescatterOp>> reducescatter_ops,
+                   std::vector<std::shared_ptr<AlltoallOp>> alltoall_ops,
+                   std::vector<std::shared_ptr<SparseAllreduceOp>> sparse_allreduce_ops,
+                   std::vector<std::shared_ptr<ReduceToRootOp>> reduce_ops,
+                   std::vector<std::shared_ptr<GatherOp>> gather_ops,
+                   std::vector<std::shared_ptr<ScatterOp>> scatter_ops,
                    std::shared_ptr<ErrorOp> error_op);
 
   virtual ~OperationManager() = default;
@@ -47,6 +53,18 @@ public:
 
   Status ExecuteAdasum(std::vector<TensorTableEntry>& entries, const Response& response) const;
 
+  Status ExecuteReducescatter(std::vector<TensorTableEntry>& entries, const Response& response) const;
+
+  Status ExecuteAlltoall(std::vector<TensorTableEntry>& entries, const Response& response) const;
+
+  Status ExecuteSparseAllreduce(std::vector<TensorTableEntry>& entries, const Response& response) const;
+
+  Status ExecuteReduce(std::vector<TensorTableEntry>& entries, const Response& response) const;
+
+  Status ExecuteGather(std::vector<TensorTableEntry>& entries, const Response& response) const;
+
+  Status ExecuteScatter(std::vector<TensorTableEntry>& entries, const Response& response) const;
+
   Status ExecuteOperation(std::vector<TensorTableEntry>& entries, const Response& response) const;
 
 private:
@@ -57,6 +75,12 @@ private:
   std::vector<std::shared_ptr<BroadcastOp>> broadcast_ops_;
   std::shared_ptr<JoinOp> join_op_;
   std::vector<std::shared_ptr<AllreduceOp>> adasum_ops_;
+  std::vector<std::shared_ptr<ReducescatterOp>> reducescatter_ops_;
+  std::vector<std::shared_ptr<AlltoallOp>> alltoall_ops_;
+  std::vector<std::shared_ptr<SparseAllreduceOp>> sparse_allreduce_ops_;
+  std::vector<std::shared_ptr<ReduceToRootOp>> reduce_ops_;
+  std::vector<std::shared_ptr<GatherOp>> gather_ops_;
+  std::vector<std::shared_ptr<ScatterOp>> scatter_ops_;
   std::shared_ptr<ErrorOp> error_op_;
 };
 
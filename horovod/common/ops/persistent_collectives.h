@@ -0,0 +1,131 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#ifndef HOROVOD_PERSISTENT_COLLECTIVES_H
+#define HOROVOD_PERSISTENT_COLLECTIVES_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace horovod {
+namespace common {
+
+// LRU cache of collectives bound to a fusion buffer, such as MPI persistent
+// requests or Gloo algorithm instances.
+//
+// In steady state the same fused responses are performed every step, so their
+// setup is done once, when a key is seen for the second time, and reused from
+// then on. Setting up these collectives is itself collective, so the cache must
+// evolve identically on all ranks: keys are looked up in the same order, with
+// the same capacity, and buffers are identified by their generation rather
+// than their address, which differs from rank to rank.
+template <class T> class PersistentCollectives {
+public:
+  // Limits the number of cached collectives. Zero disables the cache.
+  void SetCapacity(size_t capacity) {
+    capacity_ = capacity;
+    while (entries_.size() > capacity_) {
+      Evict();
+    }
+    if (capacity_ == 0) {
+      seen_.clear();
+    }
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  // Returns the collective cached under the key if it is bound to the given
+  // generation of the buffer, or nullptr. Otherwise should_create tells
+  // whether the key recurs and a collective should be set up and put into the
+  // cache.
+  T* Get(const std::string& key, uint64_t buffer_generation,
+         bool& should_create) {
+    should_create = false;
+    if (capacity_ == 0) {
+      return nullptr;
+    }
+
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      if (it->second.buffer_generation == buffer_generation) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        return it->second.collective.get();
+      }
+      // Fusion buffer was reallocated, so the collective has to be bound
+      // again.
+      lru_.erase(it->second.lru_it);
+      entries_.erase(it);
+      should_create = true;
+      return nullptr;
+    }
+
+    // Keys that never recur must not grow the set forever.
+    if (seen_.size() >= MAX_SEEN_PER_ENTRY * capacity_) {
+      seen_.clear();
+    }
+    should_create = !seen_.insert(key).second;
+    return nullptr;
+  }
+
+  T* Put(const std::string& key, uint64_t buffer_generation,
+         std::unique_ptr<T> collective) {
+    if (entries_.size() >= capacity_) {
+      Evict();
+    }
+    lru_.push_front(key);
+    auto& entry = entries_[key];
+    entry.buffer_generation = buffer_generation;
+    entry.collective = std::move(collective);
+    entry.lru_it = lru_.begin();
+    seen_.erase(key);
+    return entry.collective.get();
+  }
+
+  // Releases all collectives, e.g. before the communication library is
+  // finalized.
+  void Clear() {
+    entries_.clear();
+    lru_.clear();
+    seen_.clear();
+  }
+
+private:
+  static constexpr size_t MAX_SEEN_PER_ENTRY = 4;
+
+  struct Entry {
+    uint64_t buffer_generation;
+    std::unique_ptr<T> collective;
+    std::list<std::string>::iterator lru_it;
+  };
+
+  void Evict() {
+    entries_.erase(lru_.back());
+    lru_.pop_back();
+  }
+
+  size_t capacity_ = 0;
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, Entry> entries_;
+  std::unordered_set<std::string> seen_;
+};
+
+} // namespace common
+} // namespace horovod
+
+#endif // HOROVOD_PERSISTENT_COLLECTIVES_H
@@ -43,6 +43,13 @@ ParameterManager::ParameterManager() :
     steps_per_sample_(GetIntEnvOrDefault(HOROVOD_AUTOTUNE_STEPS_PER_SAMPLE, DEFAULT_STEPS_PER_SAMPLE)),
     hierarchical_allreduce_(CategoricalParameter<bool>(std::vector<bool>{false, true})),
     hierarchical_allgather_(CategoricalParameter<bool>(std::vector<bool>{false, true})),
+    cpu_allreduce_algorithm_(CategoricalParameter<int>(std::vector<int>{
+        (int) AllreduceAlgorithm::AUTO,
+        (int) AllreduceAlgorithm::RING,
+        (int) AllreduceAlgorithm::RECURSIVE_DOUBLING,
+        (int) AllreduceAlgorithm::RABENSEIFNER,
+        (int) AllreduceAlgorithm::TWO_LEVEL_TREE,
+        (int) AllreduceAlgorithm::LIBRARY})),
     cache_enabled_(CategoricalParameter<bool>(std::vector<bool>{false, true})),
     joint_params_(BayesianParameter(
       std::vector<BayesianVariableConfig>{
@@ -58,7 +65,7 @@ ParameterManager::ParameterManager() :
       GetIntEnvOrDefault(HOROVOD_AUTOTUNE_BAYES_OPT_MAX_SAMPLES, DEFAULT_BAYES_OPT_MAX_SAMPLES),
       GetDoubleEnvOrDefault(HOROVOD_AUTOTUNE_GAUSSIAN_PROCESS_NOISE, DEFAULT_GAUSSIAN_PROCESS_NOISE))),
     parameter_chain_(std::vector<ITunableParameter*>{&joint_params_, &hierarchical_allreduce_, &hierarchical_allgather_,
-                                                     &cache_enabled_}),
+                                                     &cpu_allreduce_algorithm_, &cache_enabled_}),
     active_(false),
     warmup_remaining_(warmups_),
     sample_(0),
@@ -73,12 +80,12 @@ void ParameterManager::Initialize(int32_t rank, int32_t root_rank,
   rank_ = rank;
   root_rank_ = root_rank;
   if (rank_ == root_rank) {
-    LOG(INFO) << "Autotuner: Tunable params [hierarchical_allreduce,hierarchical_allgather,cache_enabled,cycle_time_ms,tensor_fusion_threshold] score";
+    LOG(INFO) << "Autotuner: Tunable params [hierarchical_allreduce,hierarchical_allgather,cpu_allreduce_algorithm,cache_enabled,cycle_time_ms,tensor_fusion_threshold] score";
   }
   if (rank_ == root_rank && !file_name.empty()) {
     file_.open(file_name, std::ios::out | std::ios::trunc);
     if (file_.good()) {
-      file_ << "hierarchical_allreduce,hierarchical_allgather,cache_enabled,cycle_time_ms,tensor_fusion_threshold,score" << std::endl;
+      file_ << "hierarchical_allreduce,hierarchical_allgather,cpu_allreduce_algorithm,cache_enabled,cycle_time_ms,tensor_fusion_threshold,score" << std::endl;
       writing_ = true;
     }
   }
@@ -107,6 +114,23 @@ void ParameterManager::SetHierarchicalAllgather(bool value, bool fixed) {
   hierarchical_allgather_.SetValue(value, fixed);
 }
 
+AllreduceAlgorithm ParameterManager::CpuAllreduceAlgorithm() const {
+  return (AllreduceAlgorithm) (active_ ? cpu_allreduce_algorithm_.Value()
+                                       : cpu_allreduce_algorithm_.BestValue());
+}
+
+void ParameterManager::SetCpuAllreduceAlgorithm(AllreduceAlgorithm algorithm, bool fixed) {
+  cpu_allreduce_algorithm_.SetValue((int) algorithm, fixed);
+}
+
+void ParameterManager::SetCpuAllreduceAlgorithms(const std::vector<AllreduceAlgorithm>& algorithms) {
+  std::vector<int> values;
+  for (auto algorithm : algorithms) {
+    values.push_back((int) algorithm);
+  }
+  cpu_allreduce_algorithm_.SetValues(values);
+}
+
 bool ParameterManager::CacheEnabled() const {
   return active_ ? cache_enabled_.Value() : cache_enabled_.BestValue();
 };
@@ -220,6 +244,7 @@ ParameterManager::Params ParameterManager::GetParams() {
     // We're actively tuning, so send the current value.
     params.hierarchical_allreduce = hierarchical_allreduce_.Value();
     params.hierarchical_allgather = hierarchical_allgather_.Value();
+    params.cpu_allreduce_algorithm = cpu_allreduce_algorithm_.Value();
     params.cache_enabled = cache_enabled_.Value();
     params.tensor_fusion_threshold = joint_params_.Value(fusion_buffer_threshold_mb);
     params.cycle_time = joint_params_.Value(cycle_time_ms);
@@ -227,6 +252,7 @@ ParameterManager::Params ParameterManager::GetParams() {
     // Tuning has completed, so send the best value.
     params.hierarchical_allreduce = hierarchical_allreduce_.BestValue();
     params.hierarchical_allgather = hierarchical_allgather_.BestValue();
+    params.cpu_allreduce_algorithm = cpu_allreduce_algorithm_.BestValue();
     params.cache_enabled = cache_enabled_.BestValue();
     params.tensor_fusion_threshold = joint_params_.BestValue(fusion_buffer_threshold_mb);
     params.cycle_time = joint_params_.BestValue(cycle_time_ms);
@@ -240,6 +266,7 @@ ParameterManager::Params ParameterManager::GetParams() {
 void ParameterManager::SetParams(const Params& newParams) {
   hierarchical_allreduce_.SetValue(newParams.hierarchical_allreduce, true);
   hierarchical_allgather_.SetValue(newParams.hierarchical_allgather, true);
+  cpu_allreduce_algorithm_.SetValue(newParams.cpu_allreduce_algorithm, true);
   cache_enabled_.SetValue(newParams.cache_enabled, true);
   joint_params_.SetValue(fusion_buffer_threshold_mb, newParams.tensor_fusion_threshold, true);
   joint_params_.SetValue(cycle_time_ms, newParams.cycle_time, true);
@@ -258,6 +285,7 @@ void ParameterManager::LogParameters(double score) {
     LOG(INFO) << "Autotuner: ["
               << hierarchical_allreduce_.Value() << ", "
               << hierarchical_allgather_.Value() << ", "
+              << AllreduceAlgorithmName((AllreduceAlgorithm) cpu_allreduce_algorithm_.Value()) << ", "
               << cache_enabled_.Value() << ", "
               << joint_params_.Value(cycle_time_ms) << " ms, "
               << joint_params_.Value(fusion_buffer_threshold_mb) << " mb] "
@@ -265,6 +293,7 @@ void ParameterManager::LogParameters(double score) {
     if (writing_ && file_.good()) {
       file_ << hierarchical_allreduce_.Value() << ","
             << hierarchical_allgather_.Value() << ","
+            << AllreduceAlgorithmName((AllreduceAlgorithm) cpu_allreduce_algorithm_.Value()) << ","
             << cache_enabled_.Value() << ","
             << joint_params_.Value(cycle_time_ms) << ","
             << joint_params_.Value(fusion_buffer_threshold_mb) << ","
@@ -279,6 +308,7 @@ void ParameterManager::LogBestParameters() {
     LOG(INFO) << "Autotuner: Best params ["
               << hierarchical_allreduce_.BestValue() << ", "
               << hierarchical_allgather_.BestValue() << ", "
+              << AllreduceAlgorithmName((AllreduceAlgorithm) cpu_allreduce_algorithm_.BestValue()) << ", "
               << cache_enabled_.BestValue() << ", "
               << joint_params_.BestValue(cycle_time_ms) << " ms, "
               << joint_params_.BestValue(fusion_buffer_threshold_mb) << " mb] "
@@ -286,6 +316,7 @@ void ParameterManager::LogBestParameters() {
     if (writing_ && file_.good()) {
       file_ << hierarchical_allreduce_.BestValue() << ","
             << hierarchical_allgather_.BestValue() << ","
+            << AllreduceAlgorithmName((AllreduceAlgorithm) cpu_allreduce_algorithm_.BestValue()) << ","
             << cache_enabled_.BestValue() << ","
             << joint_params_.BestValue(cycle_time_ms) << ","
             << joint_params_.BestValue(fusion_buffer_threshold_mb) << ","
@@ -376,6 +407,13 @@ ParameterManager::CategoricalParameter<T>::CategoricalParameter(std::vector<T> v
   ResetState();
 }
 
+template <class T>
+void ParameterManager::CategoricalParameter<T>::SetValues(std::vector<T> values) {
+  values_ = std::move(values);
+  this->Reinitialize(values_[0]);
+  ResetState();
+}
+
 template <class T>
 void ParameterManager::CategoricalParameter<T>::OnTune(double score, T& value) {
   ++index_;
@@ -25,6 +25,7 @@
 
 #include <Eigen/Core>
 
+#include "common.h"
 #include "optim/bayesian_optimization.h"
 
 namespace horovod {
@@ -63,6 +64,14 @@ public:
   bool HierarchicalAllgather() const;
   void SetHierarchicalAllgather(bool value, bool fixed=false);
 
+  // Algorithm used to allreduce CPU tensors.
+  AllreduceAlgorithm CpuAllreduceAlgorithm() const;
+  void SetCpuAllreduceAlgorithm(AllreduceAlgorithm algorithm, bool fixed=false);
+
+  // Algorithms the autotuner tries for CPU allreduce, which depend on the
+  // communication library. The first one is the initial value.
+  void SetCpuAllreduceAlgorithms(const std::vector<AllreduceAlgorithm>& algorithms);
+
   // Threshold for Tensor Fusion.  All tensors that occupy memory beyond this
   // threshold will be fused.
   int64_t TensorFusionThresholdBytes() const;
@@ -90,6 +99,7 @@ public:
   struct Params {
     bool hierarchical_allreduce;
     bool hierarchical_allgather;
+    int cpu_allreduce_algorithm;
     bool cache_enabled;
     double tensor_fusion_threshold;
     double cycle_time;
@@ -166,6 +176,9 @@ private:
   public:
     CategoricalParameter(std::vector<T> values);
 
+    // Replaces the values to try and starts over with the first one.
+    void SetValues(std::vector<T> values);
+
   private:
     void OnTune(double score, T& value);
     bool IsDoneTuning() const;
@@ -224,6 +237,7 @@ private:
 
   CategoricalParameter<bool> hierarchical_allreduce_;
   CategoricalParameter<bool> hierarchical_allgather_;
+  CategoricalParameter<int> cpu_allreduce_algorithm_;
   CategoricalParameter<bool> cache_enabled_;
   BayesianParameter joint_params_;
 
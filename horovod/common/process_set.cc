@@ -0,0 +1,69 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#include "process_set.h"
+
+#include <algorithm>
+
+#include "controller.h"
+
+namespace horovod {
+namespace common {
+
+bool ProcessSet::Includes(int rank) const {
+  return std::binary_search(registered_global_ranks.begin(),
+                            registered_global_ranks.end(), rank);
+}
+
+int32_t ProcessSetTable::RegisterProcessSet(std::vector<int> global_ranks) {
+  std::sort(global_ranks.begin(), global_ranks.end());
+  global_ranks.erase(std::unique(global_ranks.begin(), global_ranks.end()),
+                     global_ranks.end());
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  int32_t process_set_id = next_process_set_id_++;
+  auto& process_set = id_to_process_set_[process_set_id];
+  process_set.reset(new ProcessSet());
+  process_set->registered_global_ranks = std::move(global_ranks);
+  return process_set_id;
+}
+
+ProcessSet* ProcessSetTable::Get(int32_t process_set_id) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = id_to_process_set_.find(process_set_id);
+  if (it == id_to_process_set_.end()) {
+    return nullptr;
+  }
+  return it->second.get();
+}
+
+std::vector<int32_t> ProcessSetTable::Ids() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  std::vector<int32_t> ids;
+  ids.reserve(id_to_process_set_.size());
+  for (auto& it : id_to_process_set_) {
+    ids.push_back(it.first);
+  }
+  return ids;
+}
+
+void ProcessSetTable::Clear() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  id_to_process_set_.clear();
+  next_process_set_id_ = GLOBAL_PROCESS_SET_ID + 1;
+}
+
+} // namespace common
+} // namespace horovod
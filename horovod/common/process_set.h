@@ -0,0 +1,126 @@
+// Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// =============================================================================
+
+#ifndef HOROVOD_PROCESS_SET_H
+#define HOROVOD_PROCESS_SET_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "fusion_buffer_manager.h"
+#include "group_table.h"
+#include "ops/operation_manager.h"
+#include "response_cache.h"
+#include "tensor_queue.h"
+
+#if HAVE_MPI
+#include "mpi/mpi_context.h"
+#endif
+
+#if HAVE_GLOO
+#include "gloo/gloo_context.h"
+#endif
+
+namespace horovod {
+namespace common {
+
+// Forward declaration
+class Controller;
+
+// A subset of the Horovod ranks running collectives among themselves.
+//
+// Every process set has its own communicators, tensor queue, response cache,
+// fusion buffers and controller, so its tensors are negotiated only by its
+// members and do not wait for tensors of other ranks. The global process set, made of all
+// ranks, is the state kept in HorovodGlobalState and has no entry here.
+struct ProcessSet {
+  ProcessSet() = default;
+  ProcessSet(const ProcessSet&) = delete;
+
+  // Whether the given Horovod rank is a member of this process set.
+  bool Includes(int rank) const;
+
+  // Horovod ranks of the members, in increasing order. The rank of a member
+  // within the process set is its index in this list.
+  std::vector<int> registered_global_ranks;
+
+  // Only set on members, once the background thread has set up the process
+  // set.
+  std::shared_ptr<Controller> controller;
+
+  TensorQueue tensor_queue;
+
+  ResponseCache response_cache;
+
+  GroupTable group_table;
+
+  std::unique_ptr<OperationManager> op_manager;
+
+  FusionBufferManager fusion_buffer;
+
+  // Negotiates and performs the collectives of the process set, if they can
+  // run concurrently with the ones of other process sets. Otherwise the
+  // global background thread runs them after its own.
+  std::thread background_thread;
+
+  // Set by the global background thread to stop the one of the process set.
+  std::atomic_bool shut_down{false};
+
+#if HAVE_MPI
+  MPIContext mpi_context;
+#endif
+
+#if HAVE_GLOO
+  GlooContext gloo_context;
+#endif
+};
+
+// Process sets registered on this rank, by ID. Process sets must be
+// registered on all ranks in the same order, so that they get the same IDs
+// everywhere, before Horovod is initialized.
+class ProcessSetTable {
+public:
+  ProcessSetTable() = default;
+  ProcessSetTable(const ProcessSetTable&) = delete;
+
+  // Registers a process set of the given Horovod ranks and returns its ID.
+  int32_t RegisterProcessSet(std::vector<int> global_ranks);
+
+  // Returns the process set with the given ID, or nullptr if there is none.
+  ProcessSet* Get(int32_t process_set_id) const;
+
+  // IDs of all registered process sets, in increasing order.
+  std::vector<int32_t> Ids() const;
+
+  // Removes all process sets once Horovod has been shut down, so that they
+  // have to be registered again before Horovod is initialized again.
+  void Clear();
+
+private:
+  std::map<int32_t, std::unique_ptr<ProcessSet>> id_to_process_set_;
+
+  int32_t next_process_set_id_ = GLOBAL_PROCESS_SET_ID + 1;
+
+  mutable std::mutex mutex_;
+};
+
+} // namespace common
+} // namespace horovod
+
+#endif // HOROVOD_PROCESS_SET_H
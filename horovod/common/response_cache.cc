@@ -53,10 +53,19 @@ ResponseCache::CacheState ResponseCache::cached(const Request& message) const {
     // If entry associated with this request already exists in cache, check
     // if tensor parameters match. If not, return that entry is invalid.
     uint32_t cache_bit = it->second;
+    auto& cache_response = std::get<0>(*cache_iters_[cache_bit]);
     auto& cache_params = std::get<1>(*cache_iters_[cache_bit]);
-    return (cache_params.device == message.device() &&
+    // Request and response types share their values, so a name reused for
+    // another collective invalidates the entry.
+    return ((int)cache_response.response_type() ==
+                (int)message.request_type() &&
+            cache_response.reduce_op() == message.reduce_op() &&
+            cache_response.prescale_factor() == message.prescale_factor() &&
+            cache_response.postscale_factor() == message.postscale_factor() &&
+            cache_params.device == message.device() &&
             cache_params.dtype == message.tensor_type() &&
-            cache_params.shape == message.tensor_shape())
+            cache_params.shape == message.tensor_shape() &&
+            cache_params.root_rank == message.root_rank())
                ? CacheState::HIT
                : CacheState::INVALID;
   } else {
@@ -76,7 +85,8 @@ ResponseCache::cached(const Response& response,
     auto& cache_params = std::get<1>(*cache_iters_[cache_bit]);
     return (cache_params.device == params.device &&
             cache_params.dtype == params.dtype &&
-            cache_params.shape == params.shape)
+            cache_params.shape == params.shape &&
+            cache_params.root_rank == params.root_rank)
                ? CacheState::HIT
                : CacheState::INVALID;
   } else {
@@ -151,12 +161,27 @@ void ResponseCache::put(const Response& response, TensorQueue& tensor_queue) {
 
   // If response is fused, split back into individual responses
   if (response.tensor_names().size() > 1) {
-    for (auto& name : response.tensor_names()) {
+    // Fused gathers hold the sizes of all the ranks for every tensor in turn,
+    // while other fused responses share their sizes.
+    bool split_sizes =
+        response.response_type() == Response::ResponseType::GATHER;
+    size_t num_ranks = response.devices().size();
+    for (size_t i = 0; i < response.tensor_names().size(); ++i) {
+      auto& name = response.tensor_names()[i];
       Response new_response;
       new_response.add_tensor_name(name);
       new_response.set_response_type(response.response_type());
+      new_response.set_reduce_op(response.reduce_op());
+      new_response.set_prescale_factor(response.prescale_factor());
+      new_response.set_postscale_factor(response.postscale_factor());
       new_response.set_devices(response.devices());
-      new_response.set_tensor_sizes(response.tensor_sizes());
+      if (split_sizes) {
+        auto sizes_begin = response.tensor_sizes().begin() + i * num_ranks;
+        new_response.set_tensor_sizes(
+            std::vector<int64_t>(sizes_begin, sizes_begin + num_ranks));
+      } else {
+        new_response.set_tensor_sizes(response.tensor_sizes());
+      }
 
       // Populate tensor parameters from tensor_queue entry
       const auto& tensor_entry = tensor_queue.GetTensorEntry(name);
@@ -164,6 +189,7 @@ void ResponseCache::put(const Response& response, TensorQueue& tensor_queue) {
       params.device = tensor_entry.device;
       params.dtype = tensor_entry.tensor->dtype();
       params.shape = tensor_entry.tensor->shape().to_vector();
+      params.root_rank = tensor_entry.root_rank;
 
       this->put_(new_response, params);
     }
@@ -174,6 +200,7 @@ void ResponseCache::put(const Response& response, TensorQueue& tensor_queue) {
     params.device = tensor_entry.device;
     params.dtype = tensor_entry.tensor->dtype();
     params.shape = tensor_entry.tensor->shape().to_vector();
+    params.root_rank = tensor_entry.root_rank;
 
     this->put_(response, params);
   }
@@ -264,6 +291,12 @@ void CacheCoordinator::record_hit(uint32_t bit) {
   cache_hits_.insert(bit);
 }
 
+void CacheCoordinator::erase_hit(uint32_t bit) {
+  assert(synced_);
+  cache_hits_.erase(bit);
+  uncached_in_queue_ = true;
+}
+
 void CacheCoordinator::record_invalid_bit(uint32_t bit) {
   assert(!synced_);
   invalid_bits_.insert(bit);
@@ -39,6 +39,8 @@ struct TensorParams {
   DataType dtype;
   std::vector<int64_t> shape;
   int32_t device;
+  // Root of a broadcast, reduce, gather or scatter, zero otherwise.
+  int32_t root_rank;
 };
 
 // LRU cache of Responses
@@ -107,6 +109,10 @@ public:
 
   void record_invalid_bit(uint32_t bit);
 
+  // Drops a common cache hit after sync(), so that the tensor is negotiated
+  // again in this cycle. Must be called with the same bit on all workers.
+  void erase_hit(uint32_t bit);
+
   void set_should_shut_down(bool should_shut_down);
 
   void set_uncached_in_queue(bool uncached_in_queue);
@@ -34,6 +34,21 @@ Status TensorQueue::AddToTensorQueue(TensorTableEntry& e, Request& message) {
   return Status::OK();
 }
 
+Status TensorQueue::AddToTensorQueueMulti(std::vector<TensorTableEntry>& entries,
+                                          std::vector<Request>& messages) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto& e : entries) {
+    if (tensor_table_.find(e.tensor_name) != tensor_table_.end()) {
+      return DUPLICATE_NAME_ERROR;
+    }
+  }
+  for (size_t i = 0; i < entries.size(); ++i) {
+    tensor_table_.emplace(entries[i].tensor_name, std::move(entries[i]));
+    message_queue_.push(messages[i]);
+  }
+  return Status::OK();
+}
+
 // Put callbacks for each tensor in the callback buffer and clear tensor queue
 void TensorQueue::FinalizeTensorQueue(
     std::vector<StatusCallback>& callbacks_buffer) {
@@ -82,6 +97,12 @@ void TensorQueue::GetTensorEntriesFromResponse(
              response.response_type() == Response::ALLGATHER ||
              response.response_type() == Response::BROADCAST ||
              response.response_type() == Response::ADASUM ||
+             response.response_type() == Response::REDUCESCATTER ||
+             response.response_type() == Response::ALLTOALL ||
+             response.response_type() == Response::SPARSE_ALLREDUCE ||
+             response.response_type() == Response::REDUCE ||
+             response.response_type() == Response::GATHER ||
+             response.response_type() == Response::SCATTER ||
              response.response_type() == Response::ERROR);
 
       if (!joined) {
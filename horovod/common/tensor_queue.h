@@ -31,6 +31,11 @@ public:
   TensorQueue(const TensorQueue&) = delete;
   Status AddToTensorQueue(TensorTableEntry& e, Request& message);
 
+  // Adds the entries of a group at once, so that their messages are always
+  // sent to the coordinator in the same cycle.
+  Status AddToTensorQueueMulti(std::vector<TensorTableEntry>& entries,
+                               std::vector<Request>& messages);
+
   void FinalizeTensorQueue(std::vector<StatusCallback>& callbacks_buffer);
 
   int64_t GetTensorDataForAutotuner(const ResponseList& response_list,
@@ -93,16 +93,30 @@ enum RequestType {
   RequestType_ALLGATHER = 1,
   RequestType_BROADCAST = 2,
   RequestType_JOIN = 3,
+  RequestType_ADASUM = 4,
+  RequestType_REDUCESCATTER = 5,
+  RequestType_ALLTOALL = 6,
+  RequestType_SPARSE_ALLREDUCE = 7,
+  RequestType_REDUCE = 8,
+  RequestType_GATHER = 9,
+  RequestType_SCATTER = 10,
   RequestType_MIN = RequestType_ALLREDUCE,
-  RequestType_MAX = RequestType_JOIN
+  RequestType_MAX = RequestType_SCATTER
 };
 
-inline const RequestType (&EnumValuesRequestType())[4] {
+inline const RequestType (&EnumValuesRequestType())[11] {
   static const RequestType values[] = {
     RequestType_ALLREDUCE,
     RequestType_ALLGATHER,
     RequestType_BROADCAST,
-    RequestType_JOIN
+    RequestType_JOIN,
+    RequestType_ADASUM,
+    RequestType_REDUCESCATTER,
+    RequestType_ALLTOALL,
+    RequestType_SPARSE_ALLREDUCE,
+    RequestType_REDUCE,
+    RequestType_GATHER,
+    RequestType_SCATTER
   };
   return values;
 }
@@ -113,13 +127,20 @@ inline const char * const *EnumNamesRequestType() {
     "ALLGATHER",
     "BROADCAST",
     "JOIN",
+    "ADASUM",
+    "REDUCESCATTER",
+    "ALLTOALL",
+    "SPARSE_ALLREDUCE",
+    "REDUCE",
+    "GATHER",
+    "SCATTER",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNameRequestType(RequestType e) {
-  if (e < RequestType_ALLREDUCE || e > RequestType_JOIN) return "";
+  if (e < RequestType_ALLREDUCE || e > RequestType_SCATTER) return "";
   const size_t index = static_cast<size_t>(e);
   return EnumNamesRequestType()[index];
 }
@@ -130,18 +151,30 @@ enum ResponseType {
   ResponseType_BROADCAST = 2,
   ResponseType_JOIN = 3,
   ResponseType_ADASUM = 4,
-  ResponseType_ERROR = 5,
+  ResponseType_REDUCESCATTER = 5,
+  ResponseType_ALLTOALL = 6,
+  ResponseType_SPARSE_ALLREDUCE = 7,
+  ResponseType_REDUCE = 8,
+  ResponseType_GATHER = 9,
+  ResponseType_SCATTER = 10,
+  ResponseType_ERROR = 11,
   ResponseType_MIN = ResponseType_ALLREDUCE,
   ResponseType_MAX = ResponseType_ERROR
 };
 
-inline const ResponseType (&EnumValuesResponseType())[6] {
+inline const ResponseType (&EnumValuesResponseType())[12] {
   static const ResponseType values[] = {
     ResponseType_ALLREDUCE,
     ResponseType_ALLGATHER,
     ResponseType_BROADCAST,
     ResponseType_JOIN,
     ResponseType_ADASUM,
+    ResponseType_REDUCESCATTER,
+    ResponseType_ALLTOALL,
+    ResponseType_SPARSE_ALLREDUCE,
+    ResponseType_REDUCE,
+    ResponseType_GATHER,
+    ResponseType_SCATTER,
     ResponseType_ERROR
   };
   return values;
@@ -153,6 +186,13 @@ inline const char * const *EnumNamesResponseType() {
     "ALLGATHER",
     "BROADCAST",
     "JOIN",
+    "ADASUM",
+    "REDUCESCATTER",
+    "ALLTOALL",
+    "SPARSE_ALLREDUCE",
+    "REDUCE",
+    "GATHER",
+    "SCATTER",
     "ERROR",
     nullptr
   };
@@ -173,7 +213,12 @@ struct Request FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_TENSOR_NAME = 10,
     VT_ROOT_RANK = 12,
     VT_DEVICE = 14,
-    VT_TENSOR_SHAPE = 16
+    VT_TENSOR_SHAPE = 16,
+    VT_SPLITS = 18,
+    VT_REDUCE_OP = 20,
+    VT_PRESCALE_FACTOR = 22,
+    VT_POSTSCALE_FACTOR = 24,
+    VT_GROUP_ID = 26
   };
   int32_t request_rank() const {
     return GetField<int32_t>(VT_REQUEST_RANK, 0);
@@ -196,6 +241,21 @@ struct Request FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<int64_t> *tensor_shape() const {
     return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_TENSOR_SHAPE);
   }
+  const flatbuffers::Vector<int64_t> *splits() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_SPLITS);
+  }
+  int32_t reduce_op() const {
+    return GetField<int32_t>(VT_REDUCE_OP, 0);
+  }
+  double prescale_factor() const {
+    return GetField<double>(VT_PRESCALE_FACTOR, 1.0);
+  }
+  double postscale_factor() const {
+    return GetField<double>(VT_POSTSCALE_FACTOR, 1.0);
+  }
+  int32_t group_id() const {
+    return GetField<int32_t>(VT_GROUP_ID, -1);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_REQUEST_RANK) &&
@@ -207,6 +267,12 @@ struct Request FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<int32_t>(verifier, VT_DEVICE) &&
            VerifyOffset(verifier, VT_TENSOR_SHAPE) &&
            verifier.VerifyVector(tensor_shape()) &&
+           VerifyOffset(verifier, VT_SPLITS) &&
+           verifier.VerifyVector(splits()) &&
+           VerifyField<int32_t>(verifier, VT_REDUCE_OP) &&
+           VerifyField<double>(verifier, VT_PRESCALE_FACTOR) &&
+           VerifyField<double>(verifier, VT_POSTSCALE_FACTOR) &&
+           VerifyField<int32_t>(verifier, VT_GROUP_ID) &&
            verifier.EndTable();
   }
 };
@@ -235,6 +301,21 @@ struct RequestBuilder {
   void add_tensor_shape(flatbuffers::Offset<flatbuffers::Vector<int64_t>> tensor_shape) {
     fbb_.AddOffset(Request::VT_TENSOR_SHAPE, tensor_shape);
   }
+  void add_splits(flatbuffers::Offset<flatbuffers::Vector<int64_t>> splits) {
+    fbb_.AddOffset(Request::VT_SPLITS, splits);
+  }
+  void add_reduce_op(int32_t reduce_op) {
+    fbb_.AddElement<int32_t>(Request::VT_REDUCE_OP, reduce_op, 0);
+  }
+  void add_prescale_factor(double prescale_factor) {
+    fbb_.AddElement<double>(Request::VT_PRESCALE_FACTOR, prescale_factor, 1.0);
+  }
+  void add_postscale_factor(double postscale_factor) {
+    fbb_.AddElement<double>(Request::VT_POSTSCALE_FACTOR, postscale_factor, 1.0);
+  }
+  void add_group_id(int32_t group_id) {
+    fbb_.AddElement<int32_t>(Request::VT_GROUP_ID, group_id, -1);
+  }
   explicit RequestBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -255,8 +336,18 @@ inline flatbuffers::Offset<Request> CreateRequest(
     flatbuffers::Offset<flatbuffers::String> tensor_name = 0,
     int32_t root_rank = 0,
     int32_t device = 0,
-    flatbuffers::Offset<flatbuffers::Vector<int64_t>> tensor_shape = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> tensor_shape = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> splits = 0,
+    int32_t reduce_op = 0,
+    double prescale_factor = 1.0,
+    double postscale_factor = 1.0,
+    int32_t group_id = -1) {
   RequestBuilder builder_(_fbb);
+  builder_.add_postscale_factor(postscale_factor);
+  builder_.add_prescale_factor(prescale_factor);
+  builder_.add_group_id(group_id);
+  builder_.add_reduce_op(reduce_op);
+  builder_.add_splits(splits);
   builder_.add_tensor_shape(tensor_shape);
   builder_.add_device(device);
   builder_.add_root_rank(root_rank);
@@ -275,9 +366,15 @@ inline flatbuffers::Offset<Request> CreateRequestDirect(
     const char *tensor_name = nullptr,
     int32_t root_rank = 0,
     int32_t device = 0,
-    const std::vector<int64_t> *tensor_shape = nullptr) {
+    const std::vector<int64_t> *tensor_shape = nullptr,
+    const std::vector<int64_t> *splits = nullptr,
+    int32_t reduce_op = 0,
+    double prescale_factor = 1.0,
+    double postscale_factor = 1.0,
+    int32_t group_id = -1) {
   auto tensor_name__ = tensor_name ? _fbb.CreateString(tensor_name) : 0;
   auto tensor_shape__ = tensor_shape ? _fbb.CreateVector<int64_t>(*tensor_shape) : 0;
+  auto splits__ = splits ? _fbb.CreateVector<int64_t>(*splits) : 0;
   return horovod::common::wire::CreateRequest(
       _fbb,
       request_rank,
@@ -286,7 +383,12 @@ inline flatbuffers::Offset<Request> CreateRequestDirect(
       tensor_name__,
       root_rank,
       device,
-      tensor_shape__);
+      tensor_shape__,
+      splits__,
+      reduce_op,
+      prescale_factor,
+      postscale_factor,
+      group_id);
 }
 
 struct RequestList FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -359,7 +461,10 @@ struct Response FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_ERROR_MESSAGE = 8,
     VT_DEVICES = 10,
     VT_TENSOR_SIZES = 12,
-    VT_TENSOR_TYPE = 14
+    VT_TENSOR_TYPE = 14,
+    VT_REDUCE_OP = 16,
+    VT_PRESCALE_FACTOR = 18,
+    VT_POSTSCALE_FACTOR = 20
   };
   ResponseType response_type() const {
     return static_cast<ResponseType>(GetField<int8_t>(VT_RESPONSE_TYPE, 0));
@@ -379,6 +484,15 @@ struct Response FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   DataType tensor_type() const {
     return static_cast<DataType>(GetField<int8_t>(VT_TENSOR_TYPE, 0));
   }
+  int32_t reduce_op() const {
+    return GetField<int32_t>(VT_REDUCE_OP, 0);
+  }
+  double prescale_factor() const {
+    return GetField<double>(VT_PRESCALE_FACTOR, 1.0);
+  }
+  double postscale_factor() const {
+    return GetField<double>(VT_POSTSCALE_FACTOR, 1.0);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_RESPONSE_TYPE) &&
@@ -392,6 +506,9 @@ struct Response FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_TENSOR_SIZES) &&
            verifier.VerifyVector(tensor_sizes()) &&
            VerifyField<int8_t>(verifier, VT_TENSOR_TYPE) &&
+           VerifyField<int32_t>(verifier, VT_REDUCE_OP) &&
+           VerifyField<double>(verifier, VT_PRESCALE_FACTOR) &&
+           VerifyField<double>(verifier, VT_POSTSCALE_FACTOR) &&
            verifier.EndTable();
   }
 };
@@ -417,6 +534,15 @@ struct ResponseBuilder {
   void add_tensor_type(DataType tensor_type) {
     fbb_.AddElement<int8_t>(Response::VT_TENSOR_TYPE, static_cast<int8_t>(tensor_type), 0);
   }
+  void add_reduce_op(int32_t reduce_op) {
+    fbb_.AddElement<int32_t>(Response::VT_REDUCE_OP, reduce_op, 0);
+  }
+  void add_prescale_factor(double prescale_factor) {
+    fbb_.AddElement<double>(Response::VT_PRESCALE_FACTOR, prescale_factor, 1.0);
+  }
+  void add_postscale_factor(double postscale_factor) {
+    fbb_.AddElement<double>(Response::VT_POSTSCALE_FACTOR, postscale_factor, 1.0);
+  }
   explicit ResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -436,8 +562,14 @@ inline flatbuffers::Offset<Response> CreateResponse(
     flatbuffers::Offset<flatbuffers::String> error_message = 0,
     flatbuffers::Offset<flatbuffers::Vector<int32_t>> devices = 0,
     flatbuffers::Offset<flatbuffers::Vector<int64_t>> tensor_sizes = 0,
-    DataType tensor_type = DataType_HOROVOD_UINT8) {
+    DataType tensor_type = DataType_HOROVOD_UINT8,
+    int32_t reduce_op = 0,
+    double prescale_factor = 1.0,
+    double postscale_factor = 1.0) {
   ResponseBuilder builder_(_fbb);
+  builder_.add_postscale_factor(postscale_factor);
+  builder_.add_prescale_factor(prescale_factor);
+  builder_.add_reduce_op(reduce_op);
   builder_.add_tensor_sizes(tensor_sizes);
   builder_.add_devices(devices);
   builder_.add_error_message(error_message);
@@ -454,7 +586,10 @@ inline flatbuffers::Offset<Response> CreateResponseDirect(
     const char *error_message = nullptr,
     const std::vector<int32_t> *devices = nullptr,
     const std::vector<int64_t> *tensor_sizes = nullptr,
-    DataType tensor_type = DataType_HOROVOD_UINT8) {
+    DataType tensor_type = DataType_HOROVOD_UINT8,
+    int32_t reduce_op = 0,
+    double prescale_factor = 1.0,
+    double postscale_factor = 1.0) {
   auto tensor_names__ = tensor_names ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*tensor_names) : 0;
   auto error_message__ = error_message ? _fbb.CreateString(error_message) : 0;
   auto devices__ = devices ? _fbb.CreateVector<int32_t>(*devices) : 0;
@@ -466,7 +601,10 @@ inline flatbuffers::Offset<Response> CreateResponseDirect(
       error_message__,
       devices__,
       tensor_sizes__,
-      tensor_type);
+      tensor_type,
+      reduce_op,
+      prescale_factor,
+      postscale_factor);
 }
 
 struct ResponseList FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
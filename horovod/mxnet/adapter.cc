@@ -125,6 +125,16 @@ Status MXOpContext<T>::AllocateOutput(TensorShape shape,
   return Status::OK();
 }
 
+template <class T>
+Status MXOpContext<T>::AllocateOutput(int output_index, TensorShape shape,
+                                      std::shared_ptr<Tensor>* tensor) {
+  if (output_index != 0) {
+    return Status::PreconditionError(
+        "Multiple outputs are not supported for MXNet yet.");
+  }
+  return AllocateOutput(shape, tensor);
+}
+
 template <class T>
 Status
 MXOpContext<T>::AllocateZeros(int64_t num_elements, DataType dtype,
@@ -268,7 +268,9 @@ def gloo_run(settings, remote_host_names, common_intfs, env, server_ip, command)
     # Start rendezvous server and get port that it is listening
     global_rendezv_port = global_rendezv.start_server(host_alloc_plan)
 
-    iface = list(common_intfs)[0]
+    # Interfaces listed in HOROVOD_GLOO_IFACE are used as given, so that large
+    # allreduces can be striped across several of them.
+    iface = env.get('HOROVOD_GLOO_IFACE', list(common_intfs)[0])
 
     run_command = (
         'HOROVOD_GLOO_RENDEZVOUS_ADDR={addr} '
@@ -280,7 +282,7 @@ def gloo_run(settings, remote_host_names, common_intfs, env, server_ip, command)
         '{command}'  # expect a lot of environment variables
         .format(addr=server_ip,
                 port=global_rendezv_port,
-                iface=iface,  # TODO: add multiple ifaces in future
+                iface=iface,
                 common_intfs=','.join(common_intfs),
                 command=' '.join(quote(par) for par in command)))
 
@@ -14,10 +14,12 @@
 # =============================================================================
 import collections
 
-from six.moves import BaseHTTPServer, SimpleHTTPServer
+from six.moves import BaseHTTPServer, SimpleHTTPServer, socketserver
+from six.moves.urllib.parse import parse_qs
 from horovod.run.util.network import find_port
 import threading
 import socket
+import time
 
 # Timeout for reading from a single request
 SINGLE_REQUEST_TIMEOUT = 3
@@ -25,6 +27,9 @@ SINGLE_REQUEST_TIMEOUT = 3
 # Timeout for accepting new request
 TOTAL_TIMEOUT = 60
 
+# Longest time a batched GET waits for its keys
+MAX_WAIT_TIMEOUT = 60
+
 BAD_REQUEST = 400
 TIMEOUT = 408
 OK = 200
@@ -88,9 +93,63 @@ class KVStoreHandler(SimpleHTTPServer.SimpleHTTPRequestHandler):
             scope_dict[key] = value
             if self.server.verbose:
                 print(scope, self.server.cache[scope].keys())
+            self.server.cache_cond.notify_all()
 
         self.send_status_code(OK)
 
+    # Override POST handler, a batched GET of the newline-separated keys in
+    # the body. The request waits up to wait_ms milliseconds for all keys to
+    # exist, then returns a "<key>\n<length>\n<value>" record for every key
+    # found.
+    def do_POST(self):
+        path, _, query = self.path.partition('?')
+        paths = path.split('/')
+        if len(paths) != 3 or paths[2]:
+            print(
+                'KVStore ERROR: Invalid request path: {path}.'.format(
+                    path=self.path))
+            self.send_status_code(BAD_REQUEST)
+            return
+
+        scope = paths[1]
+        try:
+            wait_ms = int(parse_qs(query).get('wait_ms', ['0'])[0])
+        except ValueError:
+            self.send_status_code(BAD_REQUEST)
+            return
+
+        content_length = int(self.headers['Content-Length'])
+        try:
+            body = self.rfile.read(content_length)
+        except socket.timeout:
+            if self.server.verbose:
+                print(
+                    'KVStore ERROR: Timeout when receiving {content_bytes} '
+                    'bytes, aborting this incomplete request.' .format(
+                        content_bytes=content_length))
+            self.send_status_code(TIMEOUT)
+            return
+
+        keys = [key for key in body.decode('utf-8').split('\n') if key]
+        deadline = time.time() + min(wait_ms / 1000.0, MAX_WAIT_TIMEOUT)
+        with self.server.cache_lock:
+            while True:
+                scope_dict = self.server.cache.get(scope, {})
+                found = [(key, scope_dict[key]) for key in keys
+                         if key in scope_dict]
+                remaining = deadline - time.time()
+                if len(found) == len(keys) or remaining <= 0:
+                    break
+                self.server.cache_cond.wait(remaining)
+
+        value = b''.join(
+            key.encode('utf-8') + b'\n' + str(len(data)).encode('utf-8') +
+            b'\n' + data for key, data in found)
+        self.send_response(OK)
+        self.send_header("Content-Length", str(len(value)))
+        self.end_headers()
+        self.wfile.write(value)
+
     def send_status_code(self, status_code):
         self.send_response(status_code)
         self.send_header("Content-Length", 0)
@@ -120,8 +179,18 @@ class RendezvousHandler(KVStoreHandler):
 
         self.send_status_code(OK)
 
+        # Requests are handled by their own threads, so the last one to
+        # finish stops the listening loop.
+        if not self.server.should_continue():
+            self.server.shutdown()
+
+
+# Requests are served by their own threads, so that batched GETs waiting for
+# keys do not hold up the PUTs that create them.
+class RendezvousHTTPServer(socketserver.ThreadingMixIn,
+                           BaseHTTPServer.HTTPServer, object):
+    daemon_threads = True
 
-class RendezvousHTTPServer(BaseHTTPServer.HTTPServer, object):
     def __init__(self, addr, handler, verbose):
         # This class has to inherit from object since HTTPServer is an old-style
         # class that does not inherit from object.
@@ -136,6 +205,7 @@ class RendezvousHTTPServer(BaseHTTPServer.HTTPServer, object):
 
         # Cache that provides the store
         self.cache_lock = threading.Lock()
+        self.cache_cond = threading.Condition(self.cache_lock)
         self.cache = {}
 
         self.verbose = verbose
@@ -198,8 +268,8 @@ class RendezvousServer:
 
     # Listening loop for handle request
     def listen_loop(self):
-        while self.httpd.should_continue():
-            self.httpd.handle_request()
+        if self.httpd.should_continue():
+            self.httpd.serve_forever()
 
         self.httpd.server_close()
 
@@ -208,12 +278,16 @@ class RendezvousServer:
         # Because this thread is daemonized, no need to join.
 
 
-class KVStoreHTTPServer(BaseHTTPServer.HTTPServer, object):
+class KVStoreHTTPServer(socketserver.ThreadingMixIn,
+                        BaseHTTPServer.HTTPServer, object):
+    daemon_threads = True
+
     def __init__(self, addr, handler, verbose):
         super(KVStoreHTTPServer, self).__init__(addr, handler)
 
         # Cache that provides the store
         self.cache_lock = threading.Lock()
+        self.cache_cond = threading.Condition(self.cache_lock)
         self.cache = {}
 
         self.verbose = verbose
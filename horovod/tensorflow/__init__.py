@@ -25,13 +25,16 @@ from horovod.common.util import check_extension, gpu_available
 check_extension('horovod.tensorflow', 'HOROVOD_WITH_TENSORFLOW', __file__, 'mpi_lib')
 
 from horovod.tensorflow.compression import Compression
-from horovod.tensorflow.mpi_ops import allgather, broadcast, _allreduce
+from horovod.tensorflow.mpi_ops import allgather, broadcast, reducescatter, alltoall, _allreduce
+from horovod.tensorflow.mpi_ops import _grouped_allreduce
+from horovod.tensorflow.mpi_ops import sparse_allreduce, reduce, gather, scatter
 from horovod.tensorflow.mpi_ops import init, shutdown
+from horovod.tensorflow.mpi_ops import add_process_set, process_set_rank, process_set_size
 from horovod.tensorflow.mpi_ops import size, local_size, rank, local_rank, is_homogeneous
 from horovod.tensorflow.mpi_ops import mpi_threads_supported, mpi_enabled, mpi_built
 from horovod.tensorflow.mpi_ops import gloo_enabled, gloo_built
 from horovod.tensorflow.mpi_ops import nccl_built, ddl_built, mlsl_built
-from horovod.tensorflow.mpi_ops import Average, Sum, Adasum
+from horovod.tensorflow.mpi_ops import Average, Sum, Adasum, Min, Max, Product
 from horovod.tensorflow.mpi_ops import _check_has_gpu
 from horovod.tensorflow.mpi_ops import handle_average_backwards_compatibility, check_num_rank_power_of_2
 
@@ -42,13 +45,15 @@ import warnings
 
 has_gpu = gpu_available('tensorflow')
 def allreduce(tensor, average=None, device_dense='', device_sparse='',
-              compression=Compression.none, op=None):
+              compression=Compression.none, op=None,
+              prescale_factor=1.0, postscale_factor=1.0, process_set=0):
     """Perform an allreduce on a tf.Tensor or tf.IndexedSlices.
 
     This function performs a bandwidth-optimal ring allreduce on the input
-    tensor. If the input is an tf.IndexedSlices, the function instead does an
-    allgather on the values and the indices, effectively doing an allreduce on
-    the represented tensor.
+    tensor. If the input is an tf.IndexedSlices, the function instead does a
+    sparse allreduce of the values and the indices on the host, which sums up
+    rows with the same index, or an allgather of them if device_sparse is a GPU,
+    effectively doing an allreduce on the represented tensor.
 
     Arguments:
         tensor: tf.Tensor, tf.Variable, or tf.IndexedSlices to reduce.
@@ -63,6 +68,12 @@ def allreduce(tensor, average=None, device_dense='', device_sparse='',
                      using compression.
         op: The reduction operation to combine tensors across different ranks.
             Defaults to Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensor before allreduce.
+        postscale_factor: Multiplicative factor to scale tensor after allreduce.
+        process_set: ID of a process set returned by add_process_set() to
+                     reduce over only its processes. Defaults to all processes.
+                     Only dense tensors and the Sum, Average, Min, Max and
+                     Product reductions support process sets.
 
     Returns:
         A tensor of the same shape and type as `tensor`, summed across all
@@ -72,14 +83,42 @@ def allreduce(tensor, average=None, device_dense='', device_sparse='',
     # Averaging happens in framework code, so translate that to Sum for the actual call
     true_op = Sum if op == Average else op
 
+    if process_set != 0:
+        if isinstance(tensor, tf.IndexedSlices):
+            raise NotImplementedError("Process sets do not support sparse "
+                "tensors.")
+        if op == Adasum:
+            raise NotImplementedError("The Adasum reduction does not support "
+                "process sets.")
+
     if isinstance(tensor, tf.IndexedSlices):
         # TODO: Need to fix this to actuall call Adasum
         if op == Adasum:
             raise NotImplementedError("The Adasum reduction does not currently support "
                 "sparse tensors. As a workaround please pass sparse_as_dense=True to "
                 "DistributedOptimizer")
+        if op in (Min, Max, Product):
+            raise NotImplementedError("The Min, Max and Product reductions do not "
+                "support sparse tensors.")
+        if prescale_factor != 1.0 or postscale_factor != 1.0:
+            raise NotImplementedError("Pre- and postscaling is not supported "
+                "for sparse tensors.")
+        if 'GPU' not in device_sparse.upper():
+            # Sum up rows with the same index in a single exchange of indices
+            # and values.
+            dense_rows = None
+            if tensor.dense_shape is not None:
+                dense_rows = tensor.dense_shape[0]
+            values, indices = sparse_allreduce(tensor.values, tensor.indices,
+                                               dense_rows=dense_rows)
+            indices = tf.cast(indices, tensor.indices.dtype)
+            horovod_size = tf.cast(size(), values.dtype)
+            new_values = (values / horovod_size) if op == Average else values
+            return tf.IndexedSlices(new_values, indices,
+                                    dense_shape=tensor.dense_shape)
         with tf.device(device_sparse):
-            # For IndexedSlices, do two allgathers instead of an allreduce.
+            # For IndexedSlices on GPU, do two allgathers instead of an
+            # allreduce.
             horovod_size = tf.cast(size(), tensor.values.dtype)
             values = allgather(tensor.values)
             indices = allgather(tensor.indices)
@@ -91,10 +130,23 @@ def allreduce(tensor, average=None, device_dense='', device_sparse='',
                                 dense_shape=tensor.dense_shape)
     else:
         with tf.device(device_dense):
-            horovod_size = tf.cast(size(), dtype=tensor.dtype)
+            horovod_size = tf.cast(process_set_size(process_set),
+                                   dtype=tensor.dtype)
+            if 'CPU' not in tensor.device and has_gpu:
+                # The core only scales CPU tensors, GPU tensors are scaled here.
+                if prescale_factor != 1.0:
+                    tensor = tensor * tf.cast(prescale_factor, tensor.dtype)
+                core_prescale, core_postscale = 1.0, 1.0
+            else:
+                core_prescale, core_postscale = prescale_factor, postscale_factor
             tensor_compressed, ctx = compression.compress(tensor)
-            summed_tensor_compressed = _allreduce(tensor_compressed, op=true_op)
+            summed_tensor_compressed = _allreduce(tensor_compressed, op=true_op,
+                                                  prescale_factor=core_prescale,
+                                                  postscale_factor=core_postscale,
+                                                  process_set=process_set)
             summed_tensor = compression.decompress(summed_tensor_compressed, ctx)
+            if core_postscale != postscale_factor:
+                summed_tensor = summed_tensor * tf.cast(postscale_factor, summed_tensor.dtype)
             if op == Adasum:
                 if ('CPU' not in tensor.device and has_gpu):
                     if nccl_built():
@@ -118,6 +170,67 @@ def allreduce(tensor, average=None, device_dense='', device_sparse='',
         return new_tensor
 
 
+def grouped_allreduce(tensors, average=None, device_dense='', compression=Compression.none,
+                      op=None, prescale_factor=1.0, postscale_factor=1.0):
+    """Perform an allreduce on a list of tf.Tensors, negotiated as a group.
+
+    None of the tensors is reduced before all of them are ready on all ranks,
+    and they are fused together, the same way every step. All ranks must
+    reduce the same groups in the same order.
+
+    Arguments:
+        tensors: List of tf.Tensor or tf.Variable to reduce, all of the same
+                 type. The shapes of the inputs must be identical across all
+                 ranks.
+        average: DEPRECATED, please use op instead.
+        device_dense: Device to be used for the tensors. Uses GPU by default
+                      if Horovod was built with HOROVOD_GPU_ALLREDUCE.
+        compression: Compression algorithm used to reduce the amount of data
+                     sent and received by each worker node.  Defaults to not
+                     using compression.
+        op: The reduction operation to combine tensors across different ranks.
+            Defaults to Average if None is given. Adasum is not supported.
+        prescale_factor: Multiplicative factor to scale tensors before allreduce.
+        postscale_factor: Multiplicative factor to scale tensors after allreduce.
+
+    Returns:
+        A list of tensors of the same shapes and type as `tensors`, summed
+        across all processes.
+    """
+    op = handle_average_backwards_compatibility(op, average)
+    if op == Adasum:
+        raise NotImplementedError("The Adasum reduction does not support "
+            "grouped allreduce.")
+    # Averaging happens in framework code, so translate that to Sum for the actual call
+    true_op = Sum if op == Average else op
+
+    with tf.device(device_dense):
+        tensors = [tf.convert_to_tensor(tensor) for tensor in tensors]
+        if 'CPU' not in tensors[0].device and has_gpu:
+            # The core only scales CPU tensors, GPU tensors are scaled here.
+            if prescale_factor != 1.0:
+                tensors = [tensor * tf.cast(prescale_factor, tensor.dtype)
+                           for tensor in tensors]
+            core_prescale, core_postscale = 1.0, 1.0
+        else:
+            core_prescale, core_postscale = prescale_factor, postscale_factor
+        tensors_compressed, ctxs = zip(*[compression.compress(tensor)
+                                         for tensor in tensors])
+        summed_tensors_compressed = _grouped_allreduce(list(tensors_compressed),
+                                                       op=true_op,
+                                                       prescale_factor=core_prescale,
+                                                       postscale_factor=core_postscale)
+        new_tensors = []
+        for summed_tensor_compressed, ctx in zip(summed_tensors_compressed, ctxs):
+            summed_tensor = compression.decompress(summed_tensor_compressed, ctx)
+            if core_postscale != postscale_factor:
+                summed_tensor = summed_tensor * tf.cast(postscale_factor, summed_tensor.dtype)
+            if op == Average:
+                summed_tensor = summed_tensor / tf.cast(size(), dtype=summed_tensor.dtype)
+            new_tensors.append(summed_tensor)
+        return new_tensors
+
+
 @_cache
 def _make_broadcast_group_fn():
     if _executing_eagerly():
@@ -15,6 +15,7 @@
 // limitations under the License.
 // =============================================================================
 
+#include <atomic>
 #include <memory>
 #include <queue>
 #include <thread>
@@ -117,6 +118,9 @@ public:
   AllocateOutput(common::TensorShape shape,
                  std::shared_ptr<common::Tensor>* tensor) override;
   virtual common::Status
+  AllocateOutput(int output_index, common::TensorShape shape,
+                 std::shared_ptr<common::Tensor>* tensor) override;
+  virtual common::Status
   AllocateZeros(int64_t num_elements, common::DataType dtype,
                 std::shared_ptr<common::Tensor>* tensor) override;
   virtual common::Framework framework() const override;
@@ -228,12 +232,18 @@ common::Status TFOpContext::AllocatePersistent(
 common::Status
 TFOpContext::AllocateOutput(common::TensorShape shape,
                             std::shared_ptr<common::Tensor>* tensor) {
+  return AllocateOutput(0, shape, tensor);
+}
+
+common::Status
+TFOpContext::AllocateOutput(int output_index, common::TensorShape shape,
+                            std::shared_ptr<common::Tensor>* tensor) {
   TensorShape tf_shape;
   for (int idx = 0; idx < shape.dims(); ++idx) {
     tf_shape.AddDim(shape.dim_size(idx));
   }
   Tensor* tf_tensor;
-  Status status = context_->allocate_output(0, tf_shape, &tf_tensor);
+  Status status = context_->allocate_output(output_index, tf_shape, &tf_tensor);
   if (status.ok()) {
     *tensor = std::make_shared<TFTensor>(*tf_tensor);
   }
@@ -289,6 +299,9 @@ public:
   explicit HorovodAllreduceOp(OpKernelConstruction* context)
       : AsyncOpKernel(context) {
     OP_REQUIRES_OK(context, context->GetAttr("reduce_op", &reduce_op_));
+    OP_REQUIRES_OK(context, context->GetAttr("prescale_factor", &prescale_factor_));
+    OP_REQUIRES_OK(context, context->GetAttr("postscale_factor", &postscale_factor_));
+    OP_REQUIRES_OK(context, context->GetAttr("process_set", &process_set_));
   }
 
   void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
@@ -312,12 +325,16 @@ public:
         [context, done](const common::Status& status) {
           context->SetStatus(ConvertStatus(status));
           done();
-        }, reduce_op);
+        }, reduce_op, (double) prescale_factor_, (double) postscale_factor_,
+        process_set_);
     OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
   }
 
 private:
   int reduce_op_;
+  float prescale_factor_;
+  float postscale_factor_;
+  int process_set_;
 };
 
 REGISTER_KERNEL_BUILDER(Name("HorovodAllreduce").Device(DEVICE_CPU),
@@ -328,8 +345,11 @@ REGISTER_KERNEL_BUILDER(Name("HorovodAllreduce").Device(DEVICE_GPU),
 #endif
 
 REGISTER_OP("HorovodAllreduce")
-    .Attr("T: {int32, int64, float16, float32, float64}")
+    .Attr("T: {int32, int64, float16, float32, float64, bool}")
     .Attr("reduce_op: int")
+    .Attr("prescale_factor: float = 1.0")
+    .Attr("postscale_factor: float = 1.0")
+    .Attr("process_set: int = 0")
     .Input("tensor: T")
     .Output("sum: T")
     .SetShapeFn([](shape_inference::InferenceContext* c) {
@@ -344,15 +364,124 @@ allreduce.
 
 Arguments
     tensor:     A tensor to reduce.
+    reduce_op:  The reduction operation, one of SUM, MIN, MAX, PRODUCT or ADASUM.
+    prescale_factor:  Factor the tensor is multiplied by before the reduction.
+    postscale_factor: Factor the result is multiplied by after the reduction.
+    process_set: ID of the process set to reduce over, 0 for all processes.
 
 Output
     sum:    A tensor with the same shape as `tensor`, summed across all MPI processes.
 )doc");
 
+class HorovodGroupedAllreduceOp : public AsyncOpKernel {
+public:
+  explicit HorovodGroupedAllreduceOp(OpKernelConstruction* context)
+      : AsyncOpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("reduce_op", &reduce_op_));
+    OP_REQUIRES_OK(context, context->GetAttr("prescale_factor", &prescale_factor_));
+    OP_REQUIRES_OK(context, context->GetAttr("postscale_factor", &postscale_factor_));
+  }
+
+  void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(common::CheckInitialized()),
+                         done);
+
+    auto node_name = name();
+    auto device = GetDeviceID(context);
+    auto num_tensors = context->num_inputs();
+    horovod::common::ReduceOp reduce_op = static_cast<horovod::common::ReduceOp>(reduce_op_);
+
+    std::vector<std::shared_ptr<common::OpContext>> hvd_contexts;
+    std::vector<std::shared_ptr<common::Tensor>> hvd_tensors;
+    std::vector<std::shared_ptr<common::Tensor>> hvd_outputs;
+    std::vector<std::shared_ptr<common::ReadyEvent>> ready_events;
+    std::vector<std::string> names;
+    std::vector<common::StatusCallback> callbacks;
+
+    // The kernel is done once all tensors of the group are done.
+    auto remaining = std::make_shared<std::atomic_int>(num_tensors);
+    auto hvd_context = std::make_shared<TFOpContext>(context);
+    for (int i = 0; i < num_tensors; ++i) {
+      auto tensor = context->input(i);
+      Tensor* output;
+      OP_REQUIRES_OK_ASYNC(
+          context, context->allocate_output(i, tensor.shape(), &output), done);
+      hvd_contexts.push_back(hvd_context);
+      hvd_tensors.push_back(std::make_shared<TFTensor>(tensor));
+      hvd_outputs.push_back(std::make_shared<TFTensor>(*output));
+      names.push_back(node_name + "_" + std::to_string(i + 1) + "of" +
+                      std::to_string(num_tensors));
+      callbacks.push_back(
+          [context, done, remaining](const common::Status& status) {
+            context->SetStatus(ConvertStatus(status));
+            if (--*remaining == 0) {
+              done();
+            }
+          });
+    }
+    // ReadyEvent makes sure input tensors are ready, and outputs are
+    // allocated.
+    auto ready_event =
+        std::shared_ptr<common::ReadyEvent>(RecordReadyEvent(context));
+    ready_events.assign(num_tensors, ready_event);
+
+    auto enqueue_result = EnqueueTensorAllreduces(
+        hvd_contexts, hvd_tensors, hvd_outputs, ready_events, names, device,
+        callbacks, reduce_op, (double) prescale_factor_,
+        (double) postscale_factor_);
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
+  }
+
+private:
+  int reduce_op_;
+  float prescale_factor_;
+  float postscale_factor_;
+};
+
+REGISTER_KERNEL_BUILDER(Name("HorovodGroupedAllreduce").Device(DEVICE_CPU),
+                        HorovodGroupedAllreduceOp);
+#if HOROVOD_GPU_ALLREDUCE
+REGISTER_KERNEL_BUILDER(Name("HorovodGroupedAllreduce").Device(DEVICE_GPU),
+                        HorovodGroupedAllreduceOp);
+#endif
+
+REGISTER_OP("HorovodGroupedAllreduce")
+    .Attr("T: {int32, int64, float16, float32, float64}")
+    .Attr("num_tensors: int >= 1")
+    .Attr("reduce_op: int")
+    .Attr("prescale_factor: float = 1.0")
+    .Attr("postscale_factor: float = 1.0")
+    .Input("tensors: num_tensors * T")
+    .Output("sum: num_tensors * T")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      for (int i = 0; i < c->num_inputs(); ++i) {
+        c->set_output(i, c->input(i));
+      }
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Perform an MPI Allreduce on a group of tensors. The tensors are negotiated as
+a unit, none of them is reduced before all of them are ready on all processes,
+and they are only fused with each other. All processes must run the same
+groups in the same order.
+
+Arguments
+    tensors:    Tensors to reduce.
+    reduce_op:  The reduction operation, one of SUM, MIN, MAX, PRODUCT or ADASUM.
+    prescale_factor:  Factor the tensors are multiplied by before the reduction.
+    postscale_factor: Factor the results are multiplied by after the reduction.
+
+Output
+    sum:    Tensors with the same shapes as `tensors`, summed across all MPI
+            processes.
+)doc");
+
 class HorovodAllgatherOp : public AsyncOpKernel {
 public:
   explicit HorovodAllgatherOp(OpKernelConstruction* context)
-      : AsyncOpKernel(context) {}
+      : AsyncOpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("process_set", &process_set_));
+  }
 
   void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
     OP_REQUIRES_OK_ASYNC(context, ConvertStatus(common::CheckInitialized()),
@@ -372,10 +501,13 @@ public:
         [context, done](const common::Status& status) {
           context->SetStatus(ConvertStatus(status));
           done();
-        });
+        }, process_set_);
     OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
   }
-}; // namespace tensorflow
+
+private:
+  int process_set_;
+};
 
 REGISTER_KERNEL_BUILDER(Name("HorovodAllgather").Device(DEVICE_CPU),
                         HorovodAllgatherOp);
@@ -387,6 +519,7 @@ REGISTER_KERNEL_BUILDER(Name("HorovodAllgather").Device(DEVICE_GPU),
 REGISTER_OP("HorovodAllgather")
     .Attr(
         "T: {uint8, int8, uint16, int16, int32, int64, float16, float32, float64, bool}")
+    .Attr("process_set: int = 0")
     .Input("tensor: T")
     .Output("output: T")
     .SetShapeFn([](shape_inference::InferenceContext* c) {
@@ -403,6 +536,7 @@ same dimension on all but the first dimension.
 
 Arguments
     tensor:     A tensor to gather.
+    process_set: ID of the process set to gather from, 0 for all processes.
 
 Output
     gathered:    A tensor with the same shape as `tensor` except for the first dimension.
@@ -413,6 +547,7 @@ public:
   explicit HorovodBroadcastOp(OpKernelConstruction* context)
       : AsyncOpKernel(context) {
     OP_REQUIRES_OK(context, context->GetAttr("root_rank", &root_rank_));
+    OP_REQUIRES_OK(context, context->GetAttr("process_set", &process_set_));
   }
 
   void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
@@ -423,7 +558,8 @@ public:
     auto device = GetDeviceID(context);
     auto tensor = context->input(0);
     Tensor* output = nullptr;
-    if (common::horovod_rank() == root_rank_) {
+    // The root rank is a rank within the process set.
+    if (common::horovod_process_set_rank(process_set_) == root_rank_) {
       context->set_output(0, tensor);
     } else {
       OP_REQUIRES_OK_ASYNC(
@@ -442,12 +578,13 @@ public:
         device, [context, done](const common::Status& status) {
           context->SetStatus(ConvertStatus(status));
           done();
-        });
+        }, process_set_);
     OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
   }
 
 private:
   int root_rank_;
+  int process_set_;
 };
 
 REGISTER_KERNEL_BUILDER(Name("HorovodBroadcast").Device(DEVICE_CPU),
@@ -461,6 +598,7 @@ REGISTER_OP("HorovodBroadcast")
     .Attr(
         "T: {uint8, int8, uint16, int16, int32, int64, float16, float32, float64, bool}")
     .Attr("root_rank: int")
+    .Attr("process_set: int = 0")
     .Input("tensor: T")
     .Output("output: T")
     .SetShapeFn([](shape_inference::InferenceContext* c) {
@@ -474,11 +612,401 @@ on a tensor with the same name must have the same dimension for that tensor.
 Arguments
     tensor:     A tensor to broadcast.
     root_rank:  Rank that will send data, other ranks will receive data.
+    process_set: ID of the process set to broadcast within, 0 for all
+                 processes. The root rank is a rank within the process set.
 
 Output
     output:    A tensor with the same shape as `tensor` and same value as
                `tensor` on root rank.
 )doc");
 
+class HorovodReducescatterOp : public AsyncOpKernel {
+public:
+  explicit HorovodReducescatterOp(OpKernelConstruction* context)
+      : AsyncOpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("reduce_op", &reduce_op_));
+  }
+
+  void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(common::CheckInitialized()),
+                         done);
+
+    auto node_name = name();
+    auto device = GetDeviceID(context);
+    auto tensor = context->input(0);
+    horovod::common::ReduceOp reduce_op = static_cast<horovod::common::ReduceOp>(reduce_op_);
+    // The output is allocated once the slice of this rank is known.
+    auto ready_event = std::shared_ptr<common::ReadyEvent>(RecordReadyEvent(context));
+    auto hvd_context = std::make_shared<TFOpContext>(context);
+    auto hvd_tensor = std::make_shared<TFTensor>(tensor);
+    auto enqueue_result = EnqueueTensorReducescatter(
+        hvd_context, hvd_tensor, ready_event, node_name, device,
+        [context, done](const common::Status& status) {
+          context->SetStatus(ConvertStatus(status));
+          done();
+        }, reduce_op);
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
+  }
+
+private:
+  int reduce_op_;
+};
+
+REGISTER_KERNEL_BUILDER(Name("HorovodReducescatter").Device(DEVICE_CPU),
+                        HorovodReducescatterOp);
+
+REGISTER_OP("HorovodReducescatter")
+    .Attr("T: {uint8, int8, uint16, int16, int32, int64, float16, float32, float64}")
+    .Attr("reduce_op: int")
+    .Input("tensor: T")
+    .Output("output: T")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      shape_inference::ShapeHandle output;
+      TF_RETURN_IF_ERROR(
+          c->ReplaceDim(c->input(0), 0, c->UnknownDim(), &output));
+      c->set_output(0, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Perform an MPI Reduce_scatter on a tensor. All other processes that do a
+reducescatter on a tensor with the same name must have the same shape for that
+tensor. The reduced tensor is split along the first dimension, with lower ranks
+receiving one extra row if it does not divide evenly.
+
+Arguments
+    tensor:     A tensor to reduce and scatter.
+    reduce_op:  The reduction operation, one of SUM, MIN, MAX or PRODUCT.
+
+Output
+    output:    The slice of the reduced tensor assigned to this process.
+)doc");
+
+class HorovodAlltoallOp : public AsyncOpKernel {
+public:
+  explicit HorovodAlltoallOp(OpKernelConstruction* context)
+      : AsyncOpKernel(context) {}
+
+  void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(common::CheckInitialized()),
+                         done);
+
+    auto node_name = name();
+    auto device = GetDeviceID(context);
+    auto tensor = context->input(0);
+    auto splits_tensor = context->input(1);
+    OP_REQUIRES_ASYNC(context, TensorShapeUtils::IsVector(splits_tensor.shape()),
+                      errors::InvalidArgument("splits must be a vector."),
+                      done);
+    auto splits_flat = splits_tensor.vec<int32>();
+    std::vector<int64_t> splits(splits_flat.data(),
+                                splits_flat.data() + splits_flat.size());
+    // The output is allocated once the rows sent by every rank are known.
+    auto ready_event = std::shared_ptr<common::ReadyEvent>(RecordReadyEvent(context));
+    auto hvd_context = std::make_shared<TFOpContext>(context);
+    auto hvd_tensor = std::make_shared<TFTensor>(tensor);
+    auto enqueue_result = EnqueueTensorAlltoall(
+        hvd_context, hvd_tensor, splits, ready_event, node_name, device,
+        [context, done](const common::Status& status) {
+          context->SetStatus(ConvertStatus(status));
+          done();
+        });
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
+  }
+};
+
+REGISTER_KERNEL_BUILDER(Name("HorovodAlltoall").Device(DEVICE_CPU),
+                        HorovodAlltoallOp);
+
+REGISTER_OP("HorovodAlltoall")
+    .Attr(
+        "T: {uint8, int8, uint16, int16, int32, int64, float16, float32, float64, bool}")
+    .Input("tensor: T")
+    .Input("splits: int32")
+    .Output("output: T")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      shape_inference::ShapeHandle output;
+      TF_RETURN_IF_ERROR(
+          c->ReplaceDim(c->input(0), 0, c->UnknownDim(), &output));
+      c->set_output(0, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Perform an MPI Alltoallv on a tensor. All other processes that do an alltoall
+on a tensor with the same name must have the same rank for that tensor, and
+have the same dimension on all but the first dimension.
+
+Arguments
+    tensor:     A tensor to distribute.
+    splits:     Number of rows of `tensor` to send to every process.
+
+Output
+    output:    The rows received from all processes, concatenated in rank order.
+)doc");
+
+class HorovodSparseAllreduceOp : public AsyncOpKernel {
+public:
+  explicit HorovodSparseAllreduceOp(OpKernelConstruction* context)
+      : AsyncOpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("deduplicate", &deduplicate_));
+  }
+
+  void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(common::CheckInitialized()),
+                         done);
+
+    auto node_name = name();
+    auto device = GetDeviceID(context);
+    auto values = context->input(0);
+    auto indices = context->input(1);
+    auto dense_rows_tensor = context->input(2);
+    OP_REQUIRES_ASYNC(
+        context, TensorShapeUtils::IsScalar(dense_rows_tensor.shape()),
+        errors::InvalidArgument("dense_rows must be a scalar."), done);
+    int64_t dense_rows = dense_rows_tensor.scalar<int64>()();
+    // Both outputs are allocated once the indices of every rank are known.
+    auto ready_event = std::shared_ptr<common::ReadyEvent>(RecordReadyEvent(context));
+    auto hvd_context = std::make_shared<TFOpContext>(context);
+    auto hvd_values = std::make_shared<TFTensor>(values);
+    auto hvd_indices = std::make_shared<TFTensor>(indices);
+    auto enqueue_result = EnqueueTensorSparseAllreduce(
+        hvd_context, hvd_indices, hvd_values, dense_rows, deduplicate_,
+        ready_event, node_name, device,
+        [context, done](const common::Status& status) {
+          context->SetStatus(ConvertStatus(status));
+          done();
+        });
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
+  }
+
+private:
+  bool deduplicate_;
+};
+
+REGISTER_KERNEL_BUILDER(Name("HorovodSparseAllreduce")
+                            .Device(DEVICE_CPU)
+                            .HostMemory("dense_rows"),
+                        HorovodSparseAllreduceOp);
+
+REGISTER_OP("HorovodSparseAllreduce")
+    .Attr("T: {uint8, int8, uint16, int16, int32, int64, float16, float32, float64}")
+    .Attr("deduplicate: bool = true")
+    .Input("values: T")
+    .Input("indices: int64")
+    .Input("dense_rows: int64")
+    .Output("output_values: T")
+    .Output("output_indices: int64")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      shape_inference::ShapeHandle output;
+      TF_RETURN_IF_ERROR(
+          c->ReplaceDim(c->input(0), 0, c->UnknownDim(), &output));
+      c->set_output(0, output);
+      c->set_output(1, c->Vector(c->UnknownDim()));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Perform a sparse allreduce on the rows of a tensor given by their indices, as
+in an IndexedSlices. The indices and values of all processes are gathered in a
+single exchange. If the gathered rows exceed the density threshold, a dense
+allreduce of all `dense_rows` rows is performed instead.
+
+Arguments
+    values:      The rows to reduce.
+    indices:     The row index of every row in `values`.
+    dense_rows:  Number of rows of the dense tensor, or 0 if it is unknown.
+    deduplicate: Whether rows with the same index are summed up.
+
+Output
+    output_values:  The summed rows of all processes.
+    output_indices: The row index of every row in `output_values`.
+)doc");
+
+class HorovodReduceOp : public AsyncOpKernel {
+public:
+  explicit HorovodReduceOp(OpKernelConstruction* context)
+      : AsyncOpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("reduce_op", &reduce_op_));
+    OP_REQUIRES_OK(context, context->GetAttr("root_rank", &root_rank_));
+  }
+
+  void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(common::CheckInitialized()),
+                         done);
+
+    auto node_name = name();
+    auto device = GetDeviceID(context);
+    auto tensor = context->input(0);
+    horovod::common::ReduceOp reduce_op = static_cast<horovod::common::ReduceOp>(reduce_op_);
+    Tensor* output;
+    OP_REQUIRES_OK_ASYNC(
+        context, context->allocate_output(0, tensor.shape(), &output), done);
+    // ReadyEvent makes sure input tensor is ready, and output is allocated.
+    auto ready_event = std::shared_ptr<common::ReadyEvent>(RecordReadyEvent(context));
+    auto hvd_context = std::make_shared<TFOpContext>(context);
+    auto hvd_tensor = std::make_shared<TFTensor>(tensor);
+    auto hvd_output = std::make_shared<TFTensor>(*output);
+    auto enqueue_result = EnqueueTensorReduce(
+        hvd_context, hvd_tensor, hvd_output, root_rank_, ready_event,
+        node_name, device,
+        [context, done](const common::Status& status) {
+          context->SetStatus(ConvertStatus(status));
+          done();
+        }, reduce_op);
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
+  }
+
+private:
+  int reduce_op_;
+  int root_rank_;
+};
+
+REGISTER_KERNEL_BUILDER(Name("HorovodReduce").Device(DEVICE_CPU),
+                        HorovodReduceOp);
+
+REGISTER_OP("HorovodReduce")
+    .Attr("T: {uint8, int8, uint16, int16, int32, int64, float16, float32, float64}")
+    .Attr("reduce_op: int")
+    .Attr("root_rank: int")
+    .Input("tensor: T")
+    .Output("output: T")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      c->set_output(0, c->input(0));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Perform an MPI Reduce on a tensor. All other processes that do a reduce on a
+tensor with the same name must have the same shape for that tensor.
+
+Arguments
+    tensor:     A tensor to reduce.
+    reduce_op:  The reduction operation, one of SUM, MIN, MAX or PRODUCT.
+    root_rank:  Rank that will receive the reduced tensor.
+
+Output
+    output:    The reduced tensor on the root rank, `tensor` on other ranks.
+)doc");
+
+class HorovodGatherOp : public AsyncOpKernel {
+public:
+  explicit HorovodGatherOp(OpKernelConstruction* context)
+      : AsyncOpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("root_rank", &root_rank_));
+  }
+
+  void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(common::CheckInitialized()),
+                         done);
+
+    auto node_name = name();
+    auto device = GetDeviceID(context);
+    auto tensor = context->input(0);
+    // The output is allocated once the sizes of all tensors are known.
+    auto ready_event = std::shared_ptr<common::ReadyEvent>(RecordReadyEvent(context));
+    auto hvd_context = std::make_shared<TFOpContext>(context);
+    auto hvd_tensor = std::make_shared<TFTensor>(tensor);
+    auto enqueue_result = EnqueueTensorGather(
+        hvd_context, hvd_tensor, root_rank_, ready_event, node_name, device,
+        [context, done](const common::Status& status) {
+          context->SetStatus(ConvertStatus(status));
+          done();
+        });
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
+  }
+
+private:
+  int root_rank_;
+};
+
+REGISTER_KERNEL_BUILDER(Name("HorovodGather").Device(DEVICE_CPU),
+                        HorovodGatherOp);
+
+REGISTER_OP("HorovodGather")
+    .Attr(
+        "T: {uint8, int8, uint16, int16, int32, int64, float16, float32, float64, bool}")
+    .Attr("root_rank: int")
+    .Input("tensor: T")
+    .Output("output: T")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      shape_inference::ShapeHandle output;
+      TF_RETURN_IF_ERROR(
+          c->ReplaceDim(c->input(0), 0, c->UnknownDim(), &output));
+      c->set_output(0, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Perform an MPI Gatherv on a tensor. All other processes that do a gather on a
+tensor with the same name must have the same rank for that tensor, and have the
+same dimension on all but the first dimension.
+
+Arguments
+    tensor:     A tensor to gather.
+    root_rank:  Rank that will receive the gathered tensor.
+
+Output
+    output:    The tensors of all processes concatenated along the first
+               dimension on the root rank, an empty tensor on other ranks.
+)doc");
+
+class HorovodScatterOp : public AsyncOpKernel {
+public:
+  explicit HorovodScatterOp(OpKernelConstruction* context)
+      : AsyncOpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("root_rank", &root_rank_));
+  }
+
+  void ComputeAsync(OpKernelContext* context, DoneCallback done) override {
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(common::CheckInitialized()),
+                         done);
+
+    auto node_name = name();
+    auto device = GetDeviceID(context);
+    auto tensor = context->input(0);
+    // The output is allocated once the slice of this rank is known.
+    auto ready_event = std::shared_ptr<common::ReadyEvent>(RecordReadyEvent(context));
+    auto hvd_context = std::make_shared<TFOpContext>(context);
+    auto hvd_tensor = std::make_shared<TFTensor>(tensor);
+    auto enqueue_result = EnqueueTensorScatter(
+        hvd_context, hvd_tensor, root_rank_, ready_event, node_name, device,
+        [context, done](const common::Status& status) {
+          context->SetStatus(ConvertStatus(status));
+          done();
+        });
+    OP_REQUIRES_OK_ASYNC(context, ConvertStatus(enqueue_result), done);
+  }
+
+private:
+  int root_rank_;
+};
+
+REGISTER_KERNEL_BUILDER(Name("HorovodScatter").Device(DEVICE_CPU),
+                        HorovodScatterOp);
+
+REGISTER_OP("HorovodScatter")
+    .Attr(
+        "T: {uint8, int8, uint16, int16, int32, int64, float16, float32, float64, bool}")
+    .Attr("root_rank: int")
+    .Input("tensor: T")
+    .Output("output: T")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      shape_inference::ShapeHandle output;
+      TF_RETURN_IF_ERROR(
+          c->ReplaceDim(c->input(0), 0, c->UnknownDim(), &output));
+      c->set_output(0, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Perform an MPI Scatterv on a tensor. All other processes that do a scatter on a
+tensor with the same name must have the same shape for that tensor, but only
+the tensor of the root rank is sent. It is split along the first dimension,
+with lower ranks receiving one extra row if it does not divide evenly.
+
+Arguments
+    tensor:     A tensor to scatter.
+    root_rank:  Rank that will send data.
+
+Output
+    output:    The slice of the tensor of the root rank assigned to this
+               process.
+)doc");
+
 } // namespace tensorflow
-} // namespace horovod
+} // namespace horovod
\ No newline at end of file
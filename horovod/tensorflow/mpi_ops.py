@@ -52,6 +52,9 @@ _basics = _HorovodBasics(__file__, 'mpi_lib')
 # import basic methods
 init = _basics.init
 shutdown = _basics.shutdown
+add_process_set = _basics.add_process_set
+process_set_rank = _basics.process_set_rank
+process_set_size = _basics.process_set_size
 size = _basics.size
 local_size = _basics.local_size
 rank = _basics.rank
@@ -69,6 +72,9 @@ mlsl_built = _basics.mlsl_built
 Average = _basics.Average
 Sum = _basics.Sum
 Adasum = _basics.Adasum
+Min = _basics.Min
+Max = _basics.Max
+Product = _basics.Product
 
 is_homogeneous = _basics.is_homogeneous
 
@@ -87,7 +93,8 @@ def _normalize_name(name):
     return re.sub('[^a-zA-Z0-9_]', '_', name)
 
 
-def _allreduce(tensor, name=None, op=Sum):
+def _allreduce(tensor, name=None, op=Sum, prescale_factor=1.0, postscale_factor=1.0,
+               process_set=0):
     """An op which reduces an input tensor over all the Horovod processes. The
     default reduction is a sum.
 
@@ -95,13 +102,22 @@ def _allreduce(tensor, name=None, op=Sum):
     shape must be the same on all Horovod processes for a given name. The reduction
     will not start until all processes are ready to send and receive the tensor.
 
+    The tensor is multiplied by prescale_factor before and by postscale_factor
+    after the reduction. Scaling is only supported for CPU tensors.
+
+    If process_set is the ID returned by add_process_set(), the tensor is only
+    reduced over the processes of that set.
+
     Returns:
       A tensor of the same shape and type as `tensor`, summed across all
       processes.
     """
     if name is None and not _executing_eagerly():
         name = 'HorovodAllreduce_%s' % _normalize_name(tensor.name)
-    return MPI_LIB.horovod_allreduce(tensor, name=name, reduce_op=op)
+    return MPI_LIB.horovod_allreduce(tensor, name=name, reduce_op=op,
+                                     prescale_factor=prescale_factor,
+                                     postscale_factor=postscale_factor,
+                                     process_set=process_set)
 
 
 @ops.RegisterGradient('HorovodAllreduce')
@@ -115,10 +131,77 @@ def _allreduce_grad(op, grad):
     Returns:
       The gradient with respect to the input of the op.
     """
-    return _allreduce(grad)
+    reduce_op = op.get_attr('reduce_op')
+    prescale_factor = op.get_attr('prescale_factor')
+    postscale_factor = op.get_attr('postscale_factor')
+    process_set = op.get_attr('process_set')
+    if reduce_op in (Min, Max, Product) and \
+            (prescale_factor != 1.0 or postscale_factor != 1.0):
+        raise NotImplementedError(
+            'Gradients of scaled Min, Max and Product allreduce are not supported.')
+    if reduce_op in (Min, Max):
+        # The gradient flows to every process holding the extreme value.
+        mask = tf.cast(tf.equal(op.inputs[0], op.outputs[0]), grad.dtype)
+        return _allreduce(grad, process_set=process_set) * mask
+    if reduce_op == Product:
+        # The gradient of a process' input is the product of the inputs of the
+        # other processes. Zeros are masked out of the product and counted, so
+        # that it is never computed by dividing by zero.
+        tensor = op.inputs[0]
+        is_zero = tf.equal(tensor, 0)
+        nonzero = tf.where(is_zero, tf.ones_like(tensor), tensor)
+        product = _allreduce(nonzero, op=Product, process_set=process_set)
+        num_zeros = _allreduce(tf.cast(is_zero, tf.int32),
+                               process_set=process_set)
+        others = tf.where(is_zero, product, product / nonzero)
+        others = tf.where(tf.equal(num_zeros - tf.cast(is_zero, tf.int32), 0),
+                          others, tf.zeros_like(others))
+        return _allreduce(grad, process_set=process_set) * others
+    return _allreduce(grad, prescale_factor=prescale_factor,
+                      postscale_factor=postscale_factor,
+                      process_set=process_set)
+
+
+def _grouped_allreduce(tensors, name=None, op=Sum, prescale_factor=1.0, postscale_factor=1.0):
+    """An op which reduces a list of input tensors over all the Horovod
+    processes. The default reduction is a sum.
+
+    The tensors are negotiated as a group: none of them is reduced before all
+    of them are ready on all processes, and they are only fused with each
+    other. All processes must run the same groups in the same order.
+
+    Returns:
+      A list of tensors of the same shapes and types as `tensors`, summed
+      across all processes.
+    """
+    if name is None and not _executing_eagerly():
+        name = 'HorovodGroupedAllreduce_%s' % _normalize_name(tensors[0].name)
+    return MPI_LIB.horovod_grouped_allreduce(tensors, name=name, reduce_op=op,
+                                             prescale_factor=prescale_factor,
+                                             postscale_factor=postscale_factor)
+
 
+@ops.RegisterGradient('HorovodGroupedAllreduce')
+def _grouped_allreduce_grad(op, *grads):
+    """Gradient for grouped allreduce op.
+
+    Args:
+      op: An operation.
+      grads: List of `Tensor` gradients with respect to the outputs of the op.
+
+    Returns:
+      The gradients with respect to the inputs of the op.
+    """
+    reduce_op = op.get_attr('reduce_op')
+    if reduce_op in (Min, Max, Product):
+        raise NotImplementedError(
+            'Gradients of grouped Min, Max and Product allreduce are not supported.')
+    return _grouped_allreduce(list(grads),
+                              prescale_factor=op.get_attr('prescale_factor'),
+                              postscale_factor=op.get_attr('postscale_factor'))
 
-def allgather(tensor, name=None):
+
+def allgather(tensor, name=None, process_set=0):
     """An op which concatenates the input tensor with the same input tensor on
     all other Horovod processes.
 
@@ -131,10 +214,14 @@ def allgather(tensor, name=None):
       across all processes. The shape is identical to the input shape, except for
       the first dimension, which may be greater and is the sum of all first
       dimensions of the tensors in different Horovod processes.
+
+    If process_set is the ID returned by add_process_set(), the tensor is only
+    gathered from the processes of that set, in the order of their ranks.
     """
     if name is None and not _executing_eagerly():
         name = 'HorovodAllgather_%s' % _normalize_name(tensor.name)
-    return MPI_LIB.horovod_allgather(tensor, name=name)
+    return MPI_LIB.horovod_allgather(tensor, name=name,
+                                     process_set=process_set)
 
 
 @ops.RegisterGradient('HorovodAllgather')
@@ -148,7 +235,8 @@ def _allgather_grad(op, grad):
     Returns:
       The gradient with respect to the input of the op.
     """
-    grad = _allreduce(grad)
+    process_set = op.get_attr('process_set')
+    grad = _allreduce(grad, process_set=process_set)
 
     with tf.device('/cpu:0'):
         # Keep the tensor of split sizes on CPU.
@@ -156,14 +244,155 @@ def _allgather_grad(op, grad):
         d0 = x.get_shape().as_list()[0]
         d = tf.convert_to_tensor([d0], dtype=tf.int32)
 
-        s = size()
-        d = tf.reshape(allgather(d), [s])
+        s = process_set_size(process_set)
+        d = tf.reshape(allgather(d, process_set=process_set), [s])
 
     splits = tf.split(grad, num_or_size_splits=d, axis=0)
-    return splits[rank()]
+    return splits[process_set_rank(process_set)]
+
+
+def reducescatter(tensor, name=None, op=Average):
+    """An op which reduces an input tensor over all the Horovod processes and
+    scatters the result, so that every process receives one slice of it.
+
+    The reduction is done on the first dimension, which is split as evenly as
+    possible, with the processes of lower rank receiving one extra row. The
+    tensor type and shape must be the same on all Horovod processes for a given
+    name.
+
+    Arguments:
+        tensor: A tensor to reduce and scatter.
+        name: A name of the reducescatter operation.
+        op: The reduction operation to combine tensors across different ranks,
+            one of Average (default), Sum, Min, Max or Product.
+
+    Returns:
+      A tensor of the same type as `tensor`, holding the slice of the reduced
+      tensor assigned to this process along the first dimension.
+    """
+    if op not in (Average, Sum, Min, Max, Product):
+        raise NotImplementedError(
+            'Reducescatter supports only Average, Sum, Min, Max and Product.')
+    if name is None and not _executing_eagerly():
+        name = 'HorovodReducescatter_%s' % _normalize_name(tensor.name)
+    # Averaging happens in framework code, as for allreduce.
+    true_op = Sum if op == Average else op
+    reduced_tensor = MPI_LIB.horovod_reducescatter(tensor, name=name,
+                                                   reduce_op=true_op)
+    if op == Average:
+        horovod_size = tf.cast(size(), dtype=reduced_tensor.dtype)
+        return reduced_tensor / horovod_size
+    return reduced_tensor
+
+
+@ops.RegisterGradient('HorovodReducescatter')
+def _reducescatter_grad(op, grad):
+    """Gradient for reducescatter op.
+
+    Args:
+      op: An operation.
+      grad: `Tensor` gradient with respect to the output of the op.
+
+    Returns:
+      The gradient with respect to the input of the op.
+    """
+    if op.get_attr('reduce_op') != Sum:
+        raise NotImplementedError(
+            'Reducescatter gradient is supported only for Average and Sum.')
+    return allgather(grad)
+
+
+def alltoall(tensor, splits=None, name=None):
+    """An op which scatters slices of the input tensor to all other Horovod
+    processes and gathers the slices they send to this process.
+
+    The slicing is done on the first dimension. Process i sends splits[j] rows
+    to process j, in rank order, and receives the rows the other processes
+    send to it concatenated in rank order. The input tensors on the different
+    processes must have the same rank and shape, except for the first
+    dimension, which is allowed to be different.
+
+    Arguments:
+        tensor: A tensor to distribute with alltoall.
+        splits: A tensor of integers holding the number of rows to send to
+                every process. Defaults to splitting the first dimension evenly
+                across all processes.
+        name: A name of the alltoall operation.
+
+    Returns:
+      A tensor of the same type as `tensor`, holding the rows received from all
+      processes concatenated on dimension zero in rank order.
+    """
+    with tf.device('/cpu:0'):
+        # Keep the tensor of split sizes on CPU.
+        if splits is None:
+            d0 = tf.shape(tensor, out_type=tf.int32)[0]
+            splits = tf.fill([size()], d0 // size())
+        else:
+            splits = tf.cast(splits, dtype=tf.int32)
+    if name is None and not _executing_eagerly():
+        name = 'HorovodAlltoall_%s' % _normalize_name(tensor.name)
+    return MPI_LIB.horovod_alltoall(tensor, splits, name=name)
+
+
+@ops.RegisterGradient('HorovodAlltoall')
+def _alltoall_grad(op, grad):
+    """Gradient for alltoall op.
+
+    Args:
+      op: An operation.
+      grad: `Tensor` gradient with respect to the output of the op.
+
+    Returns:
+      The gradient with respect to the input of the op.
+    """
+    # The gradient of every received slice goes back to the process that sent
+    # it, so the backward pass is an alltoall with the received splits.
+    with tf.device('/cpu:0'):
+        splits = tf.reshape(op.inputs[1], [1, size()])
+        recv_splits = allgather(splits)[:, rank()]
+    return [alltoall(grad, recv_splits), None]
+
+
+def sparse_allreduce(values, indices, dense_rows=None, deduplicate=True,
+                     name=None):
+    """An op which sums the rows of an IndexedSlices-like tensor over all the
+    Horovod processes without densifying it.
+
+    The indices and values of all processes are exchanged in a single
+    collective. If the gathered rows exceed the density threshold set through
+    HOROVOD_SPARSE_DENSITY_THRESHOLD relative to `dense_rows`, a dense allreduce
+    is done instead and the result holds all `dense_rows` rows. The reduction
+    runs on the host, so the inputs are placed on CPU.
+
+    Arguments:
+        values: A tensor holding the rows to reduce.
+        indices: A vector holding the row index of every row in `values`.
+        dense_rows: Number of rows of the dense tensor. If None, the switch to
+                    a dense allreduce is disabled.
+        deduplicate: If True, rows with the same index are summed up, otherwise
+                     the result may hold the same index several times.
+        name: A name of the sparse allreduce operation.
+
+    Returns:
+      A tuple of a tensor of the same type as `values` holding the summed rows
+      and an int64 vector holding their indices.
+    """
+    if name is None and not _executing_eagerly():
+        name = 'HorovodSparseAllreduce_%s' % _normalize_name(values.name)
+    with tf.device('/cpu:0'):
+        indices = tf.cast(indices, dtype=tf.int64)
+        dense_rows = tf.cast(dense_rows if dense_rows is not None else 0,
+                             dtype=tf.int64)
+        return MPI_LIB.horovod_sparse_allreduce(values, indices, dense_rows,
+                                                deduplicate=deduplicate,
+                                                name=name)
+
+
+ops.NotDifferentiable('HorovodSparseAllreduce')
 
 
-def broadcast(tensor, root_rank, name=None):
+def broadcast(tensor, root_rank, name=None, process_set=0):
     """An op which broadcasts the input tensor on root rank to the same input tensor
     on all other Horovod processes.
 
@@ -174,10 +403,14 @@ def broadcast(tensor, root_rank, name=None):
     Returns:
       A tensor of the same shape and type as `tensor`, with the value broadcasted
       from root rank.
+
+    If process_set is the ID returned by add_process_set(), the tensor is only
+    broadcast within that set, and root_rank is a rank within the set.
     """
     if name is None and not _executing_eagerly():
         name = 'HorovodBroadcast_%s' % _normalize_name(tensor.name)
-    return MPI_LIB.horovod_broadcast(tensor, name=name, root_rank=root_rank)
+    return MPI_LIB.horovod_broadcast(tensor, name=name, root_rank=root_rank,
+                                     process_set=process_set)
 
 
 @ops.RegisterGradient('HorovodBroadcast')
@@ -192,7 +425,101 @@ def _broadcast_grad(op, grad):
       The gradient with respect to the input of the op.
     """
     root_rank = op.get_attr('root_rank')
-    grad_reduced = _allreduce(grad)
-    if rank() != root_rank:
+    process_set = op.get_attr('process_set')
+    grad_reduced = _allreduce(grad, process_set=process_set)
+    if process_set_rank(process_set) != root_rank:
         return grad_reduced * 0
     return grad_reduced
+
+
+def reduce(tensor, root_rank, name=None, op=Average):
+    """An op which reduces an input tensor over all the Horovod processes into
+    the output of the root rank.
+
+    The tensor type and shape must be the same on all Horovod processes for a
+    given name. The reduction runs on the host, so the tensor is placed on CPU.
+
+    Arguments:
+        tensor: A tensor to reduce.
+        root_rank: The rank receiving the reduced tensor.
+        name: A name of the reduce operation.
+        op: The reduction operation to combine tensors across different ranks,
+            one of Average (default), Sum, Min, Max or Product.
+
+    Returns:
+      A tensor of the same shape and type as `tensor`, holding the reduced
+      tensor on the root rank and `tensor` on other ranks.
+    """
+    if op not in (Average, Sum, Min, Max, Product):
+        raise NotImplementedError(
+            'Reduce supports only Average, Sum, Min, Max and Product.')
+    if name is None and not _executing_eagerly():
+        name = 'HorovodReduce_%s' % _normalize_name(tensor.name)
+    # Averaging happens in framework code, as for allreduce.
+    true_op = Sum if op == Average else op
+    with tf.device('/cpu:0'):
+        reduced_tensor = MPI_LIB.horovod_reduce(tensor, name=name,
+                                                reduce_op=true_op,
+                                                root_rank=root_rank)
+    if op == Average and rank() == root_rank:
+        horovod_size = tf.cast(size(), dtype=reduced_tensor.dtype)
+        return reduced_tensor / horovod_size
+    return reduced_tensor
+
+
+ops.NotDifferentiable('HorovodReduce')
+
+
+def gather(tensor, root_rank, name=None):
+    """An op which concatenates the input tensor with the same input tensor on
+    all other Horovod processes into the output of the root rank.
+
+    The concatenation is done on the first dimension, so the input tensors on
+    the different processes must have the same rank and shape, except for the
+    first dimension, which is allowed to be different. The gather runs on the
+    host, so the tensor is placed on CPU.
+
+    Arguments:
+        tensor: A tensor to gather.
+        root_rank: The rank receiving the gathered tensor.
+        name: A name of the gather operation.
+
+    Returns:
+      A tensor of the same type as `tensor`, concatenated on dimension zero
+      across all processes on the root rank and with no rows on other ranks.
+    """
+    if name is None and not _executing_eagerly():
+        name = 'HorovodGather_%s' % _normalize_name(tensor.name)
+    with tf.device('/cpu:0'):
+        return MPI_LIB.horovod_gather(tensor, name=name, root_rank=root_rank)
+
+
+ops.NotDifferentiable('HorovodGather')
+
+
+def scatter(tensor, root_rank, name=None):
+    """An op which splits the input tensor of the root rank along the first
+    dimension and sends every Horovod process one slice of it.
+
+    The first dimension is split as for reducescatter, with the processes of
+    lower rank receiving one extra row. The tensor type and shape must be the
+    same on all Horovod processes for a given name, though only the tensor of
+    the root rank is sent. The scatter runs on the host, so the tensor is
+    placed on CPU.
+
+    Arguments:
+        tensor: A tensor to scatter.
+        root_rank: The rank sending its tensor.
+        name: A name of the scatter operation.
+
+    Returns:
+      A tensor of the same type as `tensor`, holding the slice of the tensor of
+      the root rank assigned to this process along the first dimension.
+    """
+    if name is None and not _executing_eagerly():
+        name = 'HorovodScatter_%s' % _normalize_name(tensor.name)
+    with tf.device('/cpu:0'):
+        return MPI_LIB.horovod_scatter(tensor, name=name, root_rank=root_rank)
+
+
+ops.NotDifferentiable('HorovodScatter')
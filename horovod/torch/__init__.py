@@ -37,16 +37,24 @@ def _check_has_gpu():
 
 from horovod.torch.compression import Compression
 from horovod.torch.mpi_ops import allreduce, allreduce_async, allreduce_, allreduce_async_
+from horovod.torch.mpi_ops import grouped_allreduce, grouped_allreduce_async, grouped_allreduce_, \
+    grouped_allreduce_async_
 from horovod.torch.mpi_ops import allgather, allgather_async
 from horovod.torch.mpi_ops import broadcast, broadcast_async, broadcast_, broadcast_async_
+from horovod.torch.mpi_ops import reducescatter, reducescatter_async
+from horovod.torch.mpi_ops import alltoall, alltoall_async
+from horovod.torch.mpi_ops import sparse_allreduce, sparse_allreduce_async
+from horovod.torch.mpi_ops import reduce, reduce_async, gather, gather_async
+from horovod.torch.mpi_ops import scatter, scatter_async
 from horovod.torch.mpi_ops import join
 from horovod.torch.mpi_ops import poll, synchronize
 from horovod.torch.mpi_ops import init, shutdown
+from horovod.torch.mpi_ops import add_process_set, process_set_rank, process_set_size
 from horovod.torch.mpi_ops import size, local_size, rank, local_rank
 from horovod.torch.mpi_ops import mpi_threads_supported, mpi_enabled, mpi_built
 from horovod.torch.mpi_ops import gloo_enabled, gloo_built
 from horovod.torch.mpi_ops import nccl_built, ddl_built, mlsl_built
-from horovod.torch.mpi_ops import Average, Sum, Adasum
+from horovod.torch.mpi_ops import Average, Sum, Adasum, Min, Max, Product
 
 import torch
 import collections
@@ -126,6 +134,11 @@ class _DistributedOptimizer(torch.optim.Optimizer):
     def _allreduce_grad_async(self, p):
         name = self._parameter_names.get(p)
         tensor = p.grad
+        if tensor.is_sparse:
+            # Sparse gradients, e.g. of embeddings with sparse=True, are
+            # reduced without densifying them and are not compressed.
+            handle = sparse_allreduce_async(tensor, name=name, op=self.op)
+            return handle, None
         tensor_compressed, ctx = self._compression.compress(tensor)
 
         handle = allreduce_async_(tensor_compressed, name=name, op=self.op)
@@ -163,7 +176,10 @@ class _DistributedOptimizer(torch.optim.Optimizer):
         for p, (handle, _) in self._handles.items():
             output = synchronize(handle)
             self._allreduce_delay[p] = self.backward_passes_per_step
-            p.grad.set_(self._compression.decompress(output, ctx))
+            if p.grad.is_sparse:
+                p.grad = output
+            else:
+                p.grad.set_(self._compression.decompress(output, ctx))
         self._handles.clear()
 
         self._synchronized = True
@@ -131,6 +131,17 @@ TorchOpContext<DT, Dev, T>::AllocateOutput(TensorShape shape,
   return Status::OK();
 }
 
+template <DataType DT, DeviceType Dev, class T>
+Status
+TorchOpContext<DT, Dev, T>::AllocateOutput(int output_index, TensorShape shape,
+                                           std::shared_ptr<Tensor>* tensor) {
+  if (output_index != 0) {
+    return Status::PreconditionError(
+        "Multiple outputs are not supported for PyTorch < 1.0");
+  }
+  return AllocateOutput(shape, tensor);
+}
+
 template <DataType DT, DeviceType Dev, class T>
 Status
 TorchOpContext<DT, Dev, T>::AllocateZeros(int64_t num_elements, DataType dtype,
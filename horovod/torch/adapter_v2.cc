@@ -101,7 +101,11 @@ int64_t TorchTensor::size() const {
 }
 
 TorchOpContext::TorchOpContext(int device, ::torch::Tensor output)
-    : device_(device), output_(output) {}
+    : device_(device), outputs_({output}) {}
+
+TorchOpContext::TorchOpContext(int device,
+                               std::vector<::torch::Tensor> outputs)
+    : device_(device), outputs_(std::move(outputs)) {}
 
 Status
 TorchOpContext::AllocatePersistent(int64_t size,
@@ -113,14 +117,20 @@ TorchOpContext::AllocatePersistent(int64_t size,
 
 Status TorchOpContext::AllocateOutput(TensorShape shape,
                                       std::shared_ptr<Tensor>* tensor) {
+  return AllocateOutput(0, shape, tensor);
+}
+
+Status TorchOpContext::AllocateOutput(int output_index, TensorShape shape,
+                                      std::shared_ptr<Tensor>* tensor) {
   std::vector<int64_t> shape_vector;
   shape_vector.reserve(shape.dims());
   for (int idx = 0; idx < shape.dims(); ++idx) {
     shape_vector.push_back(shape.dim_size(idx));
   }
   with_device device_context(device_);
-  output_.resize_(shape_vector);
-  *tensor = std::make_shared<TorchTensor>(output_);
+  auto& output = outputs_.at(output_index);
+  output.resize_(shape_vector);
+  *tensor = std::make_shared<TorchTensor>(output);
   return Status::OK();
 }
 
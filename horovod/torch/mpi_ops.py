@@ -46,6 +46,9 @@ from horovod.torch.compression import Compression
 # import basic methods
 init = _basics.init
 shutdown = _basics.shutdown
+add_process_set = _basics.add_process_set
+process_set_rank = _basics.process_set_rank
+process_set_size = _basics.process_set_size
 size = _basics.size
 local_size = _basics.local_size
 rank = _basics.rank
@@ -63,6 +66,9 @@ mlsl_built = _basics.mlsl_built
 Average = _basics.Average
 Sum = _basics.Sum
 Adasum = _basics.Adasum
+Min = _basics.Min
+Max = _basics.Max
+Product = _basics.Product
 
 is_homogeneous = _basics.is_homogeneous
 
@@ -92,15 +98,17 @@ def _allreduce_function_factory(tensor):
     return 'horovod_torch_allreduce_async_' + tensor.type().replace('.', '_')
 
 
-def _allreduce_async(tensor, output, name, op):
-    if tensor.dtype == torch.float16 and not _fp16_supported:
+def _check_process_set(process_set):
+    if process_set != 0 and not _v2_api:
         raise NotImplementedError(
-            'float16 allreduce is not supported for PyTorch version {} < 1.0.0'
+            'Process sets are not supported for PyTorch version {} < 1.0.0'
             .format(torch.__version__))
 
+
+def _allreduce_divisor(tensor, op, process_set=0):
     # Set the divisor for reduced gradients to average when necessary
     if op == Average:
-        divisor = size()
+        divisor = process_set_size(process_set)
     elif (op == Adasum):
         if (tensor.device.type != 'cpu' and _has_gpu):
             if nccl_built():
@@ -120,17 +128,39 @@ def _allreduce_async(tensor, output, name, op):
             divisor = 1
     else:
         divisor = 1
+    return divisor
+
+
+def _allreduce_async(tensor, output, name, op, prescale_factor, postscale_factor,
+                     process_set=0):
+    if tensor.dtype == torch.float16 and not _fp16_supported:
+        raise NotImplementedError(
+            'float16 allreduce is not supported for PyTorch version {} < 1.0.0'
+            .format(torch.__version__))
+    if (prescale_factor != 1.0 or postscale_factor != 1.0) and not _v2_api:
+        raise NotImplementedError(
+            'Scaled allreduce is not supported for PyTorch version {} < 1.0.0'
+            .format(torch.__version__))
+    _check_process_set(process_set)
+
+    divisor = _allreduce_divisor(tensor, op, process_set)
     # Averaging happens in framework code, so translate that to Sum for the actual call
     true_op = Sum if op == Average else op
 
     function = _check_function(_allreduce_function_factory, tensor)
-    handle = getattr(mpi_lib, function)(tensor, output, divisor,
-                                        name.encode() if name is not None else _NULL, true_op)
+    if _v2_api:
+        handle = getattr(mpi_lib, function)(tensor, output, divisor,
+                                            name.encode() if name is not None else _NULL, true_op,
+                                            prescale_factor, postscale_factor, process_set)
+    else:
+        handle = getattr(mpi_lib, function)(tensor, output, divisor,
+                                            name.encode() if name is not None else _NULL, true_op)
     _handle_map[handle] = (tensor, output)
     return handle
 
 
-def allreduce_async(tensor, average=None, name=None, op=None):
+def allreduce_async(tensor, average=None, name=None, op=None,
+                    prescale_factor=1.0, postscale_factor=1.0, process_set=0):
     """
     A function that performs asynchronous averaging or summation of the input tensor
     over all the Horovod processes. The input tensor is not modified.
@@ -146,6 +176,10 @@ def allreduce_async(tensor, average=None, name=None, op=None):
         name: A name of the reduction operation.
         op: The reduction operation to combine tensors across different 
                    ranks. Defaults to Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensor before allreduce.
+        postscale_factor: Multiplicative factor to scale tensor after allreduce.
+        process_set: ID of the process set to reduce over, as returned by
+                     `add_process_set()`. Defaults to all processes.
 
     Returns:
         A handle to the allreduce operation that can be used with `poll()` or
@@ -153,25 +187,61 @@ def allreduce_async(tensor, average=None, name=None, op=None):
     """
     op = handle_average_backwards_compatibility(op, average)
     output = tensor.new(tensor.shape)
-    return _allreduce_async(tensor, output, name, op)
+    return _allreduce_async(tensor, output, name, op, prescale_factor, postscale_factor,
+                            process_set)
 
 
 class HorovodAllreduce(torch.autograd.Function):
     """An autograd function that performs allreduce on a tensor."""
 
     @staticmethod
-    def forward(ctx, tensor, average, name, op):
+    def forward(ctx, tensor, average, name, op, prescale_factor, postscale_factor,
+                process_set):
         ctx.average = average
         ctx.op = op
-        handle = allreduce_async(tensor, average, name, op)
-        return synchronize(handle)
+        ctx.prescale_factor = prescale_factor
+        ctx.postscale_factor = postscale_factor
+        ctx.process_set = process_set
+        handle = allreduce_async(tensor, average, name, op,
+                                 prescale_factor, postscale_factor, process_set)
+        output = synchronize(handle)
+        if op in (Min, Max, Product):
+            ctx.save_for_backward(tensor, output)
+        return output
 
     @staticmethod
     def backward(ctx, grad_output):
-        return allreduce(grad_output, average=ctx.average, op=ctx.op), None, None, None
-
-
-def allreduce(tensor, average=None, name=None, compression=Compression.none, op=None):
+        if ctx.op in (Min, Max, Product) and \
+                (ctx.prescale_factor != 1.0 or ctx.postscale_factor != 1.0):
+            raise NotImplementedError(
+                'Gradients of scaled Min, Max and Product allreduce are not supported.')
+        if ctx.op in (Min, Max):
+            # The gradient flows to every process holding the extreme value.
+            tensor, output = ctx.saved_tensors
+            grad = allreduce(grad_output, op=Sum, process_set=ctx.process_set)
+            return grad * (tensor == output).type_as(grad), None, None, None, None, None, None
+        if ctx.op == Product:
+            # The gradient of a process' input is the product of the inputs of
+            # the other processes. Zeros are masked out of the product and
+            # counted, so that it is never computed by dividing by zero.
+            tensor, output = ctx.saved_tensors
+            grad = allreduce(grad_output, op=Sum, process_set=ctx.process_set)
+            is_zero = tensor == 0
+            nonzero = torch.where(is_zero, torch.ones_like(tensor), tensor)
+            product = allreduce(nonzero, op=Product, process_set=ctx.process_set)
+            num_zeros = allreduce(is_zero.int(), op=Sum, process_set=ctx.process_set)
+            others = torch.where(is_zero, product, product / nonzero)
+            others = torch.where(num_zeros - is_zero.int() == 0, others,
+                                 torch.zeros_like(others))
+            return grad * others, None, None, None, None, None, None
+        return allreduce(grad_output, average=ctx.average, op=ctx.op,
+                         prescale_factor=ctx.prescale_factor,
+                         postscale_factor=ctx.postscale_factor,
+                         process_set=ctx.process_set), None, None, None, None, None, None
+
+
+def allreduce(tensor, average=None, name=None, compression=Compression.none, op=None,
+              prescale_factor=1.0, postscale_factor=1.0, process_set=0):
     """
     A function that performs averaging or summation of the input tensor over all the
     Horovod processes. The input tensor is not modified.
@@ -194,17 +264,24 @@ def allreduce(tensor, average=None, name=None, compression=Compression.none, op=
                      not using compression.
         op: The reduction operation to combine tensors across different ranks. Defaults
             to Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensor before allreduce.
+        postscale_factor: Multiplicative factor to scale tensor after allreduce.
+        process_set: ID of the process set to reduce over, as returned by
+                     `add_process_set()`. Defaults to all processes.
 
     Returns:
         A tensor of the same shape and type as `tensor`, averaged or summed across all
         processes.
     """
     tensor_compressed, ctx = compression.compress(tensor)
-    summed_tensor_compressed = HorovodAllreduce.apply(tensor_compressed, average, name, op)
+    summed_tensor_compressed = HorovodAllreduce.apply(tensor_compressed, average, name, op,
+                                                      prescale_factor, postscale_factor,
+                                                      process_set)
     return compression.decompress(summed_tensor_compressed, ctx)
 
 
-def allreduce_async_(tensor, average=None, name=None, op=None):
+def allreduce_async_(tensor, average=None, name=None, op=None,
+                     prescale_factor=1.0, postscale_factor=1.0, process_set=0):
     """
     A function that performs asynchronous in-place averaging or summation of the input
     tensor over all the Horovod processes.
@@ -220,16 +297,22 @@ def allreduce_async_(tensor, average=None, name=None, op=None):
         name: A name of the reduction operation.
         op: The reduction operation to combine tensors across different ranks. Defaults to
             Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensor before allreduce.
+        postscale_factor: Multiplicative factor to scale tensor after allreduce.
+        process_set: ID of the process set to reduce over, as returned by
+                     `add_process_set()`. Defaults to all processes.
 
     Returns:
         A handle to the allreduce operation that can be used with `poll()` or
         `synchronize()`.
     """
     op = handle_average_backwards_compatibility(op, average)
-    return _allreduce_async(tensor, tensor, name, op)
+    return _allreduce_async(tensor, tensor, name, op, prescale_factor, postscale_factor,
+                            process_set)
 
 
-def allreduce_(tensor, average=None, name=None, op=None):
+def allreduce_(tensor, average=None, name=None, op=None,
+               prescale_factor=1.0, postscale_factor=1.0, process_set=0):
     """
     A function that performs in-place averaging or summation of the input tensor over
     all the Horovod processes.
@@ -245,12 +328,17 @@ def allreduce_(tensor, average=None, name=None, op=None):
         name: A name of the reduction operation.
         op: The reduction operation to combine tensors across different ranks. Defaults to
             Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensor before allreduce.
+        postscale_factor: Multiplicative factor to scale tensor after allreduce.
+        process_set: ID of the process set to reduce over, as returned by
+                     `add_process_set()`. Defaults to all processes.
 
     Returns:
         A tensor of the same shape and type as `tensor`, averaged or summed across all
         processes.
     """
-    handle = allreduce_async_(tensor, average, name, op)
+    handle = allreduce_async_(tensor, average, name, op, prescale_factor, postscale_factor,
+                              process_set)
     return synchronize(handle)
 
 
@@ -258,15 +346,20 @@ def _allgather_function_factory(tensor):
     return 'horovod_torch_allgather_async_' + tensor.type().replace('.', '_')
 
 
-def _allgather_async(tensor, output, name):
+def _allgather_async(tensor, output, name, process_set=0):
+    _check_process_set(process_set)
     function = _check_function(_allgather_function_factory, tensor)
-    handle = getattr(mpi_lib, function)(
-        tensor, output, name.encode() if name is not None else _NULL)
+    if _v2_api:
+        handle = getattr(mpi_lib, function)(
+            tensor, output, name.encode() if name is not None else _NULL, process_set)
+    else:
+        handle = getattr(mpi_lib, function)(
+            tensor, output, name.encode() if name is not None else _NULL)
     _handle_map[handle] = (tensor, output)
     return handle
 
 
-def allgather_async(tensor, name=None):
+def allgather_async(tensor, name=None, process_set=0):
     """
     A function that asynchronously concatenates the input tensor with the same input
     tensor on all other Horovod processes. The input tensor is not modified.
@@ -278,37 +371,41 @@ def allgather_async(tensor, name=None):
     Arguments:
         tensor: A tensor to allgather.
         name: A name of the allgather operation.
+        process_set: ID of the process set to gather from, as returned by
+                     `add_process_set()`. Defaults to all processes.
 
     Returns:
         A handle to the allgather operation that can be used with `poll()` or
         `synchronize()`.
     """
     output = tensor.new()
-    return _allgather_async(tensor, output, name)
+    return _allgather_async(tensor, output, name, process_set)
 
 
 class HorovodAllgather(torch.autograd.Function):
     """An autograd function that performs allgather on a tensor."""
 
     @staticmethod
-    def forward(ctx, tensor, name):
+    def forward(ctx, tensor, name, process_set):
         ctx.dim = tensor.shape[0]
-        handle = allgather_async(tensor, name)
+        ctx.process_set = process_set
+        handle = allgather_async(tensor, name, process_set)
         return synchronize(handle)
 
     @staticmethod
     def backward(ctx, grad_output):
-        grad_reduced = allreduce(grad_output, average=False)
+        grad_reduced = allreduce(grad_output, average=False, process_set=ctx.process_set)
 
         dim_t = torch.IntTensor([ctx.dim])
-        dim = allgather(dim_t).view(size())
+        dim = allgather(dim_t, process_set=ctx.process_set).view(
+            process_set_size(ctx.process_set))
 
-        r = rank()
+        r = process_set_rank(ctx.process_set)
         offset = torch.sum(dim.narrow(0, 0, r)).item() if r != 0 else 0
-        return grad_reduced.narrow(0, offset, ctx.dim), None
+        return grad_reduced.narrow(0, offset, ctx.dim), None, None
 
 
-def allgather(tensor, name=None):
+def allgather(tensor, name=None, process_set=0):
     """
     A function that concatenates the input tensor with the same input tensor on
     all other Horovod processes. The input tensor is not modified.
@@ -324,6 +421,8 @@ def allgather(tensor, name=None):
     Arguments:
         tensor: A tensor to allgather.
         name: A name of the allgather operation.
+        process_set: ID of the process set to gather from, as returned by
+                     `add_process_set()`. Defaults to all processes.
 
     Returns:
         A tensor of the same type as `tensor`, concatenated on dimension zero
@@ -331,22 +430,522 @@ def allgather(tensor, name=None):
         the first dimension, which may be greater and is the sum of all first
         dimensions of the tensors in different Horovod processes.
     """
-    return HorovodAllgather.apply(tensor, name)
+    return HorovodAllgather.apply(tensor, name, process_set)
+
+
+def _reducescatter_function_factory(tensor):
+    return 'horovod_torch_reducescatter_async_' + tensor.type().replace('.', '_')
+
+
+def _reducescatter_async(tensor, output, name, op):
+    if op not in (Average, Sum, Min, Max, Product):
+        raise NotImplementedError(
+            'Reducescatter supports only Average, Sum, Min, Max and Product.')
+
+    # Averaging happens in framework code, as for allreduce.
+    divisor = size() if op == Average else 1
+    true_op = Sum if op == Average else op
+    function = _check_function(_reducescatter_function_factory, tensor)
+    handle = getattr(mpi_lib, function)(
+        tensor, output, divisor, name.encode() if name is not None else _NULL,
+        true_op)
+    _handle_map[handle] = (tensor, output)
+    return handle
+
+
+def reducescatter_async(tensor, name=None, op=Average):
+    """
+    A function that asynchronously reduces the input tensor over all the
+    Horovod processes and scatters the result, so that every process receives
+    one slice of it. The input tensor is not modified.
+
+    The reduction is done on the first dimension, which is split as evenly as
+    possible, with the processes of lower rank receiving one extra row. The
+    input tensors on the different processes must have the same shape.
+
+    Arguments:
+        tensor: A tensor to reduce and scatter.
+        name: A name of the reducescatter operation.
+        op: The reduction operation to combine tensors across different ranks,
+            one of Average (default), Sum, Min, Max or Product.
+
+    Returns:
+        A handle to the reducescatter operation that can be used with `poll()`
+        or `synchronize()`.
+    """
+    output = tensor.new()
+    return _reducescatter_async(tensor, output, name, op)
+
+
+class HorovodReducescatter(torch.autograd.Function):
+    """An autograd function that performs reducescatter on a tensor."""
+
+    @staticmethod
+    def forward(ctx, tensor, name, op):
+        ctx.op = op
+        handle = reducescatter_async(tensor, name, op)
+        return synchronize(handle)
+
+    @staticmethod
+    def backward(ctx, grad_output):
+        if ctx.op not in (Average, Sum):
+            raise NotImplementedError(
+                'Reducescatter gradient is supported only for Average and Sum.')
+        grad = allgather(grad_output)
+        if ctx.op == Average:
+            grad.div_(size())
+        return grad, None, None
+
+
+def reducescatter(tensor, name=None, op=Average):
+    """
+    A function that reduces the input tensor over all the Horovod processes
+    and scatters the result, so that every process receives one slice of it.
+    The input tensor is not modified.
+
+    The reduction is done on the first dimension, which is split as evenly as
+    possible, with the processes of lower rank receiving one extra row. The
+    input tensors on the different processes must have the same shape.
+
+    This acts as a thin wrapper around an autograd function.  If your input
+    tensor requires gradients, then callings this function will allow gradients
+    to be computed and backpropagated.
+
+    Arguments:
+        tensor: A tensor to reduce and scatter.
+        name: A name of the reducescatter operation.
+        op: The reduction operation to combine tensors across different ranks,
+            one of Average (default), Sum, Min, Max or Product.
+
+    Returns:
+        A tensor of the same type as `tensor`, holding the slice of the reduced
+        tensor assigned to this process along the first dimension.
+    """
+    return HorovodReducescatter.apply(tensor, name, op)
+
+
+def _alltoall_function_factory(tensor):
+    return 'horovod_torch_alltoall_async_' + tensor.type().replace('.', '_')
+
+
+def _alltoall_async(tensor, splits, output, name):
+    if tensor.dim() == 0:
+        raise ValueError('Alltoall requires a tensor of rank at least one.')
+    if splits is None:
+        if tensor.shape[0] % size() != 0:
+            raise ValueError('Alltoall without splits requires the first '
+                             'dimension of the tensor to be divisible by the '
+                             'number of Horovod processes.')
+        splits = [tensor.shape[0] // size()] * size()
+    elif isinstance(splits, torch.Tensor):
+        splits = splits.tolist()
+    splits = [int(s) for s in splits]
+    if len(splits) != size():
+        raise ValueError('Alltoall requires one split per Horovod process.')
+
+    function = _check_function(_alltoall_function_factory, tensor)
+    handle = getattr(mpi_lib, function)(
+        tensor, splits, output, name.encode() if name is not None else _NULL)
+    _handle_map[handle] = (tensor, output)
+    return handle
+
+
+def alltoall_async(tensor, splits=None, name=None):
+    """
+    A function that asynchronously scatters slices of the input tensor to all
+    other Horovod processes and gathers the slices they send to this process.
+    The input tensor is not modified.
+
+    The slicing is done on the first dimension. Process i sends splits[j] rows
+    to process j, in rank order, and receives the rows the other processes
+    send to it concatenated in rank order. The input tensors on the different
+    processes must have the same rank and shape, except for the first
+    dimension, which is allowed to be different.
+
+    Arguments:
+        tensor: A tensor to distribute with alltoall.
+        splits: A list or tensor of integers holding the number of rows to send
+                to every process. Defaults to splitting the first dimension
+                evenly across all processes.
+        name: A name of the alltoall operation.
+
+    Returns:
+        A handle to the alltoall operation that can be used with `poll()` or
+        `synchronize()`.
+    """
+    output = tensor.new()
+    return _alltoall_async(tensor, splits, output, name)
+
+
+class HorovodAlltoall(torch.autograd.Function):
+    """An autograd function that performs alltoall on a tensor."""
+
+    @staticmethod
+    def forward(ctx, tensor, splits, name):
+        handle = alltoall_async(tensor, splits, name)
+        if splits is None:
+            splits = [tensor.shape[0] // size()] * size()
+        elif isinstance(splits, torch.Tensor):
+            splits = splits.tolist()
+        ctx.splits = [int(s) for s in splits]
+        return synchronize(handle)
+
+    @staticmethod
+    def backward(ctx, grad_output):
+        # The gradient of every received slice goes back to the process that
+        # sent it, so the backward pass is an alltoall with the received
+        # splits.
+        splits = torch.LongTensor(ctx.splits).view(1, -1)
+        recv_splits = allgather(splits)[:, rank()]
+        grad = alltoall(grad_output, recv_splits)
+        return grad, None, None
+
+
+def alltoall(tensor, splits=None, name=None):
+    """
+    A function that scatters slices of the input tensor to all other Horovod
+    processes and gathers the slices they send to this process. The input
+    tensor is not modified.
+
+    The slicing is done on the first dimension. Process i sends splits[j] rows
+    to process j, in rank order, and receives the rows the other processes
+    send to it concatenated in rank order. The input tensors on the different
+    processes must have the same rank and shape, except for the first
+    dimension, which is allowed to be different.
+
+    This acts as a thin wrapper around an autograd function.  If your input
+    tensor requires gradients, then callings this function will allow gradients
+    to be computed and backpropagated.
+
+    Arguments:
+        tensor: A tensor to distribute with alltoall.
+        splits: A list or tensor of integers holding the number of rows to send
+                to every process. Defaults to splitting the first dimension
+                evenly across all processes.
+        name: A name of the alltoall operation.
+
+    Returns:
+        A tensor of the same type as `tensor`, holding the rows received from
+        all processes concatenated on dimension zero in rank order.
+    """
+    return HorovodAlltoall.apply(tensor, splits, name)
+
+
+def _sparse_allreduce_function_factory(tensor):
+    return 'horovod_torch_sparse_allreduce_async_' + tensor.type().replace('.', '_')
+
+
+class _SparseAllreduceOutput(object):
+    """Holds the outputs of a sparse allreduce until they are assembled back
+    into a sparse tensor by `synchronize()`."""
+
+    def __init__(self, tensor, values, indices, op):
+        self.sparse_sizes = tensor.shape[:tensor.sparse_dim()]
+        self.shape = tensor.shape
+        self.device = tensor.device
+        self.values = values
+        self.indices = indices
+        self.op = op
+
+    def assemble(self):
+        # Unravel the row indices into coordinates of the sparse dimensions.
+        flat = self.indices
+        coords = []
+        for dim_size in reversed(self.sparse_sizes):
+            coords.insert(0, flat % dim_size)
+            flat = flat // dim_size
+        values = self.values
+        if self.op == Average:
+            values = values / size()
+        output = torch.sparse_coo_tensor(torch.stack(coords), values, self.shape)
+        return output.to(self.device)
+
+
+def _sparse_allreduce_async(tensor, name, op, deduplicate):
+    if not _v2_api:
+        raise NotImplementedError(
+            'Sparse allreduce is not supported for PyTorch < 1.0')
+    if op != Average and op != Sum:
+        raise NotImplementedError(
+            'Sparse allreduce only supports Average and Sum.')
+    if not tensor.is_sparse:
+        raise ValueError('Sparse allreduce requires a sparse tensor.')
+
+    # Flatten the coordinates of the sparse dimensions into one row index, so
+    # that the core only deals with rows of the dense dimensions.
+    sparse_sizes = tensor.shape[:tensor.sparse_dim()]
+    coords = tensor._indices()
+    indices = torch.zeros(coords.shape[1], dtype=torch.int64, device=coords.device)
+    dense_rows = 1
+    for dim, dim_size in enumerate(sparse_sizes):
+        indices = indices * dim_size + coords[dim]
+        dense_rows *= dim_size
+
+    # The core reduces sparse tensors on the host.
+    values = tensor._values().cpu().contiguous()
+    indices = indices.cpu().contiguous()
+    output = _SparseAllreduceOutput(tensor, values.new(), indices.new(), op)
+
+    function = _check_function(_sparse_allreduce_function_factory, values)
+    handle = getattr(mpi_lib, function)(
+        values, indices, output.values, output.indices, dense_rows, deduplicate,
+        name.encode() if name is not None else _NULL)
+    _handle_map[handle] = ((values, indices), output)
+    return handle
+
+
+def sparse_allreduce_async(tensor, name=None, op=Average, deduplicate=True):
+    """
+    A function that asynchronously averages or sums a sparse tensor over all
+    Horovod processes. The input tensor is not modified.
+
+    Rather than densifying the tensor, the indices and values of all processes
+    are exchanged in a single collective and rows with the same index are
+    summed up. If the combined tensors are dense enough, as controlled by
+    HOROVOD_SPARSE_DENSITY_THRESHOLD, a dense allreduce is done instead and the
+    result holds all rows.
+
+    Arguments:
+        tensor: A sparse COO tensor to reduce.
+        name: A name of the reduction operation.
+        op: The reduction operation to combine tensors across different ranks,
+            either Average or Sum. Defaults to Average.
+        deduplicate: If True, rows with the same index are summed up, otherwise
+                     the result may hold the same index several times.
+
+    Returns:
+        A handle to the sparse allreduce operation that can be used with
+        `poll()` or `synchronize()`.
+    """
+    return _sparse_allreduce_async(tensor, name, op, deduplicate)
+
+
+def sparse_allreduce(tensor, name=None, op=Average, deduplicate=True):
+    """
+    A function that averages or sums a sparse tensor over all Horovod
+    processes. The input tensor is not modified.
+
+    Rather than densifying the tensor, the indices and values of all processes
+    are exchanged in a single collective and rows with the same index are
+    summed up. If the combined tensors are dense enough, as controlled by
+    HOROVOD_SPARSE_DENSITY_THRESHOLD, a dense allreduce is done instead and the
+    result holds all rows.
+
+    Arguments:
+        tensor: A sparse COO tensor to reduce.
+        name: A name of the reduction operation.
+        op: The reduction operation to combine tensors across different ranks,
+            either Average or Sum. Defaults to Average.
+        deduplicate: If True, rows with the same index are summed up, otherwise
+                     the result may hold the same index several times.
+
+    Returns:
+        A sparse tensor of the same shape and type as `tensor`, on the same
+        device, reduced across all processes.
+    """
+    handle = sparse_allreduce_async(tensor, name, op, deduplicate)
+    return synchronize(handle)
+
+
+def _reduce_function_factory(tensor):
+    return 'horovod_torch_reduce_async_' + tensor.type().replace('.', '_')
+
+
+def _reduce_async(tensor, output, root_rank, name, op):
+    if op not in (Average, Sum, Min, Max, Product):
+        raise NotImplementedError(
+            'Reduce supports only Average, Sum, Min, Max and Product.')
+
+    # Averaging happens in framework code, as for allreduce, and only on the
+    # root rank, which receives the reduced tensor.
+    divisor = size() if op == Average and rank() == root_rank else 1
+    true_op = Sum if op == Average else op
+    function = _check_function(_reduce_function_factory, tensor)
+    handle = getattr(mpi_lib, function)(
+        tensor, output, divisor, root_rank,
+        name.encode() if name is not None else _NULL, true_op)
+    _handle_map[handle] = (tensor, output)
+    return handle
+
+
+def reduce_async(tensor, root_rank, name=None, op=Average):
+    """
+    A function that asynchronously reduces the input tensor over all the
+    Horovod processes into the output of the root rank. The input tensor is
+    not modified.
+
+    The input tensors on the different processes must have the same shape.
+    The reduction runs on the host, so GPU tensors are staged through host
+    memory.
+
+    Arguments:
+        tensor: A tensor to reduce.
+        root_rank: The rank receiving the reduced tensor.
+        name: A name of the reduce operation.
+        op: The reduction operation to combine tensors across different ranks,
+            one of Average (default), Sum, Min, Max or Product.
+
+    Returns:
+        A handle to the reduce operation that can be used with `poll()` or
+        `synchronize()`.
+    """
+    output = tensor.new(tensor.shape)
+    return _reduce_async(tensor, output, root_rank, name, op)
+
+
+def reduce(tensor, root_rank, name=None, op=Average):
+    """
+    A function that reduces the input tensor over all the Horovod processes
+    into the output of the root rank. The input tensor is not modified.
+
+    The input tensors on the different processes must have the same shape.
+    The reduction runs on the host, so GPU tensors are staged through host
+    memory.
+
+    Arguments:
+        tensor: A tensor to reduce.
+        root_rank: The rank receiving the reduced tensor.
+        name: A name of the reduce operation.
+        op: The reduction operation to combine tensors across different ranks,
+            one of Average (default), Sum, Min, Max or Product.
+
+    Returns:
+        A tensor of the same shape and type as `tensor`, holding the reduced
+        tensor on the root rank and a copy of `tensor` on other ranks.
+    """
+    handle = reduce_async(tensor, root_rank, name, op)
+    return synchronize(handle)
+
+
+def _gather_function_factory(tensor):
+    return 'horovod_torch_gather_async_' + tensor.type().replace('.', '_')
+
+
+def gather_async(tensor, root_rank, name=None):
+    """
+    A function that asynchronously concatenates the input tensor with the same
+    input tensor on all other Horovod processes into the output of the root
+    rank. The input tensor is not modified.
+
+    The concatenation is done on the first dimension, so the input tensors on
+    the different processes must have the same rank and shape, except for the
+    first dimension, which is allowed to be different.
+
+    Arguments:
+        tensor: A tensor to gather.
+        root_rank: The rank receiving the gathered tensor.
+        name: A name of the gather operation.
+
+    Returns:
+        A handle to the gather operation that can be used with `poll()` or
+        `synchronize()`.
+    """
+    function = _check_function(_gather_function_factory, tensor)
+    output = tensor.new()
+    handle = getattr(mpi_lib, function)(
+        tensor, output, root_rank, name.encode() if name is not None else _NULL)
+    _handle_map[handle] = (tensor, output)
+    return handle
+
+
+def gather(tensor, root_rank, name=None):
+    """
+    A function that concatenates the input tensor with the same input tensor
+    on all other Horovod processes into the output of the root rank. The input
+    tensor is not modified.
+
+    The concatenation is done on the first dimension, so the input tensors on
+    the different processes must have the same rank and shape, except for the
+    first dimension, which is allowed to be different.
+
+    Arguments:
+        tensor: A tensor to gather.
+        root_rank: The rank receiving the gathered tensor.
+        name: A name of the gather operation.
+
+    Returns:
+        A tensor of the same type as `tensor`, concatenated on dimension zero
+        across all processes on the root rank and with no rows on other ranks.
+    """
+    handle = gather_async(tensor, root_rank, name)
+    return synchronize(handle)
+
+
+def _scatter_function_factory(tensor):
+    return 'horovod_torch_scatter_async_' + tensor.type().replace('.', '_')
+
+
+def scatter_async(tensor, root_rank, name=None):
+    """
+    A function that asynchronously splits the input tensor of the root rank
+    along the first dimension and sends every Horovod process one slice of it.
+    The input tensor is not modified.
+
+    The first dimension is split as for `reducescatter()`, with the processes
+    of lower rank receiving one extra row. The input tensors on the different
+    processes must have the same shape, though only the tensor of the root
+    rank is sent.
+
+    Arguments:
+        tensor: A tensor to scatter.
+        root_rank: The rank sending its tensor.
+        name: A name of the scatter operation.
+
+    Returns:
+        A handle to the scatter operation that can be used with `poll()` or
+        `synchronize()`.
+    """
+    function = _check_function(_scatter_function_factory, tensor)
+    output = tensor.new()
+    handle = getattr(mpi_lib, function)(
+        tensor, output, root_rank, name.encode() if name is not None else _NULL)
+    _handle_map[handle] = (tensor, output)
+    return handle
+
+
+def scatter(tensor, root_rank, name=None):
+    """
+    A function that splits the input tensor of the root rank along the first
+    dimension and sends every Horovod process one slice of it. The input
+    tensor is not modified.
+
+    The first dimension is split as for `reducescatter()`, with the processes
+    of lower rank receiving one extra row. The input tensors on the different
+    processes must have the same shape, though only the tensor of the root
+    rank is sent.
+
+    Arguments:
+        tensor: A tensor to scatter.
+        root_rank: The rank sending its tensor.
+        name: A name of the scatter operation.
+
+    Returns:
+        A tensor of the same type as `tensor`, holding the slice of the tensor
+        of the root rank assigned to this process along the first dimension.
+    """
+    handle = scatter_async(tensor, root_rank, name)
+    return synchronize(handle)
 
 
 def _broadcast_function_factory(tensor):
     return 'horovod_torch_broadcast_async_' + tensor.type().replace('.', '_')
 
 
-def _broadcast_async(tensor, output, root_rank, name):
+def _broadcast_async(tensor, output, root_rank, name, process_set=0):
+    _check_process_set(process_set)
     function = _check_function(_broadcast_function_factory, tensor)
-    handle = getattr(mpi_lib, function)(
-        tensor, output, root_rank, name.encode() if name is not None else _NULL)
+    if _v2_api:
+        handle = getattr(mpi_lib, function)(
+            tensor, output, root_rank, name.encode() if name is not None else _NULL,
+            process_set)
+    else:
+        handle = getattr(mpi_lib, function)(
+            tensor, output, root_rank, name.encode() if name is not None else _NULL)
     _handle_map[handle] = (tensor, output)
     return handle
 
 
-def broadcast_async(tensor, root_rank, name=None):
+def broadcast_async(tensor, root_rank, name=None, process_set=0):
     """
     A function that asynchronously broadcasts the input tensor on root rank to the same
     input tensor on all other Horovod processes. The input tensor is not modified.
@@ -360,33 +959,37 @@ def broadcast_async(tensor, root_rank, name=None):
         tensor: A tensor to broadcast.
         root_rank: The rank to broadcast the value from.
         name: A name of the broadcast operation.
+        process_set: ID of the process set to broadcast within, as returned by
+                     `add_process_set()`, whose ranks root_rank refers to.
+                     Defaults to all processes.
 
     Returns:
         A handle to the broadcast operation that can be used with `poll()` or
         `synchronize()`.
     """
     output = tensor.new(tensor.shape)
-    return _broadcast_async(tensor, output, root_rank, name)
+    return _broadcast_async(tensor, output, root_rank, name, process_set)
 
 
 class HorovodBroadcast(torch.autograd.Function):
     """An autograd function that broadcasts a tensor."""
 
     @staticmethod
-    def forward(ctx, tensor, root_rank, name):
+    def forward(ctx, tensor, root_rank, name, process_set):
         ctx.root_rank = root_rank
-        handle = broadcast_async(tensor, root_rank, name)
+        ctx.process_set = process_set
+        handle = broadcast_async(tensor, root_rank, name, process_set)
         return synchronize(handle)
 
     @staticmethod
     def backward(ctx, grad_output):
-        grad_reduced = allreduce(grad_output, average=False)
-        if rank() != ctx.root_rank:
+        grad_reduced = allreduce(grad_output, average=False, process_set=ctx.process_set)
+        if process_set_rank(ctx.process_set) != ctx.root_rank:
             grad_reduced *= 0
-        return grad_reduced, None, None
+        return grad_reduced, None, None, None
 
 
-def broadcast(tensor, root_rank, name=None):
+def broadcast(tensor, root_rank, name=None, process_set=0):
     """
     A function that broadcasts the input tensor on root rank to the same input tensor
     on all other Horovod processes. The input tensor is not modified.
@@ -404,15 +1007,18 @@ def broadcast(tensor, root_rank, name=None):
         tensor: A tensor to broadcast.
         root_rank: The rank to broadcast the value from.
         name: A name of the broadcast operation.
+        process_set: ID of the process set to broadcast within, as returned by
+                     `add_process_set()`, whose ranks root_rank refers to.
+                     Defaults to all processes.
 
     Returns:
         A tensor of the same shape and type as `tensor`, with the value broadcasted
         from root rank.
     """
-    return HorovodBroadcast.apply(tensor, root_rank, name)
+    return HorovodBroadcast.apply(tensor, root_rank, name, process_set)
 
 
-def broadcast_async_(tensor, root_rank, name=None):
+def broadcast_async_(tensor, root_rank, name=None, process_set=0):
     """
     A function that asynchronously broadcasts the input tensor on root rank to the same
     input tensor on all other Horovod processes. The operation is performed in-place.
@@ -426,15 +1032,18 @@ def broadcast_async_(tensor, root_rank, name=None):
         tensor: A tensor to broadcast.
         root_rank: The rank to broadcast the value from.
         name: A name of the broadcast operation.
+        process_set: ID of the process set to broadcast within, as returned by
+                     `add_process_set()`, whose ranks root_rank refers to.
+                     Defaults to all processes.
 
     Returns:
         A handle to the broadcast operation that can be used with `poll()` or
         `synchronize()`.
     """
-    return _broadcast_async(tensor, tensor, root_rank, name)
+    return _broadcast_async(tensor, tensor, root_rank, name, process_set)
 
 
-def broadcast_(tensor, root_rank, name=None):
+def broadcast_(tensor, root_rank, name=None, process_set=0):
     """
     A function that broadcasts the input tensor on root rank to the same input tensor
     on all other Horovod processes. The operation is performed in-place.
@@ -448,12 +1057,191 @@ def broadcast_(tensor, root_rank, name=None):
         tensor: A tensor to broadcast.
         root_rank: The rank to broadcast the value from.
         name: A name of the broadcast operation.
+        process_set: ID of the process set to broadcast within, as returned by
+                     `add_process_set()`, whose ranks root_rank refers to.
+                     Defaults to all processes.
 
     Returns:
         A tensor of the same shape and type as `tensor`, with the value broadcasted
         from root rank.
     """
-    handle = broadcast_async_(tensor, root_rank, name)
+    handle = broadcast_async_(tensor, root_rank, name, process_set)
+    return synchronize(handle)
+
+
+def _grouped_allreduce_async(tensors, outputs, name, op, prescale_factor, postscale_factor,
+                             process_set=0):
+    if not _v2_api:
+        raise NotImplementedError(
+            'Grouped allreduce is not supported for PyTorch version {} < 1.0.0'
+            .format(torch.__version__))
+    if not tensors:
+        raise ValueError('Grouped allreduce needs at least one tensor.')
+    device = tensors[0].device
+    for tensor in tensors:
+        if tensor.device != device:
+            raise ValueError('Tensors of a grouped allreduce must be on the same device.')
+        _check_function(_allreduce_function_factory, tensor)
+
+    divisor = _allreduce_divisor(tensors[0], op, process_set)
+    # Averaging happens in framework code, so translate that to Sum for the actual call
+    true_op = Sum if op == Average else op
+
+    function = 'horovod_torch_grouped_allreduce_async'
+    if device.type == 'cuda':
+        function += '_cuda'
+    handle = getattr(mpi_lib, function)(list(tensors), list(outputs), divisor,
+                                        name.encode() if name is not None else _NULL, true_op,
+                                        prescale_factor, postscale_factor, process_set)
+    _handle_map[handle] = (tensors, outputs)
+    return handle
+
+
+def grouped_allreduce_async(tensors, average=None, name=None, op=None,
+                            prescale_factor=1.0, postscale_factor=1.0, process_set=0):
+    """
+    A function that performs asynchronous averaging or summation of a list of input
+    tensors over all the Horovod processes. The input tensors are not modified.
+
+    The tensors are negotiated as a group: none of them is reduced before all of them
+    are ready on all processes, and they are fused together, the same way every step.
+    Groups must be enqueued in the same order on all Horovod processes.
+
+    Arguments:
+        tensors: A list of tensors to reduce, all on the same device.
+        average: DEPRECATED, please use op instead.
+        name: A name of the group of reduction operations.
+        op: The reduction operation to combine tensors across different
+                   ranks. Defaults to Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensors before allreduce.
+        postscale_factor: Multiplicative factor to scale tensors after allreduce.
+        process_set: ID of the process set to reduce the tensors over, as returned by
+                     `add_process_set()`. Defaults to all processes.
+
+    Returns:
+        A handle to the group allreduce operation that can be used with `poll()` or
+        `synchronize()`, which returns the list of reduced tensors.
+    """
+    op = handle_average_backwards_compatibility(op, average)
+    outputs = [tensor.new(tensor.shape) for tensor in tensors]
+    return _grouped_allreduce_async(tensors, outputs, name, op,
+                                    prescale_factor, postscale_factor, process_set)
+
+
+class HorovodGroupedAllreduce(torch.autograd.Function):
+    """An autograd function that performs allreduce on a list of tensors."""
+
+    @staticmethod
+    def forward(ctx, average, name, op, prescale_factor, postscale_factor, process_set,
+                *tensors):
+        ctx.average = average
+        ctx.op = op
+        ctx.prescale_factor = prescale_factor
+        ctx.postscale_factor = postscale_factor
+        ctx.process_set = process_set
+        handle = grouped_allreduce_async(list(tensors), average, name, op,
+                                         prescale_factor, postscale_factor, process_set)
+        return tuple(synchronize(handle))
+
+    @staticmethod
+    def backward(ctx, *grad_outputs):
+        if ctx.op in (Min, Max, Product):
+            raise NotImplementedError(
+                'Gradients of grouped Min, Max and Product allreduce are not supported.')
+        grads = grouped_allreduce(list(grad_outputs), average=ctx.average, op=ctx.op,
+                                  prescale_factor=ctx.prescale_factor,
+                                  postscale_factor=ctx.postscale_factor,
+                                  process_set=ctx.process_set)
+        return (None, None, None, None, None, None) + tuple(grads)
+
+
+def grouped_allreduce(tensors, average=None, name=None, compression=Compression.none, op=None,
+                      prescale_factor=1.0, postscale_factor=1.0, process_set=0):
+    """
+    A function that performs averaging or summation of a list of input tensors over
+    all the Horovod processes. The input tensors are not modified.
+
+    The tensors are negotiated as a group: none of them is reduced before all of them
+    are ready on all processes, and they are fused together, the same way every step.
+    Groups must be enqueued in the same order on all Horovod processes.
+
+    This acts as a thin wrapper around an autograd function.  If your input
+    tensors require gradients, then callings this function will allow gradients
+    to be computed and backpropagated.
+
+    Arguments:
+        tensors: A list of tensors to reduce, all on the same device.
+        average: DEPRECATED, please use op instead.
+        name: A name of the group of reduction operations.
+        compression: Compression algorithm used during allreduce to reduce the amount
+                     of data sent during the each parameter update step.  Defaults to
+                     not using compression.
+        op: The reduction operation to combine tensors across different ranks. Defaults
+            to Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensors before allreduce.
+        postscale_factor: Multiplicative factor to scale tensors after allreduce.
+        process_set: ID of the process set to reduce the tensors over, as returned by
+                     `add_process_set()`. Defaults to all processes.
+
+    Returns:
+        A list of tensors of the same shapes and types as `tensors`, averaged or summed
+        across all processes.
+    """
+    tensors_compressed, ctxs = zip(*[compression.compress(tensor) for tensor in tensors])
+    summed_tensors_compressed = HorovodGroupedAllreduce.apply(
+        average, name, op, prescale_factor, postscale_factor, process_set,
+        *tensors_compressed)
+    return [compression.decompress(t, ctx) for t, ctx in zip(summed_tensors_compressed, ctxs)]
+
+
+def grouped_allreduce_async_(tensors, average=None, name=None, op=None,
+                             prescale_factor=1.0, postscale_factor=1.0, process_set=0):
+    """
+    A function that performs asynchronous in-place averaging or summation of a list
+    of input tensors over all the Horovod processes, negotiated as a group.
+
+    Arguments:
+        tensors: A list of tensors to reduce, all on the same device.
+        average: DEPRECATED, please use op instead.
+        name: A name of the group of reduction operations.
+        op: The reduction operation to combine tensors across different ranks. Defaults to
+            Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensors before allreduce.
+        postscale_factor: Multiplicative factor to scale tensors after allreduce.
+        process_set: ID of the process set to reduce the tensors over, as returned by
+                     `add_process_set()`. Defaults to all processes.
+
+    Returns:
+        A handle to the group allreduce operation that can be used with `poll()` or
+        `synchronize()`.
+    """
+    op = handle_average_backwards_compatibility(op, average)
+    return _grouped_allreduce_async(tensors, tensors, name, op,
+                                    prescale_factor, postscale_factor, process_set)
+
+
+def grouped_allreduce_(tensors, average=None, name=None, op=None,
+                       prescale_factor=1.0, postscale_factor=1.0, process_set=0):
+    """
+    A function that performs in-place averaging or summation of a list of input
+    tensors over all the Horovod processes, negotiated as a group.
+
+    Arguments:
+        tensors: A list of tensors to reduce, all on the same device.
+        average: DEPRECATED, please use op instead.
+        name: A name of the group of reduction operations.
+        op: The reduction operation to combine tensors across different ranks. Defaults to
+            Average if None is given.
+        prescale_factor: Multiplicative factor to scale tensors before allreduce.
+        postscale_factor: Multiplicative factor to scale tensors after allreduce.
+        process_set: ID of the process set to reduce the tensors over, as returned by
+                     `add_process_set()`. Defaults to all processes.
+
+    Returns:
+        The list of tensors, averaged or summed across all processes.
+    """
+    handle = grouped_allreduce_async_(tensors, average, name, op,
+                                      prescale_factor, postscale_factor, process_set)
     return synchronize(handle)
 
 
@@ -489,6 +1277,8 @@ def synchronize(handle):
         return
     mpi_lib.horovod_torch_wait_and_clear(handle)
     _, output = _handle_map.pop(handle)
+    if isinstance(output, _SparseAllreduceOutput):
+        return output.assemble()
     return output
 
 
@@ -16,6 +16,7 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <torch/extension.h>
 #include <torch/torch.h>
@@ -48,38 +49,86 @@ int GetDeviceID(const ::torch::Tensor& tensor) {
   return CPU_DEVICE_ID;
 }
 
+// Marks the handle of a group done once all of its tensors are done, with
+// the first error reported for any of them.
+class GroupCompletion {
+public:
+  GroupCompletion(int handle, int num_tensors)
+      : handle_(handle), remaining_(num_tensors) {}
+
+  void Done(const Status& status) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!status.ok() && status_.ok()) {
+      status_ = status;
+    }
+    if (--remaining_ == 0) {
+      handle_manager.MarkDone(handle_, status_);
+    }
+  }
+
+private:
+  int handle_;
+  int remaining_;
+  Status status_ = Status::OK();
+  std::mutex mutex_;
+};
+
 } // namespace
 
 int DoAllreduce(::torch::Tensor tensor, ::torch::Tensor output, int divisor,
-                const std::string& name, int reduce_op_int) {
+                const std::string& name, int reduce_op_int,
+                double prescale_factor, double postscale_factor,
+                int process_set_id) {
   ThrowIfError(common::CheckInitialized());
 
   auto handle = handle_manager.AllocateHandle();
   auto device = GetDeviceID(tensor);
+  ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
+
+  // The core scales CPU tensors while copying them into and out of the
+  // fusion buffer, GPU tensors are scaled here. Integer averages keep the
+  // exact division.
+  double output_factor = 1.0;
+  if (device != CPU_DEVICE_ID) {
+    if (prescale_factor != 1.0) {
+      with_device device_guard(device);
+      tensor = tensor.mul(prescale_factor);
+    }
+    output_factor = postscale_factor;
+    prescale_factor = 1.0;
+    postscale_factor = 1.0;
+  } else if (tensor.is_floating_point()) {
+    postscale_factor /= divisor;
+    divisor = 1;
+  }
+
   auto ready_event = RecordReadyEvent(device);
   auto hvd_tensor = std::make_shared<TorchTensor>(tensor);
   auto hvd_context = std::make_shared<TorchOpContext>(device, output);
   auto hvd_output = std::make_shared<TorchTensor>(output);
 
-  ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
-  
   auto enqueue_result = EnqueueTensorAllreduce(
       hvd_context, hvd_tensor, hvd_output, ready_event,
       GetOpName("allreduce", name, handle), device,
-      [handle, divisor, output](const Status& status) mutable {
+      [handle, divisor, output_factor, output](const Status& status) mutable {
         // Will execute in the `device` context.
         if (divisor > 1) {
           output.div_(divisor);
         }
+        if (output_factor != 1.0) {
+          output.mul_(output_factor);
+        }
         handle_manager.MarkDone(handle, status);
-      }, reduce_op);
+      }, reduce_op, prescale_factor, postscale_factor, process_set_id);
   ThrowIfError(enqueue_result);
 
   return handle;
 }
 
 int DoAllreduceCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output, int divisor,
-                         const std::string& name, int reduce_op_int) {
+                         const std::string& name, int reduce_op_int,
+                         double prescale_factor, double postscale_factor,
+                         int process_set_id) {
   ThrowIfError(common::CheckInitialized());
 
   // Make async copy of input tensor to CPU tensor and record completion event.
@@ -92,6 +141,13 @@ int DoAllreduceCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output, int div
   auto hvd_context =
       std::make_shared<TorchOpContext>(CPU_DEVICE_ID, cpu_buffer);
 
+  // The reduction runs on the CPU, so the core does the scaling. Integer
+  // averages keep the exact division.
+  if (tensor.is_floating_point()) {
+    postscale_factor /= divisor;
+    divisor = 1;
+  }
+
   ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
   auto handle = handle_manager.AllocateHandle();
   auto enqueue_result = EnqueueTensorAllreduce(
@@ -107,13 +163,148 @@ int DoAllreduceCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output, int div
           output.div_(divisor);
         }
         handle_manager.MarkDone(handle, status);
-      }, reduce_op);
+      }, reduce_op, prescale_factor, postscale_factor, process_set_id);
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoGroupedAllreduce(const std::vector<::torch::Tensor>& tensors,
+                       const std::vector<::torch::Tensor>& outputs, int divisor,
+                       const std::string& name, int reduce_op_int,
+                       double prescale_factor, double postscale_factor,
+                       int process_set_id) {
+  ThrowIfError(common::CheckInitialized());
+
+  auto handle = handle_manager.AllocateHandle();
+  auto device = GetDeviceID(tensors[0]);
+  ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
+
+  // Tensors of a group share their scale factors, so the divisor is only
+  // folded into them if no tensor needs the exact integer division.
+  bool all_floating_point = true;
+  for (auto& tensor : tensors) {
+    all_floating_point &= tensor.is_floating_point();
+  }
+  double output_factor = 1.0;
+  if (device != CPU_DEVICE_ID) {
+    output_factor = postscale_factor;
+  } else if (all_floating_point) {
+    postscale_factor /= divisor;
+    divisor = 1;
+  }
+
+  std::vector<std::shared_ptr<OpContext>> hvd_contexts;
+  std::vector<std::shared_ptr<Tensor>> hvd_tensors;
+  std::vector<std::shared_ptr<Tensor>> hvd_outputs;
+  std::vector<std::shared_ptr<ReadyEvent>> ready_events;
+  std::vector<std::string> names;
+  std::vector<StatusCallback> callbacks;
+
+  auto completion = std::make_shared<GroupCompletion>(handle, tensors.size());
+  auto group_name = GetOpName("grouped_allreduce", name, handle);
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    auto tensor = tensors[i];
+    auto output = outputs[i];
+    if (device != CPU_DEVICE_ID && prescale_factor != 1.0) {
+      with_device device_guard(device);
+      tensor = tensor.mul(prescale_factor);
+    }
+    hvd_contexts.push_back(std::make_shared<TorchOpContext>(device, output));
+    hvd_tensors.push_back(std::make_shared<TorchTensor>(tensor));
+    hvd_outputs.push_back(std::make_shared<TorchTensor>(output));
+    ready_events.push_back(RecordReadyEvent(device));
+    names.push_back(group_name + "." + std::to_string(i));
+    callbacks.push_back([completion, divisor, output_factor,
+                         output](const Status& status) mutable {
+      // Will execute in the `device` context.
+      if (divisor > 1) {
+        output.div_(divisor);
+      }
+      if (output_factor != 1.0) {
+        output.mul_(output_factor);
+      }
+      completion->Done(status);
+    });
+  }
+  if (device != CPU_DEVICE_ID) {
+    prescale_factor = 1.0;
+    postscale_factor = 1.0;
+  }
+
+  auto enqueue_result = EnqueueTensorAllreduces(
+      hvd_contexts, hvd_tensors, hvd_outputs, ready_events, names, device,
+      callbacks, reduce_op, prescale_factor, postscale_factor, process_set_id);
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoGroupedAllreduceCudaOnCPU(const std::vector<::torch::Tensor>& tensors,
+                                const std::vector<::torch::Tensor>& outputs,
+                                int divisor, const std::string& name,
+                                int reduce_op_int, double prescale_factor,
+                                double postscale_factor, int process_set_id) {
+  ThrowIfError(common::CheckInitialized());
+
+  auto handle = handle_manager.AllocateHandle();
+  auto device = GetDeviceID(tensors[0]);
+  ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
+
+  // The reduction runs on the CPU, so the core does the scaling. Integer
+  // averages keep the exact division.
+  bool all_floating_point = true;
+  for (auto& tensor : tensors) {
+    all_floating_point &= tensor.is_floating_point();
+  }
+  if (all_floating_point) {
+    postscale_factor /= divisor;
+    divisor = 1;
+  }
+
+  std::vector<std::shared_ptr<OpContext>> hvd_contexts;
+  std::vector<std::shared_ptr<Tensor>> hvd_cpu_buffers;
+  std::vector<std::shared_ptr<ReadyEvent>> ready_events;
+  std::vector<std::string> names;
+  std::vector<StatusCallback> callbacks;
+
+  auto completion = std::make_shared<GroupCompletion>(handle, tensors.size());
+  auto group_name = GetOpName("grouped_allreduce", name, handle);
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    // Make async copy of input tensor to CPU tensor and record completion
+    // event.
+    auto cpu_buffer =
+        tensors[i].to(::torch::Device(::torch::kCPU), /*non_blocking=*/true);
+    auto output = outputs[i];
+    hvd_contexts.push_back(
+        std::make_shared<TorchOpContext>(CPU_DEVICE_ID, cpu_buffer));
+    hvd_cpu_buffers.push_back(std::make_shared<TorchTensor>(cpu_buffer));
+    ready_events.push_back(RecordReadyEvent(device));
+    names.push_back(group_name + "." + std::to_string(i));
+    callbacks.push_back([completion, divisor, cpu_buffer, output,
+                         device](const Status& status) mutable {
+      // Since the operation was on CPU, need to perform copy with the GPU
+      // device guard.
+      with_device device_guard(device);
+      output.copy_(cpu_buffer);
+      if (divisor > 1) {
+        output.div_(divisor);
+      }
+      completion->Done(status);
+    });
+  }
+
+  auto enqueue_result = EnqueueTensorAllreduces(
+      hvd_contexts, hvd_cpu_buffers, hvd_cpu_buffers, ready_events, names,
+      CPU_DEVICE_ID, callbacks, reduce_op, prescale_factor, postscale_factor,
+      process_set_id);
   ThrowIfError(enqueue_result);
 
   return handle;
 }
 
-int DoAllgather(::torch::Tensor tensor, ::torch::Tensor output, const std::string& name) {
+int DoAllgather(::torch::Tensor tensor, ::torch::Tensor output, const std::string& name,
+                int process_set_id) {
   ThrowIfError(common::CheckInitialized());
 
   auto device = GetDeviceID(tensor);
@@ -127,14 +318,14 @@ int DoAllgather(::torch::Tensor tensor, ::torch::Tensor output, const std::strin
                              GetOpName("allgather", name, handle), device,
                              [handle](const Status& status) {
                                handle_manager.MarkDone(handle, status);
-                             });
+                             }, process_set_id);
   ThrowIfError(enqueue_result);
 
   return handle;
 }
 
 int DoAllgatherCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output,
-                         const std::string& name) {
+                         const std::string& name, int process_set_id) {
   ThrowIfError(common::CheckInitialized());
 
   // Make async copy of input tensor to CPU tensor and record completion event.
@@ -161,14 +352,14 @@ int DoAllgatherCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output,
         output.resize_(cpu_output.sizes());
         output.copy_(cpu_output);
         handle_manager.MarkDone(handle, status);
-      });
+      }, process_set_id);
   ThrowIfError(enqueue_result);
 
   return handle;
 }
 
 int DoBroadcast(::torch::Tensor tensor, ::torch::Tensor output, int root_rank,
-                const std::string& name) {
+                const std::string& name, int process_set_id) {
   ThrowIfError(common::CheckInitialized());
 
   auto device = GetDeviceID(tensor);
@@ -176,7 +367,8 @@ int DoBroadcast(::torch::Tensor tensor, ::torch::Tensor output, int root_rank,
   auto hvd_tensor = std::make_shared<TorchTensor>(tensor);
   auto hvd_context = std::make_shared<TorchOpContext>(device, output);
   std::shared_ptr<Tensor> hvd_output = nullptr;
-  if (horovod_rank() == root_rank) {
+  // The root rank is relative to the process set.
+  if (horovod_process_set_rank(process_set_id) == root_rank) {
     if (tensor.data_ptr() != output.data_ptr()) {
       with_device device_guard(device);
       output.copy_(tensor);
@@ -191,14 +383,14 @@ int DoBroadcast(::torch::Tensor tensor, ::torch::Tensor output, int root_rank,
                              ready_event, GetOpName("broadcast", name, handle),
                              device, [handle](const Status& status) {
                                handle_manager.MarkDone(handle, status);
-                             });
+                             }, process_set_id);
   ThrowIfError(enqueue_result);
 
   return handle;
 }
 
 int DoBroadcastCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output, int root_rank,
-                         const std::string& name) {
+                         const std::string& name, int process_set_id) {
   ThrowIfError(common::CheckInitialized());
 
   // Make async copy of input tensor to CPU tensor and record completion event.
@@ -221,6 +413,322 @@ int DoBroadcastCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output, int roo
         with_device device_guard(device);
         output.copy_(cpu_buffer);
         handle_manager.MarkDone(handle, status);
+      }, process_set_id);
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoReducescatter(::torch::Tensor tensor, ::torch::Tensor output, int divisor,
+                    const std::string& name, int reduce_op_int) {
+  ThrowIfError(common::CheckInitialized());
+
+  auto device = GetDeviceID(tensor);
+  auto ready_event = RecordReadyEvent(device);
+  auto hvd_tensor = std::make_shared<TorchTensor>(tensor);
+  auto hvd_context = std::make_shared<TorchOpContext>(device, output);
+
+  ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result = EnqueueTensorReducescatter(
+      hvd_context, hvd_tensor, ready_event,
+      GetOpName("reducescatter", name, handle), device,
+      [handle, divisor, output](const Status& status) mutable {
+        // Will execute in the `device` context.
+        if (divisor > 1) {
+          output.div_(divisor);
+        }
+        handle_manager.MarkDone(handle, status);
+      }, reduce_op);
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoReducescatterCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output,
+                             int divisor, const std::string& name,
+                             int reduce_op_int) {
+  ThrowIfError(common::CheckInitialized());
+
+  // Make async copy of input tensor to CPU tensor and record completion event.
+  auto device = GetDeviceID(tensor);
+  auto cpu_tensor =
+      tensor.to(::torch::Device(::torch::kCPU), /*non_blocking=*/true);
+  auto hvd_cpu_tensor = std::make_shared<TorchTensor>(cpu_tensor);
+  auto ready_event = RecordReadyEvent(device);
+
+  auto cpu_output = ::torch::empty_like(cpu_tensor);
+  auto hvd_context =
+      std::make_shared<TorchOpContext>(CPU_DEVICE_ID, cpu_output);
+
+  ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result = EnqueueTensorReducescatter(
+      hvd_context, hvd_cpu_tensor, ready_event,
+      GetOpName("reducescatter", name, handle), CPU_DEVICE_ID,
+      [handle, divisor, cpu_output, output,
+       device](const Status& status) mutable {
+        // Since the operation was on CPU, need to perform copy with the GPU
+        // device guard.
+        with_device device_guard(device);
+        // output needs to be resized before copying in the CPU tensor.
+        output.resize_(cpu_output.sizes());
+        output.copy_(cpu_output);
+        if (divisor > 1) {
+          output.div_(divisor);
+        }
+        handle_manager.MarkDone(handle, status);
+      }, reduce_op);
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoAlltoall(::torch::Tensor tensor, const std::vector<int64_t>& splits,
+               ::torch::Tensor output, const std::string& name) {
+  ThrowIfError(common::CheckInitialized());
+
+  auto device = GetDeviceID(tensor);
+  auto ready_event = RecordReadyEvent(device);
+  auto hvd_tensor = std::make_shared<TorchTensor>(tensor);
+  auto hvd_context = std::make_shared<TorchOpContext>(device, output);
+
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result =
+      EnqueueTensorAlltoall(hvd_context, hvd_tensor, splits, ready_event,
+                            GetOpName("alltoall", name, handle), device,
+                            [handle](const Status& status) {
+                              handle_manager.MarkDone(handle, status);
+                            });
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoAlltoallCudaOnCPU(::torch::Tensor tensor,
+                        const std::vector<int64_t>& splits,
+                        ::torch::Tensor output, const std::string& name) {
+  ThrowIfError(common::CheckInitialized());
+
+  // Make async copy of input tensor to CPU tensor and record completion event.
+  auto device = GetDeviceID(tensor);
+  auto cpu_tensor =
+      tensor.to(::torch::Device(::torch::kCPU), /*non_blocking=*/true);
+  auto hvd_cpu_tensor = std::make_shared<TorchTensor>(cpu_tensor);
+  auto ready_event = RecordReadyEvent(device);
+
+  auto cpu_output = ::torch::empty_like(cpu_tensor);
+  auto hvd_context =
+      std::make_shared<TorchOpContext>(CPU_DEVICE_ID, cpu_output);
+
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result = EnqueueTensorAlltoall(
+      hvd_context, hvd_cpu_tensor, splits, ready_event,
+      GetOpName("alltoall", name, handle), CPU_DEVICE_ID,
+      [handle, cpu_output, output, device](const Status& status) mutable {
+        // Since the operation was on CPU, need to perform copy with the GPU
+        // device guard.
+        with_device device_guard(device);
+        // output needs to be resized before copying in the CPU tensor.
+        output.resize_(cpu_output.sizes());
+        output.copy_(cpu_output);
+        handle_manager.MarkDone(handle, status);
+      });
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoReduce(::torch::Tensor tensor, ::torch::Tensor output, int divisor,
+             int root_rank, const std::string& name, int reduce_op_int) {
+  ThrowIfError(common::CheckInitialized());
+
+  auto device = GetDeviceID(tensor);
+  auto ready_event = RecordReadyEvent(device);
+  auto hvd_tensor = std::make_shared<TorchTensor>(tensor);
+  auto hvd_context = std::make_shared<TorchOpContext>(device, output);
+  auto hvd_output = std::make_shared<TorchTensor>(output);
+
+  ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result = EnqueueTensorReduce(
+      hvd_context, hvd_tensor, hvd_output, root_rank, ready_event,
+      GetOpName("reduce", name, handle), device,
+      [handle, divisor, output](const Status& status) mutable {
+        // Will execute in the `device` context.
+        if (divisor > 1) {
+          output.div_(divisor);
+        }
+        handle_manager.MarkDone(handle, status);
+      }, reduce_op);
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoReduceCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output,
+                      int divisor, int root_rank, const std::string& name,
+                      int reduce_op_int) {
+  ThrowIfError(common::CheckInitialized());
+
+  // Make async copy of input tensor to CPU tensor and record completion event.
+  auto device = GetDeviceID(tensor);
+  auto cpu_buffer =
+      tensor.to(::torch::Device(::torch::kCPU), /*non_blocking=*/true);
+  auto hvd_cpu_buffer = std::make_shared<TorchTensor>(cpu_buffer);
+  auto ready_event = RecordReadyEvent(device);
+
+  auto hvd_context =
+      std::make_shared<TorchOpContext>(CPU_DEVICE_ID, cpu_buffer);
+
+  ReduceOp reduce_op = static_cast<ReduceOp>(reduce_op_int);
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result = EnqueueTensorReduce(
+      hvd_context, hvd_cpu_buffer, hvd_cpu_buffer, root_rank, ready_event,
+      GetOpName("reduce", name, handle), CPU_DEVICE_ID,
+      [handle, divisor, cpu_buffer, output,
+       device](const Status& status) mutable {
+        // Since the operation was on CPU, need to perform copy with the GPU
+        // device guard.
+        with_device device_guard(device);
+        output.copy_(cpu_buffer);
+        if (divisor > 1) {
+          output.div_(divisor);
+        }
+        handle_manager.MarkDone(handle, status);
+      }, reduce_op);
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoGather(::torch::Tensor tensor, ::torch::Tensor output, int root_rank,
+             const std::string& name) {
+  ThrowIfError(common::CheckInitialized());
+
+  auto device = GetDeviceID(tensor);
+  auto ready_event = RecordReadyEvent(device);
+  auto hvd_tensor = std::make_shared<TorchTensor>(tensor);
+  auto hvd_context = std::make_shared<TorchOpContext>(device, output);
+
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result =
+      EnqueueTensorGather(hvd_context, hvd_tensor, root_rank, ready_event,
+                          GetOpName("gather", name, handle), device,
+                          [handle](const Status& status) {
+                            handle_manager.MarkDone(handle, status);
+                          });
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoGatherCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output,
+                      int root_rank, const std::string& name) {
+  ThrowIfError(common::CheckInitialized());
+
+  // Make async copy of input tensor to CPU tensor and record completion event.
+  auto device = GetDeviceID(tensor);
+  auto cpu_tensor =
+      tensor.to(::torch::Device(::torch::kCPU), /*non_blocking=*/true);
+  auto hvd_cpu_tensor = std::make_shared<TorchTensor>(cpu_tensor);
+  auto ready_event = RecordReadyEvent(device);
+
+  auto cpu_output = ::torch::empty_like(cpu_tensor);
+  auto hvd_context =
+      std::make_shared<TorchOpContext>(CPU_DEVICE_ID, cpu_output);
+
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result = EnqueueTensorGather(
+      hvd_context, hvd_cpu_tensor, root_rank, ready_event,
+      GetOpName("gather", name, handle), CPU_DEVICE_ID,
+      [handle, cpu_output, output, device](const Status& status) mutable {
+        // Since the operation was on CPU, need to perform copy with the GPU
+        // device guard.
+        with_device device_guard(device);
+        // output needs to be resized before copying in the CPU tensor.
+        output.resize_(cpu_output.sizes());
+        output.copy_(cpu_output);
+        handle_manager.MarkDone(handle, status);
+      });
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoScatter(::torch::Tensor tensor, ::torch::Tensor output, int root_rank,
+              const std::string& name) {
+  ThrowIfError(common::CheckInitialized());
+
+  auto device = GetDeviceID(tensor);
+  auto ready_event = RecordReadyEvent(device);
+  auto hvd_tensor = std::make_shared<TorchTensor>(tensor);
+  auto hvd_context = std::make_shared<TorchOpContext>(device, output);
+
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result =
+      EnqueueTensorScatter(hvd_context, hvd_tensor, root_rank, ready_event,
+                           GetOpName("scatter", name, handle), device,
+                           [handle](const Status& status) {
+                             handle_manager.MarkDone(handle, status);
+                           });
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoScatterCudaOnCPU(::torch::Tensor tensor, ::torch::Tensor output,
+                       int root_rank, const std::string& name) {
+  ThrowIfError(common::CheckInitialized());
+
+  // Make async copy of input tensor to CPU tensor and record completion event.
+  auto device = GetDeviceID(tensor);
+  auto cpu_tensor =
+      tensor.to(::torch::Device(::torch::kCPU), /*non_blocking=*/true);
+  auto hvd_cpu_tensor = std::make_shared<TorchTensor>(cpu_tensor);
+  auto ready_event = RecordReadyEvent(device);
+
+  auto cpu_output = ::torch::empty_like(cpu_tensor);
+  auto hvd_context =
+      std::make_shared<TorchOpContext>(CPU_DEVICE_ID, cpu_output);
+
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result = EnqueueTensorScatter(
+      hvd_context, hvd_cpu_tensor, root_rank, ready_event,
+      GetOpName("scatter", name, handle), CPU_DEVICE_ID,
+      [handle, cpu_output, output, device](const Status& status) mutable {
+        // Since the operation was on CPU, need to perform copy with the GPU
+        // device guard.
+        with_device device_guard(device);
+        // output needs to be resized before copying in the CPU tensor.
+        output.resize_(cpu_output.sizes());
+        output.copy_(cpu_output);
+        handle_manager.MarkDone(handle, status);
+      });
+  ThrowIfError(enqueue_result);
+
+  return handle;
+}
+
+int DoSparseAllreduce(::torch::Tensor values, ::torch::Tensor indices,
+                      ::torch::Tensor output_values,
+                      ::torch::Tensor output_indices, int64_t dense_rows,
+                      bool deduplicate, const std::string& name) {
+  ThrowIfError(common::CheckInitialized());
+
+  auto device = GetDeviceID(values);
+  auto ready_event = RecordReadyEvent(device);
+  auto hvd_values = std::make_shared<TorchTensor>(values);
+  auto hvd_indices = std::make_shared<TorchTensor>(indices);
+  auto hvd_context = std::make_shared<TorchOpContext>(
+      device, std::vector<::torch::Tensor>{output_values, output_indices});
+
+  auto handle = handle_manager.AllocateHandle();
+  auto enqueue_result = EnqueueTensorSparseAllreduce(
+      hvd_context, hvd_indices, hvd_values, dense_rows, deduplicate,
+      ready_event, GetOpName("sparse_allreduce", name, handle), device,
+      [handle](const Status& status) {
+        handle_manager.MarkDone(handle, status);
       });
   ThrowIfError(enqueue_result);
 
@@ -288,6 +796,28 @@ PYBIND11_MODULE(mpi_lib_v2, m) {
         &DoAllreduceCudaOnCPU);
 #endif
 
+  // grouped allreduce
+  m.def("horovod_torch_grouped_allreduce_async", &DoGroupedAllreduce);
+#if HOROVOD_GPU_ALLREDUCE
+  m.def("horovod_torch_grouped_allreduce_async_cuda", &DoGroupedAllreduce);
+#else
+  m.def("horovod_torch_grouped_allreduce_async_cuda",
+        &DoGroupedAllreduceCudaOnCPU);
+#endif
+
+  // sparse allreduce, whose values and indices are staged on CPU by the
+  // caller
+  m.def("horovod_torch_sparse_allreduce_async_torch_IntTensor",
+        &DoSparseAllreduce);
+  m.def("horovod_torch_sparse_allreduce_async_torch_LongTensor",
+        &DoSparseAllreduce);
+  m.def("horovod_torch_sparse_allreduce_async_torch_HalfTensor",
+        &DoSparseAllreduce);
+  m.def("horovod_torch_sparse_allreduce_async_torch_FloatTensor",
+        &DoSparseAllreduce);
+  m.def("horovod_torch_sparse_allreduce_async_torch_DoubleTensor",
+        &DoSparseAllreduce);
+
   // allgather
   m.def("horovod_torch_allgather_async_torch_ByteTensor", &DoAllgather);
   m.def("horovod_torch_allgather_async_torch_CharTensor", &DoAllgather);
@@ -362,6 +892,136 @@ PYBIND11_MODULE(mpi_lib_v2, m) {
         &DoBroadcastCudaOnCPU);
 #endif
 
+  // reducescatter
+  m.def("horovod_torch_reducescatter_async_torch_ByteTensor", &DoReducescatter);
+  m.def("horovod_torch_reducescatter_async_torch_CharTensor", &DoReducescatter);
+  m.def("horovod_torch_reducescatter_async_torch_ShortTensor", &DoReducescatter);
+  m.def("horovod_torch_reducescatter_async_torch_IntTensor", &DoReducescatter);
+  m.def("horovod_torch_reducescatter_async_torch_LongTensor", &DoReducescatter);
+  m.def("horovod_torch_reducescatter_async_torch_HalfTensor", &DoReducescatter);
+  m.def("horovod_torch_reducescatter_async_torch_FloatTensor", &DoReducescatter);
+  m.def("horovod_torch_reducescatter_async_torch_DoubleTensor", &DoReducescatter);
+  m.def("horovod_torch_reducescatter_async_torch_cuda_ByteTensor",
+        &DoReducescatterCudaOnCPU);
+  m.def("horovod_torch_reducescatter_async_torch_cuda_CharTensor",
+        &DoReducescatterCudaOnCPU);
+  m.def("horovod_torch_reducescatter_async_torch_cuda_ShortTensor",
+        &DoReducescatterCudaOnCPU);
+  m.def("horovod_torch_reducescatter_async_torch_cuda_IntTensor",
+        &DoReducescatterCudaOnCPU);
+  m.def("horovod_torch_reducescatter_async_torch_cuda_LongTensor",
+        &DoReducescatterCudaOnCPU);
+  m.def("horovod_torch_reducescatter_async_torch_cuda_HalfTensor",
+        &DoReducescatterCudaOnCPU);
+  m.def("horovod_torch_reducescatter_async_torch_cuda_FloatTensor",
+        &DoReducescatterCudaOnCPU);
+  m.def("horovod_torch_reducescatter_async_torch_cuda_DoubleTensor",
+        &DoReducescatterCudaOnCPU);
+
+  // alltoall
+  m.def("horovod_torch_alltoall_async_torch_ByteTensor", &DoAlltoall);
+  m.def("horovod_torch_alltoall_async_torch_CharTensor", &DoAlltoall);
+  m.def("horovod_torch_alltoall_async_torch_ShortTensor", &DoAlltoall);
+  m.def("horovod_torch_alltoall_async_torch_IntTensor", &DoAlltoall);
+  m.def("horovod_torch_alltoall_async_torch_LongTensor", &DoAlltoall);
+  m.def("horovod_torch_alltoall_async_torch_HalfTensor", &DoAlltoall);
+  m.def("horovod_torch_alltoall_async_torch_FloatTensor", &DoAlltoall);
+  m.def("horovod_torch_alltoall_async_torch_DoubleTensor", &DoAlltoall);
+  m.def("horovod_torch_alltoall_async_torch_cuda_ByteTensor",
+        &DoAlltoallCudaOnCPU);
+  m.def("horovod_torch_alltoall_async_torch_cuda_CharTensor",
+        &DoAlltoallCudaOnCPU);
+  m.def("horovod_torch_alltoall_async_torch_cuda_ShortTensor",
+        &DoAlltoallCudaOnCPU);
+  m.def("horovod_torch_alltoall_async_torch_cuda_IntTensor",
+        &DoAlltoallCudaOnCPU);
+  m.def("horovod_torch_alltoall_async_torch_cuda_LongTensor",
+        &DoAlltoallCudaOnCPU);
+  m.def("horovod_torch_alltoall_async_torch_cuda_HalfTensor",
+        &DoAlltoallCudaOnCPU);
+  m.def("horovod_torch_alltoall_async_torch_cuda_FloatTensor",
+        &DoAlltoallCudaOnCPU);
+  m.def("horovod_torch_alltoall_async_torch_cuda_DoubleTensor",
+        &DoAlltoallCudaOnCPU);
+
+  // reduce
+  m.def("horovod_torch_reduce_async_torch_ByteTensor", &DoReduce);
+  m.def("horovod_torch_reduce_async_torch_CharTensor", &DoReduce);
+  m.def("horovod_torch_reduce_async_torch_ShortTensor", &DoReduce);
+  m.def("horovod_torch_reduce_async_torch_IntTensor", &DoReduce);
+  m.def("horovod_torch_reduce_async_torch_LongTensor", &DoReduce);
+  m.def("horovod_torch_reduce_async_torch_HalfTensor", &DoReduce);
+  m.def("horovod_torch_reduce_async_torch_FloatTensor", &DoReduce);
+  m.def("horovod_torch_reduce_async_torch_DoubleTensor", &DoReduce);
+  m.def("horovod_torch_reduce_async_torch_cuda_ByteTensor",
+        &DoReduceCudaOnCPU);
+  m.def("horovod_torch_reduce_async_torch_cuda_CharTensor",
+        &DoReduceCudaOnCPU);
+  m.def("horovod_torch_reduce_async_torch_cuda_ShortTensor",
+        &DoReduceCudaOnCPU);
+  m.def("horovod_torch_reduce_async_torch_cuda_IntTensor",
+        &DoReduceCudaOnCPU);
+  m.def("horovod_torch_reduce_async_torch_cuda_LongTensor",
+        &DoReduceCudaOnCPU);
+  m.def("horovod_torch_reduce_async_torch_cuda_HalfTensor",
+        &DoReduceCudaOnCPU);
+  m.def("horovod_torch_reduce_async_torch_cuda_FloatTensor",
+        &DoReduceCudaOnCPU);
+  m.def("horovod_torch_reduce_async_torch_cuda_DoubleTensor",
+        &DoReduceCudaOnCPU);
+
+  // gather
+  m.def("horovod_torch_gather_async_torch_ByteTensor", &DoGather);
+  m.def("horovod_torch_gather_async_torch_CharTensor", &DoGather);
+  m.def("horovod_torch_gather_async_torch_ShortTensor", &DoGather);
+  m.def("horovod_torch_gather_async_torch_IntTensor", &DoGather);
+  m.def("horovod_torch_gather_async_torch_LongTensor", &DoGather);
+  m.def("horovod_torch_gather_async_torch_HalfTensor", &DoGather);
+  m.def("horovod_torch_gather_async_torch_FloatTensor", &DoGather);
+  m.def("horovod_torch_gather_async_torch_DoubleTensor", &DoGather);
+  m.def("horovod_torch_gather_async_torch_cuda_ByteTensor",
+        &DoGatherCudaOnCPU);
+  m.def("horovod_torch_gather_async_torch_cuda_CharTensor",
+        &DoGatherCudaOnCPU);
+  m.def("horovod_torch_gather_async_torch_cuda_ShortTensor",
+        &DoGatherCudaOnCPU);
+  m.def("horovod_torch_gather_async_torch_cuda_IntTensor",
+        &DoGatherCudaOnCPU);
+  m.def("horovod_torch_gather_async_torch_cuda_LongTensor",
+        &DoGatherCudaOnCPU);
+  m.def("horovod_torch_gather_async_torch_cuda_HalfTensor",
+        &DoGatherCudaOnCPU);
+  m.def("horovod_torch_gather_async_torch_cuda_FloatTensor",
+        &DoGatherCudaOnCPU);
+  m.def("horovod_torch_gather_async_torch_cuda_DoubleTensor",
+        &DoGatherCudaOnCPU);
+
+  // scatter
+  m.def("horovod_torch_scatter_async_torch_ByteTensor", &DoScatter);
+  m.def("horovod_torch_scatter_async_torch_CharTensor", &DoScatter);
+  m.def("horovod_torch_scatter_async_torch_ShortTensor", &DoScatter);
+  m.def("horovod_torch_scatter_async_torch_IntTensor", &DoScatter);
+  m.def("horovod_torch_scatter_async_torch_LongTensor", &DoScatter);
+  m.def("horovod_torch_scatter_async_torch_HalfTensor", &DoScatter);
+  m.def("horovod_torch_scatter_async_torch_FloatTensor", &DoScatter);
+  m.def("horovod_torch_scatter_async_torch_DoubleTensor", &DoScatter);
+  m.def("horovod_torch_scatter_async_torch_cuda_ByteTensor",
+        &DoScatterCudaOnCPU);
+  m.def("horovod_torch_scatter_async_torch_cuda_CharTensor",
+        &DoScatterCudaOnCPU);
+  m.def("horovod_torch_scatter_async_torch_cuda_ShortTensor",
+        &DoScatterCudaOnCPU);
+  m.def("horovod_torch_scatter_async_torch_cuda_IntTensor",
+        &DoScatterCudaOnCPU);
+  m.def("horovod_torch_scatter_async_torch_cuda_LongTensor",
+        &DoScatterCudaOnCPU);
+  m.def("horovod_torch_scatter_async_torch_cuda_HalfTensor",
+        &DoScatterCudaOnCPU);
+  m.def("horovod_torch_scatter_async_torch_cuda_FloatTensor",
+        &DoScatterCudaOnCPU);
+  m.def("horovod_torch_scatter_async_torch_cuda_DoubleTensor",
+        &DoScatterCudaOnCPU);
+
   // join
   m.def("horovod_torch_join", &DoJoin);
 
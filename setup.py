@@ -646,6 +646,9 @@ def get_common_options(build_ext):
     SOURCES = ['horovod/common/common.cc',
                'horovod/common/controller.cc',
                'horovod/common/fusion_buffer_manager.cc',
+               'horovod/common/group_table.cc',
+               'horovod/common/process_set.cc',
+               'horovod/common/half.cc',
                'horovod/common/logging.cc',
                'horovod/common/message.cc',
                'horovod/common/operations.cc',
@@ -654,6 +657,7 @@ def get_common_options(build_ext):
                'horovod/common/stall_inspector.cc',
                'horovod/common/timeline.cc',
                'horovod/common/tensor_queue.cc',
+               'horovod/common/ops/allreduce_algorithm_table.cc',
                'horovod/common/ops/collective_operations.cc',
                'horovod/common/ops/operation_manager.cc',
                'horovod/common/optim/bayesian_optimization.cc',
@@ -687,10 +691,11 @@ def get_common_options(build_ext):
 
     if have_mpi:
         MACROS += [('HAVE_MPI', '1')]
-        SOURCES += ['horovod/common/half.cc',
-                    'horovod/common/mpi/mpi_context.cc',
+        SOURCES += ['horovod/common/mpi/mpi_context.cc',
                     'horovod/common/mpi/mpi_controller.cc',
+                    'horovod/common/mpi/mpi_progress_engine.cc',
                     'horovod/common/ops/mpi_operations.cc',
+                    'horovod/common/ops/mpi_allreduce_algorithms.cc',
                     'horovod/common/ops/adasum/adasum_mpi.cc',
                     'horovod/common/ops/adasum_mpi_operations.cc']
         COMPILE_FLAGS += shlex.split(mpi_flags)
@@ -59,6 +59,14 @@ def mpi_env_rank_and_size():
     return 0, 1
 
 
+def size_before_init():
+    """Returns the number of ranks before Horovod is initialized, from the
+    variables set by horovodrun with Gloo or by mpirun."""
+    if 'HOROVOD_SIZE' in os.environ:
+        return int(os.environ['HOROVOD_SIZE'])
+    return mpi_env_rank_and_size()[1]
+
+
 @contextlib.contextmanager
 def tempdir():
     dirpath = tempfile.mkdtemp()
@@ -21,14 +21,19 @@ import contextlib
 import copy
 import os
 import sys
+import threading
+import time
 import unittest
 import warnings
 
 import pytest
 from mock import MagicMock
+from six.moves.urllib.error import HTTPError
+from six.moves.urllib.request import Request, urlopen
 
 from horovod.run.common.util import config_parser, secret, settings as hvd_settings, timeout
 from horovod.run.common.util.host_hash import _hash, host_hash
+from horovod.run.http.http_server import KVStoreServer
 from horovod.run.mpi_run import _get_mpi_implementation_flags, _LARGE_CLUSTER_THRESHOLD as large_cluster_threshold, mpi_run
 from horovod.run.run import parse_args
 
@@ -45,6 +50,38 @@ def override_args(tool=None, *args):
         sys.argv = old
 
 
+@contextlib.contextmanager
+def kvstore_server():
+    server = KVStoreServer(verbose=False)
+    port = server.start_server()
+    try:
+        yield port
+    finally:
+        server.shutdown_server()
+
+
+def kvstore_put(port, scope, key, value):
+    req = Request('http://127.0.0.1:{port}/{scope}/{key}'.format(
+        port=port, scope=scope, key=key), data=value)
+    req.get_method = lambda: 'PUT'
+    urlopen(req)
+
+
+def kvstore_batched_get(port, scope, keys, wait_ms):
+    """Looks up the keys with a single POST and returns the values found."""
+    req = Request('http://127.0.0.1:{port}/{scope}/?wait_ms={wait_ms}'.format(
+        port=port, scope=scope, wait_ms=wait_ms),
+        data='\n'.join(keys).encode('utf-8'))
+    req.get_method = lambda: 'POST'
+    body = urlopen(req).read()
+    values = {}
+    while body:
+        key, length, body = body.split(b'\n', 2)
+        values[key.decode('utf-8')] = body[:int(length)]
+        body = body[int(length):]
+    return values
+
+
 @contextlib.contextmanager
 def override_env(env):
     old = os.environ.copy()
@@ -359,3 +396,51 @@ class RunTests(unittest.TestCase):
 
         with pytest.raises(RuntimeError, match="^mpirun failed with exit code 1$") as e:
             mpi_run(settings, None, {}, cmd, run_func=run_func)
+
+    def test_kvstore_batched_get(self):
+        """Test that a batched GET returns the values of all keys found, which
+        may contain newlines, and leaves out the missing ones."""
+        with kvstore_server() as port:
+            kvstore_put(port, 'scope', 'a', b'value a')
+            kvstore_put(port, 'scope', 'b', b'value\nb\n')
+            kvstore_put(port, 'other', 'c', b'value c')
+
+            values = kvstore_batched_get(port, 'scope', ['a', 'b', 'c'], 0)
+            self.assertEqual({'a': b'value a', 'b': b'value\nb\n'}, values)
+
+            with pytest.raises(HTTPError) as e:
+                urlopen(Request('http://127.0.0.1:{port}/scope/?wait_ms=x'
+                                .format(port=port), data=b'a'))
+            self.assertEqual(400, e.value.code)
+
+    def test_kvstore_batched_get_timeout(self):
+        """Test that a batched GET of missing keys returns what it found once
+        wait_ms elapsed."""
+        with kvstore_server() as port:
+            kvstore_put(port, 'scope', 'a', b'value a')
+
+            start = time.time()
+            values = kvstore_batched_get(port, 'scope', ['a', 'b'], 200)
+            elapsed = time.time() - start
+
+            self.assertEqual({'a': b'value a'}, values)
+            self.assertGreaterEqual(elapsed, 0.2)
+            self.assertLess(elapsed, 5)
+
+    def test_kvstore_batched_get_wakes_on_put(self):
+        """Test that a batched GET waiting for keys returns as soon as the
+        last one is put, rather than when wait_ms elapsed."""
+        with kvstore_server() as port:
+            kvstore_put(port, 'scope', 'a', b'value a')
+            timer = threading.Timer(
+                0.2, lambda: kvstore_put(port, 'scope', 'b', b'value b'))
+            timer.start()
+            try:
+                start = time.time()
+                values = kvstore_batched_get(port, 'scope', ['a', 'b'], 30000)
+                elapsed = time.time() - start
+            finally:
+                timer.join()
+
+            self.assertEqual({'a': b'value a', 'b': b'value b'}, values)
+            self.assertLess(elapsed, 10)
@@ -149,6 +149,126 @@ class MPITests(tf.test.TestCase):
             self.assertTrue(diff <= threshold,
                             "hvd.allreduce produces incorrect results")
 
+    def test_horovod_grouped_allreduce_cpu(self):
+        """Test on CPU that the grouped allreduce correctly sums a group of 1D,
+        2D, 3D tensors."""
+        hvd.init()
+        size = hvd.size()
+        dtypes = self.filter_supported_types([tf.int32, tf.int64, tf.float16, tf.float32, tf.float64])
+        for dtype in dtypes:
+            with tf.device("/cpu:0"):
+                tensors = [self.random_uniform(
+                    [17] * dim, -100, 100, dtype=dtype) for dim in [1, 2, 3]]
+                summed = hvd.grouped_allreduce(tensors, average=False)
+            max_difference = tf.reduce_max(
+                [tf.reduce_max(tf.abs(t1 - t2 * size))
+                 for t1, t2 in zip(summed, tensors)])
+
+            # Threshold for floating point equality depends on number of
+            # ranks, since we're comparing against precise multiplication.
+            if size <= 3 or dtype in [tf.int32, tf.int64]:
+                threshold = 0
+            elif size < 10:
+                threshold = 1e-4
+            elif size < 15:
+                threshold = 5e-4
+            else:
+                break
+
+            diff = self.evaluate(max_difference)
+            self.assertTrue(diff <= threshold,
+                            "hvd.grouped_allreduce produces incorrect results")
+
+    def test_horovod_grouped_allreduce_grad_cpu(self):
+        """Test the correctness of the grouped allreduce gradient on CPU."""
+        hvd.init()
+        size = hvd.size()
+        dtypes = [tf.float32, tf.float64]
+        for dtype in dtypes:
+            with tf.device("/cpu:0"):
+                if _executing_eagerly():
+                    tensors = [self.tfe.Variable(self.random_uniform(
+                        [5] * dim, -100, 100, dtype=dtype)) for dim in [1, 2, 3]]
+                    with tf.GradientTape() as tape:
+                        summed = hvd.grouped_allreduce(tensors, average=False)
+                else:
+                    tensors = [self.random_uniform(
+                        [5] * dim, -100, 100, dtype=dtype) for dim in [1, 2, 3]]
+                    summed = hvd.grouped_allreduce(tensors, average=False)
+
+                grads_ys = [tf.ones([5] * dim, dtype=dtype) for dim in [1, 2, 3]]
+                if _executing_eagerly():
+                    grads_out = tape.gradient(summed, tensors, grads_ys)
+                else:
+                    grads = tf.gradients(summed, tensors, grads_ys)
+                    grads_out = [self.evaluate(grad) for grad in grads]
+
+            for grad_out, dim in zip(grads_out, [1, 2, 3]):
+                expected = np.ones([5] * dim) * size
+                err = np.linalg.norm(expected - grad_out)
+                self.assertLess(err, 0.00000001,
+                                "gradient %s differs from expected %s, "
+                                "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_allreduce_cpu_min_max_product(self):
+        """Test on CPU that the allreduce correctly computes the elementwise
+        minimum, maximum and product of 1D, 2D, 3D tensors."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # Keep the product exactly representable in every type.
+        if size > 16:
+            return
+
+        dtypes = self.filter_supported_types([tf.int32, tf.int64, tf.float16, tf.float32, tf.float64])
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            with tf.device("/cpu:0"):
+                base = tf.cast(tf.round(self.random_uniform(
+                    [17] * dim, -100, 100, dtype=tf.float32)), dtype)
+                tensor = base + tf.cast(rank, dtype)
+                minimum = hvd.allreduce(tensor, op=hvd.Min)
+                maximum = hvd.allreduce(tensor, op=hvd.Max)
+                factor = tf.fill([17] * dim, tf.cast(1 + rank % 2, dtype))
+                product = hvd.allreduce(factor, op=hvd.Product)
+
+            min_difference = tf.reduce_max(tf.abs(minimum - base))
+            max_difference = tf.reduce_max(
+                tf.abs(maximum - base - tf.cast(size - 1, dtype)))
+            product_difference = tf.reduce_max(
+                tf.abs(product - tf.cast(2 ** (size // 2), dtype)))
+            self.assertEqual(self.evaluate(min_difference), 0,
+                             "hvd.allreduce produces incorrect minimum")
+            self.assertEqual(self.evaluate(max_difference), 0,
+                             "hvd.allreduce produces incorrect maximum")
+            self.assertEqual(self.evaluate(product_difference), 0,
+                             "hvd.allreduce produces incorrect product")
+
+    def test_horovod_allreduce_cpu_prescale_postscale(self):
+        """Test on CPU that the allreduce correctly scales 1D, 2D, 3D tensors
+        before and after the reduction."""
+        hvd.init()
+        size = hvd.size()
+        dtypes = self.filter_supported_types([tf.float16, tf.float32, tf.float64])
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            with tf.device("/cpu:0"):
+                tensor = tf.cast(tf.round(self.random_uniform(
+                    [17] * dim, -100, 100, dtype=tf.float32)), dtype)
+                # Powers of two keep the scaled sums exact.
+                prescaled = hvd.allreduce(tensor, op=hvd.Sum, prescale_factor=0.5)
+                postscaled = hvd.allreduce(tensor, op=hvd.Sum, postscale_factor=0.25)
+
+            prescale_difference = tf.reduce_max(
+                tf.abs(prescaled - tensor * tf.cast(0.5 * size, dtype)))
+            postscale_difference = tf.reduce_max(
+                tf.abs(postscaled - tensor * tf.cast(0.25 * size, dtype)))
+            self.assertEqual(self.evaluate(prescale_difference), 0,
+                             "hvd.allreduce produces incorrect prescaled results")
+            self.assertEqual(self.evaluate(postscale_difference), 0,
+                             "hvd.allreduce produces incorrect postscaled results")
+
     def test_horovod_allreduce_cpu_fused(self):
         """Test on CPU that the allreduce correctly sums 1D, 2D, 3D tensors
         with Tensor Fusion."""
@@ -337,6 +457,22 @@ class MPITests(tf.test.TestCase):
         with self.assertRaises(tf.errors.FailedPreconditionError):
             self.evaluate(hvd.allreduce(tensor))
 
+    def test_horovod_allreduce_reduce_op_error(self):
+        """Test that the allreduce raises an error if different ranks try to
+        reduce a tensor with different reduction operations."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # This test does not apply if there is only one worker.
+        if size == 1:
+            return
+
+        tensor = tf.ones([17] * 3)
+        with self.assertRaises(tf.errors.FailedPreconditionError):
+            self.evaluate(hvd.allreduce(
+                tensor, op=hvd.Min if rank % 2 == 0 else hvd.Max))
+
     def test_horovod_allreduce_type_error(self):
         """Test that the allreduce raises an error if different ranks try to
         send tensors of different type."""
@@ -416,6 +552,89 @@ class MPITests(tf.test.TestCase):
                             "gradient %s differs from expected %s, "
                             "error: %s" % (grad_out, expected, str(err)))
 
+    def test_horovod_allreduce_grad_min_max_cpu(self):
+        """Test the correctness of the allreduce minimum and maximum gradients
+        on CPU."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # As of TensorFlow v1.9, gradients are not supported on
+        # integer tensors
+        dtypes = [tf.float32, tf.float64]
+        dims = [1, 2, 3]
+        for dtype, dim, (op, extreme_rank) in itertools.product(
+                dtypes, dims, [(hvd.Min, 0), (hvd.Max, size - 1)]):
+            with tf.device("/cpu:0"):
+                value = self.random_uniform(
+                    [5] * dim, -100, 100, dtype=dtype) + tf.cast(rank, dtype)
+                if _executing_eagerly():
+                    tensor = self.tfe.Variable(value)
+                    with tf.GradientTape() as tape:
+                        reduced = hvd.allreduce(tensor, op=op)
+                else:
+                    tensor = value
+                    reduced = hvd.allreduce(tensor, op=op)
+
+                grad_ys = tf.ones([5] * dim, dtype=dtype)
+                if _executing_eagerly():
+                    grad_out = tape.gradient(reduced, tensor, grad_ys)
+                else:
+                    grad = tf.gradients(reduced, tensor, grad_ys)[0]
+                    grad_out = self.evaluate(grad)
+
+            # Only the rank holding the extreme value receives gradient.
+            expected = np.ones([5] * dim) * (size if rank == extreme_rank else 0)
+            err = np.linalg.norm(expected - grad_out)
+            self.assertLess(err, 0.00000001,
+                            "gradient %s differs from expected %s, "
+                            "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_allreduce_grad_product_cpu(self):
+        """Test the correctness of the allreduce product gradient on CPU,
+        including inputs holding zeros."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # Element 0 is zero on rank 0 and element 1 on ranks 0 and 1, the
+        # gradient of other elements is the product of the other ranks.
+        def make_input(r):
+            value = np.full(17, 1.0 + 0.25 * (r % 3))
+            if r == 0:
+                value[0] = 0.0
+            if r < 2:
+                value[1] = 0.0
+            return value
+
+        inputs = np.stack([make_input(r) for r in range(size)])
+        expected = np.prod(np.delete(inputs, rank, axis=0), axis=0) * size
+
+        for dtype in [tf.float32, tf.float64]:
+            with tf.device("/cpu:0"):
+                value = tf.constant(inputs[rank], dtype=dtype)
+                if _executing_eagerly():
+                    tensor = self.tfe.Variable(value)
+                    with tf.GradientTape() as tape:
+                        reduced = hvd.allreduce(tensor, op=hvd.Product)
+                else:
+                    tensor = value
+                    reduced = hvd.allreduce(tensor, op=hvd.Product)
+
+                grad_ys = tf.ones([17], dtype=dtype)
+                if _executing_eagerly():
+                    grad_out = tape.gradient(reduced, tensor, grad_ys)
+                else:
+                    grad = tf.gradients(reduced, tensor, grad_ys)[0]
+                    grad_out = self.evaluate(grad)
+
+            assert np.all(np.isfinite(grad_out)), \
+                'gradient %s of allreduce product is not finite' % grad_out
+            err = np.linalg.norm(expected - grad_out)
+            self.assertLess(err, 0.00001,
+                            "gradient %s differs from expected %s, "
+                            "error: %s" % (grad_out, expected, str(err)))
+
     def test_horovod_allreduce_grad_gpu(self):
         """Test the correctness of the allreduce gradient on GPU."""
         # Only do this test if there are GPUs available.
@@ -800,6 +1019,346 @@ class MPITests(tf.test.TestCase):
                             "error: %s" %
                             (grad_out, expected, str(err)))
 
+    def test_horovod_reducescatter(self):
+        """Test that the reducescatter correctly sums and scatters 1D, 2D, 3D
+        tensors, also when the first dimension does not divide evenly."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [tf.int32, tf.int64, tf.float16, tf.float32, tf.float64]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            with tf.device("/cpu:0"):
+                tensor = tf.ones([size * 3 + 1] + [17] * (dim - 1)) * rank
+                tensor = tf.cast(tensor, dtype=dtype)
+                reduced = hvd.reducescatter(tensor, op=hvd.Sum)
+
+            reduced_tensor = self.evaluate(reduced)
+            expected_rows = 4 if rank == 0 else 3
+            self.assertEqual(list(reduced_tensor.shape),
+                             [expected_rows] + [17] * (dim - 1))
+            self.assertTrue(
+                self.evaluate(tf.reduce_all(
+                    tf.equal(tf.cast(reduced_tensor, tf.int32),
+                             size * (size - 1) // 2))),
+                "hvd.reducescatter produces incorrect results")
+
+    def test_horovod_reducescatter_fused(self):
+        """Test that the reducescatter correctly averages and scatters 1D, 2D,
+        3D tensors with Tensor Fusion."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [tf.float32, tf.float64]
+        dims = [1, 2, 3]
+        tests = []
+        for dtype, dim in itertools.product(dtypes, dims):
+            with tf.device("/cpu:0"):
+                # Row i holds i on every rank, so the average is the row index.
+                rows = tf.reshape(tf.range(size * 2, dtype=dtype),
+                                  [size * 2] + [1] * (dim - 1))
+                tensor = rows * tf.ones([size * 2] + [17] * (dim - 1), dtype=dtype)
+                averaged = hvd.reducescatter(tensor)
+            expected = tf.slice(tensor, [rank * 2] + [0] * (dim - 1),
+                                [2] + [-1] * (dim - 1))
+            tests.append(tf.reduce_all(tf.equal(averaged, expected)))
+        self.assertTrue(self.evaluate(tf.reduce_all(tests)),
+                        "hvd.reducescatter produces incorrect results")
+
+    def test_horovod_reducescatter_error(self):
+        """Test that the reducescatter returns an error if the tensor shapes
+        differ among the processes."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # This test does not apply if there is only one worker.
+        if size == 1:
+            return
+
+        tensor_size = [17] * 3
+        tensor_size[1] = 10 * (rank + 1)
+        with tf.device("/cpu:0"):
+            tensor = tf.ones(tensor_size, dtype=tf.float32) * rank
+            with self.assertRaises(tf.errors.FailedPreconditionError):
+                self.evaluate(hvd.reducescatter(tensor))
+
+    def test_horovod_reducescatter_grad_cpu(self):
+        """Test the correctness of the reducescatter gradient on CPU."""
+        hvd.init()
+        size = hvd.size()
+
+        # As of TensorFlow v1.9, gradients are not supported on
+        # integer tensors
+        dtypes = [tf.float32, tf.float64]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            with tf.device("/cpu:0"):
+                if _executing_eagerly():
+                    tensor = self.tfe.Variable(self.random_uniform(
+                        [size * 4] + [17] * (dim - 1), -100, 100, dtype=dtype))
+                    with tf.GradientTape() as tape:
+                        reduced = hvd.reducescatter(tensor, op=hvd.Sum)
+                    grad_ys = tf.ones([4] + [17] * (dim - 1), dtype=dtype)
+                    grad_out = tape.gradient(reduced, tensor, grad_ys)
+                else:
+                    tensor = self.random_uniform(
+                        [size * 4] + [17] * (dim - 1), -100, 100, dtype=dtype)
+                    reduced = hvd.reducescatter(tensor, op=hvd.Sum)
+                    grad_ys = tf.ones([4] + [17] * (dim - 1), dtype=dtype)
+                    grad = tf.gradients(reduced, tensor, grad_ys)[0]
+                    grad_out = self.evaluate(grad)
+
+            expected = np.ones([size * 4] + [17] * (dim - 1))
+            err = np.linalg.norm(expected - grad_out)
+            self.assertLess(err, 0.00000001,
+                            "gradient %s differs from expected %s, "
+                            "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_alltoall(self):
+        """Test that the alltoall correctly distributes 1D, 2D, 3D tensors with
+        the default even splits."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [tf.uint8, tf.int8, tf.int32, tf.int64, tf.float16, tf.float32,
+                  tf.float64]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            with tf.device("/cpu:0"):
+                # Row block j holds j, so every rank receives its own rank.
+                rows = tf.reshape(tf.tile(tf.reshape(tf.range(size), [size, 1]), [1, 2]),
+                                  [size * 2] + [1] * (dim - 1))
+                tensor = tf.cast(rows * tf.ones([size * 2] + [17] * (dim - 1),
+                                                dtype=tf.int32), dtype=dtype)
+                received = hvd.alltoall(tensor)
+
+            received_tensor = self.evaluate(received)
+            self.assertEqual(list(received_tensor.shape),
+                             [size * 2] + [17] * (dim - 1))
+            self.assertTrue(
+                self.evaluate(tf.reduce_all(
+                    tf.equal(tf.cast(received_tensor, tf.int32), rank))),
+                "hvd.alltoall produces incorrect results")
+
+    def test_horovod_alltoall_splits(self):
+        """Test that the alltoall correctly distributes 1D, 2D, 3D tensors with
+        uneven splits and Tensor Fusion."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [tf.int32, tf.int64, tf.float32, tf.float64]
+        dims = [1, 2, 3]
+        tests = []
+        for dtype, dim in itertools.product(dtypes, dims):
+            with tf.device("/cpu:0"):
+                # Every rank sends j + 1 rows holding its rank to rank j.
+                splits = tf.range(1, size + 1, dtype=tf.int32)
+                first_dim = size * (size + 1) // 2
+                tensor = tf.ones([first_dim] + [17] * (dim - 1), dtype=dtype) * rank
+                received = hvd.alltoall(tensor, splits)
+                expected = tf.reshape(
+                    tf.cast(tf.tile(tf.reshape(tf.range(size), [size, 1]), [1, rank + 1]),
+                            dtype=dtype),
+                    [size * (rank + 1)] + [1] * (dim - 1))
+            tests.append(tf.reduce_all(tf.equal(received, expected)))
+        self.assertTrue(self.evaluate(tf.reduce_all(tests)),
+                        "hvd.alltoall produces incorrect results")
+
+    def test_horovod_alltoall_error(self):
+        """Test that the alltoall returns an error if the splits do not cover
+        the first dimension of the tensor."""
+        hvd.init()
+        size = hvd.size()
+
+        with tf.device("/cpu:0"):
+            tensor = tf.ones([size * 2, 17], dtype=tf.float32)
+            splits = tf.ones([size], dtype=tf.int32)
+            with self.assertRaises(tf.errors.FailedPreconditionError):
+                self.evaluate(hvd.alltoall(tensor, splits))
+
+    def test_horovod_alltoall_grad_cpu(self):
+        """Test the correctness of the alltoall gradient on CPU."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # As of TensorFlow v1.9, gradients are not supported on
+        # integer tensors
+        dtypes = [tf.float32, tf.float64]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            with tf.device("/cpu:0"):
+                splits = tf.range(1, size + 1, dtype=tf.int32)
+                first_dim = size * (size + 1) // 2
+                # Every rank fills its gradient with its rank, so the rows sent
+                # to rank j get gradient j.
+                grad_ys = tf.ones([size * (rank + 1)] + [17] * (dim - 1),
+                                  dtype=dtype) * rank
+                if _executing_eagerly():
+                    tensor = self.tfe.Variable(self.random_uniform(
+                        [first_dim] + [17] * (dim - 1), -100, 100, dtype=dtype))
+                    with tf.GradientTape() as tape:
+                        received = hvd.alltoall(tensor, splits)
+                    grad_out = tape.gradient(received, tensor, grad_ys)
+                else:
+                    tensor = self.random_uniform(
+                        [first_dim] + [17] * (dim - 1), -100, 100, dtype=dtype)
+                    received = hvd.alltoall(tensor, splits)
+                    grad = tf.gradients(received, tensor, grad_ys)[0]
+                    grad_out = self.evaluate(grad)
+
+            expected = np.ones([first_dim] + [17] * (dim - 1))
+            start = 0
+            for j in range(size):
+                expected[start:start + j + 1] *= j
+                start += j + 1
+            err = np.linalg.norm(expected - grad_out)
+            self.assertLess(err, 0.00000001,
+                            "gradient %s differs from expected %s, "
+                            "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_sparse_allreduce_cpu(self):
+        """Test that the sparse allreduce sums up rows with the same index,
+        both when exchanging rows and when switching to a dense allreduce."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [tf.int32, tf.int64, tf.float16, tf.float32, tf.float64]
+        # A large dense tensor keeps the rows sparse, a small one makes the
+        # allreduce dense.
+        all_dense_rows = [100 * size, size + 1]
+        for dtype, dense_rows in itertools.product(dtypes, all_dense_rows):
+            with tf.device("/cpu:0"):
+                # Every rank sends its own row and the shared last row.
+                indices = tf.constant([rank, size], dtype=tf.int64)
+                values = tf.cast(tf.ones([2, 17]) * (rank + 1), dtype=dtype)
+                summed = hvd.sparse_allreduce(values, indices,
+                                              dense_rows=dense_rows)
+            summed_values, summed_indices = self.evaluate(summed)
+
+            dense = np.zeros([dense_rows, 17])
+            np.add.at(dense, summed_indices, summed_values.astype(np.float64))
+            expected = np.zeros([dense_rows, 17])
+            expected[:size] = np.arange(1, size + 1).reshape(size, 1)
+            expected[size] = size * (size + 1) // 2
+            self.assertEqual(len(set(summed_indices)), len(summed_indices),
+                             "hvd.sparse_allreduce does not deduplicate rows")
+            self.assertTrue(np.allclose(dense, expected),
+                            "hvd.sparse_allreduce produces incorrect results")
+
+    def test_horovod_allreduce_indexed_slices_cpu(self):
+        """Test that the allreduce of IndexedSlices on CPU averages the rows
+        of all processes."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        with tf.device("/cpu:0"):
+            slices = tf.IndexedSlices(
+                tf.ones([2, 17]) * (rank + 1),
+                tf.constant([rank, size], dtype=tf.int32),
+                dense_shape=tf.constant([100 * size, 17], dtype=tf.int32))
+            averaged = hvd.allreduce(slices)
+            dense = tf.math.unsorted_segment_sum(
+                averaged.values, averaged.indices, 100 * size)
+        dense = self.evaluate(dense)
+
+        expected = np.zeros([100 * size, 17])
+        expected[:size] = np.arange(1, size + 1).reshape(size, 1) / size
+        expected[size] = (size + 1) / 2.0
+        self.assertTrue(np.allclose(dense, expected),
+                        "hvd.allreduce produces incorrect results for "
+                        "IndexedSlices")
+
+    def test_horovod_reduce_cpu(self):
+        """Test that the reduce correctly sums 1D, 2D, 3D tensors into the
+        root rank and leaves the tensors of other ranks unchanged."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [tf.int32, tf.int64, tf.float16, tf.float32, tf.float64]
+        dims = [1, 2, 3]
+        root_ranks = list(range(size))
+        for dtype, dim, root_rank in itertools.product(dtypes, dims, root_ranks):
+            with tf.device("/cpu:0"):
+                tensor = tf.cast(tf.ones([17] * dim) * rank, dtype=dtype)
+                reduced = hvd.reduce(tensor, root_rank, op=hvd.Sum)
+
+            reduced_tensor = self.evaluate(reduced)
+            expected = size * (size - 1) // 2 if rank == root_rank else rank
+            self.assertEqual(list(reduced_tensor.shape), [17] * dim)
+            self.assertTrue(np.all(reduced_tensor.astype(np.int32) == expected),
+                            "hvd.reduce produces incorrect results")
+
+    def test_horovod_gather_cpu(self):
+        """Test that the gather correctly concatenates tensors of different
+        first dimensions on the root rank only."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [tf.uint8, tf.int8, tf.int32, tf.int64, tf.float16,
+                  tf.float32, tf.float64, tf.bool]
+        dims = [1, 2, 3]
+        root_ranks = list(range(size))
+        for dtype, dim, root_rank in itertools.product(dtypes, dims, root_ranks):
+            with tf.device("/cpu:0"):
+                tensor = tf.ones([rank + 1] + [17] * (dim - 1)) * (rank % 2)
+                tensor = tf.cast(tensor, dtype=dtype)
+                gathered = hvd.gather(tensor, root_rank)
+
+            gathered_tensor = self.evaluate(gathered)
+            if rank != root_rank:
+                self.assertEqual(gathered_tensor.shape[0], 0)
+                continue
+            self.assertEqual(list(gathered_tensor.shape),
+                             [size * (size + 1) // 2] + [17] * (dim - 1))
+            offset = 0
+            for r in range(size):
+                rank_rows = gathered_tensor[offset:offset + r + 1]
+                self.assertTrue(np.all(rank_rows.astype(np.int32) == r % 2),
+                                "hvd.gather produces incorrect results")
+                offset += r + 1
+
+    def test_horovod_scatter_cpu(self):
+        """Test that the scatter sends every rank its slice of the tensor of the
+        root rank, also when the first dimension does not divide evenly."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [tf.uint8, tf.int8, tf.int32, tf.int64, tf.float16,
+                  tf.float32, tf.float64]
+        dims = [1, 2, 3]
+        root_ranks = list(range(size))
+        first_dim = size * 3 + 1
+        for dtype, dim, root_rank in itertools.product(dtypes, dims, root_ranks):
+            # Row i of the root tensor holds i, other ranks send nothing.
+            rows = np.arange(first_dim).reshape([first_dim] + [1] * (dim - 1))
+            values = np.broadcast_to(rows, [first_dim] + [17] * (dim - 1))
+            if rank != root_rank:
+                values = np.zeros_like(values)
+            with tf.device("/cpu:0"):
+                tensor = tf.cast(tf.constant(values), dtype=dtype)
+                scattered = hvd.scatter(tensor, root_rank)
+
+            scattered_tensor = self.evaluate(scattered)
+            expected_rows = 4 if rank == 0 else 3
+            first_row = 0 if rank == 0 else 3 * rank + 1
+            self.assertEqual(list(scattered_tensor.shape),
+                             [expected_rows] + [17] * (dim - 1))
+            self.assertTrue(
+                np.all(scattered_tensor.astype(np.int32) ==
+                       rows[first_row:first_row + expected_rows]),
+                "hvd.scatter produces incorrect results")
+
     def test_horovod_broadcast(self):
         """Test that the broadcast correctly broadcasts 1D, 2D, 3D tensors."""
         hvd.init()
@@ -0,0 +1,143 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# =============================================================================
+
+"""Tests for the CPU allreduce algorithms of horovod.tensorflow."""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import itertools
+import numpy as np
+import os
+import tensorflow as tf
+from horovod.tensorflow.util import _executing_eagerly, _has_eager
+from tensorflow.python.framework import ops
+import warnings
+
+import horovod.tensorflow as hvd
+
+if hasattr(tf, 'ConfigProto'):
+    config = tf.ConfigProto()
+    config.gpu_options.allow_growth = True
+
+if hasattr(tf, 'config') and hasattr(tf.config, 'experimental') \
+        and hasattr(tf.config.experimental, 'set_memory_growth'):
+    gpus = tf.config.experimental.list_physical_devices('GPU')
+    for gpu in gpus:
+        tf.config.experimental.set_memory_growth(gpu, True)
+else:
+    if _has_eager:
+        # Specifies the config to use with eager execution. Does not preclude
+        # tests from running in the graph mode.
+        tf.enable_eager_execution(config=config)
+
+# MLSL supports only byte, float and double data types
+mlsl_supported_types = set([tf.float32, tf.float64])
+
+
+class AllreduceAlgorithmTests(tf.test.TestCase):
+    """
+    Tests for the CPU allreduce algorithms of horovod.tensorflow.
+
+    The algorithm is chosen when Horovod is initialized, so these tests run in
+    a process of their own, once for every value of
+    HOROVOD_CPU_ALLREDUCE_ALGORITHM the test pipeline sets, and on an odd
+    number of ranks as well.
+    """
+
+    def __init__(self, *args, **kwargs):
+        super(AllreduceAlgorithmTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def evaluate(self, tensors):
+        if _executing_eagerly():
+            return self._eval_helper(tensors)
+        sess = ops.get_default_session()
+        if sess is None:
+            with self.test_session(config=config) as sess:
+                return sess.run(tensors)
+        else:
+            return sess.run(tensors)
+
+    def filter_supported_types(self, types):
+        if 'MLSL_ROOT' in os.environ:
+           types = [t for t in types if t in mlsl_supported_types]
+        return types
+
+    def counts(self, size):
+        # Counts smaller than, equal to and just above the number of ranks
+        # leave some ranks without elements in ring and Rabenseifner.
+        return sorted(set([1, max(size - 1, 1), size, size + 1, 17, 1000,
+                           65537]))
+
+    def test_horovod_allreduce_algorithm_cpu(self):
+        """Test on CPU that the allreduce computes exact sums, minima, maxima
+        and products of tensors of all types, with fewer and more elements
+        than ranks."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+        dtypes = self.filter_supported_types(
+            [tf.int32, tf.int64, tf.float16, tf.float32, tf.float64])
+        reductions = [(hvd.Sum, lambda base: base * (rank + 1),
+                       lambda base: base * (size * (size + 1) // 2)),
+                      (hvd.Min, lambda base: base + rank, lambda base: base),
+                      (hvd.Max, lambda base: base + rank,
+                       lambda base: base + size - 1)]
+        # Keep the product exactly representable in every type.
+        if size <= 16:
+            reductions.append(
+                (hvd.Product, lambda base: np.full_like(base, 1 + rank % 2),
+                 lambda base: np.full_like(base, 2 ** (size // 2))))
+        for dtype, count, (op, value, expected) in itertools.product(
+                dtypes, self.counts(size), reductions):
+            # Small integers, so that results are exact in every type and
+            # order.
+            base = np.arange(count, dtype=np.float64) % 7
+            with tf.device("/cpu:0"):
+                tensor = tf.cast(tf.constant(value(base)), dtype)
+                reduced = hvd.allreduce(tensor, op=op)
+            result = self.evaluate(tf.cast(reduced, tf.float64))
+            self.assertTrue(np.array_equal(result, expected(base)),
+                            "hvd.allreduce produces incorrect results for %d "
+                            "elements of %s" % (count, dtype))
+
+    def test_horovod_allreduce_algorithm_bool_cpu(self):
+        """Test on CPU that the allreduce ors booleans for SUM and MAX and ands
+        them for MIN and PRODUCT."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+        if 'MLSL_ROOT' in os.environ:
+            self.skipTest('MLSL does not support booleans')
+        for count in self.counts(size):
+            index = np.arange(count)
+            values = [(index + r) % 3 == 0 for r in range(size)]
+            any_value = np.logical_or.reduce(values)
+            all_value = np.logical_and.reduce(values)
+            for op, expected in [(hvd.Sum, any_value), (hvd.Max, any_value),
+                                 (hvd.Min, all_value),
+                                 (hvd.Product, all_value)]:
+                with tf.device("/cpu:0"):
+                    reduced = hvd.allreduce(tf.constant(values[rank]), op=op)
+                result = self.evaluate(reduced)
+                self.assertTrue(np.array_equal(result, expected),
+                                "hvd.allreduce produces incorrect results for "
+                                "%d booleans" % count)
+
+
+if __name__ == '__main__':
+    tf.test.main()
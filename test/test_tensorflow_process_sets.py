@@ -0,0 +1,127 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import numpy as np
+import tensorflow as tf
+from horovod.tensorflow.util import _executing_eagerly, _has_eager
+from tensorflow.python.framework import ops
+import warnings
+
+import horovod.tensorflow as hvd
+
+from common import size_before_init
+
+if hasattr(tf, 'ConfigProto'):
+    config = tf.ConfigProto()
+    config.gpu_options.allow_growth = True
+
+if hasattr(tf, 'config') and hasattr(tf.config, 'experimental') \
+        and hasattr(tf.config.experimental, 'set_memory_growth'):
+    gpus = tf.config.experimental.list_physical_devices('GPU')
+    for gpu in gpus:
+        tf.config.experimental.set_memory_growth(gpu, True)
+else:
+    if _has_eager:
+        tf.enable_eager_execution(config=config)
+
+
+class TensorFlowProcessSetTests(tf.test.TestCase):
+    """
+    Tests for process sets in horovod.tensorflow.
+
+    Process sets are registered before Horovod is initialized, which can only
+    happen once per process with MPI, so these tests run in a process of their
+    own rather than in test_tensorflow.py.
+    """
+
+    def __init__(self, *args, **kwargs):
+        super(TensorFlowProcessSetTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def evaluate(self, tensors):
+        if _executing_eagerly():
+            return self._eval_helper(tensors)
+        sess = ops.get_default_session()
+        if sess is None:
+            with self.test_session(config=config) as sess:
+                return sess.run(tensors)
+        else:
+            return sess.run(tensors)
+
+    def test_horovod_process_set_collectives(self):
+        """Test that allreduce, allgather and broadcast on a process set only
+        involve its members, with ranks relative to the process set."""
+        even_ranks = list(range(0, size_before_init(), 2))
+        process_set = hvd.add_process_set(even_ranks)
+        hvd.init()
+        size = hvd.size()
+        rank = hvd.rank()
+
+        assert hvd.process_set_size(process_set) == len(even_ranks)
+        if rank % 2 == 0:
+            set_rank = hvd.process_set_rank(process_set)
+            set_size = len(even_ranks)
+            assert set_rank == rank // 2
+
+            with tf.device('/cpu:0'):
+                tensor = tf.constant([float(rank)])
+                summed = hvd.allreduce(tensor, op=hvd.Sum,
+                                       process_set=process_set)
+                averaged = hvd.allreduce(tensor, op=hvd.Average,
+                                         process_set=process_set)
+                gathered = hvd.allgather(tf.constant([rank]),
+                                         process_set=process_set)
+                root_rank = set_size - 1
+                broadcasted = hvd.broadcast(tf.constant([rank]), root_rank,
+                                            process_set=process_set)
+                summed, averaged, gathered, broadcasted = self.evaluate(
+                    [summed, averaged, gathered, broadcasted])
+
+            assert summed[0] == sum(even_ranks), \
+                'hvd.allreduce on a process set produces incorrect results'
+            assert np.isclose(averaged[0],
+                              float(sum(even_ranks)) / set_size), \
+                'hvd.allreduce on a process set produces incorrect average'
+            assert list(gathered) == even_ranks, \
+                'hvd.allgather on a process set produces incorrect results'
+            assert broadcasted[0] == even_ranks[root_rank], \
+                'hvd.broadcast on a process set produces incorrect results'
+
+            # The gradient of an allgather on a process set is the slice of
+            # this rank within the process set.
+            if not _executing_eagerly():
+                with tf.device('/cpu:0'):
+                    tensor = tf.ones([rank + 1, 3])
+                    gathered = hvd.allgather(tensor, process_set=process_set)
+                    grad_ys = tf.ones(tf.shape(gathered))
+                    grad = tf.gradients(gathered, tensor, grad_ys)[0]
+                    grad_out = self.evaluate(grad)
+                assert grad_out.shape == (rank + 1, 3) and \
+                    np.all(grad_out == set_size), \
+                    'gradient of hvd.allgather on a process set is incorrect'
+
+        # Collectives of the other ranks go on concurrently.
+        with tf.device('/cpu:0'):
+            summed = self.evaluate(hvd.allreduce(tf.constant([1.0]),
+                                                 op=hvd.Sum))
+        assert summed[0] == size
+
+
+if __name__ == "__main__":
+    tf.test.main()
@@ -70,6 +70,19 @@ class TorchTests(unittest.TestCase):
            types = [t for t in types if t in mlsl_supported_types]
         return types
 
+    def skip_unless_memory_available(self, nbytes):
+        # Tensors above 2^31 elements need a lot of host memory, and all ranks
+        # have to agree on skipping to avoid a hang in the collective.
+        try:
+            available = os.sysconf('SC_PAGE_SIZE') * os.sysconf('SC_AVPHYS_PAGES')
+        except (ValueError, OSError):
+            available = 0
+        enough = int(available >= nbytes * hvd.local_size())
+        enough = hvd.allreduce(torch.IntTensor([enough]), average=False,
+                               name='memory_check.%d' % nbytes)
+        if enough.item() != hvd.size():
+            self.skipTest('Not enough memory for tensors of %d bytes' % nbytes)
+
     def test_horovod_rank(self):
         """Test that the rank returned by hvd.rank() is correct."""
         mpi_rank, _ = mpi_env_rank_and_size()
@@ -171,6 +184,152 @@ class TorchTests(unittest.TestCase):
 
             assert max_difference <= threshold, 'hvd.allreduce produces incorrect results'
 
+    def test_horovod_allreduce_min_max(self):
+        """Test that the allreduce correctly computes the elementwise minimum
+        and maximum of 1D, 2D, 3D tensors."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+        dtypes = self.filter_supported_types([torch.IntTensor, torch.LongTensor,
+                     torch.FloatTensor, torch.DoubleTensor])
+        if _fp16_supported:
+            dtypes += self.filter_supported_types([torch.HalfTensor])
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+            if _fp16_supported:
+                dtypes += [torch.cuda.HalfTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            torch.manual_seed(1234)
+            base = torch.FloatTensor(*([17] * dim)).random_(-100, 100)
+            tensor = self.cast_and_place(base + rank, dtype)
+            minimum = hvd.allreduce(tensor, op=hvd.Min)
+            maximum = hvd.allreduce(tensor, op=hvd.Max)
+
+            assert minimum.cpu().float().equal(base), \
+                'hvd.allreduce produces incorrect minimum'
+            assert maximum.cpu().float().equal(base + size - 1), \
+                'hvd.allreduce produces incorrect maximum'
+
+    def test_horovod_allreduce_product(self):
+        """Test that the allreduce correctly multiplies 1D, 2D, 3D tensors."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # Keep the product exactly representable in every type.
+        if size > 16:
+            return
+
+        dtypes = self.filter_supported_types([torch.IntTensor, torch.LongTensor,
+                     torch.FloatTensor, torch.DoubleTensor])
+        if _fp16_supported:
+            dtypes += self.filter_supported_types([torch.HalfTensor])
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+            if _fp16_supported:
+                dtypes += [torch.cuda.HalfTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            tensor = torch.FloatTensor(*([17] * dim)).fill_(1 + rank % 2)
+            tensor = self.cast_and_place(tensor, dtype)
+            product = hvd.allreduce(tensor, op=hvd.Product)
+            tensor, product = self.convert_cpu_fp16_to_fp32(tensor, product)
+
+            expected = 2 ** (size // 2)
+            assert product.data.min() == expected, 'hvd.allreduce produces incorrect results'
+            assert product.data.max() == expected, 'hvd.allreduce produces incorrect results'
+
+    def test_horovod_allreduce_fp16_bit_exact(self):
+        """Test that the vectorized float16 reductions give the same bits as
+        converting every element to float32 and rounding the result."""
+        if not _fp16_supported or 'MLSL_ROOT' in os.environ:
+            return
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+        if size < 2:
+            return
+
+        # The length covers the 16 and 8 element vector loops and the scalar
+        # tail, the values include subnormals and sums overflowing to
+        # infinity.
+        np.random.seed(1234)
+        a = np.random.uniform(-8, 8, 16 * 37 + 13).astype(np.float32)
+        b = np.random.uniform(-8, 8, 16 * 37 + 13).astype(np.float32)
+        a[:32] *= 1e-6
+        b[16:48] *= 1e-6
+        a[64:80] = b[64:80] = 65000.0
+        a = a.astype(np.float16)
+        b = b.astype(np.float16)
+        with np.errstate(over='ignore'):
+            expected_sum = (a.astype(np.float32) + b.astype(np.float32)).astype(np.float16)
+            expected_product = (a.astype(np.float32) * b.astype(np.float32)).astype(np.float16)
+
+        # Only ranks 0 and 1 contribute values that need rounding, the others
+        # contribute identities, so the result does not depend on the order
+        # of reduction.
+        own = a if rank % 2 == 0 else b
+        inputs = {
+            hvd.Sum: (own if rank < 2 else np.zeros_like(a), expected_sum),
+            hvd.Product: (own if rank < 2 else np.ones_like(a), expected_product),
+            hvd.Min: (own, np.minimum(a, b)),
+            hvd.Max: (own, np.maximum(a, b)),
+        }
+        for op, (value, expected) in inputs.items():
+            result = hvd.allreduce(torch.from_numpy(value), op=op)
+            assert np.array_equal(result.numpy().view(np.uint16),
+                                  expected.view(np.uint16)), \
+                'hvd.allreduce produces float16 results differing from the scalar reduction'
+
+    def test_horovod_allreduce_prescale(self):
+        """Test that the allreduce correctly sums 1D, 2D, 3D tensors with prescaling."""
+        hvd.init()
+        size = hvd.size()
+        dtypes = self.filter_supported_types([torch.FloatTensor, torch.DoubleTensor])
+        if _fp16_supported:
+            dtypes += self.filter_supported_types([torch.HalfTensor])
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            torch.manual_seed(1234)
+            tensor = torch.FloatTensor(*([17] * dim)).random_(-100, 100)
+            tensor = self.cast_and_place(tensor, dtype)
+            # Powers of two keep the scaled sums exact.
+            summed = hvd.allreduce(tensor, op=hvd.Sum, prescale_factor=0.5)
+            tensor, summed = self.convert_cpu_fp16_to_fp32(tensor, summed)
+            expected = tensor.mul(0.5 * size)
+
+            assert torch.allclose(summed, expected, rtol=1e-2), \
+                'hvd.allreduce produces incorrect results'
+
+    def test_horovod_allreduce_postscale(self):
+        """Test that the allreduce correctly sums and averages 1D, 2D, 3D tensors
+        with postscaling."""
+        hvd.init()
+        size = hvd.size()
+        dtypes = self.filter_supported_types([torch.FloatTensor, torch.DoubleTensor])
+        if _fp16_supported:
+            dtypes += self.filter_supported_types([torch.HalfTensor])
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            torch.manual_seed(1234)
+            tensor = torch.FloatTensor(*([17] * dim)).random_(-100, 100)
+            tensor = self.cast_and_place(tensor, dtype)
+            summed = hvd.allreduce(tensor, op=hvd.Sum, postscale_factor=0.25)
+            averaged = hvd.allreduce(tensor, op=hvd.Average, postscale_factor=2.0)
+            tensor, summed, averaged = self.convert_cpu_fp16_to_fp32(tensor, summed, averaged)
+
+            assert torch.allclose(summed, tensor.mul(0.25 * size), rtol=1e-2), \
+                'hvd.allreduce produces incorrect results'
+            assert torch.allclose(averaged, tensor.mul(2.0), rtol=1e-2, atol=1e-2), \
+                'hvd.allreduce produces incorrect results'
+
     def test_horovod_allreduce_inplace(self):
         """Test that the allreduce correctly sums 1D, 2D, 3D tensors."""
         hvd.init()
@@ -258,6 +417,193 @@ class TorchTests(unittest.TestCase):
 
             assert max_difference <= threshold, 'hvd.allreduce produces incorrect results'
 
+    def test_horovod_allreduce_async_fused_mixed_dtypes(self):
+        """Test that the allreduce correctly sums interleaved tensors of
+        different types fused into a single response."""
+        hvd.init()
+        size = hvd.size()
+        dtypes = [torch.DoubleTensor, torch.IntTensor, torch.FloatTensor,
+                  torch.LongTensor]
+        if _fp16_supported:
+            dtypes.insert(1, torch.HalfTensor)
+        dtypes = self.filter_supported_types(dtypes)
+        tests = []
+        # Odd sizes and interleaved types exercise segment alignment in the
+        # fusion buffer.
+        for dim, dtype in itertools.product([1, 2, 3], dtypes):
+            torch.manual_seed(1234)
+            tensor = torch.FloatTensor(*([17] * dim)).random_(-100, 100)
+            tensor = self.cast_and_place(tensor, dtype)
+            handle = hvd.allreduce_async(tensor, average=False)
+            tensor, = self.convert_cpu_fp16_to_fp32(tensor)
+            multiplied = tensor * size
+            tests.append((dtype, multiplied, handle))
+
+        for dtype, multiplied, handle in tests:
+            summed = hvd.synchronize(handle)
+            summed, = self.convert_cpu_fp16_to_fp32(summed)
+            max_difference = summed.sub(multiplied).max()
+
+            if size <= 3 or dtype in [torch.IntTensor, torch.LongTensor]:
+                threshold = 0
+            elif size < 10:
+                threshold = 1e-4
+            elif size < 15:
+                threshold = 5e-4
+            else:
+                break
+
+            assert max_difference <= threshold, 'hvd.allreduce produces incorrect results'
+
+    def test_horovod_grouped_allreduce(self):
+        """Test that the grouped allreduce correctly sums a group of 1D, 2D, 3D
+        tensors, and averages it."""
+        hvd.init()
+        size = hvd.size()
+        dtypes = self.filter_supported_types([torch.IntTensor, torch.LongTensor,
+                     torch.FloatTensor, torch.DoubleTensor])
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        for dtype in dtypes:
+            torch.manual_seed(1234)
+            tensors = [self.cast_and_place(
+                torch.FloatTensor(*([17] * dim)).random_(-100, 100), dtype)
+                for dim in [1, 2, 3]]
+            summed = hvd.grouped_allreduce(tensors, average=False)
+            averaged = hvd.grouped_allreduce(tensors, average=True)
+
+            if size <= 3 or dtype in [torch.IntTensor, torch.LongTensor,
+                                      torch.cuda.IntTensor, torch.cuda.LongTensor]:
+                threshold = 0
+            elif size < 10:
+                threshold = 1e-4
+            elif size < 15:
+                threshold = 5e-4
+            else:
+                break
+
+            assert len(summed) == len(tensors), \
+                'hvd.grouped_allreduce produces incorrect number of results'
+            for tensor, s, a in zip(tensors, summed, averaged):
+                assert s.data.sub(tensor * size).max() <= threshold, \
+                    'hvd.grouped_allreduce produces incorrect results'
+                assert a.data.sub(tensor).max() <= threshold, \
+                    'hvd.grouped_allreduce produces incorrect results for average'
+
+    def test_horovod_grouped_allreduce_inplace(self):
+        """Test that the in-place grouped allreduce correctly sums a group of
+        tensors, enqueued in the same cycle as ungrouped tensors."""
+        hvd.init()
+        size = hvd.size()
+        dtypes = self.filter_supported_types([torch.FloatTensor, torch.DoubleTensor])
+        for dtype in dtypes:
+            torch.manual_seed(1234)
+            tensors = [self.cast_and_place(
+                torch.FloatTensor(*([17] * dim)).random_(-100, 100), dtype)
+                for dim in [1, 2, 3]]
+            multiplied = [tensor * size for tensor in tensors]
+            single = self.cast_and_place(torch.FloatTensor(17).random_(-100, 100), dtype)
+            single_multiplied = single * size
+
+            single_handle = hvd.allreduce_async_(single, average=False)
+            handle = hvd.grouped_allreduce_async_(tensors, average=False)
+            hvd.synchronize(handle)
+            hvd.synchronize(single_handle)
+
+            for tensor, expected in zip(tensors, multiplied):
+                assert torch.allclose(tensor, expected), \
+                    'hvd.grouped_allreduce_ produces incorrect results'
+            assert torch.allclose(single, single_multiplied), \
+                'hvd.allreduce_ produces incorrect results next to a group'
+
+    def test_horovod_grouped_allreduce_partial_cache_hit(self):
+        """Test that a grouped allreduce is negotiated again as a whole when
+        the shape of one of its tensors changes, so that only the other
+        tensors are hits in the response cache."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+        for step in range(6):
+            # The middle tensor changes its shape every other step, and the
+            # other ones keep theirs.
+            shapes = [[17], [17 + step // 2], [3, 5]]
+            tensors = [torch.FloatTensor(*shape).fill_(rank + i)
+                       for i, shape in enumerate(shapes)]
+            summed = hvd.grouped_allreduce(tensors, average=False,
+                                           name='partial_cache_hit')
+            for i, (shape, result) in enumerate(zip(shapes, summed)):
+                assert list(result.shape) == shape, \
+                    'hvd.grouped_allreduce produces incorrect shape'
+                assert result.eq(size * i + size * (size - 1) // 2).all(), \
+                    'hvd.grouped_allreduce produces incorrect results on ' \
+                    'a partial cache hit'
+
+    def test_horovod_grouped_allreduce_grad(self):
+        """Test the correctness of the grouped allreduce gradient."""
+        hvd.init()
+        size = hvd.size()
+        # Only Tensors of floating point dtype can require gradients
+        dtypes = [torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        for dtype in dtypes:
+            torch.manual_seed(1234)
+            tensors = [self.cast_and_place(
+                torch.FloatTensor(*([17] * dim)).random_(-100, 100), dtype)
+                for dim in [1, 2, 3]]
+            for tensor in tensors:
+                tensor.requires_grad_()
+            summed = hvd.grouped_allreduce(tensors, average=False)
+
+            torch.autograd.backward(
+                summed, [self.cast_and_place(torch.ones([17] * dim), dtype)
+                         for dim in [1, 2, 3]])
+            for tensor, dim in zip(tensors, [1, 2, 3]):
+                grad_out = tensor.grad.data.cpu().numpy()
+                expected = np.ones([17] * dim) * size
+                err = np.linalg.norm(expected - grad_out)
+                self.assertLess(err, 0.00000001,
+                                "gradient %s differs from expected %s, "
+                                "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_allreduce_large(self):
+        """Test that the allreduce correctly sums a tensor with more than
+        2^31 elements."""
+        hvd.init()
+        size = hvd.size()
+        if size > 255:
+            return
+        num_elements = 2 ** 31 + 7
+        self.skip_unless_memory_available(num_elements)
+
+        tensor = torch.ones(num_elements, dtype=torch.uint8)
+        hvd.allreduce_(tensor, average=False)
+        assert tensor.min().item() == size and tensor.max().item() == size, \
+            'hvd.allreduce produces incorrect results for large tensors'
+
+    def test_horovod_allreduce_striped(self):
+        """Test that the allreduce correctly sums fused tensors above the Gloo
+        stripe threshold whose length does not divide by the number of
+        stripes."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+        dtypes = [torch.FloatTensor, torch.DoubleTensor, torch.IntTensor]
+        tensors = []
+        for i, dtype in enumerate(dtypes):
+            tensor = (torch.arange(2 ** 18 + 3 + i) + rank).type(dtype)
+            tensors.append(tensor)
+        handles = [hvd.allreduce_async(tensor, average=False,
+                                       name='striped.%d' % i)
+                   for i, tensor in enumerate(tensors)]
+        for i, (dtype, handle) in enumerate(zip(dtypes, handles)):
+            summed = hvd.synchronize(handle)
+            expected = (torch.arange(2 ** 18 + 3 + i) * size +
+                        size * (size - 1) // 2).type(dtype)
+            assert torch.equal(summed, expected), \
+                'hvd.allreduce produces incorrect results for striped tensors'
+
     def test_horovod_allreduce_multi_gpu(self):
         """Test that the allreduce works on multiple GPUs."""
         # Only do this test if there are GPUs available.
@@ -336,6 +682,24 @@ class TorchTests(unittest.TestCase):
         except (torch.FatalError, RuntimeError):
             pass
 
+    def test_horovod_allreduce_reduce_op_error(self):
+        """Test that the allreduce raises an error if different ranks try to
+        reduce a tensor with different reduction operations."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # This test does not apply if there is only one worker.
+        if size == 1:
+            return
+
+        tensor = torch.FloatTensor(*([17] * 3)).fill_(1)
+        try:
+            hvd.allreduce(tensor, op=hvd.Min if rank % 2 == 0 else hvd.Max)
+            assert False, 'hvd.allreduce did not throw error'
+        except (torch.FatalError, RuntimeError):
+            pass
+
     def test_horovod_allreduce_type_error(self):
         """Test that the allreduce raises an error if different ranks try to
         send tensors of different type."""
@@ -466,6 +830,84 @@ class TorchTests(unittest.TestCase):
                             "gradient %s differs from expected %s, "
                             "error: %s" % (grad_out, expected, str(err)))
 
+    def test_horovod_allreduce_grad_min_max(self):
+        """Test the correctness of the allreduce minimum and maximum
+        gradients."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+        # Only Tensors of floating point dtype can require gradients
+        dtypes = [torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            for op, extreme_rank in [(hvd.Min, 0), (hvd.Max, size - 1)]:
+                torch.manual_seed(1234)
+                tensor = torch.FloatTensor(*([17] * dim)).random_(-100, 100)
+                tensor = self.cast_and_place(tensor + rank, dtype)
+                tensor.requires_grad_()
+                reduced = hvd.allreduce(tensor, op=op)
+
+                reduced.backward(self.cast_and_place(torch.ones([17] * dim), dtype))
+                grad_out = tensor.grad.data.cpu().numpy()
+
+                # Only the rank holding the extreme value receives gradient.
+                expected = np.ones([17] * dim) * (size if rank == extreme_rank else 0)
+                err = np.linalg.norm(expected - grad_out)
+                self.assertLess(err, 0.00000001,
+                                "gradient %s differs from expected %s, "
+                                "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_allreduce_grad_product(self):
+        """Test the correctness of the allreduce product gradient, including
+        inputs holding zeros."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # Element 0 is zero on rank 0 and element 1 on ranks 0 and 1, the
+        # gradient of other elements is the product of the other ranks.
+        def make_input(r):
+            value = np.full(17, 1.0 + 0.25 * (r % 3))
+            if r == 0:
+                value[0] = 0.0
+            if r < 2:
+                value[1] = 0.0
+            return value
+
+        inputs = np.stack([make_input(r) for r in range(size)])
+        others = np.prod(np.delete(inputs, rank, axis=0), axis=0)
+        expected = others * size
+
+        dtypes = [torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        for dtype in dtypes:
+            tensor = self.cast_and_place(torch.from_numpy(inputs[rank]), dtype)
+            tensor.requires_grad_()
+            reduced = hvd.allreduce(tensor, op=hvd.Product)
+
+            reduced.backward(self.cast_and_place(torch.ones(17), dtype))
+            grad_out = tensor.grad.data.cpu().numpy()
+
+            assert np.all(np.isfinite(grad_out)), \
+                'gradient %s of allreduce product is not finite' % grad_out
+            err = np.linalg.norm(expected - grad_out)
+            self.assertLess(err, 0.00001,
+                            "gradient %s differs from expected %s, "
+                            "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_process_set_error(self):
+        """Test that collectives on an unknown process set raise an error."""
+        hvd.init()
+
+        try:
+            hvd.allgather(torch.FloatTensor([1.0]), process_set=1000)
+            assert False, 'hvd.allgather did not throw error'
+        except (torch.FatalError, RuntimeError):
+            pass
+
     def test_horovod_allgather(self):
         """Test that the allgather correctly gathers 1D, 2D, 3D tensors."""
         hvd.init()
@@ -584,6 +1026,27 @@ class TorchTests(unittest.TestCase):
                 assert rank_tensor.data.min() == i, 'hvd.allgather produces incorrect gathered tensor'
                 assert rank_tensor.data.max() == i, 'hvd.allgather produces incorrect gathered tensor'
 
+    def test_horovod_allgather_large(self):
+        """Test that the allgather correctly gathers an output with more than
+        2^31 elements."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+        if size > 255:
+            return
+        num_rows = 2 ** 31 // size + 7
+        self.skip_unless_memory_available(num_rows * (size + 1))
+
+        tensor = torch.full((num_rows,), rank, dtype=torch.uint8)
+        gathered = hvd.allgather(tensor)
+        del tensor
+
+        assert list(gathered.shape) == [num_rows * size]
+        for i in range(size):
+            rank_tensor = gathered[i * num_rows:(i + 1) * num_rows]
+            assert rank_tensor.min().item() == i and rank_tensor.max().item() == i, \
+                'hvd.allgather produces incorrect results for large tensors'
+
     def test_horovod_allgather_error(self):
         """Test that the allgather returns an error if any dimension besides
         the first is different among the tensors being gathered."""
@@ -693,6 +1156,442 @@ class TorchTests(unittest.TestCase):
                             "gradient %s differs from expected %s, "
                             "error: %s" % (grad_out, expected, str(err)))
 
+    def test_horovod_reducescatter(self):
+        """Test that the reducescatter correctly sums and scatters 1D, 2D, 3D
+        tensors, also when the first dimension does not divide evenly."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if _fp16_supported:
+            dtypes += [torch.HalfTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+            if _fp16_supported:
+                dtypes += [torch.cuda.HalfTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            first_dim = size * 3 + 1
+            tensor = torch.FloatTensor(*([first_dim] + [17] * (dim - 1))).fill_(1).mul_(rank)
+            tensor = self.cast_and_place(tensor, dtype)
+            reduced = hvd.reducescatter(tensor, op=hvd.Sum)
+            tensor, reduced = self.convert_cpu_fp16_to_fp32(tensor, reduced)
+
+            expected_rows = 4 if rank == 0 else 3
+            assert list(reduced.shape) == [expected_rows] + [17] * (dim - 1), \
+                'hvd.reducescatter produces incorrect shape'
+            expected = size * (size - 1) // 2
+            assert reduced.data.min() == expected, 'hvd.reducescatter produces incorrect results'
+            assert reduced.data.max() == expected, 'hvd.reducescatter produces incorrect results'
+
+    def test_horovod_reducescatter_average(self):
+        """Test that the reducescatter correctly averages and scatters 1D, 2D,
+        3D tensors, with every rank receiving its own slice."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            # Row i holds i on every rank, so the average is the row index.
+            rows = torch.arange(size * 2, dtype=torch.float32)
+            tensor = rows.view([size * 2] + [1] * (dim - 1)).expand(
+                [size * 2] + [17] * (dim - 1)).contiguous()
+            tensor = self.cast_and_place(tensor, dtype)
+            averaged = hvd.reducescatter(tensor)
+
+            expected = rows[rank * 2:(rank + 1) * 2].view([2] + [1] * (dim - 1)).expand(
+                [2] + [17] * (dim - 1))
+            max_difference = averaged.data.cpu().float().sub(expected).abs().max()
+            assert max_difference <= 1e-6, 'hvd.reducescatter produces incorrect results'
+
+    def test_horovod_reducescatter_async_fused(self):
+        """Test that the reducescatter correctly sums and scatters 1D, 2D, 3D
+        tensors with Tensor Fusion."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        tests = []
+        for dtype, dim in itertools.product(dtypes, dims):
+            first_dim = size * 2 + dim
+            tensor = torch.FloatTensor(*([first_dim] + [17] * (dim - 1))).fill_(1).mul_(rank)
+            tensor = self.cast_and_place(tensor, dtype)
+            handle = hvd.reducescatter_async(tensor, op=hvd.Sum)
+            expected_rows = first_dim // size + (1 if rank < first_dim % size else 0)
+            tests.append((handle, [expected_rows] + [17] * (dim - 1)))
+
+        expected = size * (size - 1) // 2
+        for handle, shape in tests:
+            reduced = hvd.synchronize(handle)
+            assert list(reduced.shape) == shape, \
+                'hvd.reducescatter produces incorrect shape'
+            assert reduced.data.min() == expected, 'hvd.reducescatter produces incorrect results'
+            assert reduced.data.max() == expected, 'hvd.reducescatter produces incorrect results'
+
+    def test_horovod_reducescatter_error(self):
+        """Test that the reducescatter raises an error if the tensor shapes
+        differ among the processes."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # This test does not apply if there is only one worker.
+        if size == 1:
+            return
+
+        tensor_size = [17] * 3
+        tensor_size[1] = 10 * (rank + 1)
+        tensor = torch.FloatTensor(*tensor_size).fill_(1).mul_(rank)
+
+        try:
+            hvd.reducescatter(tensor)
+            assert False, 'hvd.reducescatter did not throw error'
+        except (torch.FatalError, RuntimeError):
+            pass
+
+    def test_horovod_reducescatter_grad(self):
+        """Test the correctness of the reducescatter gradient."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        size = hvd.size()
+
+        # Only Tensors of floating point dtype can require gradients
+        dtypes = [torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            torch.manual_seed(1234)
+            tensor = torch.FloatTensor(*([size * 4] + [17] * (dim - 1))).uniform_(-100, 100)
+            tensor = self.cast_and_place(tensor, dtype)
+            tensor.requires_grad_()
+            reduced = hvd.reducescatter(tensor, op=hvd.Sum)
+
+            reduced.backward(self.cast_and_place(torch.ones([4] + [17] * (dim - 1)), dtype))
+            grad_out = tensor.grad.data.cpu().numpy()
+
+            expected = np.ones([size * 4] + [17] * (dim - 1))
+            err = np.linalg.norm(expected - grad_out)
+            self.assertLess(err, 0.00000001,
+                            "gradient %s differs from expected %s, "
+                            "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_alltoall(self):
+        """Test that the alltoall correctly distributes 1D, 2D, 3D tensors with
+        the default even splits."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.ByteTensor, torch.CharTensor, torch.ShortTensor,
+                  torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if _fp16_supported:
+            dtypes += [torch.HalfTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+            if _fp16_supported:
+                dtypes += [torch.cuda.HalfTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            # Row block j holds j, so every rank receives its own rank.
+            rows = torch.arange(size, dtype=torch.float32).view(size, 1).expand(
+                size, 2).reshape(-1)
+            tensor = rows.view([size * 2] + [1] * (dim - 1)).expand(
+                [size * 2] + [17] * (dim - 1)).contiguous()
+            tensor = self.cast_and_place(tensor, dtype)
+            received = hvd.alltoall(tensor)
+            tensor, received = self.convert_cpu_fp16_to_fp32(tensor, received)
+
+            assert list(received.shape) == [size * 2] + [17] * (dim - 1), \
+                'hvd.alltoall produces incorrect shape'
+            assert received.data.min() == rank, 'hvd.alltoall produces incorrect results'
+            assert received.data.max() == rank, 'hvd.alltoall produces incorrect results'
+
+    def test_horovod_alltoall_splits(self):
+        """Test that the alltoall correctly distributes 1D, 2D, 3D tensors with
+        uneven splits."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            # Every rank sends j + 1 rows holding its rank to rank j.
+            splits = torch.arange(1, size + 1, dtype=torch.int32)
+            first_dim = int(splits.sum())
+            tensor = torch.FloatTensor(*([first_dim] + [17] * (dim - 1))).fill_(1).mul_(rank)
+            tensor = self.cast_and_place(tensor, dtype)
+            received = hvd.alltoall(tensor, splits)
+
+            assert list(received.shape) == [size * (rank + 1)] + [17] * (dim - 1), \
+                'hvd.alltoall produces incorrect shape'
+            expected = torch.arange(size, dtype=torch.float32).view(size, 1).expand(
+                size, rank + 1).reshape(-1)
+            expected = expected.view([size * (rank + 1)] + [1] * (dim - 1)).expand(
+                [size * (rank + 1)] + [17] * (dim - 1))
+            max_difference = received.data.cpu().float().sub(expected).abs().max()
+            assert max_difference == 0, 'hvd.alltoall produces incorrect results'
+
+    def test_horovod_alltoall_async_fused(self):
+        """Test that the alltoall correctly distributes 1D, 2D, 3D tensors with
+        Tensor Fusion."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        tests = []
+        for dtype, dim in itertools.product(dtypes, dims):
+            rows = torch.arange(size, dtype=torch.float32).view(size, 1).expand(
+                size, 3).reshape(-1)
+            tensor = rows.view([size * 3] + [1] * (dim - 1)).expand(
+                [size * 3] + [17] * (dim - 1)).contiguous()
+            tensor = self.cast_and_place(tensor, dtype)
+            handle = hvd.alltoall_async(tensor, [3] * size)
+            tests.append((handle, [size * 3] + [17] * (dim - 1)))
+
+        for handle, shape in tests:
+            received = hvd.synchronize(handle)
+            assert list(received.shape) == shape, \
+                'hvd.alltoall produces incorrect shape'
+            assert received.data.min() == rank, 'hvd.alltoall produces incorrect results'
+            assert received.data.max() == rank, 'hvd.alltoall produces incorrect results'
+
+    def test_horovod_alltoall_error(self):
+        """Test that the alltoall raises an error if the splits do not cover
+        the first dimension of the tensor."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        size = hvd.size()
+
+        tensor = torch.FloatTensor(*([size * 2] + [17])).fill_(1)
+        try:
+            hvd.alltoall(tensor, [1] * size)
+            assert False, 'hvd.alltoall did not throw error'
+        except (torch.FatalError, RuntimeError):
+            pass
+
+    def test_horovod_alltoall_grad(self):
+        """Test the correctness of the alltoall gradient."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        size = hvd.size()
+
+        # Only Tensors of floating point dtype can require gradients
+        dtypes = [torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            splits = list(range(1, size + 1))
+            first_dim = sum(splits)
+            tensor = torch.FloatTensor(*([first_dim] + [17] * (dim - 1))).uniform_(-100, 100)
+            tensor = self.cast_and_place(tensor, dtype)
+            tensor.requires_grad_()
+            received = hvd.alltoall(tensor, splits)
+
+            # Every rank fills its gradient with its rank, so the rows sent
+            # to rank j get gradient j.
+            grad_ys = self.cast_and_place(
+                torch.ones(received.shape) * hvd.rank(), dtype)
+            received.backward(grad_ys)
+            grad_out = tensor.grad.data.cpu().numpy()
+
+            expected = np.ones([first_dim] + [17] * (dim - 1))
+            for j in range(size):
+                start = sum(splits[:j])
+                expected[start:start + splits[j]] *= j
+            err = np.linalg.norm(expected - grad_out)
+            self.assertLess(err, 0.00000001,
+                            "gradient %s differs from expected %s, "
+                            "error: %s" % (grad_out, expected, str(err)))
+
+    def test_horovod_sparse_allreduce(self):
+        """Test that the sparse allreduce sums or averages the rows of sparse
+        tensors, both when exchanging rows and when switching to a dense
+        allreduce."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        # A large tensor keeps the rows sparse, a small one makes the
+        # allreduce dense.
+        all_first_dims = [100 * size, size + 1]
+        ops = [hvd.Sum, hvd.Average]
+        for dtype, first_dim, op in itertools.product(dtypes, all_first_dims, ops):
+            # Two sparse dimensions, every rank sends its own row and the
+            # shared last row.
+            indices = torch.LongTensor([[rank, size], [0, 0]])
+            values = self.cast_and_place(torch.ones(2, 17) * (rank + 1), dtype)
+            tensor = torch.sparse_coo_tensor(indices.to(values.device), values,
+                                             (first_dim, 1, 17))
+            reduced = hvd.sparse_allreduce(tensor, op=op)
+
+            assert reduced.is_sparse, 'hvd.sparse_allreduce produces a dense tensor'
+            assert reduced.device == tensor.device, \
+                'hvd.sparse_allreduce changes the device'
+            expected = torch.zeros(first_dim, 1, 17, dtype=torch.float64)
+            for r in range(size):
+                expected[r, 0] = r + 1
+            expected[size, 0] = size * (size + 1) // 2
+            if op == hvd.Average:
+                expected /= size
+            dense = reduced.to_dense().cpu().double()
+            assert torch.allclose(dense, expected), \
+                'hvd.sparse_allreduce produces incorrect results'
+
+    def test_horovod_reduce(self):
+        """Test that the reduce correctly sums 1D, 2D, 3D tensors into the
+        root rank and leaves the tensors of other ranks unchanged."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        root_ranks = list(range(size))
+        for dtype, dim, root_rank in itertools.product(dtypes, dims, root_ranks):
+            tensor = torch.FloatTensor(*([17] * dim)).fill_(1).mul_(rank)
+            tensor = self.cast_and_place(tensor, dtype)
+            reduced = hvd.reduce(tensor, root_rank, op=hvd.Sum)
+
+            assert list(reduced.shape) == [17] * dim, \
+                'hvd.reduce produces incorrect shape'
+            expected = size * (size - 1) // 2 if rank == root_rank else rank
+            assert reduced.data.min() == expected, 'hvd.reduce produces incorrect results'
+            assert reduced.data.max() == expected, 'hvd.reduce produces incorrect results'
+
+    def test_horovod_gather(self):
+        """Test that the gather correctly concatenates tensors of different
+        first dimensions on the root rank only."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.ByteTensor, torch.CharTensor, torch.ShortTensor,
+                  torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        root_ranks = list(range(size))
+        for dtype, dim, root_rank in itertools.product(dtypes, dims, root_ranks):
+            tensor = torch.FloatTensor(*([rank + 1] + [17] * (dim - 1))).fill_(1).mul_(rank)
+            tensor = self.cast_and_place(tensor, dtype)
+            gathered = hvd.gather(tensor, root_rank)
+
+            if rank != root_rank:
+                assert gathered.shape[0] == 0, 'hvd.gather produces rows on other ranks'
+                continue
+            assert list(gathered.shape) == [size * (size + 1) // 2] + [17] * (dim - 1), \
+                'hvd.gather produces incorrect shape'
+            offset = 0
+            for r in range(size):
+                rank_rows = gathered[offset:offset + r + 1]
+                assert rank_rows.data.min() == r, 'hvd.gather produces incorrect results'
+                assert rank_rows.data.max() == r, 'hvd.gather produces incorrect results'
+                offset += r + 1
+
+    def test_horovod_scatter(self):
+        """Test that the scatter sends every rank its slice of the tensor of the
+        root rank, also when the first dimension does not divide evenly."""
+        if not _v2_api:
+            return
+
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        dtypes = [torch.ByteTensor, torch.CharTensor, torch.ShortTensor,
+                  torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+        dims = [1, 2, 3]
+        root_ranks = list(range(size))
+        for dtype, dim, root_rank in itertools.product(dtypes, dims, root_ranks):
+            first_dim = size * 3 + 1
+            # Row i of the root tensor holds i, other ranks send nothing.
+            tensor = torch.arange(first_dim, dtype=torch.float32)
+            tensor = tensor.view(*([first_dim] + [1] * (dim - 1)))
+            tensor = tensor.expand(*([first_dim] + [17] * (dim - 1))).contiguous()
+            if rank != root_rank:
+                tensor.fill_(-1)
+            tensor = self.cast_and_place(tensor, dtype)
+            scattered = hvd.scatter(tensor, root_rank)
+
+            expected_rows = 4 if rank == 0 else 3
+            assert list(scattered.shape) == [expected_rows] + [17] * (dim - 1), \
+                'hvd.scatter produces incorrect shape'
+            first_row = 0 if rank == 0 else 3 * rank + 1
+            for i in range(expected_rows):
+                assert scattered[i].data.min() == first_row + i, \
+                    'hvd.scatter produces incorrect results'
+                assert scattered[i].data.max() == first_row + i, \
+                    'hvd.scatter produces incorrect results'
+
     def test_horovod_broadcast(self):
         """Test that the broadcast correctly broadcasts 1D, 2D, 3D tensors."""
         hvd.init()
@@ -764,6 +1663,68 @@ class TorchTests(unittest.TestCase):
             assert (broadcasted_tensor == root_tensor).min() == 1, \
                 'hvd.broadcast produces incorrect broadcasted tensor'
 
+    def test_horovod_broadcast_async_fused(self):
+        """Test that the broadcast correctly broadcasts 1D, 2D, 3D tensors
+        from interleaved root ranks with Tensor Fusion."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # This test does not apply if there is only one worker.
+        if size == 1:
+            return
+
+        dtypes = [torch.ByteTensor, torch.CharTensor, torch.ShortTensor,
+                  torch.IntTensor, torch.LongTensor, torch.FloatTensor, torch.DoubleTensor]
+        if _fp16_supported:
+            dtypes += [torch.HalfTensor]
+        if torch.cuda.is_available():
+            dtypes += [torch.cuda.ByteTensor, torch.cuda.CharTensor, torch.cuda.ShortTensor,
+                       torch.cuda.IntTensor, torch.cuda.LongTensor,
+                       torch.cuda.FloatTensor, torch.cuda.DoubleTensor]
+            if _fp16_supported:
+                dtypes += [torch.cuda.HalfTensor]
+        dims = [1, 2, 3]
+        root_ranks = list(range(size))
+        tests = []
+        for dtype, dim, root_rank in itertools.product(dtypes, dims, root_ranks):
+            tensor = torch.FloatTensor(*([17] * dim)).fill_(1).mul_(rank)
+            root_tensor = torch.FloatTensor(*([17] * dim)).fill_(1).mul_(root_rank)
+            tensor = self.cast_and_place(tensor, dtype)
+            root_tensor = self.cast_and_place(root_tensor, dtype)
+            handle = hvd.broadcast_async(tensor, root_rank)
+            tests.append((tensor, root_tensor, handle))
+
+        for tensor, root_tensor, handle in tests:
+            broadcasted_tensor = hvd.synchronize(handle)
+            tensor, root_tensor, broadcasted_tensor = \
+                self.convert_cpu_fp16_to_fp32(tensor, root_tensor, broadcasted_tensor)
+            if rank != root_tensor.view(-1)[0].item():
+                assert (tensor == broadcasted_tensor).min() == 0, \
+                    'hvd.broadcast modifies source tensor'
+            assert (broadcasted_tensor == root_tensor).min() == 1, \
+                'hvd.broadcast produces incorrect broadcasted tensor'
+
+    def test_horovod_broadcast_large(self):
+        """Test that the broadcast correctly broadcasts a tensor with more than
+        2^31 elements."""
+        hvd.init()
+        rank = hvd.rank()
+        size = hvd.size()
+
+        # This test does not apply if there is only one worker.
+        if size == 1 or size > 255:
+            return
+
+        num_elements = 2 ** 31 + 7
+        self.skip_unless_memory_available(num_elements)
+
+        root_rank = size - 1
+        tensor = torch.full((num_elements,), rank, dtype=torch.uint8)
+        hvd.broadcast_(tensor, root_rank)
+        assert tensor.min().item() == root_rank and tensor.max().item() == root_rank, \
+            'hvd.broadcast produces incorrect broadcasted tensor for large tensors'
+
     def test_horovod_broadcast_error(self):
         """Test that the broadcast returns an error if any dimension besides
         the first is different among the tensors being broadcasted."""
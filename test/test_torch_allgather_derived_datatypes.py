@@ -0,0 +1,145 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+from distutils.version import LooseVersion
+import os
+import torch
+import unittest
+import warnings
+
+import horovod.torch as hvd
+from horovod.common.util import env
+
+_fp16_supported = LooseVersion(torch.__version__) >= LooseVersion('1.0.0')
+
+
+class TorchAllgatherDerivedDatatypeTests(unittest.TestCase):
+    """
+    Tests for fused MPI allgathers of CPU tensors that move data between the
+    framework buffers with derived datatypes, which are enabled by
+    HOROVOD_MPI_ALLGATHER_DERIVED_DATATYPES when Horovod is initialized.
+
+    A long cycle time lets the allgathers issued by a test be fused into one
+    response per data type.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        with env(HOROVOD_MPI_ALLGATHER_DERIVED_DATATYPES='1',
+                 HOROVOD_CYCLE_TIME='20'):
+            hvd.init()
+
+    def __init__(self, *args, **kwargs):
+        super(TorchAllgatherDerivedDatatypeTests, self).__init__(*args,
+                                                                 **kwargs)
+        warnings.simplefilter('module')
+
+    def setUp(self):
+        if not hvd.mpi_enabled() or hvd.gloo_enabled() or \
+                'MLSL_ROOT' in os.environ:
+            self.skipTest('Derived datatypes are only used with MPI')
+
+    def dtypes(self):
+        dtypes = [torch.ByteTensor, torch.IntTensor, torch.LongTensor,
+                  torch.FloatTensor, torch.DoubleTensor]
+        if _fp16_supported:
+            dtypes += [torch.HalfTensor]
+        return dtypes
+
+    def rows(self, rank, i):
+        # Tensors of a rank hold its rank in every element, and the number of
+        # rows differs from rank to rank and from tensor to tensor.
+        return (rank + i) % 4
+
+    def check_gathered(self, gathered, i, row_shape, dtype):
+        size = hvd.size()
+        expected_rows = sum(self.rows(r, i) for r in range(size))
+        assert list(gathered.shape) == [expected_rows] + row_shape, \
+            'hvd.allgather produces incorrect gathered shape'
+        assert gathered.type() == dtype().type(), \
+            'hvd.allgather produces incorrect gathered type'
+        offset = 0
+        for r in range(size):
+            rows = self.rows(r, i)
+            assert gathered[offset:offset + rows].eq(r).all(), \
+                'hvd.allgather produces incorrect gathered tensor'
+            offset += rows
+
+    def test_horovod_allgather_derived_datatypes_mixed(self):
+        """Test that fused allgathers of tensors of several types and shapes,
+        with a different first dimension on every rank, gather correctly."""
+        rank = hvd.rank()
+        shapes = [[], [17], [3, 5]]
+        for step in range(3):
+            tests = []
+            for dtype in self.dtypes():
+                for i, row_shape in enumerate(shapes):
+                    tensor = torch.FloatTensor(
+                        *([self.rows(rank, i)] + row_shape)).fill_(rank)
+                    handle = hvd.allgather_async(
+                        tensor.type(dtype),
+                        name='mixed.%s.%d' % (dtype.__name__, i))
+                    tests.append((handle, i, row_shape, dtype))
+            for handle, i, row_shape, dtype in tests:
+                self.check_gathered(hvd.synchronize(handle), i, row_shape,
+                                    dtype)
+
+    def test_horovod_allgather_derived_datatypes_zero_sized(self):
+        """Test that fused allgathers gather correctly when some ranks, or all
+        of them, contribute no rows to some of the tensors."""
+        rank = hvd.rank()
+        handles = []
+        for i in range(4):
+            # Every fourth rank contributes no rows to each of these tensors.
+            tensor = torch.FloatTensor(self.rows(rank, i), 7).fill_(rank)
+            handles.append(hvd.allgather_async(tensor, name='zero.%d' % i))
+        empty = hvd.allgather_async(torch.FloatTensor(0, 7), name='zero.empty')
+        for i, handle in enumerate(handles):
+            self.check_gathered(hvd.synchronize(handle), i, [7],
+                                torch.FloatTensor)
+        gathered = hvd.synchronize(empty)
+        assert list(gathered.shape) == [0, 7], \
+            'hvd.allgather produces incorrect gathered shape'
+
+    def test_horovod_allgather_derived_datatypes_non_contiguous(self):
+        """Test that fused allgathers of non-contiguous tensors, whose first
+        dimension is not the outermost one in memory, gather correctly."""
+        rank = hvd.rank()
+        size = hvd.size()
+
+        def transposed(r, i):
+            rows = self.rows(r, i)
+            values = torch.arange(5 * rows).float() + 1000 * r
+            return values.view(5, rows).t()
+
+        handles = []
+        for i in range(4):
+            tensor = transposed(rank, i)
+            assert tensor.shape[0] <= 1 or not tensor.is_contiguous()
+            handles.append(hvd.allgather_async(tensor,
+                                               name='non_contiguous.%d' % i))
+        for i, handle in enumerate(handles):
+            gathered = hvd.synchronize(handle)
+            expected = torch.cat([transposed(r, i) for r in range(size)])
+            assert gathered.equal(expected), \
+                'hvd.allgather produces incorrect gathered tensor'
+
+
+if __name__ == "__main__":
+    unittest.main()
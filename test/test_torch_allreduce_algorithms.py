@@ -0,0 +1,226 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+from distutils.version import LooseVersion
+import itertools
+import json
+import os
+import tempfile
+import time
+import torch
+import unittest
+import warnings
+
+import horovod.torch as hvd
+from horovod.common.util import env
+
+from common import size_before_init
+
+_fp16_supported = LooseVersion(torch.__version__) >= LooseVersion('1.0.0')
+
+
+class TorchAllreduceAlgorithmTests(unittest.TestCase):
+    """
+    Tests for the CPU allreduce algorithms of horovod.torch.
+
+    The algorithm is chosen when Horovod is initialized, so these tests run in
+    a process of their own, once for every value of
+    HOROVOD_CPU_ALLREDUCE_ALGORITHM the test pipeline sets, and on an odd
+    number of ranks as well. Results are checked against exact expected
+    values, on all ranks and on a process set of all ranks but the last one.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        members = list(range(max(size_before_init() - 1, 1)))
+        cls.process_set = hvd.add_process_set(members)
+        with tempfile.NamedTemporaryFile() as t:
+            cls.timeline_name = t.name
+        with env(HOROVOD_TIMELINE=cls.timeline_name):
+            hvd.init()
+
+    @classmethod
+    def tearDownClass(cls):
+        if os.path.exists(cls.timeline_name):
+            os.remove(cls.timeline_name)
+
+    def __init__(self, *args, **kwargs):
+        super(TorchAllreduceAlgorithmTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def dtypes(self):
+        dtypes = [torch.IntTensor, torch.LongTensor, torch.FloatTensor,
+                  torch.DoubleTensor]
+        if _fp16_supported:
+            dtypes += [torch.HalfTensor]
+        if 'MLSL_ROOT' in os.environ:
+            # MLSL supports only byte, float and double data types
+            dtypes = [torch.FloatTensor, torch.DoubleTensor]
+        return dtypes
+
+    def counts(self, size):
+        # Counts smaller than, equal to and just above the number of ranks
+        # leave some ranks without elements in ring and Rabenseifner.
+        return sorted(set([1, max(size - 1, 1), size, size + 1, 17, 1000,
+                           65537]))
+
+    def pattern(self, count):
+        # Small integers, so that results are exact in every type and order.
+        return torch.arange(count).float() % 7
+
+    def check_allreduce(self, rank, size, process_set=None):
+        kwargs = {} if process_set is None else {'process_set': process_set}
+        for dtype, count in itertools.product(self.dtypes(),
+                                              self.counts(size)):
+            base = self.pattern(count)
+
+            tensor = (base * (rank + 1)).type(dtype)
+            summed = hvd.allreduce(tensor, op=hvd.Sum, **kwargs)
+            assert summed.float().equal(base * (size * (size + 1) // 2)), \
+                'hvd.allreduce produces incorrect sum of %d %s' % (count, dtype)
+
+            tensor = (base + rank).type(dtype)
+            minimum = hvd.allreduce(tensor, op=hvd.Min, **kwargs)
+            maximum = hvd.allreduce(tensor, op=hvd.Max, **kwargs)
+            assert minimum.float().equal(base), \
+                'hvd.allreduce produces incorrect minimum of %d %s' % \
+                (count, dtype)
+            assert maximum.float().equal(base + size - 1), \
+                'hvd.allreduce produces incorrect maximum of %d %s' % \
+                (count, dtype)
+
+            # Keep the product exactly representable in every type.
+            if size <= 16:
+                tensor = torch.FloatTensor(count).fill_(1 + rank % 2)
+                product = hvd.allreduce(tensor.type(dtype), op=hvd.Product,
+                                        **kwargs)
+                assert product.float().eq(2 ** (size // 2)).all(), \
+                    'hvd.allreduce produces incorrect product of %d %s' % \
+                    (count, dtype)
+
+    def test_horovod_allreduce_algorithm(self):
+        """Test that the allreduce computes exact sums, minima, maxima and
+        products of tensors of all types, with fewer and more elements than
+        ranks."""
+        self.check_allreduce(hvd.rank(), hvd.size())
+
+    def test_horovod_allreduce_algorithm_fused(self):
+        """Test that the allreduce reduces every segment of a response fused
+        across data types with the algorithm."""
+        rank = hvd.rank()
+        size = hvd.size()
+        tests = []
+        for i, (dtype, count) in enumerate(
+                itertools.product(self.dtypes(), [1, size + 1, 17])):
+            base = self.pattern(count)
+            handle = hvd.allreduce_async((base * (rank + 1)).type(dtype),
+                                         op=hvd.Sum, name='fused.%d' % i)
+            tests.append((base * (size * (size + 1) // 2), handle))
+        for expected, handle in tests:
+            summed = hvd.synchronize(handle)
+            assert summed.float().equal(expected), \
+                'fused hvd.allreduce produces incorrect results'
+
+    def test_horovod_allreduce_algorithm_process_set(self):
+        """Test that the allreduce on a process set runs the algorithm on the
+        communicators of the process set."""
+        if hvd.rank() < hvd.process_set_size(self.process_set):
+            self.check_allreduce(hvd.process_set_rank(self.process_set),
+                                 hvd.process_set_size(self.process_set),
+                                 self.process_set)
+        # Wait for the process set before the next test.
+        hvd.allreduce(torch.FloatTensor([1.0]), name='process_set.barrier')
+
+    def test_horovod_allreduce_algorithm_timeline(self):
+        """Test that the timeline names the algorithm chosen by
+        HOROVOD_CPU_ALLREDUCE_ALGORITHM or HOROVOD_CPU_ALLREDUCE_TABLE."""
+        if not hvd.mpi_enabled() or hvd.gloo_enabled() or \
+                'MLSL_ROOT' in os.environ:
+            self.skipTest('Built-in allreduce algorithms are only named with '
+                          'MPI')
+        if os.environ.get('HOROVOD_MPI_ASYNC_OPS'):
+            self.skipTest('Asynchronous allreduces always use the MPI library')
+
+        # HOROVOD_CPU_ALLREDUCE_ALGORITHM takes precedence over the table,
+        # and buffers no rule covers are left to the MPI library.
+        algorithm = os.environ.get('HOROVOD_CPU_ALLREDUCE_ALGORITHM')
+        table = os.environ.get('HOROVOD_CPU_ALLREDUCE_TABLE')
+        counts = [4, 1024, 65536]
+        for count in counts:
+            hvd.allreduce(torch.FloatTensor(count).fill_(1.0), op=hvd.Sum,
+                          name='timeline.%d' % count)
+        if hvd.rank() != 0:
+            return
+
+        # Wait for the activities to be written to the timeline.
+        time.sleep(0.5)
+        activities = self.timeline_activities()
+        for count in counts:
+            if algorithm not in (None, 'auto', 'library'):
+                expected = algorithm
+            elif table is not None:
+                expected = self.select_from_table(table, count * 4)
+            else:
+                expected = 'library'
+            name = 'MPI_ALLREDUCE' if expected == 'library' else \
+                'MPI_ALLREDUCE_' + expected.upper()
+            tensor = 'allreduce.timeline.%d' % count
+            assert name in activities[tensor], \
+                '%s was reduced by %s, not %s' % (tensor, activities[tensor],
+                                                  name)
+
+    def timeline_activities(self):
+        pids = {}
+        activities = {}
+        with open(self.timeline_name, 'r') as timeline:
+            for line in timeline:
+                line = line.strip().rstrip(',')
+                if not line.startswith('{'):
+                    continue
+                event = json.loads(line)
+                if event.get('name') == 'process_name':
+                    pids[event['pid']] = event['args']['name']
+                elif event['ph'] == 'B' and event.get('pid') in pids:
+                    activities.setdefault(pids[event['pid']], []).append(
+                        event['name'])
+        return activities
+
+    def select_from_table(self, table, num_bytes):
+        # Mirrors AllreduceAlgorithmTable: a table with a malformed rule or an
+        # algorithm MPI does not implement is ignored as a whole.
+        rules = []
+        try:
+            for rule in table.split(','):
+                max_bytes, max_ranks, algorithm = rule.split(':')
+                max_bytes = float('inf') if max_bytes == '*' else int(max_bytes)
+                max_ranks = float('inf') if max_ranks == '*' else int(max_ranks)
+                if algorithm not in ('ring', 'recursive_doubling',
+                                     'rabenseifner', 'tree', 'library'):
+                    return 'library'
+                rules.append((max_bytes, max_ranks, algorithm))
+        except ValueError:
+            return 'library'
+        for max_bytes, max_ranks, algorithm in rules:
+            if num_bytes <= max_bytes and hvd.size() <= max_ranks:
+                return algorithm
+        return 'library'
+
+
+if __name__ == "__main__":
+    unittest.main()
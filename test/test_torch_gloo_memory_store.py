@@ -0,0 +1,105 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+import unittest
+import warnings
+
+import horovod.torch as hvd
+
+# Initializes Horovod twice in a row, so that the second rendezvous runs after
+# the stores of the first one are finalized, and runs collectives on the
+# global contexts, their stripes and a process set.
+_SINGLE_PROCESS_SCRIPT = """
+import torch
+import horovod.torch as hvd
+
+for step in range(2):
+    process_set = hvd.add_process_set([0])
+    hvd.init()
+    assert hvd.size() == 1 and hvd.rank() == 0
+    assert hvd.gloo_enabled()
+
+    tensor = torch.FloatTensor(1 << 20).fill_(step + 1)
+    summed = hvd.allreduce(tensor, average=False, name='summed')
+    assert summed.equal(tensor), 'hvd.allreduce produces incorrect results'
+    gathered = hvd.allgather(torch.IntTensor([7, step]), name='gathered')
+    assert gathered.tolist() == [7, step], \\
+        'hvd.allgather produces incorrect results'
+    broadcasted = hvd.broadcast(torch.IntTensor([step]), 0, name='bcast')
+    assert broadcasted.item() == step, \\
+        'hvd.broadcast produces incorrect results'
+    summed = hvd.allreduce(tensor, average=False, name='set_summed',
+                           process_set=process_set)
+    assert summed.equal(tensor), \\
+        'hvd.allreduce on a process set produces incorrect results'
+    hvd.shutdown()
+"""
+
+
+class TorchGlooMemoryStoreTests(unittest.TestCase):
+    """
+    Tests for Gloo rendezvous without a rendezvous server, where the contexts
+    of a process exchange their addresses through in-memory stores.
+
+    Horovod only uses memory stores when it runs as a single process, so every
+    test starts a process of its own, outside of the job that runs the tests.
+    """
+
+    def __init__(self, *args, **kwargs):
+        super(TorchGlooMemoryStoreTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def setUp(self):
+        if not hvd.gloo_built():
+            self.skipTest('Memory stores are only used with Gloo')
+
+    def run_single_process(self, **env_vars):
+        # The process must not see the rendezvous server or the launcher of
+        # the job running the tests.
+        env = dict((k, v) for k, v in os.environ.items()
+                   if not k.startswith(('HOROVOD_', 'OMPI_', 'PMI_', 'PMIX_',
+                                        'HYDRA_')))
+        env.update(HOROVOD_CONTROLLER='gloo', HOROVOD_CPU_OPERATIONS='gloo',
+                   HOROVOD_GLOO_IFACE='lo', HOROVOD_GLOO_TIMEOUT_SECONDS='10')
+        env.update(env_vars)
+        process = subprocess.Popen([sys.executable, '-c',
+                                    _SINGLE_PROCESS_SCRIPT],
+                                   env=env, stdout=subprocess.PIPE,
+                                   stderr=subprocess.STDOUT)
+        output = process.communicate()[0]
+        assert process.returncode == 0, \
+            'single process Gloo job failed:\n%s' % output.decode()
+
+    def test_horovod_gloo_memory_store(self):
+        """Test that a single process with striped contexts completes the
+        rendezvous in memory, and completes it again after shutting down."""
+        self.run_single_process(HOROVOD_GLOO_NUM_STRIPES='3',
+                                HOROVOD_GLOO_STRIPE_THRESHOLD='65536')
+
+    def test_horovod_gloo_memory_store_partial_mesh(self):
+        """Test that a single process started in partial-mesh mode, whose
+        context keeps its store, completes the rendezvous in memory."""
+        self.run_single_process(HOROVOD_GLOO_PARTIAL_MESH='1')
+
+
+if __name__ == "__main__":
+    unittest.main()
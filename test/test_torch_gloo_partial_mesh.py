@@ -0,0 +1,108 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+from distutils.version import LooseVersion
+import torch
+import unittest
+import warnings
+
+import horovod.torch as hvd
+from horovod.common.util import env
+
+_v2_api = LooseVersion(torch.__version__) >= LooseVersion('1.0.0')
+
+
+class TorchGlooPartialMeshTests(unittest.TestCase):
+    """
+    Tests for Gloo started with HOROVOD_GLOO_PARTIAL_MESH, which only connects
+    the peers of ring, tree and halving-doubling algorithms at startup. Reduce
+    and alltoall connect the remaining peers the first time they run, and
+    collectives keep working on the full mesh afterwards.
+
+    The mesh is only partial on more than a few ranks, so the test pipeline
+    runs these tests on 5 and 8 ranks.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        with env(HOROVOD_GLOO_PARTIAL_MESH='1'):
+            hvd.init()
+
+    def __init__(self, *args, **kwargs):
+        super(TorchGlooPartialMeshTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def setUp(self):
+        if not hvd.gloo_enabled():
+            self.skipTest('Partial meshes are only used with Gloo')
+
+    def check_neighbor_collectives(self, name):
+        rank = hvd.rank()
+        size = hvd.size()
+
+        summed = hvd.allreduce(torch.FloatTensor(1000).fill_(rank),
+                               op=hvd.Sum, name='%s.allreduce' % name)
+        assert summed.eq(size * (size - 1) // 2).all(), \
+            'hvd.allreduce produces incorrect results on a partial mesh'
+
+        gathered = hvd.allgather(torch.IntTensor([rank]),
+                                 name='%s.allgather' % name)
+        assert gathered.equal(torch.arange(size).int()), \
+            'hvd.allgather produces incorrect results on a partial mesh'
+
+        broadcasted = hvd.broadcast(torch.IntTensor(17).fill_(rank),
+                                    size - 1, name='%s.broadcast' % name)
+        assert broadcasted.eq(size - 1).all(), \
+            'hvd.broadcast produces incorrect results on a partial mesh'
+
+    def test_horovod_gloo_partial_mesh_upgrade(self):
+        """Test that collectives on the partial mesh, reduces and alltoalls
+        connecting the full mesh, and collectives after that, all produce
+        correct results."""
+        if not _v2_api:
+            self.skipTest('Reduce and alltoall need the v2 API')
+
+        rank = hvd.rank()
+        size = hvd.size()
+        self.check_neighbor_collectives('before')
+
+        # Every rank is the root once, so every rank has to reach every other
+        # one, not only its neighbors.
+        for root_rank in range(size):
+            reduced = hvd.reduce(torch.FloatTensor(1000).fill_(rank + 1),
+                                 root_rank, op=hvd.Sum,
+                                 name='reduce.%d' % root_rank)
+            if rank == root_rank:
+                assert reduced.eq(size * (size + 1) // 2).all(), \
+                    'hvd.reduce produces incorrect results on a partial mesh'
+
+        # Rank r sends r + j + 1 rows holding r to rank j.
+        splits = [rank + j + 1 for j in range(size)]
+        tensor = torch.FloatTensor(sum(splits), 3).fill_(rank)
+        received = hvd.alltoall(tensor, splits, name='alltoallv')
+        expected = torch.cat([torch.FloatTensor(r + rank + 1, 3).fill_(r)
+                              for r in range(size)])
+        assert received.equal(expected), \
+            'hvd.alltoall produces incorrect results on a partial mesh'
+
+        self.check_neighbor_collectives('after')
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,221 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import itertools
+import torch
+import unittest
+import warnings
+
+import horovod.torch as hvd
+from horovod.common.util import env
+
+from common import size_before_init
+
+
+class TorchHierarchicalTests(unittest.TestCase):
+    """
+    Tests for hierarchical allreduce and allgather of CPU tensors in
+    horovod.torch.
+
+    Hierarchical collectives are enabled when Horovod is initialized, so these
+    tests run in a process of their own. Their results are compared with the
+    ones of a process set of all ranks, which only runs flat collectives.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        cls.flat = hvd.add_process_set(list(range(size_before_init())))
+        with env(HOROVOD_HIERARCHICAL_ALLREDUCE='1',
+                 HOROVOD_HIERARCHICAL_ALLGATHER='1'):
+            hvd.init()
+
+    def __init__(self, *args, **kwargs):
+        super(TorchHierarchicalTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def pattern(self, dtype, shape, factor):
+        # Small integers, so that sums are exact in every order.
+        num_elements = 1
+        for dim in shape:
+            num_elements *= dim
+        tensor = torch.arange(num_elements).view(*shape) % 7
+        return tensor.mul(factor).type(dtype)
+
+    def rank_tensor(self, dtype, shape):
+        return self.pattern(dtype, shape, hvd.rank() + 1)
+
+    def test_horovod_hierarchical_allreduce(self):
+        """Test that hierarchical allreduce of single tensors matches flat
+        allreduce. The largest tensor spans several 16 MiB slots of the
+        shared window."""
+        size = hvd.size()
+        dtypes = [torch.IntTensor, torch.LongTensor,
+                  torch.FloatTensor, torch.DoubleTensor]
+        shapes = [[17], [17, 17], [17, 17, 17], [5 * 1024 * 1024]]
+        for dtype, shape in itertools.product(dtypes, shapes):
+            tensor = self.rank_tensor(dtype, shape)
+            summed = hvd.allreduce(tensor, average=False)
+            flat = hvd.allreduce(tensor, average=False, process_set=self.flat)
+            expected = self.pattern(dtype, shape, size * (size + 1) // 2)
+            assert torch.equal(summed, flat), \
+                'hierarchical allreduce differs from flat allreduce'
+            assert torch.equal(summed, expected), \
+                'hierarchical allreduce produces incorrect results'
+
+    def test_horovod_hierarchical_allreduce_fused(self):
+        """Test that hierarchical allreduce of a fused group of tensors
+        matches flat allreduce."""
+        shapes = [[3], [17, 5], [1], [4, 4, 4], [1000]]
+        for dtype in [torch.FloatTensor, torch.DoubleTensor]:
+            tensors = [self.rank_tensor(dtype, shape) for shape in shapes]
+            summed = hvd.grouped_allreduce(tensors, average=False)
+            flat = hvd.grouped_allreduce(tensors, average=False,
+                                         process_set=self.flat)
+            for result, expected in zip(summed, flat):
+                assert torch.equal(result, expected), \
+                    'fused hierarchical allreduce differs from flat allreduce'
+
+    def test_horovod_hierarchical_allreduce_prescale(self):
+        """Test that hierarchical allreduce of single tensors with prescale
+        and postscale factors, which are staged into the shared window from
+        the scaled output, matches flat allreduce. The largest tensor spans
+        several 16 MiB slots of the window."""
+        size = hvd.size()
+        shapes = [[17], [17, 17], [5 * 1024 * 1024]]
+        for dtype, shape in itertools.product(
+                [torch.FloatTensor, torch.DoubleTensor], shapes):
+            tensor = self.rank_tensor(dtype, shape)
+            summed = hvd.allreduce(tensor, op=hvd.Sum, prescale_factor=0.5,
+                                   postscale_factor=4.0)
+            flat = hvd.allreduce(tensor, op=hvd.Sum, prescale_factor=0.5,
+                                 postscale_factor=4.0, process_set=self.flat)
+            expected = self.pattern(dtype, shape, size * (size + 1))
+            assert torch.equal(summed, flat), \
+                'hierarchical allreduce with prescale differs from flat ' \
+                'allreduce'
+            assert torch.equal(summed, expected), \
+                'hierarchical allreduce with prescale produces incorrect ' \
+                'results'
+            # The input is left unscaled.
+            assert torch.equal(tensor, self.rank_tensor(dtype, shape))
+
+    def test_horovod_hierarchical_allreduce_prescale_fused(self):
+        """Test that hierarchical allreduce of a fused group of tensors with
+        prescale and postscale factors matches flat allreduce."""
+        size = hvd.size()
+        shapes = [[3], [17, 5], [1], [4, 4, 4], [1000]]
+        for dtype in [torch.FloatTensor, torch.DoubleTensor]:
+            tensors = [self.rank_tensor(dtype, shape) for shape in shapes]
+            summed = hvd.grouped_allreduce(tensors, op=hvd.Sum,
+                                           prescale_factor=0.5,
+                                           postscale_factor=4.0)
+            flat = hvd.grouped_allreduce(tensors, op=hvd.Sum,
+                                         prescale_factor=0.5,
+                                         postscale_factor=4.0,
+                                         process_set=self.flat)
+            for shape, result, flat_result in zip(shapes, summed, flat):
+                assert torch.equal(result, flat_result), \
+                    'fused hierarchical allreduce with prescale differs ' \
+                    'from flat allreduce'
+                assert torch.equal(
+                    result, self.pattern(dtype, shape, size * (size + 1))), \
+                    'fused hierarchical allreduce with prescale produces ' \
+                    'incorrect results'
+
+    def test_horovod_hierarchical_allgather(self):
+        """Test that hierarchical allgather of tensors with a different first
+        dimension on every rank matches flat allgather."""
+        rank = hvd.rank()
+        size = hvd.size()
+        dtypes = [torch.IntTensor, torch.FloatTensor, torch.DoubleTensor]
+        dims = [1, 2, 3]
+        for dtype, dim in itertools.product(dtypes, dims):
+            tensor = self.rank_tensor(dtype, [rank + 1] + [5] * (dim - 1))
+            gathered = hvd.allgather(tensor)
+            flat = hvd.allgather(tensor, process_set=self.flat)
+            assert list(gathered.shape) == \
+                [size * (size + 1) // 2] + [5] * (dim - 1)
+            assert torch.equal(gathered, flat), \
+                'hierarchical allgather differs from flat allgather'
+
+    def test_horovod_hierarchical_allgather_fused(self):
+        """Test that hierarchical allgather of several tensors in flight at
+        once, which are fused, matches flat allgather."""
+        rank = hvd.rank()
+        tensors = [self.rank_tensor(torch.FloatTensor, [rank + 1, i + 1])
+                   for i in range(5)]
+        handles = [hvd.allgather_async(tensor, name='hierarchical.%d' % i)
+                   for i, tensor in enumerate(tensors)]
+        gathered = [hvd.synchronize(handle) for handle in handles]
+        flat_handles = [hvd.allgather_async(tensor, name='flat.%d' % i,
+                                            process_set=self.flat)
+                        for i, tensor in enumerate(tensors)]
+        flat = [hvd.synchronize(handle) for handle in flat_handles]
+        for result, expected in zip(gathered, flat):
+            assert torch.equal(result, expected), \
+                'fused hierarchical allgather differs from flat allgather'
+
+    def test_horovod_hierarchical_allgather_growing(self):
+        """Test that hierarchical allgather matches flat allgather while the
+        gathered tensors grow, so that the shared buffer is reallocated
+        several times, and after they shrink again, so that it is reused."""
+        rank = hvd.rank()
+        size = hvd.size()
+        rows = [1, 4, 16, 64, 256, 1024, 3, 1000]
+        for step, num_rows in enumerate(rows):
+            tensor = self.rank_tensor(torch.FloatTensor,
+                                      [num_rows * (rank + 1), 1024])
+            gathered = hvd.allgather(tensor, name='growing.%d' % step)
+            flat = hvd.allgather(tensor, name='growing.flat.%d' % step,
+                                 process_set=self.flat)
+            assert list(gathered.shape) == \
+                [num_rows * size * (size + 1) // 2, 1024]
+            assert torch.equal(gathered, flat), \
+                'hierarchical allgather of growing tensors differs from ' \
+                'flat allgather'
+
+    def test_horovod_hierarchical_allgather_mixed(self):
+        """Test that fused hierarchical allgathers, where the first dimension
+        of every tensor differs from rank to rank and some ranks contribute no
+        rows at all, match flat allgather.
+
+        The ranks of a node only synchronize before the cross-node allgather
+        on heterogeneous clusters, so that path is only covered when the
+        tests run with a different number of ranks on some nodes."""
+        rank = hvd.rank()
+        for dtype in [torch.IntTensor, torch.DoubleTensor]:
+            tensors = [self.rank_tensor(dtype, [(3 * rank + i) % 4, i + 1])
+                       for i in range(6)]
+            handles = [hvd.allgather_async(
+                tensor, name='mixed.%s.%d' % (dtype.__name__, i))
+                for i, tensor in enumerate(tensors)]
+            gathered = [hvd.synchronize(handle) for handle in handles]
+            flat_handles = [hvd.allgather_async(
+                tensor, name='mixed.flat.%s.%d' % (dtype.__name__, i),
+                process_set=self.flat)
+                for i, tensor in enumerate(tensors)]
+            flat = [hvd.synchronize(handle) for handle in flat_handles]
+            for result, expected in zip(gathered, flat):
+                assert torch.equal(result, expected), \
+                    'fused hierarchical allgather of mixed sizes differs ' \
+                    'from flat allgather'
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,137 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import os
+import torch
+import unittest
+import warnings
+
+import horovod.torch as hvd
+from horovod.common.util import env
+
+
+class TorchMPIAsyncTests(unittest.TestCase):
+    """
+    Tests for asynchronous MPI collectives of CPU tensors in horovod.torch.
+
+    HOROVOD_MPI_ASYNC_OPS is read when Horovod is initialized, so these tests
+    run in a process of their own. A small fusion threshold and a long cycle
+    time split the tensors of every cycle into several fused responses, which
+    are in flight at once.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        with env(HOROVOD_MPI_ASYNC_OPS='4',
+                 HOROVOD_FUSION_THRESHOLD=str(64 * 1024),
+                 HOROVOD_CYCLE_TIME='20'):
+            hvd.init()
+
+    def __init__(self, *args, **kwargs):
+        super(TorchMPIAsyncTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def setUp(self):
+        if not hvd.mpi_enabled() or hvd.gloo_enabled() or \
+                'MLSL_ROOT' in os.environ:
+            self.skipTest('Asynchronous collectives are only run with MPI')
+        assert hvd.mpi_threads_supported(), \
+            'HOROVOD_MPI_ASYNC_OPS requires MPI_THREAD_MULTIPLE'
+
+    def test_horovod_mpi_async_fused_in_flight(self):
+        """Test that several fused allreduces in flight at once, of tensors
+        of different types, produce correct sums."""
+        rank = hvd.rank()
+        size = hvd.size()
+        dtypes = [torch.IntTensor, torch.LongTensor, torch.FloatTensor,
+                  torch.DoubleTensor]
+        for step in range(3):
+            tests = []
+            for i in range(40):
+                dtype = dtypes[i % len(dtypes)]
+                tensor = torch.FloatTensor(1000).fill_(rank + i).type(dtype)
+                handle = hvd.allreduce_async(tensor, op=hvd.Sum,
+                                             name='in_flight.%d' % i)
+                expected = size * i + size * (size - 1) // 2
+                tests.append((expected, handle))
+            for expected, handle in tests:
+                summed = hvd.synchronize(handle)
+                assert summed.eq(expected).all(), \
+                    'asynchronous hvd.allreduce produces incorrect results'
+
+    def test_horovod_mpi_async_reuse_after_synchronize(self):
+        """Test that a tensor can be changed and reduced again right after
+        synchronize returns, for single and fused in-place allreduces."""
+        rank = hvd.rank()
+        size = hvd.size()
+        for num_tensors in [1, 8]:
+            tensors = [torch.FloatTensor(1000) for _ in range(num_tensors)]
+            for step in range(10):
+                for i, tensor in enumerate(tensors):
+                    tensor.fill_(rank + step + i)
+                handles = [hvd.allreduce_async_(tensor, op=hvd.Sum,
+                                                name='reuse.%d.%d' %
+                                                (num_tensors, i))
+                           for i, tensor in enumerate(tensors)]
+                for i, handle in enumerate(handles):
+                    hvd.synchronize(handle)
+                    expected = size * (step + i) + size * (size - 1) // 2
+                    assert tensors[i].eq(expected).all(), \
+                        'asynchronous hvd.allreduce_ produces incorrect ' \
+                        'results after reuse'
+
+    def test_horovod_mpi_async_chained(self):
+        """Test that the output of an allreduce can be reduced again as soon
+        as it is returned."""
+        size = hvd.size()
+        tensor = torch.DoubleTensor(1000).fill_(1.0)
+        for step in range(8):
+            tensor = hvd.allreduce(tensor, op=hvd.Sum, name='chained')
+            assert tensor.eq(size ** (step + 1)).all(), \
+                'chained asynchronous hvd.allreduce produces incorrect results'
+
+    def test_horovod_mpi_async_allgather_broadcast(self):
+        """Test that asynchronous allgathers and broadcasts in flight at once
+        produce correct results, and that their tensors can be reused."""
+        rank = hvd.rank()
+        size = hvd.size()
+        tensor = torch.IntTensor(17)
+        for step in range(5):
+            tensor.fill_(rank + step)
+            gather_handles = [hvd.allgather_async(tensor,
+                                                  name='gather.%d' % i)
+                              for i in range(4)]
+            broadcasted = [torch.IntTensor(17).fill_(rank + i)
+                           for i in range(4)]
+            broadcast_handles = [hvd.broadcast_async_(t, i % size,
+                                                      name='bcast.%d' % i)
+                                 for i, t in enumerate(broadcasted)]
+            for handle in gather_handles:
+                gathered = hvd.synchronize(handle)
+                for r in range(size):
+                    assert gathered[r * 17:(r + 1) * 17].eq(r + step).all(), \
+                        'asynchronous hvd.allgather produces incorrect results'
+            for i, handle in enumerate(broadcast_handles):
+                hvd.synchronize(handle)
+                assert broadcasted[i].eq(i % size + i).all(), \
+                    'asynchronous hvd.broadcast_ produces incorrect results'
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,103 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import torch
+import unittest
+import warnings
+
+import horovod.torch as hvd
+from horovod.common.util import env
+
+
+class TorchPersistentCollectiveTests(unittest.TestCase):
+    """
+    Tests for collectives bound to the fusion buffer when a fused response
+    recurs, i.e. MPI-4 persistent allreduces and bound Gloo algorithms.
+
+    The cache of bound collectives holds as many fused responses as the
+    response cache, which is made small here so that rotating through more
+    layouts than it holds evicts and binds collectives again every step.
+    """
+
+    CACHE_CAPACITY = 2
+
+    @classmethod
+    def setUpClass(cls):
+        with env(HOROVOD_CACHE_CAPACITY=str(cls.CACHE_CAPACITY),
+                 HOROVOD_CYCLE_TIME='20'):
+            hvd.init()
+
+    def __init__(self, *args, **kwargs):
+        super(TorchPersistentCollectiveTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def fused_allreduce(self, name, layout, step):
+        """Allreduces tensors of the given types and sizes, which are fused
+        into one response, and checks the sums."""
+        rank = hvd.rank()
+        size = hvd.size()
+        handles = []
+        for i, (dtype, count) in enumerate(layout):
+            tensor = torch.FloatTensor(count).fill_(rank + step + i)
+            handles.append(hvd.allreduce_async(tensor.type(dtype), op=hvd.Sum,
+                                               name='%s.%d' % (name, i)))
+        for i, handle in enumerate(handles):
+            summed = hvd.synchronize(handle)
+            expected = size * (step + i) + size * (size - 1) // 2
+            assert summed.eq(expected).all(), \
+                'recurring fused hvd.allreduce produces incorrect results'
+
+    def test_horovod_persistent_allreduce_recurring(self):
+        """Test that a recurring fused response, once bound, reduces the
+        current contents of the fusion buffer every step."""
+        layout = [(torch.FloatTensor, 1000), (torch.IntTensor, 17),
+                  (torch.DoubleTensor, 1), (torch.FloatTensor, 65537)]
+        for step in range(10):
+            self.fused_allreduce('recurring', layout, step)
+
+    def test_horovod_persistent_allreduce_evicted(self):
+        """Test that fused responses evicted from the cache are bound again
+        consistently on all ranks."""
+        layouts = [[(torch.FloatTensor, 100 * (j + 1)),
+                    (torch.LongTensor, 10 * (j + 1))]
+                   for j in range(self.CACHE_CAPACITY + 1)]
+        for step in range(6):
+            for j, layout in enumerate(layouts):
+                self.fused_allreduce('evicted.%d' % j, layout, step)
+
+    def test_horovod_persistent_allreduce_reduce_ops(self):
+        """Test that the same layout reduced with different operations is
+        bound to a collective for every operation."""
+        rank = hvd.rank()
+        size = hvd.size()
+        for step in range(4):
+            summed = size * step + size * (size - 1) // 2
+            for op, expected in [(hvd.Sum, summed), (hvd.Min, step),
+                                 (hvd.Max, step + size - 1)]:
+                handles = [hvd.allreduce_async(
+                    torch.FloatTensor(100).fill_(rank + step), op=op,
+                    name='reduce_ops.%d' % i) for i in range(3)]
+                for handle in handles:
+                    assert hvd.synchronize(handle).eq(expected).all(), \
+                        'recurring fused hvd.allreduce produces incorrect ' \
+                        'results'
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,100 @@
+# Copyright 2019 Uber Technologies, Inc. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import torch
+import unittest
+import warnings
+
+import horovod.torch as hvd
+
+from common import size_before_init
+
+
+class TorchProcessSetTests(unittest.TestCase):
+    """
+    Tests for process sets in horovod.torch.
+
+    Process sets are registered before Horovod is initialized, which can only
+    happen once per process with MPI, so these tests run in a process of their
+    own rather than in test_torch.py.
+    """
+
+    def __init__(self, *args, **kwargs):
+        super(TorchProcessSetTests, self).__init__(*args, **kwargs)
+        warnings.simplefilter('module')
+
+    def test_horovod_process_set_collectives(self):
+        """Test that allreduce, allgather and broadcast on a process set only
+        involve its members, with ranks relative to the process set."""
+        even_ranks = list(range(0, size_before_init(), 2))
+        process_set = hvd.add_process_set(even_ranks)
+        hvd.init()
+        size = hvd.size()
+        rank = hvd.rank()
+
+        assert hvd.process_set_size(process_set) == len(even_ranks)
+        if rank % 2 == 0:
+            set_rank = hvd.process_set_rank(process_set)
+            set_size = len(even_ranks)
+            assert set_rank == rank // 2
+
+            summed = hvd.allreduce(torch.FloatTensor([rank]), average=False,
+                                   process_set=process_set)
+            assert summed.item() == sum(even_ranks), \
+                'hvd.allreduce on a process set produces incorrect results'
+            averaged = hvd.allreduce(torch.FloatTensor([rank]), average=True,
+                                     process_set=process_set)
+            assert averaged.item() == float(sum(even_ranks)) / set_size, \
+                'hvd.allreduce on a process set produces incorrect average'
+
+            # Fused responses use the fusion buffer of the process set.
+            handles = [hvd.allreduce_async(torch.FloatTensor([rank, i]),
+                                           average=False,
+                                           name='process_set.%d' % i,
+                                           process_set=process_set)
+                       for i in range(4)]
+            for i, handle in enumerate(handles):
+                summed = hvd.synchronize(handle)
+                assert summed.tolist() == [sum(even_ranks), i * set_size], \
+                    'fused hvd.allreduce on a process set produces ' \
+                    'incorrect results'
+
+            gathered = hvd.allgather(torch.IntTensor([rank]),
+                                     process_set=process_set)
+            assert gathered.tolist() == even_ranks, \
+                'hvd.allgather on a process set produces incorrect results'
+
+            root_rank = set_size - 1
+            broadcasted = hvd.broadcast(torch.IntTensor([rank]), root_rank,
+                                        process_set=process_set)
+            assert broadcasted.item() == even_ranks[root_rank], \
+                'hvd.broadcast on a process set produces incorrect results'
+
+        # Collectives of the other ranks go on concurrently.
+        summed = hvd.allreduce(torch.FloatTensor([1.0]), average=False)
+        assert summed.item() == size
+
+        # Process sets are removed on shutdown, and have to be registered
+        # again before Horovod is initialized again.
+        hvd.shutdown()
+        assert hvd.add_process_set(even_ranks) == process_set
+
+
+if __name__ == "__main__":
+    unittest.main()